@@ -0,0 +1,234 @@
+#include "RideBuddyAnim.h"
+
+// --- Curve Definitions (compile time only) ---
+// Plain C++11 constexpr: single-expression functions, recursion instead of
+// loops. sin() and exp() are short Taylor series, accurate far beyond the
+// 1/16384 resolution the tables are stored at.
+
+#define ANIM_PI 3.14159265358979323846
+
+static constexpr double animFloor(double x) {
+  return (double)(long)x > x ? (double)(long)x - 1 : (double)(long)x;
+}
+
+// x - x^3/3! + x^5/5! - ..., for x in [-pi, pi]
+static constexpr double animSinTaylor(double x2, double term, int n) {
+  return n > 31 ? 0 : term - animSinTaylor(x2, term * x2 / ((n + 1) * (n + 2)), n + 2);
+}
+
+static constexpr double animSinWrapped(double x) { return animSinTaylor(x * x, x, 1); }
+
+static constexpr double animSin(double x) {
+  return animSinWrapped(x - 2 * ANIM_PI * animFloor((x + ANIM_PI) / (2 * ANIM_PI)));
+}
+
+static constexpr double animExpSeries(double x, double term, int n) {
+  return n > 40 ? term : term + animExpSeries(x, term * x / n, n + 1);
+}
+
+static constexpr double animExp(double x) { return animExpSeries(x, 1, 1); }
+
+static constexpr double animCubicInOut(double t) {
+  return t < 0.5 ? 4 * t * t * t : 1 - (2 - 2 * t) * (2 - 2 * t) * (2 - 2 * t) / 2;
+}
+
+static constexpr double animBackOut(double u) { // u = t - 1
+  return 1 + 2.70158 * u * u * u + 1.70158 * u * u;
+}
+
+static constexpr double animElasticOut(double t) {
+  return t <= 0 ? 0 : t >= 1 ? 1 : animExp(-10 * t * 0.69314718055994530942) * animSin((10 * t - 0.75) * (2 * ANIM_PI / 3)) + 1;
+}
+
+static constexpr double animBounceOut(double t) {
+  return t < 1 / 2.75 ? 7.5625 * t * t
+       : t < 2 / 2.75 ? 7.5625 * (t - 1.5 / 2.75) * (t - 1.5 / 2.75) + 0.75
+       : t < 2.5 / 2.75 ? 7.5625 * (t - 2.25 / 2.75) * (t - 2.25 / 2.75) + 0.9375
+       : 7.5625 * (t - 2.625 / 2.75) * (t - 2.625 / 2.75) + 0.984375;
+}
+
+static constexpr double animCurveValue(int curve, double t) {
+  return curve == ANIM_CURVE_CUBIC_IN ? t * t * t
+       : curve == ANIM_CURVE_CUBIC_OUT ? 1 + (t - 1) * (t - 1) * (t - 1)
+       : curve == ANIM_CURVE_CUBIC_IN_OUT ? animCubicInOut(t)
+       : curve == ANIM_CURVE_BACK_OUT ? animBackOut(t - 1)
+       : curve == ANIM_CURVE_ELASTIC_OUT ? animElasticOut(t)
+       : curve == ANIM_CURVE_BOUNCE_OUT ? animBounceOut(t)
+       : curve == ANIM_CURVE_STEPS ? animFloor(t * 4) / 4
+       : t; // ANIM_CURVE_LINEAR
+}
+
+// Samples are Q2.14: back and elastic overshoot past 1.0
+static constexpr int16_t animCurveSample(int curve, int i) {
+  return (int16_t)animFloor(animCurveValue(curve, (double)i / ANIM_CURVE_SEGMENTS) * 16384 + 0.5);
+}
+
+template <int... Is> struct AnimIndices {};
+template <int N, int... Is> struct AnimMakeIndices : AnimMakeIndices<N - 1, N - 1, Is...> {};
+template <int... Is> struct AnimMakeIndices<0, Is...> { typedef AnimIndices<Is...> type; };
+
+struct AnimCurveTable {
+  int16_t samples[ANIM_CURVE_SEGMENTS + 1];
+};
+
+template <int... Is>
+static constexpr AnimCurveTable animBuildTable(int curve, AnimIndices<Is...>) {
+  return {{ animCurveSample(curve, Is)... }};
+}
+
+#define ANIM_TABLE(curve) animBuildTable(curve, AnimMakeIndices<ANIM_CURVE_SEGMENTS + 1>::type())
+
+static constexpr AnimCurveTable animCurveTables[ANIM_CURVE_COUNT] = {
+  ANIM_TABLE(ANIM_CURVE_LINEAR),
+  ANIM_TABLE(ANIM_CURVE_CUBIC_IN),
+  ANIM_TABLE(ANIM_CURVE_CUBIC_OUT),
+  ANIM_TABLE(ANIM_CURVE_CUBIC_IN_OUT),
+  ANIM_TABLE(ANIM_CURVE_BACK_OUT),
+  ANIM_TABLE(ANIM_CURVE_ELASTIC_OUT),
+  ANIM_TABLE(ANIM_CURVE_BOUNCE_OUT),
+  ANIM_TABLE(ANIM_CURVE_STEPS),
+};
+
+static_assert(animCurveTables[ANIM_CURVE_CUBIC_IN_OUT].samples[ANIM_CURVE_SEGMENTS / 2] == 8192, "cubic midpoint");
+static_assert(animCurveTables[ANIM_CURVE_ELASTIC_OUT].samples[ANIM_CURVE_SEGMENTS] == 16384, "elastic end");
+
+// --- Evaluation ---
+#if RIDEBUDDY_FIXED_POINT
+
+#define ANIM_SEGMENT_BITS 10 // 16 progress bits = 6 bits of segment index + 10 bits of fraction
+
+anim_progress_t animEase(AnimCurve curve, anim_progress_t t) {
+  const int16_t* table = animCurveTables[curve < ANIM_CURVE_COUNT ? curve : ANIM_CURVE_LINEAR].samples;
+  if (t <= 0) return (anim_progress_t)table[0] * 4;
+  if (t >= ANIM_PROGRESS_ONE) return (anim_progress_t)table[ANIM_CURVE_SEGMENTS] * 4;
+  int32_t index = t >> ANIM_SEGMENT_BITS;
+  int32_t frac = t & ((1 << ANIM_SEGMENT_BITS) - 1);
+  int32_t a = table[index];
+  int32_t b = table[index + 1];
+  return a * 4 + (((b - a) * frac) >> (ANIM_SEGMENT_BITS - 2)); // Q2.14 -> Q15.16
+}
+
+#else
+
+anim_progress_t animEase(AnimCurve curve, anim_progress_t t) {
+  const int16_t* table = animCurveTables[curve < ANIM_CURVE_COUNT ? curve : ANIM_CURVE_LINEAR].samples;
+  if (t <= 0) return table[0] * (1.0f / 16384);
+  if (t >= 1.0f) return table[ANIM_CURVE_SEGMENTS] * (1.0f / 16384);
+  float position = t * ANIM_CURVE_SEGMENTS;
+  int index = (int)position;
+  float a = table[index];
+  float b = table[index + 1];
+  return (a + (b - a) * (position - index)) * (1.0f / 16384);
+}
+
+#endif
+
+// --- Tween Pool ---
+// These inline into start(), which runs for every property of every motion
+inline uint8_t TweenPool::find(const eye_coord_t* value) const {
+  uint8_t i = 0;
+  while (i < _count && _tweens[i].value != value) i++;
+  return i;
+}
+
+inline void TweenPool::remove(uint8_t i) {
+  for (uint8_t j = i + 1; j < _count; j++) _tweens[j - 1] = _tweens[j];
+  if (--_count > i) _tweens[i].chained = false; // Its new neighbour may be another group
+}
+
+inline void TweenPool::append(eye_coord_t* value, eye_coord_t to, uint16_t duration, AnimCurve curve, unsigned long now) {
+  if (*value == to) return; // Already there: costs nothing per frame
+  if (duration == 0 || _count == TWEEN_POOL_SIZE) {
+    *value = to;
+    return;
+  }
+  const Tween* previous = _count ? &_tweens[_count - 1] : nullptr;
+  Tween& tween = _tweens[_count++];
+  tween.value = value;
+  tween.startTime = now;
+  tween.duration = duration;
+  tween.curve = curve;
+  tween.chained = previous && previous->startTime == now && previous->duration == duration && previous->curve == curve;
+  tween.from = *value;
+  tween.to = to;
+}
+
+void TweenPool::start(eye_coord_t* value, eye_coord_t to, uint16_t duration, AnimCurve curve, unsigned long now) {
+  uint8_t existing = find(value);
+  if (existing < _count) remove(existing);
+  append(value, to, duration, curve, now);
+}
+
+void TweenPool::start(eye_coord_t* values, const eye_coord_t* targets, uint8_t count, uint16_t duration, AnimCurve curve,
+                      unsigned long now) {
+  uint8_t kept = 0;
+  bool dropped = false;
+  for (uint8_t i = 0; i < _count; i++) {
+    const Tween& tween = _tweens[i];
+    if (tween.value >= values && tween.value < values + count) {
+      dropped = true;
+      continue;
+    }
+    if (kept != i) _tweens[kept] = tween;
+    if (dropped) _tweens[kept].chained = false; // The tween it was chained to is gone
+    dropped = false;
+    kept++;
+  }
+
+  // append() inlined, with the chain test done once for the whole run
+  const Tween* previous = kept ? &_tweens[kept - 1] : nullptr;
+  bool chained = previous && previous->startTime == now && previous->duration == duration && previous->curve == curve;
+  for (uint8_t i = 0; i < count; i++) {
+    eye_coord_t from = values[i], to = targets[i];
+    if (from == to) continue;
+    if (duration == 0 || kept == TWEEN_POOL_SIZE) {
+      values[i] = to;
+      continue;
+    }
+    _tweens[kept++] = {&values[i], now, duration, curve, chained, from, to};
+    chained = true;
+  }
+  _count = kept;
+}
+
+void TweenPool::stop(eye_coord_t* value) {
+  uint8_t i = find(value);
+  if (i < _count) remove(i);
+}
+
+// Tweens started together (one startAnimation() call) sit next to each
+// other and are chained, so progress and easing run once per group rather
+// than once per value. A group finishes as a whole, which keeps the chains
+// intact when finished tweens are compacted away. Most frames finish
+// nothing, and those skip the compaction pass; when every group finishes
+// the pool simply empties.
+void TweenPool::update(unsigned long now) {
+  anim_progress_t eased = 0;
+  uint8_t count = _count, finished = 0, groups = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    const Tween& tween = _tweens[i];
+    if (!tween.chained) {
+      anim_progress_t progress = animProgress(now - tween.startTime, tween.duration);
+      eased = animEase(tween.curve, progress);
+      groups++;
+      if (progress >= ANIM_PROGRESS_ONE) finished++;
+    }
+    *tween.value = animLerp(tween.from, tween.to, eased);
+  }
+  if (finished == 0) return;
+  if (finished == groups) {
+    _count = 0;
+    return;
+  }
+
+  bool done = false;
+  uint8_t kept = 0;
+  for (uint8_t i = 0; i < _count; i++) {
+    const Tween& tween = _tweens[i];
+    if (!tween.chained) done = now - tween.startTime >= tween.duration;
+    if (done) continue;
+    if (kept != i) _tweens[kept] = tween;
+    kept++;
+  }
+  _count = kept;
+}
@@ -0,0 +1,136 @@
+/*
+  RideBuddyAnim.h - Number format and tween maths for the eye animation core.
+  Released into the public domain.
+
+  By default EyeState holds floats, as it always has. Build with
+  RIDEBUDDY_FIXED_POINT=1 (e.g. -DRIDEBUDDY_FIXED_POINT=1 in the build flags)
+  to keep it in Q8.8 fixed point instead: tween progress becomes a Q0.16
+  integer and easing and interpolation use integer multiplies and shifts
+  only. No float or pow() is involved, so the host build and the ESP32
+  produce bit-identical animation states.
+
+  Easing curves are lookup tables generated at compile time (constexpr, see
+  RideBuddyAnim.cpp); evaluating one is a table lookup plus one linear
+  interpolation, whatever the curve.
+
+  Drawing code reads eye coordinates through EYE_COORD_TO_FLOAT(), which is
+  exact for Q8.8 values, so both formats rasterise the same way.
+
+  Running animations live in a TweenPool: one tween per animated value
+  (e.g. the left eye's width), each with its own start, duration and curve,
+  in a fixed array with no heap use.
+*/
+#ifndef RideBuddyAnim_h
+#define RideBuddyAnim_h
+
+#include <stdint.h>
+
+#ifndef RIDEBUDDY_FIXED_POINT
+#define RIDEBUDDY_FIXED_POINT 0
+#endif
+
+#define ANIM_CURVE_SEGMENTS 64 // Table resolution; each curve stores SEGMENTS + 1 samples
+
+// --- Easing Curves ---
+enum AnimCurve : uint8_t {
+  ANIM_CURVE_LINEAR,
+  ANIM_CURVE_CUBIC_IN,
+  ANIM_CURVE_CUBIC_OUT,
+  ANIM_CURVE_CUBIC_IN_OUT, // The default for every tween
+  ANIM_CURVE_BACK_OUT,     // Overshoots by ~10% and settles
+  ANIM_CURVE_ELASTIC_OUT,  // Springs around the target
+  ANIM_CURVE_BOUNCE_OUT,   // Lands with three bounces
+  ANIM_CURVE_STEPS,        // Four hard steps, for snappy blinks
+  ANIM_CURVE_COUNT
+};
+
+#if RIDEBUDDY_FIXED_POINT
+
+// --- Q8.8 Fixed Point ---
+typedef int16_t eye_coord_t;      // Q8.8, -128.0 .. 127.996 px
+typedef int32_t anim_progress_t;  // Q15.16; eased values may overshoot 0 .. ANIM_PROGRESS_ONE
+
+#define EYE_COORD_FRAC_BITS 8
+#define EYE_COORD(v) ((eye_coord_t)((v) * (1 << EYE_COORD_FRAC_BITS)))
+#define EYE_COORD_TO_FLOAT(c) ((float)(c) * (1.0f / (1 << EYE_COORD_FRAC_BITS)))
+#define ANIM_PROGRESS_ONE ((anim_progress_t)1 << 16)
+
+// Fraction of a tween that has elapsed, clamped to ANIM_PROGRESS_ONE
+inline anim_progress_t animProgress(unsigned long elapsed, uint16_t duration) {
+  if (elapsed >= duration) return ANIM_PROGRESS_ONE;
+  return (anim_progress_t)(((uint32_t)elapsed << 16) / duration); // elapsed < 2^16, no overflow
+}
+
+// EyeState values stay within +-64 px and eased progress below 1.5, so the
+// product fits in 32 bits. The right shift of a negative product is
+// arithmetic on every GCC target.
+inline eye_coord_t animLerp(eye_coord_t from, eye_coord_t to, anim_progress_t t) {
+  int32_t delta = (int32_t)to - from;
+  return (eye_coord_t)(from + ((delta * (int32_t)t) >> 16));
+}
+
+#else
+
+// --- Float ---
+typedef float eye_coord_t;
+typedef float anim_progress_t;
+
+#define EYE_COORD(v) ((eye_coord_t)(v))
+#define EYE_COORD_TO_FLOAT(c) ((float)(c))
+#define ANIM_PROGRESS_ONE 1.0f
+
+inline anim_progress_t animProgress(unsigned long elapsed, uint16_t duration) {
+  float progress = (float)elapsed / duration;
+  return progress >= 1.0f ? 1.0f : progress;
+}
+
+inline eye_coord_t animLerp(eye_coord_t from, eye_coord_t to, anim_progress_t t) {
+  return from + (to - from) * t;
+}
+
+#endif
+
+// Eased progress for t in 0 .. ANIM_PROGRESS_ONE
+anim_progress_t animEase(AnimCurve curve, anim_progress_t t);
+
+// --- Tween Pool ---
+#ifndef TWEEN_POOL_SIZE
+#define TWEEN_POOL_SIZE 20 // Eight properties (shape and lids) of both eyes, plus headroom
+#endif
+
+class TweenPool {
+  public:
+    TweenPool() : _count(0) {}
+    // Tweens *value to `to`, replacing any tween already driving it; the new
+    // one starts from wherever that one got to. A value already at `to`
+    // takes no slot. A zero duration, or a full pool, sets the value
+    // straight away.
+    void start(eye_coord_t* value, eye_coord_t to, uint16_t duration, AnimCurve curve, unsigned long now);
+    // Same for `count` adjacent values (e.g. the fields of an EyeState), as
+    // one chained group; replaced tweens are dropped in a single pass
+    void start(eye_coord_t* values, const eye_coord_t* targets, uint8_t count, uint16_t duration, AnimCurve curve,
+               unsigned long now);
+    void stop(eye_coord_t* value); // Leaves the value where it is
+    void clear() { _count = 0; }
+    void update(unsigned long now); // Advances every tween, recycles finished ones
+    uint8_t active() const { return _count; }
+
+  private:
+    struct Tween {
+      eye_coord_t* value;
+      unsigned long startTime;
+      uint16_t duration;
+      AnimCurve curve;
+      bool chained;        // Same start, duration and curve as the tween before it
+      eye_coord_t from;
+      eye_coord_t to;
+    };
+    Tween _tweens[TWEEN_POOL_SIZE]; // Running tweens first, in start order
+    uint8_t _count;
+
+    uint8_t find(const eye_coord_t* value) const; // Index of the tween driving value, or _count
+    void remove(uint8_t i);
+    void append(eye_coord_t* value, eye_coord_t to, uint16_t duration, AnimCurve curve, unsigned long now);
+};
+
+#endif
@@ -0,0 +1,376 @@
+#include "RideBuddyClip.h"
+#include <stdlib.h>
+
+// --- Clip Header Access ---
+bool clipIsValid(const uint8_t* clip) {
+  return clip && pgm_read_byte(&clip[0]) == 'R' && pgm_read_byte(&clip[1]) == 'C' &&
+         pgm_read_byte(&clip[2]) == CLIP_FORMAT_VERSION && pgm_read_byte(&clip[3]) > 0;
+}
+
+uint8_t clipFrameCount(const uint8_t* clip) { return pgm_read_byte(&clip[3]); }
+uint8_t clipTileCols(const uint8_t* clip) { return pgm_read_byte(&clip[5]); }
+uint8_t clipTileRows(const uint8_t* clip) { return pgm_read_byte(&clip[6]); }
+
+uint32_t clipFrameOffset(const uint8_t* clip, uint8_t frame) {
+  const uint8_t* entry = clip + CLIP_HEADER_SIZE + frame * 4;
+  return (uint32_t)pgm_read_byte(&entry[0]) |
+         ((uint32_t)pgm_read_byte(&entry[1]) << 8) |
+         ((uint32_t)pgm_read_byte(&entry[2]) << 16) |
+         ((uint32_t)pgm_read_byte(&entry[3]) << 24);
+}
+
+ClipFrameType clipFrameType(const uint8_t* clip, uint8_t frame) {
+  return (ClipFrameType)pgm_read_byte(&clip[clipFrameOffset(clip, frame)]);
+}
+
+uint32_t clipFrameEnd(const uint8_t* clip, uint8_t frame) {
+  if (frame + 1 < clipFrameCount(clip)) return clipFrameOffset(clip, frame + 1);
+  const uint16_t size = clipTileCols(clip) * clipTileRows(clip) * CLIP_TILE_BYTES;
+  const uint8_t* start = clip + clipFrameOffset(clip, frame);
+  const uint8_t* data = start;
+  const uint8_t type = pgm_read_byte(data++);
+  if (type == CLIP_FRAME_KEY) return clipFrameOffset(clip, frame) + 1 + size;
+  if (type == CLIP_FRAME_DELTA) return clipFrameOffset(clip, frame) + 2 + pgm_read_byte(data) * (1 + CLIP_TILE_BYTES);
+  uint16_t pos = 0;
+  while (pos < size) {
+    uint8_t control = pgm_read_byte(data++);
+    if (control < 0x80) {
+      pos += control + 1;
+      data += control + 1;
+    } else {
+      pos += (control & 0x7F) + CLIP_RLE_MIN_REPEAT;
+      data++;
+    }
+  }
+  return clipFrameOffset(clip, frame) + (uint32_t)(data - start);
+}
+
+// Sizes are compared as "need > end - at", which cannot wrap with at < end
+bool clipFramesValid(const uint8_t* clip, uint32_t size) {
+  if (size < CLIP_HEADER_SIZE || !clipIsValid(clip)) return false;
+  const uint8_t frames = clipFrameCount(clip);
+  const uint16_t tiles = clipTileCols(clip) * clipTileRows(clip);
+  const uint32_t frameBytes = (uint32_t)tiles * CLIP_TILE_BYTES;
+  const uint32_t tableEnd = CLIP_HEADER_SIZE + frames * 4u;
+  if (tiles == 0 || tableEnd > size || clipFrameOffset(clip, 0) < tableEnd) return false;
+
+  for (uint8_t f = 0; f < frames; f++) {
+    uint32_t at = clipFrameOffset(clip, f);
+    uint32_t end = f + 1 < frames ? clipFrameOffset(clip, f + 1) : size;
+    if (at >= end || end > size) return false;
+    uint8_t type = pgm_read_byte(&clip[at++]);
+
+    if (type == CLIP_FRAME_KEY) {
+      if (frameBytes > end - at) return false;
+    } else if (type == CLIP_FRAME_DELTA) {
+      if (at == end) return false;
+      uint8_t tileCount = pgm_read_byte(&clip[at++]);
+      if ((uint32_t)tileCount * (1 + CLIP_TILE_BYTES) > end - at) return false;
+      for (uint8_t t = 0; t < tileCount; t++, at += 1 + CLIP_TILE_BYTES) {
+        if (pgm_read_byte(&clip[at]) >= tiles) return false;
+      }
+    } else if (type == CLIP_FRAME_KEY_RLE || type == CLIP_FRAME_DELTA_RLE) {
+      uint32_t out = 0;
+      while (out < frameBytes) {
+        if (at == end) return false;
+        uint8_t control = pgm_read_byte(&clip[at++]);
+        uint32_t read = control < 0x80 ? control + 1u : 1u;
+        if (read > end - at) return false;
+        at += read;
+        out += control < 0x80 ? control + 1u : (control & 0x7F) + CLIP_RLE_MIN_REPEAT;
+      }
+      if (out != frameBytes) return false;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+// --- Decoding ---
+
+// Writes (or XORs) one decoded byte and marks its tile if it changed
+static inline void clipPutByte(uint8_t* buffer, uint16_t pos, uint8_t value, bool xorMode, uint16_t rowBytes, uint16_t* dirtyTiles) {
+  uint8_t old = buffer[pos];
+  uint8_t now = xorMode ? old ^ value : value;
+  if (now != old) {
+    buffer[pos] = now;
+    dirtyTiles[pos / rowBytes] |= (uint16_t)1 << ((pos % rowBytes) / CLIP_TILE_BYTES);
+  }
+}
+
+// Streams an RLE frame body into the buffer, run by run
+static void clipApplyRle(const uint8_t* data, uint8_t* buffer, uint16_t size, uint16_t rowBytes, bool xorMode, uint16_t* dirtyTiles) {
+  uint16_t pos = 0;
+  while (pos < size) {
+    uint8_t control = pgm_read_byte(data++);
+    if (control < 0x80) {
+      uint16_t n = control + 1;
+      while (n-- && pos < size) clipPutByte(buffer, pos++, pgm_read_byte(data++), xorMode, rowBytes, dirtyTiles);
+    } else {
+      uint16_t n = (control & 0x7F) + CLIP_RLE_MIN_REPEAT;
+      uint8_t value = pgm_read_byte(data++);
+      if (xorMode && value == 0) { pos += n; continue; } // Unchanged span
+      while (n-- && pos < size) clipPutByte(buffer, pos++, value, xorMode, rowBytes, dirtyTiles);
+    }
+  }
+}
+
+void clipApplyFrame(const uint8_t* clip, uint8_t frame, uint8_t* buffer, uint16_t* dirtyTiles) {
+  const uint8_t cols = clipTileCols(clip);
+  const uint8_t rows = clipTileRows(clip);
+  const uint8_t* data = clip + clipFrameOffset(clip, frame);
+  const uint8_t type = pgm_read_byte(data++);
+
+  if (type == CLIP_FRAME_KEY_RLE || type == CLIP_FRAME_DELTA_RLE) {
+    uint16_t rowBytes = cols * CLIP_TILE_BYTES;
+    clipApplyRle(data, buffer, rowBytes * rows, rowBytes, type == CLIP_FRAME_DELTA_RLE, dirtyTiles);
+    return;
+  }
+
+  if (type == CLIP_FRAME_KEY) {
+    // Copy tile by tile so unchanged tiles are not reported as dirty
+    for (uint8_t ty = 0; ty < rows; ty++) {
+      for (uint8_t tx = 0; tx < cols; tx++) {
+        uint8_t* dst = buffer + (ty * cols + tx) * CLIP_TILE_BYTES;
+        uint8_t diff = 0;
+        for (uint8_t i = 0; i < CLIP_TILE_BYTES; i++) {
+          uint8_t b = pgm_read_byte(data++);
+          diff |= dst[i] ^ b;
+          dst[i] = b;
+        }
+        if (diff) dirtyTiles[ty] |= (uint16_t)1 << tx;
+      }
+    }
+    return;
+  }
+
+  uint8_t tileCount = pgm_read_byte(data++);
+  while (tileCount--) {
+    uint8_t index = pgm_read_byte(data++);
+    uint8_t ty = index / cols;
+    uint8_t tx = index % cols;
+    uint8_t* dst = buffer + (ty * cols + tx) * CLIP_TILE_BYTES;
+    for (uint8_t i = 0; i < CLIP_TILE_BYTES; i++) {
+      dst[i] ^= pgm_read_byte(data++);
+    }
+    dirtyTiles[ty] |= (uint16_t)1 << tx;
+  }
+}
+
+int clipSeek(const uint8_t* clip, int currentFrame, uint8_t targetFrame, uint8_t* buffer, uint16_t* dirtyTiles) {
+  if (currentFrame == targetFrame) return targetFrame;
+
+  uint8_t keyFrame = targetFrame;
+  while (keyFrame > 0 && clipFrameType(clip, keyFrame) != CLIP_FRAME_KEY && clipFrameType(clip, keyFrame) != CLIP_FRAME_KEY_RLE) keyFrame--;
+
+  // Keep stepping through deltas if the buffer already sits past the keyframe
+  uint8_t frame = (currentFrame >= keyFrame && currentFrame < targetFrame) ? currentFrame + 1 : keyFrame;
+  for (; frame <= targetFrame; frame++) {
+    clipApplyFrame(clip, frame, buffer, dirtyTiles);
+  }
+  return targetFrame;
+}
+
+// Places one decoded page byte at a pixel offset. A byte covers 8 rows, so
+// a vertical shift spreads it over two pages; only pages inside the band
+// [firstPage, firstPage + pageCount) are written.
+static inline void clipOrShifted(uint8_t* band, uint8_t cols, uint8_t firstPage, uint8_t pageCount, uint16_t pos, uint8_t value, int8_t dx, int8_t dy) {
+  if (!value) return;
+  const uint16_t rowBytes = cols * CLIP_TILE_BYTES;
+  int x = (int)(pos % rowBytes) + dx;
+  if (x < 0 || x >= rowBytes) return;
+  int y = (int)(pos / rowBytes) * 8 + dy; // Top pixel row of this byte
+  int page = (y >> 3) - firstPage;        // Arithmetic shift: floors for negative y
+  uint8_t shift = y & 7;
+  if (page >= 0 && page < pageCount) band[page * rowBytes + x] |= value << shift;
+  if (shift && page + 1 >= 0 && page + 1 < pageCount) band[(page + 1) * rowBytes + x] |= value >> (8 - shift);
+}
+
+void clipDrawKeyFrame(const uint8_t* clip, uint8_t frame, int8_t dx, int8_t dy, uint8_t* buffer) {
+  clipDrawKeyFrameBand(clip, frame, dx, dy, 0, clipTileRows(clip), buffer);
+}
+
+void clipDrawKeyFrameBand(const uint8_t* clip, uint8_t frame, int8_t dx, int8_t dy, uint8_t firstPage, uint8_t pageCount, uint8_t* band) {
+  const uint8_t cols = clipTileCols(clip);
+  const uint16_t rowBytes = cols * CLIP_TILE_BYTES;
+  // Source pages that land below the band are not read at all
+  int endPage = (int)firstPage + pageCount - (dy >> 3);
+  if (endPage > clipTileRows(clip)) endPage = clipTileRows(clip);
+  const uint16_t size = endPage > 0 ? endPage * rowBytes : 0;
+  const uint8_t* data = clip + clipFrameOffset(clip, frame);
+  const uint8_t type = pgm_read_byte(data++);
+
+  if (type == CLIP_FRAME_KEY) {
+    for (uint16_t pos = 0; pos < size; pos++) clipOrShifted(band, cols, firstPage, pageCount, pos, pgm_read_byte(data++), dx, dy);
+    return;
+  }
+  if (type != CLIP_FRAME_KEY_RLE) return; // Deltas cannot be drawn on their own
+
+  uint16_t pos = 0;
+  while (pos < size) {
+    uint8_t control = pgm_read_byte(data++);
+    if (control < 0x80) {
+      uint16_t n = control + 1;
+      while (n-- && pos < size) clipOrShifted(band, cols, firstPage, pageCount, pos++, pgm_read_byte(data++), dx, dy);
+    } else {
+      uint16_t n = (control & 0x7F) + CLIP_RLE_MIN_REPEAT;
+      uint8_t value = pgm_read_byte(data++);
+      if (value == 0) { pos += n; continue; }
+      while (n-- && pos < size) clipOrShifted(band, cols, firstPage, pageCount, pos++, value, dx, dy);
+    }
+  }
+}
+
+// --- Band Decoding ---
+static void clipCursorStart(ClipStreamCursor& cursor, const uint8_t* clip, uint8_t frame) {
+  const uint8_t* data = clip + clipFrameOffset(clip, frame);
+  cursor.type = pgm_read_byte(data++);
+  cursor.pos = 0;
+  cursor.left = cursor.type == CLIP_FRAME_DELTA ? pgm_read_byte(data++) : 0;
+  cursor.value = 0;
+  cursor.literal = false;
+  cursor.data = data;
+}
+
+// Applies the part of one frame that falls into the band of frame bytes
+// [start, end) and leaves the cursor at `end`. Bands must come in order.
+static void clipCursorApply(ClipStreamCursor& cursor, uint8_t cols, uint16_t start, uint16_t end, uint8_t* band) {
+  const uint16_t rowBytes = cols * CLIP_TILE_BYTES;
+
+  if (cursor.type == CLIP_FRAME_KEY) { // Raw frame: random access, no cursor state needed
+    for (uint16_t pos = start; pos < end; pos++) band[pos - start] = pgm_read_byte(&cursor.data[pos]);
+    return;
+  }
+
+  if (cursor.type == CLIP_FRAME_DELTA) { // Tiles are stored in index order
+    for (; cursor.left; cursor.left--, cursor.data += 1 + CLIP_TILE_BYTES) {
+      uint8_t index = pgm_read_byte(cursor.data);
+      uint16_t pos = (index / cols) * rowBytes + (index % cols) * CLIP_TILE_BYTES;
+      if (pos >= end) break;
+      if (pos < start) continue;
+      for (uint8_t i = 0; i < CLIP_TILE_BYTES; i++) band[pos - start + i] ^= pgm_read_byte(&cursor.data[1 + i]);
+    }
+    return;
+  }
+
+  const bool xorMode = cursor.type == CLIP_FRAME_DELTA_RLE;
+  while (cursor.pos < end) {
+    if (!cursor.left) {
+      uint8_t control = pgm_read_byte(cursor.data++);
+      cursor.literal = control < 0x80;
+      if (cursor.literal) {
+        cursor.left = control + 1;
+      } else {
+        cursor.left = (control & 0x7F) + CLIP_RLE_MIN_REPEAT;
+        cursor.value = pgm_read_byte(cursor.data++);
+      }
+    }
+    uint16_t n = cursor.left;
+    if (cursor.pos < start) { // Above the band: skip
+      if (n > start - cursor.pos) n = start - cursor.pos;
+      if (cursor.literal) cursor.data += n;
+    } else {
+      if (n > end - cursor.pos) n = end - cursor.pos;
+      uint8_t* dst = band + (cursor.pos - start);
+      if (cursor.literal) {
+        for (uint16_t i = 0; i < n; i++) dst[i] = xorMode ? dst[i] ^ pgm_read_byte(cursor.data++) : pgm_read_byte(cursor.data++);
+      } else if (!xorMode) {
+        memset(dst, cursor.value, n);
+      } else if (cursor.value) {
+        for (uint16_t i = 0; i < n; i++) dst[i] ^= cursor.value;
+      }
+    }
+    cursor.pos += n;
+    cursor.left -= n;
+  }
+}
+
+void ClipBandDecoder::begin(const uint8_t* clip, uint8_t frame) {
+  _clip = clip;
+  _frame = frame;
+  _keyFrame = frame;
+  while (_keyFrame > 0 && clipFrameType(clip, _keyFrame) != CLIP_FRAME_KEY && clipFrameType(clip, _keyFrame) != CLIP_FRAME_KEY_RLE) _keyFrame--;
+  for (uint8_t i = 0; i < CLIP_BAND_MAX_CHAIN && _keyFrame + i <= frame; i++) clipCursorStart(_cursors[i], clip, _keyFrame + i);
+}
+
+void ClipBandDecoder::decode(uint8_t firstPage, uint8_t pageCount, uint8_t* band) {
+  const uint8_t cols = clipTileCols(_clip);
+  const uint8_t rows = clipTileRows(_clip);
+  if (firstPage + pageCount > rows) pageCount = firstPage < rows ? rows - firstPage : 0;
+  const uint16_t rowBytes = cols * CLIP_TILE_BYTES;
+  const uint16_t start = firstPage * rowBytes;
+  const uint16_t end = start + pageCount * rowBytes;
+  for (uint16_t frame = _keyFrame; frame <= _frame; frame++) {
+    uint8_t i = frame - _keyFrame;
+    if (i < CLIP_BAND_MAX_CHAIN) {
+      clipCursorApply(_cursors[i], cols, start, end, band);
+    } else {
+      ClipStreamCursor cursor;
+      clipCursorStart(cursor, _clip, frame);
+      clipCursorApply(cursor, cols, start, end, band);
+    }
+  }
+}
+
+// --- Prefetch ---
+ClipPrefetch::~ClipPrefetch() { free(_buffer); }
+
+void ClipPrefetch::setBudget(uint16_t bytes) {
+  free(_buffer);
+  _buffer = nullptr;
+  reset();
+  _budget = bytes;
+}
+
+void ClipPrefetch::fill(const uint8_t* clip, uint16_t maxBytes) {
+  if (!_budget || !clip) return;
+  if (clip != _clip) {
+    if (!_buffer) _buffer = (uint8_t*)malloc(_budget);
+    if (!_buffer) { // Out of memory: stay off rather than retrying every frame
+      _budget = 0;
+      return;
+    }
+    _clip = clip;
+    _copied = 0;
+    _frames = 0;
+    _target = 0;
+    for (uint8_t f = 0; f < clipFrameCount(clip) && clipFrameEnd(clip, f) <= _budget; f++) _target = clipFrameEnd(clip, f);
+  }
+  uint32_t n = _target - _copied;
+  if (n > maxBytes) n = maxBytes;
+  for (uint32_t i = 0; i < n; i++) _buffer[_copied + i] = pgm_read_byte(&clip[_copied + i]);
+  _copied += n;
+  while (n && _frames < clipFrameCount(clip) && clipFrameEnd(clip, _frames) <= _copied) _frames++;
+}
+
+// --- Playback ---
+void ClipPlayer::play(const AnimationClip* clip, unsigned long now) {
+  _clip = clip;
+  _frameCount = clip ? clipFrameCount(clip->data) : 0;
+  _frame = 0;
+  _startTime = now;
+}
+
+int ClipPlayer::advance(unsigned long now, uint32_t* dropped) {
+  if (!_clip) return -1;
+  if (finished()) return _frame;
+  uint16_t duration = frameDuration();
+  unsigned long due = (now - _startTime) / duration; // Frame due now, counted past the end
+  if (due <= _frame) return _frame;
+
+  unsigned long target = _frame + 1;
+  if (_policy == CLIP_DROP_FRAMES) {
+    target = due;
+    if (_clip->loopMode == CLIP_HOLD_LAST && target >= _frameCount) target = _frameCount - 1;
+    *dropped += target - _frame - 1;
+  } else if (due > target) {
+    _startTime = now - target * duration; // Running late: the next frame is due one duration from now
+  }
+  if (target >= _frameCount) { // Looped: move the clock on with the frame so it never overflows
+    _startTime += (target / _frameCount) * _frameCount * duration;
+    target %= _frameCount;
+  }
+  _frame = target;
+  return _frame;
+}
@@ -0,0 +1,218 @@
+/*
+  RideBuddyClip.h - Compact storage for the full-screen bitmap clips.
+  Released into the public domain.
+
+  A clip is one flash-resident byte blob. Frames are stored in the U8g2
+  page-major layout (one byte = 8 vertical pixels, 128 bytes per page), so
+  they can be applied straight onto the display buffer without a blit:
+
+    Header (CLIP_HEADER_SIZE bytes)
+      [0..1] 'R', 'C'      magic
+      [2]    version       CLIP_FORMAT_VERSION
+      [3]    frame count
+      [4]    key interval  encoder setting, informational
+      [5]    tile columns  (SCREEN_WIDTH / 8)
+      [6]    tile rows     (SCREEN_HEIGHT / 8)
+      [7]    reserved
+    Frame offsets: frame count x uint32 (little endian, from blob start)
+    Frames (first byte is the ClipFrameType):
+      CLIP_FRAME_KEY       : tile columns x tile rows x 8 raw bytes
+      CLIP_FRAME_DELTA     : tile count, then per tile in index order: index, 8 XOR bytes
+      CLIP_FRAME_KEY_RLE   : RLE stream of the raw frame bytes
+      CLIP_FRAME_DELTA_RLE : RLE stream of the whole-frame XOR bytes
+
+  A delta frame is XORed onto the previous frame, so only the tiles that
+  changed are stored. Frame 0 is always a keyframe, which makes looping and
+  seeking cheap. The encoder picks whichever variant of a frame is smaller.
+
+  RLE streams are a sequence of runs, decoded straight into the target
+  buffer without an intermediate copy:
+      0x00..0x7F  n   literal: the next n + 1 bytes
+      0x80..0xFF  n v repeat:  byte v, (n & 0x7F) + 3 times
+  Frames are mostly long runs of 0x00 and 0xFF, so a keyframe typically
+  shrinks to a tenth of its size, and zero runs in XOR streams are skipped
+  without touching the buffer.
+
+  Single-frame clips double as stills (ANGRY, LOVE) and can be drawn at a
+  pixel offset with clipDrawKeyFrame().
+
+  With a U8g2 page buffer only a band of pages is in RAM. ClipBandDecoder
+  rebuilds a frame band by band, keeping a read cursor in every frame of the
+  keyframe chain, so each byte of the chain is read once per frame however
+  many bands there are.
+
+  ClipPrefetch keeps a RAM copy of the clip on screen, filled a chunk per
+  update while the first frames still play from flash. Frames are stored in
+  order and each depends only on those before it, so any prefix of the blob
+  that holds whole frames can be decoded from; frames past the budget are
+  read from flash as before.
+*/
+#ifndef RideBuddyClip_h
+#define RideBuddyClip_h
+
+#include <stdint.h>
+#include <string.h>
+#if defined(ARDUINO)
+#include <pgmspace.h>
+#endif
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+#ifndef pgm_read_byte
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#endif
+
+#define CLIP_FORMAT_VERSION 2
+#define CLIP_HEADER_SIZE 8
+#define CLIP_TILE_BYTES 8
+#define CLIP_RLE_MAX_LITERAL 128
+#define CLIP_RLE_MIN_REPEAT 3
+#define CLIP_RLE_MAX_REPEAT 130
+
+enum ClipFrameType {
+  CLIP_FRAME_KEY = 0,
+  CLIP_FRAME_DELTA = 1,
+  CLIP_FRAME_KEY_RLE = 2,
+  CLIP_FRAME_DELTA_RLE = 3
+};
+
+// --- Clip Header Access ---
+bool clipIsValid(const uint8_t* clip);
+uint8_t clipFrameCount(const uint8_t* clip);
+uint8_t clipTileCols(const uint8_t* clip);
+uint8_t clipTileRows(const uint8_t* clip);
+uint32_t clipFrameOffset(const uint8_t* clip, uint8_t frame);
+ClipFrameType clipFrameType(const uint8_t* clip, uint8_t frame);
+// Bytes from the blob start to the end of `frame`; the last frame is walked
+uint32_t clipFrameEnd(const uint8_t* clip, uint8_t frame);
+// Walks every frame of a clip of `size` bytes and checks the decoder can
+// never leave it: frames start after the offset table, in order, and end
+// by the next frame (the last by `size`); delta tiles lie on the screen and
+// RLE streams expand to exactly one frame. For untrusted data, e.g. packs.
+bool clipFramesValid(const uint8_t* clip, uint32_t size);
+
+// --- Decoding ---
+// `buffer` is a page-major tile buffer of clipTileCols() x clipTileRows()
+// tiles. `dirtyTiles` holds one bit per tile column for each tile row; the
+// decoder sets the bit of every tile whose contents actually changed and
+// never clears bits.
+
+// Applies one frame. A delta frame requires `buffer` to hold frame - 1.
+void clipApplyFrame(const uint8_t* clip, uint8_t frame, uint8_t* buffer, uint16_t* dirtyTiles);
+
+// Brings `buffer` from `currentFrame` (or -1 when it holds something else)
+// to `targetFrame`, stepping forward through deltas when that is shorter
+// than restarting from the nearest keyframe. Returns `targetFrame`.
+int clipSeek(const uint8_t* clip, int currentFrame, uint8_t targetFrame, uint8_t* buffer, uint16_t* dirtyTiles);
+
+// ORs a keyframe onto `buffer` shifted by (dx, dy) pixels, clipping at the
+// edges. Meant for stills drawn over a cleared buffer; no dirty tracking.
+void clipDrawKeyFrame(const uint8_t* clip, uint8_t frame, int8_t dx, int8_t dy, uint8_t* buffer);
+// Same, into a band buffer holding pages [firstPage, firstPage + pageCount)
+void clipDrawKeyFrameBand(const uint8_t* clip, uint8_t frame, int8_t dx, int8_t dy, uint8_t firstPage, uint8_t pageCount, uint8_t* band);
+
+// --- Band Decoding (U8g2 page-buffer mode) ---
+#define CLIP_BAND_MAX_CHAIN 12 // Frames from a keyframe that keep a cursor; clipenc's default key interval
+
+// Read position in one frame of the chain
+struct ClipStreamCursor {
+  const uint8_t* data; // Next unread byte of the frame body
+  uint16_t pos;        // RLE: frame byte the next decoded byte lands on
+  uint8_t type;        // ClipFrameType
+  uint8_t left;        // RLE: bytes left in the current run; DELTA: tiles left
+  uint8_t value;       // RLE: value of the current repeat run
+  bool literal;        // RLE: current run is a literal
+};
+
+// Decodes one frame into successive bands, top to bottom. The band is
+// overwritten, so it needs no clearing. Chains longer than
+// CLIP_BAND_MAX_CHAIN still decode, rereading their later frames per band.
+class ClipBandDecoder {
+  public:
+    void begin(const uint8_t* clip, uint8_t frame);
+    void decode(uint8_t firstPage, uint8_t pageCount, uint8_t* band);
+
+  private:
+    const uint8_t* _clip;
+    uint8_t _keyFrame;
+    uint8_t _frame;
+    ClipStreamCursor _cursors[CLIP_BAND_MAX_CHAIN];
+};
+
+// --- Prefetch ---
+class ClipPrefetch {
+  public:
+    ClipPrefetch() : _budget(0), _buffer(nullptr), _clip(nullptr), _target(0), _copied(0), _frames(0) {}
+    ~ClipPrefetch();
+
+    // RAM for the copy, allocated on first use; 0 reads every clip from flash
+    void setBudget(uint16_t bytes);
+    uint16_t budget() const { return _budget; }
+    // Copies up to `maxBytes` more of `clip`, starting over when it is not
+    // the clip being copied. Cheap once the copy is complete.
+    void fill(const uint8_t* clip, uint16_t maxBytes);
+    // Where to decode `frame` of `clip` from: the RAM copy once it holds
+    // that frame, else `clip` itself. Both hold the same bytes.
+    const uint8_t* source(const uint8_t* clip, uint8_t frame) const { return clip == _clip && frame < _frames ? _buffer : clip; }
+    uint8_t residentFrames(const uint8_t* clip) const { return clip == _clip ? _frames : 0; }
+    // Forgets the copy, for when the clip's memory may have been reused
+    void reset() { _clip = nullptr; _frames = 0; }
+
+  private:
+    uint16_t _budget;
+    uint8_t* _buffer;
+    const uint8_t* _clip; // Clip in _buffer
+    uint32_t _target;     // Bytes to copy: the whole frames that fit the budget
+    uint32_t _copied;
+    uint8_t _frames;      // Whole frames copied
+};
+
+// --- Playback ---
+enum ClipLoopMode : uint8_t {
+  CLIP_LOOP,      // Wraps around to frame 0
+  CLIP_HOLD_LAST  // Plays once and stays on the last frame
+};
+
+// Everything needed to play a clip; the frame table and frame count come
+// from the blob's header. Usually a static const next to the blob.
+struct AnimationClip {
+  const uint8_t* data;
+  uint16_t frameDuration; // ms per frame
+  ClipLoopMode loopMode;
+};
+
+// What to do when frames come due faster than they can be shown
+enum ClipFramePolicy : uint8_t {
+  CLIP_DROP_FRAMES, // Skip to the frame due now, so the clip keeps its duration
+  CLIP_NEVER_SKIP   // Show every frame, running late when updates are too slow
+};
+
+// Frame clock for the clip on screen. The frame follows the time elapsed
+// since play(), not the number of advance() calls, so playback speed does
+// not depend on the update rate. Times are millis() values.
+class ClipPlayer {
+  public:
+    ClipPlayer() : _clip(nullptr), _frameCount(0), _frame(0), _policy(CLIP_DROP_FRAMES), _startTime(0) {}
+    void play(const AnimationClip* clip, unsigned long now); // From frame 0
+    void stop() { _clip = nullptr; }
+    void setFramePolicy(ClipFramePolicy policy) { _policy = policy; }
+    const AnimationClip* clip() const { return _clip; }
+    uint8_t frame() const { return _frame; }
+    bool finished() const { return _clip && _clip->loopMode == CLIP_HOLD_LAST && _frame + 1 >= _frameCount; }
+    unsigned long nextFrameTime() const { return _startTime + (_frame + 1) * frameDuration(); }
+    // Steps to the frame due at `now` and returns it, or -1 when stopped.
+    // Frames skipped on the way are added to *dropped.
+    int advance(unsigned long now, uint32_t* dropped);
+
+  private:
+    uint16_t frameDuration() const { return _clip->frameDuration ? _clip->frameDuration : 1; }
+
+    const AnimationClip* _clip;
+    uint8_t _frameCount;
+    uint8_t _frame;
+    ClipFramePolicy _policy;
+    unsigned long _startTime; // When frame 0 was due; moves on at every loop
+};
+
+#endif
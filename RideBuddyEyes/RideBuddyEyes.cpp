@@ -1,107 +1,323 @@
 #include "RideBuddyEyes.h"
 #include <math.h>
+#include <string.h>
+#include "RideBuddyClip.h"
+#if !RIDEBUDDY_BUILTIN_CLIPS // Clips come from a ClipPack (RideBuddyPack.h); the stills stay built in
+#if SCREEN_HEIGHT == 32
+#include "data/128x32/angry.h"
+#include "data/128x32/love.h"
+#elif SCREEN_HEIGHT == 128
+#include "data/128x128/angry.h"
+#include "data/128x128/love.h"
+#else
+#include "data/angry.h"
+#include "data/love.h"
+#endif
+#elif SCREEN_HEIGHT == 32 // Clips fitted to the panel by clipenc -g, see guide.md
+#include "data/128x32/cry.h"
+#include "data/128x32/shy.h"
+#include "data/128x32/angry.h"
+#include "data/128x32/driving.h"
+#include "data/128x32/happy.h"
+#include "data/128x32/love.h"
+#include "data/128x32/battery.h"
+#elif SCREEN_HEIGHT == 128
+#include "data/128x128/cry.h"
+#include "data/128x128/shy.h"
+#include "data/128x128/angry.h"
+#include "data/128x128/driving.h"
+#include "data/128x128/happy.h"
+#include "data/128x128/love.h"
+#include "data/128x128/battery.h"
+#else
 #include "data/cry.h"
 #include "data/shy.h"
 #include "data/angry.h"
 #include "data/driving.h"
-#include "data/happy.h" // Include happy animation data
-#include "data/love.h" // Include love bitmap data
-#include "data/battery.h" // Include battery animation data
+#include "data/happy.h" // Include happy animation clip
+#include "data/love.h" // Include love still
+#include "data/battery.h" // Include battery animation clip
+#endif
 
 // Note: The extern declarations were removed as they conflicted with the definitions in the header files.
 // The header files provide the correct declarations for frame data arrays and frame counts.
 
-#define CRY_FRAME_DURATION 33 // ~30 FPS
-#define HAPPY_FRAME_DURATION 33 // ~30 FPS
-#define BATTERY_FRAME_DURATION 33 // ~30 FPS
+#define CLIP_FRAME_DURATION 33 // ~30 FPS for the built-in clips
+#define CLIP_REGISTRY_SIZE (EMOTION_SLOTS - 1) // Clips registered at runtime: every emotion but BLINK
 #define LOVE_BEAT_SPEED 0.005
 #define LOVE_BEAT_MAGNITUDE 0.2
-#define SHY_FRAME_DURATION 33 // ~30 FPS
-#define DRIVING_FRAME_DURATION 33 // ~30 FPS
 #define DISTRACTED_ANIM_DURATION 300 // Duration for eye scaling/moving
 #define DISTRACTED_SIDE_HOLD_DURATION 2000 // 2 seconds holding the side-distracted state
 #define DISTRACTED_NEUTRAL_HOLD_DURATION 3000 // 3 seconds holding neutral between sides
 #define SLEEP_MOUTH_TOGGLE_INTERVAL 500 // Interval to toggle sleep mouth shape (ms)
+#define SCHEDULE_MAX_WAIT 1000 // nextFrameDue() never looks further ahead than this (ms)
+#define SCARED_GLANCE_DURATION 100 // Very quick darting glances
+#define FADE_MAX_FRAMES 15 // A 4x4 Bayer matrix has 16 levels
+
+static constexpr int16_t eyeCenterX[2] = {EYE_CENTER_LEFT_X, EYE_CENTER_RIGHT_X};
+
+// --- Keyframe Timelines ---
+#define EYE_TARGET(x, y, scale) {EYE_COORD(layoutPx(x)), EYE_COORD(layoutPx(y)), EYE_COORD(EYE_WIDTH * (scale)), EYE_COORD(EYE_HEIGHT * (scale)), \
+                                EYE_COORD(0), EYE_COORD(0), EYE_COORD(0), EYE_COORD(0)} // Lids open
+#define EYE_TARGET_REST EYE_TARGET(0, 0, 1)
+
+// Look left with the near eye enlarged, back to centre, look right, back to
+// centre; from then on it keeps repeating the right-hand look.
+static constexpr EyeKeyframe distractedKeyframes[] = {
+  {{EYE_TARGET(-15, 0, 1.5), EYE_TARGET(-10, 0, 0.5)}, DISTRACTED_ANIM_DURATION,
+   DISTRACTED_ANIM_DURATION + DISTRACTED_SIDE_HOLD_DURATION, 0, 0, 0, ANIM_CURVE_CUBIC_IN_OUT, 0},
+  {{EYE_TARGET_REST, EYE_TARGET_REST}, DISTRACTED_ANIM_DURATION,
+   DISTRACTED_ANIM_DURATION + DISTRACTED_NEUTRAL_HOLD_DURATION, 0, 0, 0, ANIM_CURVE_CUBIC_IN_OUT, 0},
+  {{EYE_TARGET(10, 0, 0.5), EYE_TARGET(15, 0, 1.5)}, DISTRACTED_ANIM_DURATION,
+   DISTRACTED_ANIM_DURATION + DISTRACTED_SIDE_HOLD_DURATION, 0, 0, 0, ANIM_CURVE_CUBIC_IN_OUT, 0},
+  {{EYE_TARGET_REST, EYE_TARGET_REST}, DISTRACTED_ANIM_DURATION,
+   DISTRACTED_ANIM_DURATION + DISTRACTED_NEUTRAL_HOLD_DURATION, 0, 0, 0, ANIM_CURVE_CUBIC_IN_OUT, 0},
+};
+static constexpr EyeTimeline distractedTimeline = {distractedKeyframes, 4, 2};
+
+// Random darting glances at the shrunken size set by setEmotion(SCARED)
+static constexpr EyeKeyframe scaredKeyframes[] = {
+  {{EYE_TARGET_REST, EYE_TARGET_REST}, SCARED_GLANCE_DURATION, SCARED_GLANCE_DURATION, 0, layoutPx(8), layoutPx(6),
+   ANIM_CURVE_CUBIC_IN_OUT, KEYFRAME_KEEP_SIZE},
+};
+static constexpr EyeTimeline scaredTimeline = {scaredKeyframes, 1, 0};
+
+// NEUTRAL: glance somewhere, hold, look back and wait a while
+static constexpr EyeKeyframe idleGlanceKeyframes[] = {
+  {{EYE_TARGET_REST, EYE_TARGET_REST}, IDLE_ACTION_TRANSITION_DURATION,
+   IDLE_ACTION_TRANSITION_DURATION + IDLE_ACTION_HOLD_DURATION, 0, layoutPx(8), layoutPx(6), ANIM_CURVE_CUBIC_IN_OUT, 0},
+  {{EYE_TARGET_REST, EYE_TARGET_REST}, IDLE_ACTION_TRANSITION_DURATION,
+   IDLE_ACTION_MIN_INTERVAL, IDLE_ACTION_MAX_INTERVAL, 0, 0, ANIM_CURVE_CUBIC_IN_OUT, 0},
+};
+static constexpr EyeTimeline idleGlanceTimeline = {idleGlanceKeyframes, 2, 0};
+
+// --- Eyelid Moods ---
+// HAPPY, CRY and SHY when they have no clip, and ANGRY and LOVE on two
+// panels, where their one-panel stills do not fit. Lids are fractions of the
+// eye's target height, rounded to whole pixels so the float and Q8.8
+// builds cut the same rows.
+#define EYE_LID(scaleH, f) EYE_COORD((int)(EYE_HEIGHT * (scaleH) * (f)))
+#define EYE_MOOD(x, y, scaleW, scaleH, upper, lower, tilt, bend) \
+  {EYE_COORD(layoutPx(x)), EYE_COORD(layoutPx(y)), EYE_COORD((int)(EYE_WIDTH * (scaleW))), EYE_COORD((int)(EYE_HEIGHT * (scaleH))), \
+   EYE_LID(scaleH, upper), EYE_LID(scaleH, lower), EYE_LID(scaleH, tilt), EYE_LID(scaleH, bend)}
+
+static constexpr EyeState happyLook = EYE_MOOD(0, -3, 1.05, 1, 0, 0.3, 0, 0.42);       // Smiling arches
+static constexpr EyeState cryLook = EYE_MOOD(0, 4, 1, 0.85, 0.3, 0, -0.2, 0);          // Drooping outer corners
+static constexpr EyeState shyLook = EYE_MOOD(-6, 6, 0.9, 0.75, 0.3, 0.2, 0, 0.18);      // Squinting down and aside
+static constexpr EyeState angryLook = EYE_MOOD(0, 2, 1, 0.85, 0.1, 0, 0.35, 0);        // Lids slanting down to the nose
+static constexpr EyeState loveLook = EYE_MOOD(0, 0, 1.1, 0.95, 0, 0.25, 0, 0.35);      // Wide, soft smile
+#define MOOD_TWEEN_DURATION 250
+
+// --- Clips ---
+// Clip arrays nothing refers to are left out of the image
+#if RIDEBUDDY_BUILTIN_CLIPS
+#if !RIDEBUDDY_PROCEDURAL_MOODS
+static const AnimationClip cryAnimation = {cry_clip, CLIP_FRAME_DURATION, CLIP_LOOP};
+static const AnimationClip shyAnimation = {shy_clip, CLIP_FRAME_DURATION, CLIP_LOOP};
+static const AnimationClip happyAnimation = {happy_clip, CLIP_FRAME_DURATION, CLIP_LOOP};
+#endif
+static const AnimationClip drivingAnimation = {driving_clip, CLIP_FRAME_DURATION, CLIP_LOOP};
+static const AnimationClip batteryAnimation = {battery_clip, CLIP_FRAME_DURATION, CLIP_LOOP};
+#endif
+
+struct RegisteredClip {
+  Emotion emotion;
+  const AnimationClip* clip;
+};
+static RegisteredClip clipRegistry[CLIP_REGISTRY_SIZE];
+static uint8_t clipRegistryCount = 0;
+static uint16_t clipUnregisterCount = 0; // Clip memory may be reused once unregistered
+static uint16_t clipRegistryGeneration = 0; // Bumped on every change, so a swapped clip is never elided
+
+// The clip shown for an emotion, or nullptr for procedural eyes and stills.
+// Registered clips take precedence over the built-in ones.
+static const AnimationClip* clipFor(Emotion emotion) {
+  const AnimationClip* registered = RideBuddyEyes::registeredClip(emotion);
+  if (registered) return registered;
+#if RIDEBUDDY_BUILTIN_CLIPS
+  switch (emotion) {
+#if !RIDEBUDDY_PROCEDURAL_MOODS
+    case CRY: return &cryAnimation;
+    case SHY: return &shyAnimation;
+    case HAPPY: return &happyAnimation;
+#endif
+    case DRIVING: return &drivingAnimation;
+    case BATTERY: return &batteryAnimation;
+    default: return nullptr;
+  }
+#else
+  return nullptr;
+#endif
+}
+
+// Emotions drawn with eyelids when no clip is registered or built in for them
+static bool isEyelidMood(Emotion emotion) {
+  return emotion == HAPPY || emotion == CRY || emotion == SHY;
+}
+
+// Clips and stills are laid out across one panel, with both eyes and the
+// mouth; on two panels the procedural looks stand in for them.
+const AnimationClip* RideBuddyEyes::shownClip(Emotion emotion) const {
+  return _rightDisplay ? nullptr : clipFor(emotion);
+}
+
+bool RideBuddyEyes::showsStill(Emotion emotion) const {
+  return !_rightDisplay && (emotion == ANGRY || emotion == LOVE);
+}
+
+const AnimationClip* RideBuddyEyes::registeredClip(Emotion emotion) {
+  for (uint8_t i = 0; i < clipRegistryCount; i++) {
+    if (clipRegistry[i].emotion == emotion) return clipRegistry[i].clip;
+  }
+  return nullptr;
+}
+
+bool RideBuddyEyes::registerClip(Emotion emotion, const AnimationClip* clip) {
+  if (emotion == BLINK || (int)emotion >= EMOTION_SLOTS) return false;
+  // An AnimationClip carries no size, so only the frames' own ends are checked
+  // here; ClipPack bounds its clips by their index entries
+  if (clip && (!clipFramesValid(clip->data, 0xFFFFFFFFu) || clipTileCols(clip->data) != DISPLAY_TILE_COLS ||
+               clipTileRows(clip->data) != DISPLAY_TILE_ROWS)) return false;
+  uint8_t i = 0;
+  while (i < clipRegistryCount && clipRegistry[i].emotion != emotion) i++;
+  if (!clip) { // Unregister
+    if (i == clipRegistryCount) return true;
+    clipRegistry[i] = clipRegistry[--clipRegistryCount];
+    clipUnregisterCount++;
+    clipRegistryGeneration++;
+    return true;
+  }
+  if (i == clipRegistryCount) {
+    if (clipRegistryCount == CLIP_REGISTRY_SIZE) return false;
+    clipRegistryCount++;
+  }
+  clipRegistry[i] = {emotion, clip};
+  clipRegistryGeneration++;
+  return true;
+}
 
-RideBuddyEyes::RideBuddyEyes() {
+RideBuddyEyes::RideBuddyEyes() : _spriteCache(SCREEN_WIDTH, DISPLAY_TILE_ROWS, EYE_SPRITE_CACHE_BYTES) {
   _display = nullptr;
+  _rightDisplay = nullptr;
+  _drawPanel = 0;
   _currentEmotion = NEUTRAL;
   _previousEmotion = NEUTRAL;
-  _animDuration = 0;
   _vibrateXOffset = 0;
   _vibrateYOffset = 0;
-  _isIdleActionActive = false;
-  _cry_anim_currentFrame = 0;
-  _shy_anim_currentFrame = 0;
-  _shy_anim_lastFrameTime = 0;
-  _driving_anim_currentFrame = 0;
-  _driving_anim_lastFrameTime = 0;
-  _happy_anim_currentFrame = 0;       // Initialize happy animation current frame
-  _happy_anim_lastFrameTime = 0;      // Initialize happy animation last frame time
-  _battery_anim_currentFrame = 0;     // Initialize battery animation current frame
-  _battery_anim_lastFrameTime = 0;    // Initialize battery animation last frame time
-  _distractedPhase = DISTRACTED_INIT;
-  _distractedPhaseStartTime = 0;
+  _blinkStartTime = 0;
+  playTimeline(_emotionTimeline, nullptr, 0);
+  playTimeline(_idleTimeline, nullptr, 0);
   _sleepMouthState = SLEEP_MOUTH_UNSHAPED;
   _sleepMouthLastToggleTime = 0;
+  _frameInterval = FRAME_INTERVAL;
+  _sentBuffer = nullptr;
+  _partialFlush = true;
+  _sentBufferValid = false;
+  _lastFrameBytesSent = 0;
+  _totalBytesSent = 0;
+  memset(_dirtyTiles, 0, sizeof(_dirtyTiles));
+  _dirtyTilesKnown = false;
+  _clipInBuffer = nullptr;
+  _clipFrameInBuffer = -1;
+  _clipPrefetch.setBudget(CLIP_PREFETCH_BYTES);
+  _clipUnregisterSeen = clipUnregisterCount;
+  _fingerprintValid = false;
+  _framesElided = 0;
+  memset(&_stats, 0, sizeof(_stats));
+  _emotionSince = 0;
+  _frameFlushMicros = 0;
+  _fadeFrom = nullptr;
+  _fadeFrames = EMOTION_FADE_FRAMES;
+  _fadeStep = 0;
+  _pageMode = false;
+  _bandTop = 0;
+  _bandBottom = SCREEN_HEIGHT;
+  _clipBand = nullptr;
+#if RIDEBUDDY_DISPLAY_TASK
+  memset(_displayTasks, 0, sizeof(_displayTasks));
+  _displayTaskStop = false;
+#endif
+}
 
+RideBuddyEyes::~RideBuddyEyes() {
+  endDisplayTask();
+  free(_fadeFrom);
+  free(_sentBuffer);
+  free(_clipBand);
+}
+
+void RideBuddyEyes::begin(U8G2* leftDisplay, U8G2* rightDisplay, int sda_pin, int scl_pin) {
+  begin(leftDisplay, sda_pin, scl_pin);
+  // Each panel is drawn in its own buffer and diffed against its own copy, so both need the full-buffer layout
+  bool fullBuffers = _sentBuffer && leftDisplay->getBufferTileWidth() == DISPLAY_TILE_COLS && leftDisplay->getBufferTileHeight() == DISPLAY_TILE_ROWS &&
+                     rightDisplay->getBufferTileWidth() == DISPLAY_TILE_COLS && rightDisplay->getBufferTileHeight() == DISPLAY_TILE_ROWS;
+  uint8_t* sentBuffers = fullBuffers ? (uint8_t*)realloc(_sentBuffer, 2 * DISPLAY_BUFFER_SIZE) : nullptr;
+  if (sentBuffers) _sentBuffer = sentBuffers;
+  _rightDisplay = sentBuffers ? rightDisplay : nullptr;
 }
 
 void RideBuddyEyes::begin(U8G2* display, int sda_pin, int scl_pin) {
+  endDisplayTask();
   _display = display;
+  _rightDisplay = nullptr;
+  _sentBufferValid = false; // Panel contents are unknown until the first full send
+  _fingerprintValid = false;
+  // Tile diffing needs the whole frame in RAM (U8g2 "_F_" constructors)
+  if (_display->getBufferTileWidth() != DISPLAY_TILE_COLS || _display->getBufferTileHeight() != DISPLAY_TILE_ROWS) {
+    _partialFlush = false;
+    _spriteCache.setBudget(0); // Sprites are blitted into the full buffer too
+    _fadeFrames = 0;           // So is the cross-fade
+    // "_1_"/"_2_" constructors: drawn band by band, see renderPages()
+    _pageMode = _display->getBufferTileHeight() < DISPLAY_TILE_ROWS;
+    if (_pageMode && !_clipBand) _clipBand = (ClipBandDecoder*)malloc(sizeof(ClipBandDecoder));
+  } else {
+    _pageMode = false;
+    if (!_sentBuffer) _sentBuffer = (uint8_t*)malloc(DISPLAY_BUFFER_SIZE);
+    if (!_sentBuffer) _partialFlush = false;
+  }
   Wire.begin(sda_pin, scl_pin);
   pinMode(TOUCH_PIN, INPUT_PULLUP);
 
   for (int i = 0; i < 2; i++) {
-    _eyeCenterX[i] = (SCREEN_WIDTH / 4) * (i == 0 ? 1 : 3);
-    _eyeCenterY[i] = SCREEN_HEIGHT / 2 - 8;
-    _currentState[i] = {0, 0, EYE_WIDTH, EYE_HEIGHT};
-    _startState[i] = _currentState[i];
-    _targetState[i] = _currentState[i];
+    _currentState[i] = {EYE_COORD(0), EYE_COORD(0), EYE_COORD(EYE_WIDTH), EYE_COORD(EYE_HEIGHT),
+                        EYE_COORD(0), EYE_COORD(0), EYE_COORD(0), EYE_COORD(0)};
   }
+  _tweens.clear();
 
   unsigned long currentTime = millis();
   _lastFrameTime = currentTime;
+  resetStats();
   _nextBlinkTime = currentTime + random(AUTO_BLINK_MIN_INTERVAL, AUTO_BLINK_MAX_INTERVAL);
-  _nextIdleActionTime = currentTime + random(IDLE_ACTION_MIN_INTERVAL, IDLE_ACTION_MAX_INTERVAL);
-  _idleActionEndTime = 0;
+  playTimeline(_idleTimeline, &idleGlanceTimeline, currentTime + random(IDLE_ACTION_MIN_INTERVAL, IDLE_ACTION_MAX_INTERVAL));
 }
 
 void RideBuddyEyes::update() {
   unsigned long currentTime = millis();
-  if (currentTime - _lastFrameTime < FRAME_INTERVAL) return;
+  if (currentTime - _lastFrameTime < _frameInterval) return;
+  if ((long)(currentTime - nextFrameDue()) >= (long)_frameInterval) _stats.framesLate++;
   _lastFrameTime = currentTime;
+  unsigned long renderStart = micros();
 
   // Always update animation for procedural eyes
   if (_currentEmotion == NEUTRAL || 
-      _currentEmotion == BLINK || _currentEmotion == DISTRACTED || _currentEmotion == SLEEP || _currentEmotion == SCARED) {
+      _currentEmotion == BLINK || _currentEmotion == DISTRACTED || _currentEmotion == SLEEP || _currentEmotion == SCARED ||
+      (isEyelidMood(_currentEmotion) && !clipFor(_currentEmotion)) ||
+      _rightDisplay) { // Two panels only show procedural eyes
       updateAnimation();
   }
 
   // Handle blinking and idle actions (only for procedural eyes)
-  if (_currentEmotion != CRY && _currentEmotion != SHY && _currentEmotion != DRIVING && _currentEmotion != HAPPY && _currentEmotion != BATTERY && _currentEmotion != DISTRACTED) { // Exclude bitmap emotions
-      if (_currentEmotion != BLINK && !_isIdleActionActive && currentTime >= _nextBlinkTime) {
+  if (!shownClip(_currentEmotion) && _currentEmotion != DISTRACTED) { // Exclude bitmap emotions
+      if (_currentEmotion != BLINK && currentTime >= _nextBlinkTime) {
         _blinkStartTime = currentTime;
         setEmotion(BLINK);
         _nextBlinkTime = currentTime + BLINK_DURATION + random(AUTO_BLINK_MIN_INTERVAL, AUTO_BLINK_MAX_INTERVAL);
       }
       if (_currentEmotion == BLINK && (currentTime - _blinkStartTime > BLINK_DURATION)) {
-        setEmotion(_previousEmotion);
+        endBlink();
       }
       if (_currentEmotion == NEUTRAL) {
         _vibrateXOffset = 0; _vibrateYOffset = 0;
-        if (!_isIdleActionActive && currentTime >= _nextIdleActionTime) {
-          _isIdleActionActive = true;
-          EyeState glanceTarget = {(float)random(-8, 9), (float)random(-6, 7), EYE_WIDTH, EYE_HEIGHT};
-          startAnimation(glanceTarget, IDLE_ACTION_TRANSITION_DURATION);
-          _idleActionEndTime = currentTime + IDLE_ACTION_TRANSITION_DURATION + IDLE_ACTION_HOLD_DURATION;
-        }
-        if (_isIdleActionActive && currentTime >= _idleActionEndTime) {
-          _isIdleActionActive = false;
-          EyeState centerTarget = {0, 0, EYE_WIDTH, EYE_HEIGHT};
-          startAnimation(centerTarget, IDLE_ACTION_TRANSITION_DURATION);
-          _nextIdleActionTime = currentTime + random(IDLE_ACTION_MIN_INTERVAL, IDLE_ACTION_MAX_INTERVAL);
-        }
       } else if (_currentEmotion == ANGRY) {
         _vibrateXOffset = random(-2, 3);
         _vibrateYOffset = random(-2, 3);
@@ -113,87 +329,16 @@ void RideBuddyEyes::update() {
       }
   } // End of blinking and idle actions block
 
-  // Handle specific animation phase logic (DISTRACTED, SLEEP, SCARED)
-  if (_currentEmotion == DISTRACTED) {
-      // DISTRACTED logic (Restored)
-      switch (_distractedPhase) {
-        case DISTRACTED_INIT: {
-          // Start the first animation (looking left)
-          EyeState targetLeftEye = {-15, 0, EYE_WIDTH * 1.5, EYE_HEIGHT * 1.5};
-          EyeState targetRightEye = {-10, 0, EYE_WIDTH * 0.5, EYE_HEIGHT * 0.5};
-          startAnimation(targetLeftEye, targetRightEye, DISTRACTED_ANIM_DURATION);
-          _distractedPhase = DISTRACTED_LEFT_ANIM;
-          _distractedPhaseStartTime = currentTime;
-          break;
-        }
-        case DISTRACTED_NEUTRAL_WAIT_BEFORE_FIRST_ANIM: {
-          if (_animDuration == 0) {
-            EyeState targetLeftEye = {-15, 0, EYE_WIDTH * 1.5, EYE_HEIGHT * 1.5};
-            EyeState targetRightEye = {-10, 0, EYE_WIDTH * 0.5, EYE_HEIGHT * 0.5};
-            startAnimation(targetLeftEye, targetRightEye, DISTRACTED_ANIM_DURATION);
-            _distractedPhase = DISTRACTED_LEFT_ANIM;
-            _distractedPhaseStartTime = currentTime;
-          }
-          break;
-        }
-        case DISTRACTED_LEFT_ANIM: {
-          if (_animDuration == 0) {
-            _distractedPhase = DISTRACTED_LEFT_HOLD;
-            _distractedPhaseStartTime = currentTime;
-          }
-          break;
-        }
-        case DISTRACTED_LEFT_HOLD: {
-          if (currentTime - _distractedPhaseStartTime >= DISTRACTED_SIDE_HOLD_DURATION) {
-            EyeState neutralTarget = {0, 0, EYE_WIDTH, EYE_HEIGHT};
-            startAnimation(neutralTarget, DISTRACTED_ANIM_DURATION);
-            _distractedPhase = DISTRACTED_RETURN_TO_NEUTRAL_FROM_LEFT;
-            _distractedPhaseStartTime = currentTime;
-          }
-          break;
-        }
-        case DISTRACTED_RETURN_TO_NEUTRAL_FROM_LEFT: {
-          if (_animDuration == 0) {
-            _distractedPhase = DISTRACTED_NEUTRAL_HOLD_BETWEEN_SIDES;
-            _distractedPhaseStartTime = currentTime;
-          }
-          break;
-        }
-        case DISTRACTED_NEUTRAL_HOLD_BETWEEN_SIDES: {
-          if (currentTime - _distractedPhaseStartTime >= DISTRACTED_NEUTRAL_HOLD_DURATION) {
-            EyeState targetRightEye = {15, 0, EYE_WIDTH * 1.5, EYE_HEIGHT * 1.5};
-            EyeState targetLeftEye = {10, 0, EYE_WIDTH * 0.5, EYE_HEIGHT * 0.5};
-            startAnimation(targetLeftEye, targetRightEye, DISTRACTED_ANIM_DURATION);
-            _distractedPhase = DISTRACTED_RIGHT_ANIM;
-            _distractedPhaseStartTime = currentTime;
-          }
-          break;
-        }
-        case DISTRACTED_RIGHT_ANIM: {
-          if (_animDuration == 0) {
-            _distractedPhase = DISTRACTED_RIGHT_HOLD;
-            _distractedPhaseStartTime = currentTime;
-          }
-          break;
-        }
-        case DISTRACTED_RIGHT_HOLD: {
-          if (currentTime - _distractedPhaseStartTime >= DISTRACTED_SIDE_HOLD_DURATION) {
-            EyeState neutralTarget = {0, 0, EYE_WIDTH, EYE_HEIGHT};
-            startAnimation(neutralTarget, DISTRACTED_ANIM_DURATION);
-            _distractedPhase = DISTRACTED_RETURN_TO_NEUTRAL_FROM_RIGHT;
-            _distractedPhaseStartTime = currentTime;
-          }
-          break;
-        }
-        case DISTRACTED_RETURN_TO_NEUTRAL_FROM_RIGHT: {
-          if (_animDuration == 0) {
-            _distractedPhase = DISTRACTED_NEUTRAL_HOLD_BETWEEN_SIDES;
-            _distractedPhaseStartTime = currentTime;
-          }
-          break;
-        }
-      }
-  } else if (_currentEmotion == SLEEP) {
+  // Timelines keep playing underneath a blink
+  Emotion baseEmotion = _currentEmotion == BLINK ? _previousEmotion : _currentEmotion;
+  if (baseEmotion == NEUTRAL) {
+      stepTimeline(_idleTimeline, currentTime);
+  } else if (baseEmotion == DISTRACTED || baseEmotion == SCARED) {
+      stepTimeline(_emotionTimeline, currentTime);
+  }
+
+  // Handle specific animation phase logic (SLEEP)
+  if (_currentEmotion == SLEEP) {
       // SLEEP logic
       // _vibrateXOffset is 0 from the 'else' block above.
       // _vibrateYOffset is controlled here for mouth movement.
@@ -207,51 +352,63 @@ void RideBuddyEyes::update() {
           _vibrateYOffset = 0; // Return to normal Y position
         }
       }
-  } else if (_currentEmotion == SCARED) {
-      // SCARED logic
-      // _vibrateXOffset and _vibrateYOffset are set to 0 by the 'else' block above.
-      // SCARED uses _currentState offsets for its movement, updated by startAnimation.
-      if (_animDuration == 0) { // Animation complete, start a new quick glance
-        EyeState glanceTarget = {(float)random(-8, 9), (float)random(-6, 7), _currentState[0].width, _currentState[0].height};
-        startAnimation(glanceTarget, 100); // Very quick animation duration
-      }
   }
-  
-  drawEyes();
+
+  // Nothing drawEyes() reads has changed: the panel already shows this frame
+  if (!frameChanged(advanceClip(currentTime))) {
+    _lastFrameBytesSent = 0;
+    _framesElided++;
+    _stats.framesSkipped++;
+    return;
+  }
+  _frameFlushMicros = 0;
+  if (_pageMode) {
+    renderPages();
+  } else {
+    drawEyes();
+    if (_rightDisplay) { // The right eye goes into the right panel's own buffer
+      U8G2* left = _display;
+      _display = _rightDisplay;
+      _drawPanel = 1;
+      drawEyes();
+      _display = left;
+      _drawPanel = 0;
+    }
+    if (_fadeStep) applyFade();
+    flushDisplay();
+  }
+
+  uint32_t renderMicros = (uint32_t)(micros() - renderStart) - _frameFlushMicros;
+  _stats.framesRendered++;
+  _stats.renderMicros += renderMicros;
+  if (renderMicros > _stats.renderMicrosMax) _stats.renderMicrosMax = renderMicros;
+}
+
+// Clips and stills replace the whole picture, so changing to or from one
+// cross-fades; procedural eyes already morph through their tweens.
+static bool isBitmapEmotion(Emotion emotion) {
+  return clipFor(emotion) || emotion == ANGRY || emotion == LOVE;
 }
 
 void RideBuddyEyes::setEmotion(Emotion emotion) {
+  if ((int)emotion >= EMOTION_SLOTS) return; // No stats slot and no clip registry entry
   if (_currentEmotion == emotion && emotion != BLINK) return;
+  unsigned long now = millis();
+  _stats.emotionMillis[_currentEmotion] += now - _emotionSince;
+  _emotionSince = now;
   if (_currentEmotion != BLINK) _previousEmotion = _currentEmotion;
   _currentEmotion = emotion;
+  if (emotion == BLINK) return; // Drawn over the running tweens, which carry on underneath
+  if (!_rightDisplay && (isBitmapEmotion(_previousEmotion) || isBitmapEmotion(emotion))) startFade(); // Two panels have neither
 
-  _isIdleActionActive = false;
-  
-  if (emotion == CRY) {
-      _cry_anim_currentFrame = 0;
-      _cry_anim_lastFrameTime = millis();
-      return; 
-  }
-  if (emotion == SHY) { // Handle SHY as a full-screen animation like CRY
-      _shy_anim_currentFrame = 0;
-      _shy_anim_lastFrameTime = millis();
-      return;
-  }
-  if (emotion == DRIVING) {
-      _driving_anim_currentFrame = 0;
-      _driving_anim_lastFrameTime = millis();
-      return;
-  }
-  if (emotion == HAPPY) { // Handle HAPPY as a full-screen animation
-      _happy_anim_currentFrame = 0;
-      _happy_anim_lastFrameTime = millis();
-      return;
-  }
-  if (emotion == BATTERY) { // Handle BATTERY as a full-screen animation
-      _battery_anim_currentFrame = 0;
-      _battery_anim_lastFrameTime = millis();
+  _emotionTimeline.timeline = nullptr;
+
+  const AnimationClip* clip = shownClip(emotion);
+  if (clip) { // Full-screen clip animation (CRY, SHY, DRIVING, HAPPY, BATTERY or a registered one)
+      _clipPlayer.play(clip, millis());
       return;
   }
+  _clipPlayer.stop();
   if (emotion == SLEEP) {
       _sleepMouthState = SLEEP_MOUTH_UNSHAPED;
       _sleepMouthLastToggleTime = millis();
@@ -259,43 +416,49 @@ void RideBuddyEyes::setEmotion(Emotion emotion) {
       return;
   }
   if (emotion == DISTRACTED) {
-      _distractedPhase = DISTRACTED_INIT;
-      _distractedPhaseStartTime = millis();
+      playTimeline(_emotionTimeline, &distractedTimeline, millis()); // First look starts on the next frame
       return;
   }
 
-  EyeState target;
-  target.xOffset = 0;
-  target.yOffset = 0;
+  EyeState target = {}; // Lids open
+  target.xOffset = EYE_COORD(0);
+  target.yOffset = EYE_COORD(0);
 
   switch (emotion) {
     case HAPPY:
-      // No procedural animation for HAPPY, handled by bitmap
+      startAnimation(happyLook, MOOD_TWEEN_DURATION);
       break;
-    case LOVE:
-      // No procedural animation for LOVE, handled by bitmap
+    case CRY:
+      startAnimation(cryLook, MOOD_TWEEN_DURATION);
       break;
-    case BLINK:
-      target.width = _currentState[0].width;
-      target.height = _currentState[0].height;
-      startAnimation(target, 0);
+    case SHY:
+      startAnimation(shyLook, MOOD_TWEEN_DURATION);
+      break;
+    case LOVE:
+      if (_rightDisplay) startAnimation(loveLook, MOOD_TWEEN_DURATION);
+      // Otherwise no procedural animation for LOVE, handled by bitmap
       break;
     case SLEEP:
-      target.width = EYE_WIDTH;
-      target.height = EYE_WIDTH / 2; // Give it enough height to show the curve
-      target.yOffset = 0; 
+      target.width = EYE_COORD(EYE_WIDTH);
+      target.height = EYE_COORD(EYE_WIDTH / 2); // Give it enough height to show the curve
+      target.yOffset = EYE_COORD(0); 
       startAnimation(target, 200);
       break;
     case SCARED:
-      target.width = EYE_WIDTH * 0.7;
-      target.height = EYE_HEIGHT * 0.7;
-      target.xOffset = 0;
-      target.yOffset = 0;
+      target.width = EYE_COORD(EYE_WIDTH * 0.7);
+      target.height = EYE_COORD(EYE_HEIGHT * 0.7);
+      target.xOffset = EYE_COORD(0);
+      target.yOffset = EYE_COORD(0);
       startAnimation(target, 150);
+      playTimeline(_emotionTimeline, &scaredTimeline, millis() + 150); // Dart around once shrunk
       break;
-    default: // NEUTRAL
-      target.width = EYE_WIDTH;
-      target.height = EYE_HEIGHT;
+    default: // NEUTRAL, and ANGRY underneath its still
+      if (emotion == ANGRY && _rightDisplay) {
+        startAnimation(angryLook, MOOD_TWEEN_DURATION);
+        break;
+      }
+      target.width = EYE_COORD(EYE_WIDTH);
+      target.height = EYE_COORD(EYE_HEIGHT);
       startAnimation(target, 150);
       break;
   }
@@ -316,39 +479,214 @@ void RideBuddyEyes::battery() { setEmotion(BATTERY); }
 void RideBuddyEyes::blink()   { if (_currentEmotion != BLINK) { _blinkStartTime = millis(); setEmotion(BLINK); } }
 
 // --- Animation System ---
-void RideBuddyEyes::startAnimation(const EyeState& target, uint16_t duration) {
-  _animStartTime = millis();
-  _animDuration = duration;
-  for (int i = 0; i < 2; i++) { 
-      _startState[i] = _currentState[i];
-      _targetState[i] = target;
-  }
+void RideBuddyEyes::startAnimation(const EyeState& target, uint16_t duration, AnimCurve curve) {
+  startAnimation(target, target, duration, curve);
 }
 
-void RideBuddyEyes::startAnimation(const EyeState& targetLeft, const EyeState& targetRight, uint16_t duration) {
-  _animStartTime = millis();
-  _animDuration = duration;
-  _startState[0] = _currentState[0];
-  _targetState[0] = targetLeft;
-  _startState[1] = _currentState[1];
-  _targetState[1] = targetRight;
+// One tween per property: tweens already running on properties this call
+// leaves alone (keepSize: all but xOffset and yOffset) carry on.
+void RideBuddyEyes::startAnimation(const EyeState& targetLeft, const EyeState& targetRight, uint16_t duration,
+                                   AnimCurve curve, bool keepSize) {
+  unsigned long now = millis();
+  uint8_t fields = keepSize ? 2 : EYE_STATE_FIELDS;
+  _tweens.start(&_currentState[0].xOffset, &targetLeft.xOffset, fields, duration, curve, now);
+  _tweens.start(&_currentState[1].xOffset, &targetRight.xOffset, fields, duration, curve, now);
 }
 
 void RideBuddyEyes::updateAnimation() {
-  if (_animDuration == 0) return;
-  float progress = (float)(millis() - _animStartTime) / _animDuration;
-  if (progress >= 1.0) { progress = 1.0; _animDuration = 0; }
-  float easedProgress = easeInOut(progress);
-  for (int i = 0; i < 2; i++) {
-    _currentState[i].xOffset = _startState[i].xOffset + (_targetState[i].xOffset - _startState[i].xOffset) * easedProgress;
-    _currentState[i].yOffset = _startState[i].yOffset + (_targetState[i].yOffset - _startState[i].yOffset) * easedProgress;
-    _currentState[i].width = _startState[i].width + (_targetState[i].width - _startState[i].width) * easedProgress;
-    _currentState[i].height = _startState[i].height + (_targetState[i].height - _startState[i].height) * easedProgress;
+  _tweens.update(millis());
+}
+
+// Back to the emotion the blink interrupted, which kept animating underneath
+void RideBuddyEyes::endBlink() {
+  unsigned long now = millis();
+  _stats.emotionMillis[BLINK] += now - _emotionSince;
+  _emotionSince = now;
+  _currentEmotion = _previousEmotion;
+}
+
+// --- Keyframe Timelines ---
+void RideBuddyEyes::playTimeline(TimelineCursor& cursor, const EyeTimeline* timeline, unsigned long startTime) {
+  cursor.timeline = timeline;
+  cursor.next = 0;
+  cursor.nextTime = startTime;
+}
+
+// Starts the next keyframe once its time has come. At most one per call, so
+// zero-length keyframes cannot spin.
+void RideBuddyEyes::stepTimeline(TimelineCursor& cursor, unsigned long currentTime) {
+  if (!cursor.timeline || (long)(currentTime - cursor.nextTime) < 0) return;
+  if (cursor.next >= cursor.timeline->count) { // Finished, nothing loops back
+    cursor.timeline = nullptr;
+    return;
+  }
+
+  const EyeKeyframe& key = cursor.timeline->keyframes[cursor.next];
+  EyeState target[2] = {key.target[0], key.target[1]};
+  if (key.jitterX || key.jitterY) {
+    eye_coord_t dx = EYE_COORD(random(-key.jitterX, key.jitterX + 1));
+    eye_coord_t dy = EYE_COORD(random(-key.jitterY, key.jitterY + 1));
+    for (int i = 0; i < 2; i++) {
+      target[i].xOffset += dx;
+      target[i].yOffset += dy;
+    }
+  }
+  startAnimation(target[0], target[1], key.duration, key.curve, key.flags & KEYFRAME_KEEP_SIZE);
+
+  uint16_t dwell = key.dwellMax > key.dwell ? random(key.dwell, key.dwellMax) : key.dwell;
+  cursor.nextTime = currentTime + dwell;
+  if (++cursor.next >= cursor.timeline->count && cursor.timeline->loopTo != TIMELINE_NO_LOOP) {
+    cursor.next = cursor.timeline->loopTo;
+  }
+}
+
+// --- Emotion Cross-Fade ---
+void RideBuddyEyes::setTransitionFrames(uint8_t frames) {
+  _fadeFrames = frames > FADE_MAX_FRAMES ? FADE_MAX_FRAMES : frames;
+  if (!_fadeFrames) _fadeStep = 0;
+}
+
+// Keeps the frame on screen as the outgoing picture. The buffer still holds
+// it (or, mid-fade, the current blend, which fades on from there).
+void RideBuddyEyes::startFade() {
+  if (!_fadeFrames || !_display || !_fingerprintValid || _pageMode) return;
+  if (!_fadeFrom) _fadeFrom = (uint8_t*)malloc(DISPLAY_BUFFER_SIZE);
+  if (!_fadeFrom) return;
+  memcpy(_fadeFrom, _display->getBufferPtr(), DISPLAY_BUFFER_SIZE);
+  _fadeStep = 1;
+}
+
+// Blends the freshly rendered frame with the outgoing one through a 4x4
+// Bayer mask: pixels whose threshold is below the fade level show the new
+// frame. One byte holds 8 rows of a column starting at a multiple of 8, so
+// a mask byte only depends on x & 3 and a 32-bit word covers every phase;
+// the blend is one AND/OR per word.
+void RideBuddyEyes::applyFade() {
+  static const uint8_t bayer[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5},
+  };
+  uint8_t level = _fadeStep * 16 / (_fadeFrames + 1);
+  uint8_t maskBytes[4];
+  for (uint8_t x = 0; x < 4; x++) {
+    maskBytes[x] = 0;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      if (bayer[bit & 3][x] < level) maskBytes[x] |= 1 << bit;
+    }
+  }
+  uint32_t mask;
+  memcpy(&mask, maskBytes, 4); // Byte order follows the buffer on any CPU
+
+  uint8_t* buffer = _display->getBufferPtr();
+  for (uint16_t i = 0; i < DISPLAY_BUFFER_SIZE; i += 4) {
+    uint32_t incoming, outgoing;
+    memcpy(&incoming, &buffer[i], 4);
+    memcpy(&outgoing, &_fadeFrom[i], 4);
+    incoming = (incoming & mask) | (outgoing & ~mask);
+    memcpy(&buffer[i], &incoming, 4);
   }
+
+  _clipInBuffer = nullptr;   // Next clip frame decodes from its keyframe
+  _dirtyTilesKnown = false;  // Any tile may have changed
+  if (++_fadeStep > _fadeFrames) _fadeStep = 0;
+}
+
+// --- Frame Scheduling ---
+static void scheduleEarliest(unsigned long& due, unsigned long t) {
+  if ((long)(t - due) < 0) due = t; // Wrap-safe millis() comparison
 }
 
-float RideBuddyEyes::easeInOut(float t) { return t < 0.5 ? 4 * t * t * t : 1 - pow(-2 * t + 2, 3) / 2; }
+// Earliest of the pending events (blink, idle glance, blink end, sleep
+// mouth toggle, distracted hold) but never before the next frame slot.
+// Tweens, clips and vibrating stills change every frame.
+unsigned long RideBuddyEyes::nextFrameDue() const {
+  unsigned long frameDue = _lastFrameTime + _frameInterval;
+  if (!_fingerprintValid || _tweens.active() != 0) return frameDue;
+  if (_fadeStep || _lastFingerprint.fadeStep) return frameDue; // Cross-fading, or its clean final frame is due
 
+  unsigned long due = frameDue + SCHEDULE_MAX_WAIT;
+  // SLEEP's snore bob and other leftover offsets are reset on the next frame
+  bool vibrating = _vibrateXOffset != 0 || _vibrateYOffset != 0;
+
+  if (_clipPlayer.clip()) { // Next clip frame; a clip holding its last frame waits for the next emotion
+    if (!_clipPlayer.finished()) scheduleEarliest(due, _clipPlayer.nextFrameTime());
+    return (long)(due - frameDue) < 0 ? frameDue : due;
+  }
+  switch (_currentEmotion) {
+    case ANGRY: case LOVE: case SCARED: // SCARED's glances follow one another without a hold
+      return frameDue;
+    case DISTRACTED:
+      if (_emotionTimeline.timeline) scheduleEarliest(due, _emotionTimeline.nextTime);
+      break;
+    case BLINK:
+      if (vibrating) return frameDue;
+      scheduleEarliest(due, _blinkStartTime + BLINK_DURATION + 1);
+      if (_emotionTimeline.timeline) scheduleEarliest(due, _emotionTimeline.nextTime);
+      if (_previousEmotion == NEUTRAL && _idleTimeline.timeline) scheduleEarliest(due, _idleTimeline.nextTime);
+      break;
+    case SLEEP:
+      if (vibrating) return frameDue;
+      scheduleEarliest(due, _sleepMouthLastToggleTime + SLEEP_MOUTH_TOGGLE_INTERVAL + 1);
+      scheduleEarliest(due, _nextBlinkTime);
+      break;
+    default: // NEUTRAL, and procedural eyes of any emotion without a clip (eyelid moods, custom emotions)
+      if (vibrating) return frameDue;
+      scheduleEarliest(due, _nextBlinkTime);
+      // The idle timeline only advances in NEUTRAL; elsewhere its time is stale
+      if (_currentEmotion == NEUTRAL && _idleTimeline.timeline) scheduleEarliest(due, _idleTimeline.nextTime);
+      break;
+  }
+  return (long)(due - frameDue) < 0 ? frameDue : due;
+}
+
+unsigned long RideBuddyEyes::msUntilNextFrame() const {
+  long remaining = (long)(nextFrameDue() - millis());
+  return remaining > 0 ? remaining : 0;
+}
+
+// --- Frame Change Detection ---
+// Records the state the next frame will be drawn from. Returns false when
+// it matches the frame already on the panel, so rendering and flushing can
+// both be skipped.
+bool RideBuddyEyes::frameChanged(int clipFrame) {
+  FrameFingerprint fingerprint;
+  memset(&fingerprint, 0, sizeof(fingerprint)); // Padding takes part in the memcmp
+  fingerprint.eyes[0] = _currentState[0];
+  fingerprint.eyes[1] = _currentState[1];
+  fingerprint.clipFrame = clipFrame;
+  fingerprint.clipGeneration = clipRegistryGeneration;
+  fingerprint.emotion = _currentEmotion;
+  fingerprint.vibrateX = _vibrateXOffset;
+  fingerprint.vibrateY = _vibrateYOffset;
+  fingerprint.sleepMouth = _sleepMouthState;
+  fingerprint.fadeStep = _fadeStep;
+
+  if (_fingerprintValid && memcmp(&fingerprint, &_lastFingerprint, sizeof(fingerprint)) == 0) return false;
+  memcpy(&_lastFingerprint, &fingerprint, sizeof(fingerprint));
+  _fingerprintValid = true;
+  return true;
+}
+
+// --- Clip Playback ---
+// Steps the frame counter of the current clip emotion; returns the frame to
+// show, or -1 for emotions that are not clips.
+int RideBuddyEyes::advanceClip(unsigned long currentTime) {
+  if (_clipUnregisterSeen != clipUnregisterCount) { // A new clip may now sit at an old clip's address
+    _clipUnregisterSeen = clipUnregisterCount;
+    _clipPrefetch.reset();
+    _clipInBuffer = nullptr;
+  }
+  const AnimationClip* clip = shownClip(_currentEmotion);
+  if (!clip) { // Not a clip emotion, or its clip was unregistered while showing
+    _clipPlayer.stop();
+    return -1;
+  }
+  if (clip != _clipPlayer.clip()) _clipPlayer.play(clip, currentTime); // Re-registered while showing
+  _clipPrefetch.fill(clip->data, CLIP_PREFETCH_CHUNK_BYTES); // The first frames play from flash meanwhile
+  return _clipPlayer.advance(currentTime, &_stats.clipFramesDropped);
+}
 
 // --- Drawing ---
 void RideBuddyEyes::drawSleepZzz(int eye_x, int eye_y, int eye_w, int eye_h) {
@@ -360,9 +698,10 @@ void RideBuddyEyes::drawSleepZzz(int eye_x, int eye_y, int eye_w, int eye_h) {
           // Position 'zzz' relative to the top-right of the provided eye's coordinates.
           // eye_x, eye_y are the center of the current eye.
           // zzz_base_x is calculated to be to the right of the eye's center by half its width, plus an offset.
-          int zzz_base_x = eye_x + eye_w / 2 + 5; // Right of the eye
+          int zzz_base_x = eye_x + eye_w / 2 + layoutPx(5); // Right of the eye
           // zzz_base_y is calculated to be above the eye's top edge, with a smaller offset to keep it closer.
-          int zzz_base_y = eye_y - eye_h / 2 - 5; // Near top of the eye
+          int zzz_base_y = eye_y - eye_h / 2 - layoutPx(5); // Near top of the eye
+          if (!bandHits(zzz_base_y - 24, zzz_base_y + 1)) return; // Three glyphs rising 8 px each
       
           // Draw 'zzz' text
           _display->setCursor(zzz_base_x, zzz_base_y);
@@ -374,6 +713,7 @@ void RideBuddyEyes::drawSleepZzz(int eye_x, int eye_y, int eye_w, int eye_h) {
 }
 
 void RideBuddyEyes::drawMouth(int x, int y, int w, int h) {
+  if (!bandHits(y - h / 2, y + h / 2 + 1)) return;
   _display->setDrawColor(1); // Draw white for the base ellipse
   _display->drawFilledEllipse(x, y, w / 2, h / 2);
   _display->setDrawColor(0); // Set color to black for cutting the top
@@ -383,90 +723,82 @@ void RideBuddyEyes::drawMouth(int x, int y, int w, int h) {
 
 void RideBuddyEyes::drawEyes() {
   if (!_display) return;
-  
+
+  // --- Handle full-screen clip animations (CRY, SHY, DRIVING, HAPPY, BATTERY, registered clips) ---
+  // Clip frames are applied on top of the previous frame still in the buffer,
+  // so the buffer is not cleared for them.
+  if (_clipPlayer.clip()) {
+    const uint8_t* clip = _clipPlayer.clip()->data;
+    uint8_t frame = _clipPlayer.frame();
+    if (_bandTop == 0 && _clipPrefetch.source(clip, frame) != clip) _stats.clipFramesFromRam++;
+    if (!_pageMode) {
+      drawClipFrame(clip, frame);
+    } else if (_clipBand) { // Decode just this band's rows; bands come top to bottom
+      if (_bandTop == 0) _clipBand->begin(_clipPrefetch.source(clip, frame), frame);
+      _clipBand->decode(_bandTop / 8, (_bandBottom - _bandTop) / 8, _display->getBufferPtr());
+    }
+    return; // Exit as clip emotions take full screen
+  }
+
   _display->clearBuffer();
   _display->setDrawColor(1); // Default drawing color for white shapes
+  _clipInBuffer = nullptr; // Buffer no longer holds a clip frame
 
-  unsigned long currentTime = millis(); // Get current time once for potential use in all drawing logic
-
-  // --- Handle full-screen bitmap animations (CRY, SHY, ANGRY, DRIVING, HAPPY, BATTERY, LOVE) ---
-  if (_currentEmotion == CRY || _currentEmotion == SHY || _currentEmotion == ANGRY || _currentEmotion == DRIVING || _currentEmotion == HAPPY || _currentEmotion == BATTERY || _currentEmotion == LOVE) {
-    if (_currentEmotion == CRY) {
-      if (currentTime - _cry_anim_lastFrameTime > CRY_FRAME_DURATION) {
-        _cry_anim_lastFrameTime = currentTime;
-        _cry_anim_currentFrame = (_cry_anim_currentFrame + 1) % CRY_FRAME_COUNT;
-      }
-      _display->drawXBMP(0, 0, 128, 64, (const unsigned char*)pgm_read_dword(&cry_frames[_cry_anim_currentFrame]));
-    } else if (_currentEmotion == SHY) { // SHY animation logic
-      if (currentTime - _shy_anim_lastFrameTime > SHY_FRAME_DURATION) {
-        _shy_anim_lastFrameTime = currentTime;
-        _shy_anim_currentFrame = (_shy_anim_currentFrame + 1) % SHY_FRAME_COUNT;
-      }
-      _display->drawXBMP(0, 0, 128, 64, (const unsigned char*)pgm_read_dword(&shy_frames[_shy_anim_currentFrame]));
-    } else if (_currentEmotion == ANGRY) { // ANGRY single bitmap
-      _display->drawXBMP(_vibrateXOffset, _vibrateYOffset, 128, 64, angry_bits);
-    } else if (_currentEmotion == DRIVING) { // DRIVING animation logic
-      if (currentTime - _driving_anim_lastFrameTime > DRIVING_FRAME_DURATION) {
-        _driving_anim_lastFrameTime = currentTime;
-        _driving_anim_currentFrame = (_driving_anim_currentFrame + 1) % DRIVING_FRAME_COUNT;
-      }
-      _display->drawXBMP(0, 0, 128, 64, (const unsigned char*)pgm_read_dword(&driving_frames[_driving_anim_currentFrame]));
-    } else if (_currentEmotion == HAPPY) { // HAPPY animation logic
-      if (currentTime - _happy_anim_lastFrameTime > HAPPY_FRAME_DURATION) {
-        _happy_anim_lastFrameTime = currentTime;
-        _happy_anim_currentFrame = (_happy_anim_currentFrame + 1) % HAPPY_FRAME_COUNT;
-      }
-      _display->drawXBMP(0, 0, 128, 64, (const unsigned char*)pgm_read_dword(&happy_frames[_happy_anim_currentFrame]));
-    } else if (_currentEmotion == BATTERY) { // BATTERY animation logic
-      if (currentTime - _battery_anim_lastFrameTime > BATTERY_FRAME_DURATION) {
-        _battery_anim_lastFrameTime = currentTime;
-        _battery_anim_currentFrame = (_battery_anim_currentFrame + 1) % BATTERY_FRAME_COUNT;
-      }
-      _display->drawXBMP(0, 0, 128, 64, (const unsigned char*)pgm_read_dword(&battery_frames[_battery_anim_currentFrame]));
-    } else if (_currentEmotion == LOVE) { // LOVE single bitmap
-      _display->drawXBMP(_vibrateXOffset, _vibrateYOffset, 128, 64, love_bits);
+  // --- Handle full-screen still bitmaps (ANGRY, LOVE) ---
+  if (showsStill(_currentEmotion)) {
+    // Stills are RLE-compressed and decoded straight into the buffer at the vibration offset
+    uint8_t firstPage = _bandTop / 8;
+    uint8_t pageCount = (_bandBottom - _bandTop) / 8;
+    if (_currentEmotion == ANGRY) { // ANGRY single bitmap
+      clipDrawKeyFrameBand(angry_still, 0, _vibrateXOffset, _vibrateYOffset, firstPage, pageCount, _display->getBufferPtr());
+    } else { // LOVE single bitmap
+      clipDrawKeyFrameBand(love_still, 0, _vibrateXOffset, _vibrateYOffset, firstPage, pageCount, _display->getBufferPtr());
     }
-    _display->sendBuffer(); // Update display for bitmap emotions
     return; // Exit as bitmap emotions take full screen
   }
 
   // --- Handle procedural animations (NEUTRAL, BLINK, DISTRACTED, SLEEP) ---
   for (int i = 0; i < 2; i++) { 
+    if (_rightDisplay && i != _drawPanel) continue; // One eye per panel
     drawOneEye(i, _currentEmotion); 
   }
 
-  if (_currentEmotion == NEUTRAL) {
+  // Mouths sit between the eyes, so two panels leave them out
+  if (_rightDisplay && _currentEmotion != SCARED) return; // SCARED's eyebrows belong to the eyes
+
+  if (_currentEmotion == NEUTRAL || _currentEmotion == HAPPY) {
     _display->setDrawColor(1); // Ensure white for mouth
-    float mouthX = SCREEN_WIDTH / 2 + _currentState[0].xOffset + _vibrateXOffset;
-    float mouthY = _eyeCenterY[0] + (EYE_HEIGHT / 2) + 8 + _currentState[0].yOffset + _vibrateYOffset; // Position below neutral eyes
-    float mouthW = 20;
-    float mouthH = 8;
+    float mouthX = SCREEN_WIDTH / 2 + EYE_COORD_TO_FLOAT(_currentState[0].xOffset) + _vibrateXOffset;
+    float mouthY = EYE_CENTER_Y + (EYE_HEIGHT / 2) + layoutPx(8) + EYE_COORD_TO_FLOAT(_currentState[0].yOffset) + _vibrateYOffset; // Position below neutral eyes
+    float mouthW = layoutPx(20);
+    float mouthH = layoutPx(8);
     drawMouth(mouthX, mouthY, mouthW, mouthH);
   } else if (_currentEmotion == SCARED) {
     _display->setDrawColor(1); // Ensure white for eyebrows and mouth
     // Eyebrows for scared emotion
     for (int i = 0; i < 2; i++) {
+      if (_rightDisplay && i != _drawPanel) continue;
       // Round float coordinates to integers for drawing consistency
-      int current_eye_x = round(_eyeCenterX[i] + _currentState[i].xOffset);
-      int current_eye_y = round(_eyeCenterY[i] + _currentState[i].yOffset);
-      int current_eye_half_width = round(_currentState[i].width / 2);
-      int current_eye_half_height = round(_currentState[i].height / 2);
+      int current_eye_x = round(eyeCenter(i) + EYE_COORD_TO_FLOAT(_currentState[i].xOffset));
+      int current_eye_y = round(EYE_CENTER_Y + EYE_COORD_TO_FLOAT(_currentState[i].yOffset));
+      int current_eye_half_width = round(EYE_COORD_TO_FLOAT(_currentState[i].width) / 2);
+      int current_eye_half_height = round(EYE_COORD_TO_FLOAT(_currentState[i].height) / 2);
 
-      int eyebrow_y_base = current_eye_y - current_eye_half_height - 5; // Position above the eye
+      int eyebrow_y_base = current_eye_y - current_eye_half_height - layoutPx(5); // Position above the eye
 
       // Define eyebrow start and end points
       int x1, y1, x2, y2;
 
       if (i == 0) { // Left eye
-        x1 = current_eye_x - current_eye_half_width + 5;
+        x1 = current_eye_x - current_eye_half_width + layoutPx(5);
         y1 = eyebrow_y_base;
-        x2 = current_eye_x + 5;
-        y2 = eyebrow_y_base - 8;
+        x2 = current_eye_x + layoutPx(5);
+        y2 = eyebrow_y_base - layoutPx(8);
       } else { // Right eye
-        x1 = current_eye_x + current_eye_half_width - 5;
+        x1 = current_eye_x + current_eye_half_width - layoutPx(5);
         y1 = eyebrow_y_base;
-        x2 = current_eye_x - 5;
-        y2 = eyebrow_y_base - 8;
+        x2 = current_eye_x - layoutPx(5);
+        y2 = eyebrow_y_base - layoutPx(8);
       }
 
       // Manual clamping of coordinates to screen bounds
@@ -475,74 +807,318 @@ void RideBuddyEyes::drawEyes() {
       x2 = constrain(x2, 0, SCREEN_WIDTH - 1);
       y2 = constrain(y2, 0, SCREEN_HEIGHT - 1);
 
-      _display->drawLine(x1, y1, x2, y2);
+      if (bandHits(min(y1, y2), max(y1, y2) + 1)) _display->drawLine(x1, y1, x2, y2);
     }
 
     // Mouth for scared emotion
-    int mouthX = SCREEN_WIDTH / 2 + _currentState[0].xOffset; // Use _currentState.xOffset
-    int mouthY = _eyeCenterY[0] + (EYE_HEIGHT / 2) + 12 + _currentState[0].yOffset; // Use _currentState.yOffset
-    int mouthW = 10; // Small circular mouth
-    _display->drawDisc(mouthX, mouthY, mouthW / 2);
+    int mouthX = SCREEN_WIDTH / 2 + EYE_COORD_TO_FLOAT(_currentState[0].xOffset); // Use _currentState.xOffset
+    int mouthY = EYE_CENTER_Y + (EYE_HEIGHT / 2) + layoutPx(12) + EYE_COORD_TO_FLOAT(_currentState[0].yOffset); // Use _currentState.yOffset
+    int mouthW = layoutPx(10); // Small circular mouth
+    if (!_rightDisplay && bandHits(mouthY - mouthW / 2, mouthY + mouthW / 2 + 1)) _display->drawDisc(mouthX, mouthY, mouthW / 2);
   } else if (_currentEmotion == SLEEP) {
     _display->setDrawColor(1); // Ensure white for mouth and bubbles
     int mouthX = SCREEN_WIDTH / 2;
-    int mouthY = 58 + _vibrateYOffset; // Position below the eyes
+    int mouthY = LAYOUT_ORIGIN_Y + layoutPx(58) + _vibrateYOffset; // Position below the eyes
     int mouthW, mouthH;
 
     if (_sleepMouthState == SLEEP_MOUTH_UNSHAPED) {
-      mouthW = 20; // Unshaped (more circular)
-      mouthH = 8;
+      mouthW = layoutPx(20); // Unshaped (more circular)
+      mouthH = layoutPx(8);
     } else { // SLEEP_MOUTH_OVAL
-      mouthW = 28; // Oval (wider, shallower)
-      mouthH = 6;
+      mouthW = layoutPx(28); // Oval (wider, shallower)
+      mouthH = layoutPx(6);
     }
     drawMouth(mouthX, mouthY, mouthW, mouthH);
 
     // Draw "sleep bubbles" near the mouth
-    _display->drawCircle(mouthX + 15, mouthY - 10, 8); // Main bubble
-    _display->drawCircle(mouthX + 25, mouthY - 20, 4); // Smaller bubble trailing
+    int bubbleY = mouthY - layoutPx(10);
+    if (bandHits(bubbleY - layoutPx(8), bubbleY + layoutPx(8) + 1)) {
+      _display->drawCircle(mouthX + layoutPx(15), bubbleY, layoutPx(8)); // Main bubble
+    }
+    bubbleY = mouthY - layoutPx(20);
+    if (bandHits(bubbleY - layoutPx(4), bubbleY + layoutPx(4) + 1)) {
+      _display->drawCircle(mouthX + layoutPx(25), bubbleY, layoutPx(4)); // Smaller bubble trailing
+    }
+  }
+}
+
+// --- Display Flush ---
+void RideBuddyEyes::setFrameInterval(uint16_t interval) { _frameInterval = interval; }
+
+void RideBuddyEyes::setPartialFlush(bool enabled) {
+  _partialFlush = enabled && (_sentBuffer || !_display); // begin() allocates the shadow buffer
+  _sentBufferValid = false;
+  _fingerprintValid = false;
+}
+
+void RideBuddyEyes::forceFullFlush() {
+  _sentBufferValid = false;
+  _fingerprintValid = false;
+  _clipInBuffer = nullptr; // Someone else may have drawn into the buffer
+}
+
+// Brings the display buffer to the given clip frame. Only the tiles the
+// decoder touches are marked dirty, so the flush can skip its diff pass.
+void RideBuddyEyes::drawClipFrame(const uint8_t* clip, uint8_t frame) {
+  if (clip != _clipInBuffer) {
+    _clipInBuffer = clip;
+    _clipFrameInBuffer = -1;
+  }
+  _clipFrameInBuffer = clipSeek(_clipPrefetch.source(clip, frame), _clipFrameInBuffer, frame, _display->getBufferPtr(), _dirtyTiles);
+  _dirtyTilesKnown = true;
+}
+
+// Compares a freshly rendered buffer against the last one sent and marks
+// every 8x8 tile that differs.
+void RideBuddyEyes::markDirtyTiles(const uint8_t* buffer, const uint8_t* sent) {
+  for (uint8_t ty = 0; ty < DISPLAY_TILE_ROWS; ty++) {
+    uint16_t offset = ty * SCREEN_WIDTH;
+    for (uint8_t tx = 0; tx < DISPLAY_TILE_COLS; tx++, offset += 8) {
+      if (memcmp(&buffer[offset], &sent[offset], 8) != 0) {
+        _dirtyTiles[ty] |= (uint16_t)1 << tx;
+      }
+    }
+  }
+}
+
+// Pushes only the changed tiles to the panel. Each run of adjacent dirty
+// tiles in a page becomes one updateDisplayArea() call, so a moving mouth
+// costs a few dozen bytes instead of the whole 1 KB buffer. With the display
+// task running, the changed tiles are only staged in _sentBuffer and the
+// task sends them while the next frame renders. In dual-display mode each
+// panel has its own buffer and its own part of _sentBuffer, and goes
+// through the same steps.
+void RideBuddyEyes::flushDisplay() {
+  unsigned long flushStart = micros();
+  U8G2* panels[2] = {_display, _rightDisplay};
+  uint8_t panelCount = _rightDisplay ? 2 : 1;
+  uint16_t bytesSent = 0;
+  bool async = false;
+#if RIDEBUDDY_DISPLAY_TASK
+  if (_displayTasks[0].handle) {
+    for (uint8_t p = 0; p < panelCount; p++) {
+      xSemaphoreTake(_displayTasks[p].flushIdle, portMAX_DELAY); // The tasks may still be streaming the last frame
+    }
+    async = true;
+  }
+#endif
+
+  bool fullSend = !_partialFlush || !_sentBufferValid;
+  for (uint8_t p = 0; p < panelCount; p++) {
+    U8G2* panel = panels[p];
+    const uint8_t* buffer = panel->getBufferPtr();
+    uint8_t* sent = _sentBuffer ? &_sentBuffer[p * DISPLAY_BUFFER_SIZE] : nullptr;
+    if (fullSend && !async) {
+      panel->sendBuffer();
+      if (_partialFlush) memcpy(sent, buffer, DISPLAY_BUFFER_SIZE);
+      memset(_dirtyTiles, 0, sizeof(_dirtyTiles));
+      bytesSent += DISPLAY_BUFFER_SIZE;
+      continue;
+    }
+    if (fullSend) memset(_dirtyTiles, 0xFF, sizeof(_dirtyTiles));
+    else if (!_dirtyTilesKnown) markDirtyTiles(buffer, sent);
+    for (uint8_t ty = 0; ty < DISPLAY_TILE_ROWS; ty++) {
+      uint16_t mask = _dirtyTiles[ty];
+#if RIDEBUDDY_DISPLAY_TASK
+      _displayTasks[p].pendingTiles[ty] = mask;
+#endif
+      uint8_t tx = 0;
+      while (mask) {
+        while (!(mask & 1)) { mask >>= 1; tx++; }
+        uint8_t tw = 0;
+        while (mask & 1) { mask >>= 1; tw++; }
+        if (!async) panel->updateDisplayArea(tx, ty, tw, 1);
+        uint16_t offset = ty * SCREEN_WIDTH + tx * 8;
+        memcpy(&sent[offset], &buffer[offset], tw * 8);
+        bytesSent += tw * 8;
+        tx += tw;
+      }
+      _dirtyTiles[ty] = 0;
+    }
+  }
+  _dirtyTilesKnown = false;
+  _sentBufferValid = _partialFlush;
 
-    // Right eye is eye index 1
-    int right_eye_x = _eyeCenterX[1] + _currentState[1].xOffset + _vibrateXOffset;
-    int right_eye_y = _eyeCenterY[1] + _currentState[1].yOffset + _vibrateYOffset;
-    int right_eye_w = _currentState[1].width;
-    int right_eye_h = _currentState[1].height;
+  _lastFrameBytesSent = bytesSent;
+  _totalBytesSent += bytesSent;
+  if (bytesSent == 0) _framesElided++; // Rendered, but identical to what the panel shows
+#if RIDEBUDDY_DISPLAY_TASK
+  for (uint8_t p = 0; p < panelCount && async; p++) {
+    xSemaphoreGive(bytesSent ? _displayTasks[p].flushRequest : _displayTasks[p].flushIdle);
+  }
+#endif
+
+  _frameFlushMicros = micros() - flushStart;
+  _stats.flushMicros += _frameFlushMicros;
+  if (_frameFlushMicros > _stats.flushMicrosMax) _stats.flushMicrosMax = _frameFlushMicros;
+  _stats.bytesSent += bytesSent;
+}
+
+// --- Page-Buffer Rendering ---
+// With a U8g2 page-buffer constructor only one band of pages is in RAM:
+// 128 bytes with "_1_", 256 with "_2_". The frame is drawn once per band;
+// drawEyes() culls whatever lies outside the band and clip frames decode
+// only the band's rows, so all bands together cost about one full-buffer
+// frame. Each frame sends the whole panel, as there is nothing to diff against.
+void RideBuddyEyes::renderPages() {
+  const uint8_t bandPages = _display->getBufferTileHeight();
+  bool more;
+  _display->firstPage();
+  do {
+    _bandTop = _display->getBufferCurrTileRow() * 8;
+    _bandBottom = _bandTop + bandPages * 8;
+    drawEyes();
+    unsigned long sendStart = micros();
+    more = _display->nextPage();
+    _frameFlushMicros += micros() - sendStart;
+  } while (more);
+  _bandTop = 0;
+  _bandBottom = SCREEN_HEIGHT;
+
+  _lastFrameBytesSent = DISPLAY_BUFFER_SIZE;
+  _totalBytesSent += DISPLAY_BUFFER_SIZE;
+  _stats.flushMicros += _frameFlushMicros;
+  if (_frameFlushMicros > _stats.flushMicrosMax) _stats.flushMicrosMax = _frameFlushMicros;
+  _stats.bytesSent += DISPLAY_BUFFER_SIZE;
+}
+
+// --- Display Task ---
+#if RIDEBUDDY_DISPLAY_TASK
+// Sends the runs of dirty tiles in `mask`, one page of tile columns
+static void sendTileRuns(u8x8_t* u8x8, uint8_t ty, uint16_t mask, const uint8_t* sent) {
+  uint8_t tx = 0;
+  while (mask) {
+    while (!(mask & 1)) { mask >>= 1; tx++; }
+    uint8_t tw = 0;
+    while (mask & 1) { mask >>= 1; tw++; }
+    u8x8_DrawTile(u8x8, tx, ty, tw, (uint8_t*)&sent[ty * SCREEN_WIDTH + tx * 8]);
+    tx += tw;
+  }
+}
 
+// Sends the tiles flushDisplay() staged in this panel's part of
+// _sentBuffer, through the u8x8 layer so the U8g2 buffer on the other core
+// is never touched.
+void RideBuddyEyes::displayTaskMain(void* arg) {
+  DisplayTask* task = (DisplayTask*)arg;
+  RideBuddyEyes* eyes = task->eyes;
+  u8x8_t* u8x8 = task->display->getU8x8();
+  for (;;) {
+    xSemaphoreTake(task->flushRequest, portMAX_DELAY);
+    if (eyes->_displayTaskStop) break;
+    for (uint8_t ty = 0; ty < DISPLAY_TILE_ROWS; ty++) sendTileRuns(u8x8, ty, task->pendingTiles[ty], task->sent);
+    u8x8_RefreshDisplay(u8x8);
+    xSemaphoreGive(task->flushIdle);
   }
+  xSemaphoreGive(task->flushIdle); // Acknowledge the stop request
+  vTaskDelete(NULL);
+}
+#endif
+
+bool RideBuddyEyes::beginDisplayTask(uint8_t core) {
+#if RIDEBUDDY_DISPLAY_TASK
+  if (_displayTasks[0].handle) return true;
+  // The tasks stream whole 8x8 tiles out of _sentBuffer, so they need the full buffer layout
+  if (!_display || !_sentBuffer || _display->getBufferTileWidth() != DISPLAY_TILE_COLS || _display->getBufferTileHeight() != DISPLAY_TILE_ROWS) return false;
+  static const char* const names[2] = {"eyes_display", "eyes_display_r"};
+  uint8_t panelCount = _rightDisplay ? 2 : 1;
+  _displayTaskStop = false;
+  for (uint8_t p = 0; p < panelCount; p++) {
+    DisplayTask& task = _displayTasks[p];
+    task.eyes = this;
+    task.display = p ? _rightDisplay : _display;
+    task.sent = &_sentBuffer[p * DISPLAY_BUFFER_SIZE];
+    memset(task.pendingTiles, 0, sizeof(task.pendingTiles));
+    task.flushRequest = xSemaphoreCreateBinary();
+    task.flushIdle = xSemaphoreCreateBinary();
+    if (task.flushRequest && task.flushIdle) {
+      xSemaphoreGive(task.flushIdle);
+      if (xTaskCreatePinnedToCore(displayTaskMain, names[p], DISPLAY_TASK_STACK_SIZE, &task,
+                                  DISPLAY_TASK_PRIORITY, &task.handle, core) == pdPASS) {
+        continue;
+      }
+    }
+    if (task.flushRequest) vSemaphoreDelete(task.flushRequest);
+    if (task.flushIdle) vSemaphoreDelete(task.flushIdle);
+    task.handle = nullptr;
+    task.flushRequest = nullptr;
+    task.flushIdle = nullptr;
+    endDisplayTask(); // Stops the left panel's task if the right one failed
+    return false;
+  }
+  return true;
+#else
+  (void)core;
+  return false;
+#endif
+}
+
+void RideBuddyEyes::endDisplayTask() {
+#if RIDEBUDDY_DISPLAY_TASK
+  for (uint8_t p = 0; p < 2; p++) {
+    DisplayTask& task = _displayTasks[p];
+    if (!task.handle) continue;
+    xSemaphoreTake(task.flushIdle, portMAX_DELAY);
+    _displayTaskStop = true;
+    xSemaphoreGive(task.flushRequest);
+    xSemaphoreTake(task.flushIdle, portMAX_DELAY); // Task has stopped
+    vSemaphoreDelete(task.flushRequest);
+    vSemaphoreDelete(task.flushIdle);
+    task.handle = nullptr;
+    task.flushRequest = nullptr;
+    task.flushIdle = nullptr;
+  }
+  _displayTaskStop = false;
+#endif
+}
+
+void RideBuddyEyes::waitForFlush() {
+#if RIDEBUDDY_DISPLAY_TASK
+  for (uint8_t p = 0; p < 2; p++) {
+    if (!_displayTasks[p].handle) continue;
+    xSemaphoreTake(_displayTasks[p].flushIdle, portMAX_DELAY);
+    xSemaphoreGive(_displayTasks[p].flushIdle);
+  }
+#endif
+}
 
-  _display->sendBuffer(); // Update display once for procedural emotions
+// Horizontal centre of eye i at rest: its place in the face, or the middle
+// of its own panel in dual-display mode
+float RideBuddyEyes::eyeCenter(uint8_t i) const {
+  return _rightDisplay ? SCREEN_WIDTH / 2 : eyeCenterX[i];
 }
 
 void RideBuddyEyes::drawOneEye(uint8_t i, Emotion emotion) {
-    float x = _eyeCenterX[i] + _currentState[i].xOffset;
-    float y = _eyeCenterY[i] + _currentState[i].yOffset;
-    float w = _currentState[i].width;
-    float h = _currentState[i].height;
+    float x = eyeCenter(i) + EYE_COORD_TO_FLOAT(_currentState[i].xOffset);
+    float y = EYE_CENTER_Y + EYE_COORD_TO_FLOAT(_currentState[i].yOffset);
+    if (emotion == ANGRY || emotion == LOVE) { // Only drawn in place of the stills, which tremble
+      x += _vibrateXOffset;
+      y += _vibrateYOffset;
+    }
+    float w = EYE_COORD_TO_FLOAT(_currentState[i].width);
+    float h = EYE_COORD_TO_FLOAT(_currentState[i].height);
+    uint8_t* buffer = _display->getBufferPtr();
+    int halfExtent = (int)(max(w, h) / 2) + 1; // Round shapes reach w / 2 from the centre
+    if (!bandHits(y - halfExtent, y + halfExtent)) return;
 
     _display->setDrawColor(1); // Ensure drawing in white by default for eyes
 
     switch (emotion) {
-      case ANGRY: {
-        // ANGRY emotion is now handled as a bitmap display in drawEyes()
-        break;
-      }
       case BLINK: {
         _display->drawHLine(x - w/2, y, w);
         break;
       }
-      case SHY: {
-        // SHY emotion is now handled as a bitmap animation in drawEyes()
-        break;
-      }
-      case DRIVING: {
-        // DRIVING emotion is now handled as a bitmap animation in drawEyes()
-        break;
-      }
       case SLEEP: {
         // "U" Shape Logic
         int radius = w / 2;
         if (radius < 2) radius = 2; // Safety check
-        int thickness = 3; // How thick the U line is
+        int thickness = layoutPx(3); // How thick the U line is
+
+        EyeSpriteKey key = {EYE_SPRITE_SLEEP_U, (uint8_t)(radius * 2 + 1), (uint8_t)(radius * 2 + 1), (uint8_t)radius};
+        int16_t left = (int16_t)x - radius;
+        int16_t top = (int16_t)y - radius;
+        if (_spriteCache.draw(buffer, key, left, top)) break;
+        bool capture = _spriteCache.canCapture(buffer, key, left, top);
 
         _display->setDrawColor(1); // Draw white for the outer disc
         _display->drawDisc(x, y, radius);
@@ -553,13 +1129,21 @@ void RideBuddyEyes::drawOneEye(uint8_t i, Emotion emotion) {
         _display->setDrawColor(0); // Draw black for the box to cut into U shape
         _display->drawBox(x - radius, y - radius, radius * 2 + 1, radius + 1);
         _display->setDrawColor(1); // Reset to white for subsequent drawings
+
+        if (capture) _spriteCache.store(buffer, key, left, top);
         break;
       }
       case SCARED: {
         int outer_radius = w / 2;
-        int inner_radius = outer_radius - 2; // Make inner circle slightly smaller
+        int inner_radius = outer_radius - layoutPx(2); // Make inner circle slightly smaller
         if (inner_radius < 1) inner_radius = 1; // Safety check
 
+        EyeSpriteKey key = {EYE_SPRITE_SCARED, (uint8_t)(outer_radius * 2 + 1), (uint8_t)(outer_radius * 2 + 1), (uint8_t)outer_radius};
+        int16_t left = (int16_t)x - outer_radius;
+        int16_t top = (int16_t)y - outer_radius;
+        if (_spriteCache.draw(buffer, key, left, top)) break;
+        bool capture = _spriteCache.canCapture(buffer, key, left, top);
+
         _display->setDrawColor(1); // Draw white outer circle
         _display->drawDisc(x, y, outer_radius); 
         
@@ -568,6 +1152,8 @@ void RideBuddyEyes::drawOneEye(uint8_t i, Emotion emotion) {
         
         _display->setDrawColor(1); // Draw white pupil
         _display->drawDisc(x, y, inner_radius / 2); 
+
+        if (capture) _spriteCache.store(buffer, key, left, top);
         break;
       }
       default: { // NEUTRAL, DISTRACTED, etc.
@@ -576,9 +1162,62 @@ void RideBuddyEyes::drawOneEye(uint8_t i, Emotion emotion) {
         currentRadius = min(currentRadius, (int)(h / 2.0));
         currentRadius = min(currentRadius, (int)(w / 2.0));
         if (currentRadius < 0) currentRadius = 0; 
-        
-        _display->drawRBox(x - w / 2, y - h / 2, w, h, currentRadius);
+
+        EyeSpriteKey key = {EYE_SPRITE_RBOX, (uint8_t)w, (uint8_t)h, (uint8_t)currentRadius};
+        int16_t left = (int16_t)(x - w / 2);
+        int16_t top = (int16_t)(y - h / 2);
+        if (!_spriteCache.draw(buffer, key, left, top)) {
+          bool capture = _spriteCache.canCapture(buffer, key, left, top);
+          _display->drawRBox(x - w / 2, y - h / 2, w, h, currentRadius);
+          if (capture) _spriteCache.store(buffer, key, left, top); // Before the lids cut into it
+        }
+        drawEyelids(i, x, y, w, h);
         break;
       }
     }
-}
\ No newline at end of file
+}
+
+// Cuts the lids out of a freshly drawn eye, one vertical span per column
+// above the upper lid and one below the lower lid. The upper lid is a
+// straight line, tilted towards the nose; the lower one a parabola.
+void RideBuddyEyes::drawEyelids(uint8_t i, float x, float y, float w, float h) {
+  const EyeState& s = _currentState[i];
+  float upper = EYE_COORD_TO_FLOAT(s.lidUpper);
+  float lower = EYE_COORD_TO_FLOAT(s.lidLower);
+  float tilt = EYE_COORD_TO_FLOAT(s.lidTilt);
+  float bend = EYE_COORD_TO_FLOAT(s.lidBend);
+  if (upper == 0 && lower == 0 && tilt == 0 && bend == 0) return; // Wide open: nothing to cut
+  int left = (int)(x - w / 2); // The columns and rows drawRBox() covered
+  int top = (int)(y - h / 2);
+  int width = (int)w;
+  int height = (int)h;
+  if (width < 1 || height < 1) return;
+
+  _display->setDrawColor(0);
+  for (int col = 0; col < width; col++) {
+    float u = (col + 0.5f) / width * 2 - 1; // -1 .. 1 across the eye
+    float inner = i == 0 ? u : -u;          // 1 at the corner next to the nose
+    int lidTop = (int)ceilf(upper + tilt * inner);
+    int lidBottom = height - (int)ceilf(lower + bend * (1 - u * u));
+    lidTop = constrain(lidTop, 0, height);
+    if (lidBottom < lidTop) lidBottom = lidTop; // Lids meet: the column is shut
+    if (lidTop > 0) _display->drawVLine(left + col, top, lidTop);
+    if (lidBottom < height) _display->drawVLine(left + col, top + lidBottom, height - lidBottom);
+  }
+  _display->setDrawColor(1);
+}
+
+// --- Statistics ---
+RideBuddyStats RideBuddyEyes::stats() const {
+  RideBuddyStats snapshot = _stats;
+  snapshot.emotionMillis[_currentEmotion] += millis() - _emotionSince; // Include the current stretch
+  return snapshot;
+}
+
+void RideBuddyEyes::resetStats() {
+  memset(&_stats, 0, sizeof(_stats));
+  _emotionSince = millis();
+}
+
+// --- Eye Sprite Cache ---
+void RideBuddyEyes::setSpriteCacheSize(uint16_t bytes) { _spriteCache.setBudget(_pageMode ? 0 : bytes); } // Blits need the full buffer
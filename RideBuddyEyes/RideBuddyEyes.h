@@ -9,23 +9,101 @@
 #include "Arduino.h"
 #include <Wire.h>
 #include <U8g2lib.h>
-#include <Adafruit_MPU6050.h>
-#include <Adafruit_Sensor.h>
+#include "RideBuddySprites.h"
+#include "RideBuddyAnim.h"
+#include "RideBuddyClip.h"
+#include "RideBuddyPack.h"
+
+// --- Display Task Support ---
+// Flushing from a FreeRTOS task on the other core needs the ESP32 Arduino core
+#ifndef RIDEBUDDY_DISPLAY_TASK
+#if defined(ARDUINO_ARCH_ESP32)
+#define RIDEBUDDY_DISPLAY_TASK 1
+#else
+#define RIDEBUDDY_DISPLAY_TASK 0
+#endif
+#endif
+
+#if RIDEBUDDY_DISPLAY_TASK
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#endif
+
+// --- Panel Geometry ---
+// Fixed at compile time, so other panels cost nothing at runtime. Build with
+// -DRIDEBUDDY_PANEL_HEIGHT=32 for a 128x32 SSD1306 or =128 for a 128x128
+// SSD1327; the default is the 128x64 SH1106.
+#ifndef RIDEBUDDY_PANEL_HEIGHT
+#define RIDEBUDDY_PANEL_HEIGHT 64
+#endif
+#if RIDEBUDDY_PANEL_HEIGHT != 32 && RIDEBUDDY_PANEL_HEIGHT != 64 && RIDEBUDDY_PANEL_HEIGHT != 128
+#error "RIDEBUDDY_PANEL_HEIGHT must be 32, 64 or 128"
+#endif
+
+// --- Procedural Moods ---
+// HAPPY, CRY and SHY are bitmap clips by default. Build with
+// -DRIDEBUDDY_PROCEDURAL_MOODS=1 to draw them with eyelids instead (see
+// EyeState): a few dozen bytes of parameters in place of ~15 KB of clips,
+// and they tween in and out of the other procedural emotions. A registered
+// clip still takes precedence.
+#ifndef RIDEBUDDY_PROCEDURAL_MOODS
+#define RIDEBUDDY_PROCEDURAL_MOODS 0
+#endif
+
+// --- Built-in Clips ---
+// Build with -DRIDEBUDDY_BUILTIN_CLIPS=0 to leave the CRY, SHY, DRIVING,
+// HAPPY and BATTERY clips out of the firmware and load them from a ClipPack
+// (RideBuddyPack.h) instead. Without a pack, DRIVING and BATTERY draw plain
+// eyes and HAPPY, CRY and SHY their eyelid looks.
+#ifndef RIDEBUDDY_BUILTIN_CLIPS
+#define RIDEBUDDY_BUILTIN_CLIPS 1
+#endif
 
 // --- Core Definitions ---
 #define SCREEN_WIDTH 128
-#define SCREEN_HEIGHT 64
+#define SCREEN_HEIGHT RIDEBUDDY_PANEL_HEIGHT
+
+// --- Face Layout ---
+// The face is laid out on a 128x64 canvas, shrunk to fit smaller panels and
+// centred on larger ones (a 32 px band above and below on 128x128). clipenc
+// -g fits the bitmap clips the same way. All constexpr.
+#define LAYOUT_SHRINK (SCREEN_HEIGHT < 64 ? 2 : 1)
+constexpr int layoutPx(int px) { return px / LAYOUT_SHRINK; }
+#define LAYOUT_ORIGIN_X ((SCREEN_WIDTH - layoutPx(128)) / 2)
+#define LAYOUT_ORIGIN_Y ((SCREEN_HEIGHT - layoutPx(64)) / 2)
+#define EYE_CENTER_LEFT_X (LAYOUT_ORIGIN_X + layoutPx(32))
+#define EYE_CENTER_RIGHT_X (LAYOUT_ORIGIN_X + layoutPx(96))
+#define EYE_CENTER_Y (LAYOUT_ORIGIN_Y + layoutPx(24))
+
+// --- Display Buffer Layout (U8g2 full buffer: 8-row pages, 8x8 tiles) ---
+#define DISPLAY_TILE_COLS (SCREEN_WIDTH / 8)
+#define DISPLAY_TILE_ROWS (SCREEN_HEIGHT / 8)
+#define DISPLAY_BUFFER_SIZE (SCREEN_WIDTH * DISPLAY_TILE_ROWS)
 
 // --- Hardware Pins ---
 #define TOUCH_PIN 27
 
 // --- Eye Geometry ---
-#define EYE_WIDTH 38
-#define EYE_HEIGHT 42
-#define EYE_CORNER_RADIUS 12
+#define EYE_WIDTH layoutPx(38)
+#define EYE_HEIGHT layoutPx(42)
+#define EYE_CORNER_RADIUS layoutPx(12)
+
+// --- Display Task ---
+#define DISPLAY_TASK_CORE 0          // loop() runs on core 1 in the ESP32 Arduino core
+#define DISPLAY_TASK_PRIORITY 1
+#define DISPLAY_TASK_STACK_SIZE 2048
+
+// --- Eye Sprite Cache ---
+#define EYE_SPRITE_CACHE_BYTES (4 * EYE_SPRITE_SLOT_BYTES) // Default RAM budget, 4 sprites
+
+// --- Clip Prefetch ---
+#define CLIP_PREFETCH_BYTES 0        // Default RAM budget for the clip on screen; 0 reads clips from flash
+#define CLIP_PREFETCH_CHUNK_BYTES 1024 // Copied per update() while a clip is being prefetched
 
 // --- Animation Timings & Parameters ---
 #define FRAME_INTERVAL 50 // 20 FPS
+#define EMOTION_FADE_FRAMES 4 // Cross-fade to and from bitmap emotions, in frames
 #define BLINK_DURATION 150 
 #define AUTO_BLINK_MIN_INTERVAL 2500
 #define AUTO_BLINK_MAX_INTERVAL 7000
@@ -49,33 +127,84 @@ enum Emotion {
   SLEEP,
   BATTERY
 };
+#define EMOTION_COUNT (BATTERY + 1)
+#define CUSTOM_EMOTION_COUNT 4 // Extra emotion ids for clips registered at runtime
+#define CUSTOM_EMOTION(n) ((Emotion)(EMOTION_COUNT + (n)))
+#define EMOTION_SLOTS (EMOTION_COUNT + CUSTOM_EMOTION_COUNT)
 
-// --- Distracted Emotion Phases ---
-enum DistractedPhase {
-  DISTRACTED_INIT,
-  DISTRACTED_LEFT_ANIM,
-  DISTRACTED_LEFT_HOLD,
-  DISTRACTED_RETURN_TO_NEUTRAL_FROM_LEFT,
-  DISTRACTED_NEUTRAL_HOLD_BETWEEN_SIDES,
-  DISTRACTED_RIGHT_ANIM,
-  DISTRACTED_RIGHT_HOLD,
-  DISTRACTED_RETURN_TO_NEUTRAL_FROM_RIGHT,
-  DISTRACTED_NEUTRAL_WAIT_BEFORE_FIRST_ANIM
+// --- Data Structures ---
+struct EyeState { // Float or Q8.8, see RideBuddyAnim.h
+  eye_coord_t xOffset;
+  eye_coord_t yOffset;
+  eye_coord_t width;
+  eye_coord_t height;
+  // Eyelids, cut out of the rounded eye in px; all 0 is a wide-open eye
+  eye_coord_t lidUpper; // Upper lid closed this far down from the top, mid-eye
+  eye_coord_t lidLower; // Lower lid closed this far up from the bottom at the corners
+  eye_coord_t lidTilt;  // Upper lid this much lower at the inner corner, higher at the outer; < 0 looks sad
+  eye_coord_t lidBend;  // Lower lid arched this much higher mid-eye; > 0 gives the smiling "^" eye
 };
+// TweenPool tweens an EyeState as one run of adjacent values
+#define EYE_STATE_FIELDS 8
+static_assert(sizeof(EyeState) == EYE_STATE_FIELDS * sizeof(eye_coord_t), "EyeState must be a plain run of coordinates");
 
-// --- Data Structures ---
-struct EyeState {
-  float xOffset;
-  float yOffset;
-  float width;
-  float height;
+// --- Keyframe Timelines ---
+// Multi-step looks (the distracted look-around, scared darting, idle
+// glances) are constant keyframe tables played by one sequencer. Each
+// keyframe tweens both eyes to its targets; the next keyframe starts
+// `dwell` ms after this one did, so dwell - duration is the hold.
+#define KEYFRAME_KEEP_SIZE 0x01 // Tween the position only; size tweens carry on
+#define TIMELINE_NO_LOOP 0xFF
+
+struct EyeKeyframe {
+  EyeState target[2];  // Left and right eye
+  uint16_t duration;   // Tween length (ms)
+  uint16_t dwell;      // ms until the next keyframe starts
+  uint16_t dwellMax;   // If above dwell, the dwell is random in [dwell, dwellMax)
+  int8_t jitterX;      // Random offset added to both targets, -jitter .. +jitter px
+  int8_t jitterY;
+  AnimCurve curve;
+  uint8_t flags;       // KEYFRAME_*
+};
+
+struct EyeTimeline {
+  const EyeKeyframe* keyframes;
+  uint8_t count;
+  uint8_t loopTo;      // Keyframe that follows the last one, or TIMELINE_NO_LOOP
+};
+
+// --- Runtime Statistics ---
+// Cheap enough to stay enabled in production: a few counters and two
+// micros() reads per rendered frame.
+struct RideBuddyStats {
+  uint32_t framesRendered;    // Frames drawn and flushed
+  uint32_t framesSkipped;     // Frames not drawn because nothing visible changed
+  uint32_t framesLate;        // Frames that started a whole frame interval or more after they were due
+  uint64_t renderMicros;      // Drawing time, excluding the flush
+  uint32_t renderMicrosMax;
+  uint64_t flushMicros;       // Transfer time (staging time with the display task)
+  uint32_t flushMicrosMax;
+  uint32_t bytesSent;
+  uint32_t clipFramesDropped; // Clip frames skipped to stay on time (CLIP_DROP_FRAMES)
+  uint32_t clipFramesFromRam; // Clip frames decoded from the prefetched copy
+  uint32_t emotionMillis[EMOTION_SLOTS]; // Time spent in each emotion
 };
 
 class RideBuddyEyes {
   public:
     RideBuddyEyes();
+    ~RideBuddyEyes();
     void begin(U8G2* display, int sda_pin, int scl_pin);
+    // Dual-display mode: one panel per eye, each drawn in the middle of its
+    // panel. There is no mouth, and clips and stills give way to the
+    // procedural looks. Both need full-buffer (_F_) constructors on their
+    // own bus or address; the right one's bus is set up by the sketch.
+    void begin(U8G2* leftDisplay, U8G2* rightDisplay, int sda_pin, int scl_pin);
     void update();
+
+    // --- Frame Scheduling ---
+    unsigned long nextFrameDue() const; // millis() at which update() next has work to do
+    unsigned long msUntilNextFrame() const; // 0 if a frame is due now
     
     // --- Emotion API ---
     void setEmotion(Emotion emotion);
@@ -92,42 +221,137 @@ class RideBuddyEyes {
     void scared();
     void battery();
 
+    // --- Clip Registry (shared by all instances) ---
+    // Plays `clip` full-screen for `emotion`, a built-in one or
+    // CUSTOM_EMOTION(n); nullptr restores the built-in look. The clip must
+    // stay valid while registered.
+    static bool registerClip(Emotion emotion, const AnimationClip* clip);
+    static const AnimationClip* registeredClip(Emotion emotion); // nullptr if none
+    // Clips follow the clock and drop frames they had no update for (default),
+    // or CLIP_NEVER_SKIP to show every frame, slowing down instead.
+    void setClipFramePolicy(ClipFramePolicy policy) { _clipPlayer.setFramePolicy(policy); }
+    // RAM for a copy of the clip on screen, so its frames decode without
+    // reading flash (default CLIP_PREFETCH_BYTES; 0 disables). Clips larger
+    // than the budget keep their first frames resident.
+    void setClipPrefetchBudget(uint16_t bytes) { _clipPrefetch.setBudget(bytes); }
+    uint8_t clipFramesResident() const { return _clipPlayer.clip() ? _clipPrefetch.residentFrames(_clipPlayer.clip()->data) : 0; }
+
+    // --- Display Flush API ---
+    void setFrameInterval(uint16_t interval); // Minimum ms between frames (default FRAME_INTERVAL)
+    void setPartialFlush(bool enabled);       // Send only changed tiles (default on)
+    void forceFullFlush();                    // Next frame sends the whole buffer
+    uint16_t lastFrameBytesSent() const { return _lastFrameBytesSent; }
+    uint32_t totalBytesSent() const { return _totalBytesSent; }
+    uint32_t framesElided() const { return _framesElided; } // Frames that sent nothing to the panel
+    void setTransitionFrames(uint8_t frames); // Cross-fade length, 0 = hard cut, at most 15
+
+    // --- Statistics API ---
+    RideBuddyStats stats() const;
+    void resetStats();
+
+    // --- Display Task API (dual-core ESP32) ---
+    bool beginDisplayTask(uint8_t core = DISPLAY_TASK_CORE); // Flush on a task pinned to core; false if unavailable
+    void endDisplayTask();
+    void waitForFlush(); // Blocks until the panels show the last rendered frame
+
+    // --- Eye Sprite Cache API ---
+    void setSpriteCacheSize(uint16_t bytes); // RAM budget in bytes, 0 disables
+    uint32_t spriteCacheHits() const { return _spriteCache.hits(); }
+    uint32_t spriteCacheMisses() const { return _spriteCache.misses(); }
+    void resetSpriteCacheStats() { _spriteCache.resetStats(); }
+
   private:
-    U8G2* _display;
-    Adafruit_MPU6050 _mpu;
-    int16_t _eyeCenterX[2];
-    int16_t _eyeCenterY[2];
+    U8G2* _display;      // Renders the face; the left panel in dual-display mode
+    U8G2* _rightDisplay; // Right panel in dual-display mode, else nullptr
+    uint8_t _drawPanel;  // Dual-display: panel, and so eye, drawEyes() is drawing
     Emotion _currentEmotion;
     Emotion _previousEmotion;
 
     unsigned long _lastFrameTime;
+    uint16_t _frameInterval;
+
+    // --- Display Flush State ---
+    uint8_t* _sentBuffer; // What the panels currently show, one buffer each; allocated by begin() for full-buffer displays
+    uint16_t _dirtyTiles[DISPLAY_TILE_ROWS];  // One bit per tile column, per page
+    bool _partialFlush;
+    bool _sentBufferValid;
+    uint16_t _lastFrameBytesSent;
+    uint32_t _totalBytesSent;
+    bool _dirtyTilesKnown; // Renderer already marked _dirtyTiles; skip the diff
+
+    // --- Statistics ---
+    RideBuddyStats _stats;
+    unsigned long _emotionSince;   // When _currentEmotion was entered
+    uint32_t _frameFlushMicros;    // Flush time of the frame being rendered
+
+    // --- Display Task State ---
+#if RIDEBUDDY_DISPLAY_TASK
+    struct DisplayTask { // One per panel, so both buses transfer at once
+      RideBuddyEyes* eyes;
+      U8G2* display;
+      const uint8_t* sent;             // This panel's part of _sentBuffer
+      uint16_t pendingTiles[DISPLAY_TILE_ROWS]; // Tiles of it the task still has to send
+      TaskHandle_t handle;
+      SemaphoreHandle_t flushRequest;  // Given by flushDisplay(), a frame is ready in _sentBuffer
+      SemaphoreHandle_t flushIdle;     // Given by the task, _sentBuffer may be written again
+    };
+    DisplayTask _displayTasks[2];
+    volatile bool _displayTaskStop;
+    static void displayTaskMain(void* arg);
+#endif
+
+    // --- Frame Change Detection ---
+    struct FrameFingerprint { // Everything drawEyes() reads; equal fingerprints draw equal frames
+      EyeState eyes[2];
+      int16_t clipFrame;
+      uint16_t clipGeneration; // Clip registry changes, e.g. a clip swapped at the same frame index
+      uint8_t emotion;
+      int8_t vibrateX;
+      int8_t vibrateY;
+      uint8_t sleepMouth;
+      uint8_t fadeStep;
+    };
+    FrameFingerprint _lastFingerprint;
+    bool _fingerprintValid;
+    uint32_t _framesElided;
+
+    // --- Emotion Cross-Fade State ---
+    uint8_t* _fadeFrom;   // Outgoing frame, allocated on first use
+    uint8_t _fadeFrames;
+    uint8_t _fadeStep;    // Blend being shown, 1 .. _fadeFrames; 0 when not fading
+
+    // --- Page Buffer State (U8g2 "_1_"/"_2_" constructors) ---
+    bool _pageMode;             // The display holds one band of pages at a time
+    int16_t _bandTop;           // Pixel rows [_bandTop, _bandBottom) of the band being
+    int16_t _bandBottom;        // drawn; the whole screen in full-buffer mode
+    ClipBandDecoder* _clipBand; // Allocated by begin() in page mode
+
+    // --- Clip Decoding State ---
+    const uint8_t* _clipInBuffer; // Clip whose frame the display buffer holds
+    int _clipFrameInBuffer;
+    ClipPrefetch _clipPrefetch;
+    uint16_t _clipUnregisterSeen;
+
+    // --- Eye Sprite Cache ---
+    EyeSpriteCache _spriteCache;
 
     // --- State Variables ---
     unsigned long _nextBlinkTime;
     unsigned long _blinkStartTime;
-    unsigned long _nextIdleActionTime;
-    unsigned long _idleActionEndTime;
-    bool _isIdleActionActive;
     int8_t _vibrateXOffset;
     int8_t _vibrateYOffset;
 
-    // --- Cry Animation State ---
-    int _cry_anim_currentFrame;
-    unsigned long _cry_anim_lastFrameTime;
-    int _shy_anim_currentFrame;
-    unsigned long _shy_anim_lastFrameTime;
-    int _driving_anim_currentFrame;
-    unsigned long _driving_anim_lastFrameTime;
-    // --- Happy Animation State ---
-    int _happy_anim_currentFrame;
-    unsigned long _happy_anim_lastFrameTime;
-    // --- Battery Animation State ---
-    int _battery_anim_currentFrame;
-    unsigned long _battery_anim_lastFrameTime;
-
-    // --- Distracted Animation State ---
-    DistractedPhase _distractedPhase;
-    unsigned long _distractedPhaseStartTime;
+    // --- Clip Playback State ---
+    ClipPlayer _clipPlayer;
+
+    // --- Timeline State ---
+    struct TimelineCursor {
+      const EyeTimeline* timeline; // nullptr when nothing plays
+      uint8_t next;
+      unsigned long nextTime;      // millis() at which next starts
+    };
+    TimelineCursor _emotionTimeline; // DISTRACTED and SCARED
+    TimelineCursor _idleTimeline;    // NEUTRAL idle glances, kept across blinks
 
     // --- Sleep Animation State ---
     enum SleepMouthState { SLEEP_MOUTH_UNSHAPED, SLEEP_MOUTH_OVAL };
@@ -138,21 +362,34 @@ class RideBuddyEyes {
 
     // --- Animation System State ---
     EyeState _currentState[2];
-    EyeState _startState[2];
-    EyeState _targetState[2];
-    unsigned long _animStartTime;
-    uint16_t _animDuration;
+    TweenPool _tweens; // Drives the fields of _currentState
 
     // --- Private Methods ---
     void updateAnimation();
-    void startAnimation(const EyeState& target, uint16_t duration);
-    void startAnimation(const EyeState& targetLeft, const EyeState& targetRight, uint16_t duration);
-    float easeInOut(float t);
+    void startAnimation(const EyeState& target, uint16_t duration, AnimCurve curve = ANIM_CURVE_CUBIC_IN_OUT);
+    void startAnimation(const EyeState& targetLeft, const EyeState& targetRight, uint16_t duration,
+                        AnimCurve curve = ANIM_CURVE_CUBIC_IN_OUT, bool keepSize = false);
+    void endBlink();
+    void playTimeline(TimelineCursor& cursor, const EyeTimeline* timeline, unsigned long startTime);
+    void stepTimeline(TimelineCursor& cursor, unsigned long currentTime);
+    int advanceClip(unsigned long currentTime);
+    bool frameChanged(int clipFrame);
+    void startFade();
+    void applyFade();
+    const AnimationClip* shownClip(Emotion emotion) const;
+    bool showsStill(Emotion emotion) const;
+    float eyeCenter(uint8_t i) const;
     void drawEyes();
     void drawOneEye(uint8_t i, Emotion emotion);
     void drawHeart(int x, int y, int size);
+    void drawEyelids(uint8_t i, float x, float y, float w, float h);
     void drawSleepZzz(int eye_x, int eye_y, int eye_w, int eye_h);
     void drawMouth(int x, int y, int w, int h);
+    void drawClipFrame(const uint8_t* clip, uint8_t frame);
+    void markDirtyTiles(const uint8_t* buffer, const uint8_t* sent);
+    void flushDisplay();
+    void renderPages();
+    bool bandHits(int top, int bottom) const { return bottom > _bandTop && top < _bandBottom; }
 };
 
 #endif
\ No newline at end of file
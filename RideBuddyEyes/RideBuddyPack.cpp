@@ -0,0 +1,196 @@
+#include "RideBuddyPack.h"
+#include "RideBuddyEyes.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <esp_partition.h>
+#include <esp_idf_version.h>
+#include <esp_heap_caps.h>
+#include <LittleFS.h>
+#if ESP_IDF_VERSION_MAJOR < 5
+#include <esp_spi_flash.h>
+#endif
+#elif defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CLIP_PACK_MMAP 1
+#endif
+
+static uint32_t readLe32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Bitwise CRC-32, no table: it runs once per open()
+uint32_t clipPackCrc32(const uint8_t* data, size_t size, uint32_t crc) {
+  crc = ~crc;
+  while (size--) {
+    crc ^= pgm_read_byte(data++);
+    for (uint8_t bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+  }
+  return ~crc;
+}
+
+ClipPack::ClipPack() {
+  _data = nullptr;
+  _size = 0;
+  _clips = nullptr;
+  _clipCount = 0;
+  _source = PACK_NONE;
+  _mapHandle = 0;
+}
+
+ClipPack::~ClipPack() { close(); }
+
+uint8_t ClipPack::emotion(uint8_t i) const {
+  return i < _clipCount ? pgm_read_byte(&_data[CLIP_PACK_HEADER_SIZE + i * CLIP_PACK_ENTRY_SIZE]) : 0;
+}
+
+// --- Validation ---
+// Checks the header, the CRC, every index entry and every frame of every
+// clip, then builds the clip table. On failure the mapping or copy is
+// released.
+bool ClipPack::attach(const uint8_t* data, size_t size, Source source) {
+  _data = data;
+  _size = size;
+  _source = source;
+  uint8_t header[CLIP_PACK_HEADER_SIZE] = {0};
+  for (uint8_t i = 0; i < CLIP_PACK_HEADER_SIZE && i < size; i++) header[i] = pgm_read_byte(&data[i]);
+  uint8_t count = header[3];
+  size_t indexEnd = CLIP_PACK_HEADER_SIZE + (size_t)count * CLIP_PACK_ENTRY_SIZE;
+  bool valid = size >= CLIP_PACK_HEADER_SIZE && header[0] == 'R' && header[1] == 'P' && header[2] == CLIP_PACK_VERSION &&
+               count > 0 && readLe32(&header[4]) == size && indexEnd <= size &&
+               clipPackCrc32(data + CLIP_PACK_HEADER_SIZE, size - CLIP_PACK_HEADER_SIZE) == readLe32(&header[8]);
+  if (valid) _clips = (AnimationClip*)malloc(count * sizeof(AnimationClip));
+  if (!_clips) {
+    release();
+    return false;
+  }
+
+  for (uint8_t i = 0; i < count; i++) {
+    uint8_t entry[CLIP_PACK_ENTRY_SIZE];
+    for (uint8_t b = 0; b < CLIP_PACK_ENTRY_SIZE; b++) entry[b] = pgm_read_byte(&data[CLIP_PACK_HEADER_SIZE + i * CLIP_PACK_ENTRY_SIZE + b]);
+    uint32_t offset = readLe32(&entry[4]);
+    uint32_t clipSize = readLe32(&entry[8]);
+    const uint8_t* clip = data + offset;
+    if (offset < indexEnd || clipSize < CLIP_HEADER_SIZE || clipSize > size || offset > size - clipSize ||
+        !clipFramesValid(clip, clipSize) || entry[1] > CLIP_HOLD_LAST) {
+      release();
+      return false;
+    }
+    _clips[i] = {clip, (uint16_t)(entry[2] | (entry[3] << 8)), (ClipLoopMode)entry[1]};
+  }
+  _clipCount = count;
+  return true;
+}
+
+uint8_t ClipPack::registerClips() const {
+  uint8_t accepted = 0;
+  for (uint8_t i = 0; i < _clipCount; i++) {
+    if (RideBuddyEyes::registerClip((Emotion)emotion(i), &_clips[i])) accepted++;
+  }
+  return accepted;
+}
+
+void ClipPack::close() {
+  // Eyes showing one of these clips fall back to the built-in look on their next update()
+  for (uint8_t i = 0; i < _clipCount; i++) {
+    Emotion e = (Emotion)emotion(i);
+    if (RideBuddyEyes::registeredClip(e) == &_clips[i]) RideBuddyEyes::registerClip(e, nullptr);
+  }
+  release();
+}
+
+void ClipPack::release() {
+  free(_clips);
+  _clips = nullptr;
+  _clipCount = 0;
+  switch (_source) {
+#if defined(ARDUINO_ARCH_ESP32)
+    case PACK_PARTITION:
+#if ESP_IDF_VERSION_MAJOR >= 5
+      esp_partition_munmap((esp_partition_mmap_handle_t)_mapHandle);
+#else
+      spi_flash_munmap((spi_flash_mmap_handle_t)_mapHandle);
+#endif
+      break;
+#endif
+#if CLIP_PACK_MMAP
+    case PACK_MAPPED_FILE: munmap((void*)_data, _size); break;
+#endif
+    case PACK_HEAP: free((void*)_data); break;
+    default: break;
+  }
+  _data = nullptr;
+  _size = 0;
+  _source = PACK_NONE;
+}
+
+// --- Sources ---
+bool ClipPack::openMemory(const uint8_t* data, size_t size) {
+  close();
+  return data && attach(data, size, PACK_MEMORY);
+}
+
+#if defined(ARDUINO_ARCH_ESP32)
+bool ClipPack::openPartition(const char* label) {
+  close();
+  const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+  uint8_t header[CLIP_PACK_HEADER_SIZE];
+  if (!partition || esp_partition_read(partition, 0, header, sizeof(header)) != ESP_OK) return false;
+  uint32_t size = readLe32(&header[4]);
+  if (header[0] != 'R' || header[1] != 'P' || size < CLIP_PACK_HEADER_SIZE || size > partition->size) return false;
+
+  const void* mapped = nullptr;
+#if ESP_IDF_VERSION_MAJOR >= 5
+  esp_partition_mmap_handle_t handle;
+  if (esp_partition_mmap(partition, 0, size, ESP_PARTITION_MMAP_DATA, &mapped, &handle) != ESP_OK) return false;
+#else
+  spi_flash_mmap_handle_t handle;
+  if (esp_partition_mmap(partition, 0, size, SPI_FLASH_MMAP_DATA, &mapped, &handle) != ESP_OK) return false;
+#endif
+  _mapHandle = (uint32_t)handle;
+  return attach((const uint8_t*)mapped, size, PACK_PARTITION);
+}
+
+bool ClipPack::openFile(const char* path) {
+  close();
+  File file = LittleFS.open(path, "r"); // LittleFS.begin() is up to the sketch
+  if (!file) return false;
+  size_t size = file.size();
+  uint8_t* data = (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!data) data = (uint8_t*)malloc(size);
+  bool read = data && file.read(data, size) == size;
+  file.close();
+  if (!read) {
+    free(data);
+    return false;
+  }
+  return attach(data, size, PACK_HEAP);
+}
+#else
+bool ClipPack::openPartition(const char* label) {
+  (void)label;
+  close();
+  return false; // No flash partitions off the ESP32
+}
+
+bool ClipPack::openFile(const char* path) {
+  close();
+#if CLIP_PACK_MMAP
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return false;
+  struct stat info;
+  void* mapped = MAP_FAILED;
+  if (fstat(fd, &info) == 0 && info.st_size > 0) mapped = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd); // The mapping keeps the file open
+  if (mapped == MAP_FAILED) return false;
+  return attach((const uint8_t*)mapped, info.st_size, PACK_MAPPED_FILE);
+#else
+  (void)path;
+  return false;
+#endif
+}
+#endif
@@ -0,0 +1,82 @@
+/*
+  RideBuddyPack.h - Clip packs: the bitmap clips as one file outside the firmware.
+  Released into the public domain.
+
+  A pack bundles clips (RideBuddyClip.h blobs) with the emotion each one
+  plays for, so animations can be changed by rewriting a data partition or
+  a file instead of reflashing the application:
+
+    Header (CLIP_PACK_HEADER_SIZE bytes, little endian)
+      [0..1]   'R', 'P'    magic
+      [2]      version     CLIP_PACK_VERSION
+      [3]      clip count
+      [4..7]   pack size   in bytes, header included
+      [8..11]  CRC-32      (IEEE 802.3) of every byte after the header
+      [12..15] reserved
+    Index: clip count x CLIP_PACK_ENTRY_SIZE bytes
+      [0]      emotion     Emotion id, CUSTOM_EMOTION(n) included
+      [1]      loop mode   ClipLoopMode
+      [2..3]   ms per frame
+      [4..7]   clip offset from pack start
+      [8..11]  clip size
+    Clip blobs
+
+  The pack is read in place wherever the platform can map it: a raw data
+  partition on the ESP32 is mapped into the flash cache, and a file on
+  Linux/macOS is mmap()ed, so clips cost no RAM. A file on LittleFS cannot
+  be mapped and is read into PSRAM (or the heap) once. Build packs with
+  extras/tools/clippack.
+*/
+#ifndef RideBuddyPack_h
+#define RideBuddyPack_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include "RideBuddyClip.h"
+
+#define CLIP_PACK_VERSION 1
+#define CLIP_PACK_HEADER_SIZE 16
+#define CLIP_PACK_ENTRY_SIZE 12
+#define CLIP_PACK_PARTITION_LABEL "clips" // Default data partition, see guide.md
+
+uint32_t clipPackCrc32(const uint8_t* data, size_t size, uint32_t crc = 0);
+
+class ClipPack {
+  public:
+    ClipPack();
+    ~ClipPack(); // Calls close()
+
+    // Each returns false, with the pack left closed, when the source is
+    // missing, unsupported on this platform, or fails the checks (magic,
+    // version, size, CRC, clip headers).
+    bool openPartition(const char* label = CLIP_PACK_PARTITION_LABEL); // ESP32 raw data partition
+    bool openFile(const char* path); // LittleFS on the ESP32, any file on Linux/macOS
+    bool openMemory(const uint8_t* data, size_t size); // Caller keeps `data` valid while open
+    // Unregisters this pack's clips and releases the mapping
+    void close();
+
+    bool isOpen() const { return _clips != nullptr; }
+    uint8_t clipCount() const { return _clipCount; }
+    const AnimationClip* clip(uint8_t i) const { return i < _clipCount ? &_clips[i] : nullptr; }
+    uint8_t emotion(uint8_t i) const;
+    size_t size() const { return _size; }
+
+    // Registers every clip with RideBuddyEyes::registerClip(); returns how
+    // many were accepted (clips for another panel geometry are not).
+    uint8_t registerClips() const;
+
+  private:
+    enum Source : uint8_t { PACK_NONE, PACK_MEMORY, PACK_MAPPED_FILE, PACK_PARTITION, PACK_HEAP };
+
+    const uint8_t* _data;
+    size_t _size;
+    AnimationClip* _clips;
+    uint8_t _clipCount;
+    Source _source;
+    uint32_t _mapHandle; // esp_partition_mmap handle
+
+    bool attach(const uint8_t* data, size_t size, Source source);
+    void release();
+};
+
+#endif
@@ -0,0 +1,127 @@
+#include "RideBuddySprites.h"
+
+EyeSpriteCache::EyeSpriteCache(uint8_t bufferWidth, uint8_t bufferPages, uint16_t budgetBytes) {
+  _bufferWidth = bufferWidth;
+  _bufferPages = bufferPages;
+  _budget = budgetBytes;
+  _arena = nullptr;
+  _slots = nullptr;
+  _clock = 0;
+  _hits = 0;
+  _misses = 0;
+}
+
+EyeSpriteCache::~EyeSpriteCache() { release(); }
+
+void EyeSpriteCache::setBudget(uint16_t budgetBytes) {
+  release();
+  _budget = budgetBytes;
+}
+
+bool EyeSpriteCache::allocate() {
+  if (_arena) return true;
+  uint8_t count = slotCount();
+  if (count == 0) return false;
+  _arena = (uint8_t*)malloc((size_t)count * EYE_SPRITE_SLOT_BYTES);
+  _slots = (Slot*)calloc(count, sizeof(Slot));
+  if (!_arena || !_slots) {
+    release();
+    _budget = 0; // Out of memory: stay disabled rather than retrying every frame
+    return false;
+  }
+  return true;
+}
+
+void EyeSpriteCache::release() {
+  free(_arena);
+  free(_slots);
+  _arena = nullptr;
+  _slots = nullptr;
+}
+
+bool EyeSpriteCache::fits(const EyeSpriteKey& key) const {
+  return key.w > 0 && key.h > 0 && (uint16_t)key.w * ((key.h + 7) / 8) <= EYE_SPRITE_SLOT_BYTES;
+}
+
+int8_t EyeSpriteCache::find(const EyeSpriteKey& key) const {
+  if (!_slots) return -1;
+  for (uint8_t i = 0; i < slotCount(); i++) {
+    const Slot& s = _slots[i];
+    if (s.valid && s.key.shape == key.shape && s.key.w == key.w && s.key.h == key.h && s.key.radius == key.radius) return i;
+  }
+  return -1;
+}
+
+bool EyeSpriteCache::canCapture(const uint8_t* buffer, const EyeSpriteKey& key, int16_t left, int16_t top) const {
+  if (slotCount() == 0 || !fits(key)) return false;
+  if (left < 0 || top < 0 || left + key.w > _bufferWidth || top + key.h > _bufferPages * 8) return false;
+  // Anything already drawn inside the rectangle would end up in the sprite
+  for (int16_t page = top >> 3; page <= (top + key.h - 1) >> 3; page++) {
+    const uint8_t* row = buffer + page * _bufferWidth + left;
+    for (uint8_t c = 0; c < key.w; c++) {
+      if (row[c]) return false;
+    }
+  }
+  return true;
+}
+
+bool EyeSpriteCache::draw(uint8_t* buffer, const EyeSpriteKey& key, int16_t left, int16_t top) {
+  if (slotCount() == 0) return false;
+  int8_t index = find(key);
+  if (index < 0) {
+    _misses++;
+    return false;
+  }
+  _hits++;
+  _slots[index].lastUsed = ++_clock;
+
+  const uint8_t* sprite = _arena + index * EYE_SPRITE_SLOT_BYTES;
+  const uint8_t pages = (key.h + 7) / 8;
+  for (uint8_t p = 0; p < pages; p++) {
+    int16_t y = top + p * 8;
+    int16_t page = y >> 3; // Arithmetic shift: floors for negative y
+    uint8_t shift = y & 7;
+    bool lowVisible = page >= 0 && page < _bufferPages;
+    bool highVisible = shift && page + 1 >= 0 && page + 1 < _bufferPages;
+    if (!lowVisible && !highVisible) continue;
+    for (uint8_t c = 0; c < key.w; c++) {
+      int16_t x = left + c;
+      uint8_t bits = sprite[p * key.w + c];
+      if (!bits || x < 0 || x >= _bufferWidth) continue;
+      if (lowVisible) buffer[page * _bufferWidth + x] |= bits << shift;
+      if (highVisible) buffer[(page + 1) * _bufferWidth + x] |= bits >> (8 - shift);
+    }
+  }
+  return true;
+}
+
+void EyeSpriteCache::store(const uint8_t* buffer, const EyeSpriteKey& key, int16_t left, int16_t top) {
+  if (!allocate()) return;
+
+  // Reuse an empty slot, otherwise evict the least recently used one
+  uint8_t victim = 0;
+  for (uint8_t i = 0; i < slotCount(); i++) {
+    if (!_slots[i].valid) { victim = i; break; }
+    if ((uint16_t)(_clock - _slots[i].lastUsed) > (uint16_t)(_clock - _slots[victim].lastUsed)) victim = i;
+  }
+
+  uint8_t* sprite = _arena + victim * EYE_SPRITE_SLOT_BYTES;
+  const uint8_t pages = (key.h + 7) / 8;
+  for (uint8_t p = 0; p < pages; p++) {
+    int16_t y = top + p * 8;
+    uint8_t page = y >> 3;
+    uint8_t shift = y & 7;
+    uint8_t rowsLeft = key.h - p * 8;
+    uint8_t mask = rowsLeft >= 8 ? 0xFF : (uint8_t)((1 << rowsLeft) - 1);
+    for (uint8_t c = 0; c < key.w; c++) {
+      uint16_t offset = page * _bufferWidth + left + c;
+      uint8_t bits = buffer[offset] >> shift;
+      if (shift && page + 1 < _bufferPages) bits |= buffer[offset + _bufferWidth] << (8 - shift);
+      sprite[p * key.w + c] = bits & mask;
+    }
+  }
+
+  _slots[victim].key = key;
+  _slots[victim].lastUsed = ++_clock;
+  _slots[victim].valid = true;
+}
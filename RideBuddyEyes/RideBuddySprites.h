@@ -0,0 +1,81 @@
+/*
+  RideBuddySprites.h - LRU cache of pre-rasterised eye sprites.
+  Released into the public domain.
+
+  During a tween the eye dimensions only take a handful of integer values,
+  so most frames redraw a shape that was already rasterised. The cache keeps
+  those shapes as 1bpp sprites in the U8g2 page-major layout (one byte = one
+  column of 8 pixels) and ORs them back into the display buffer with one
+  shifted byte write per column and page.
+
+  Sprites are captured from the display buffer right after U8g2 drew them,
+  so a cached eye is pixel-identical to a freshly drawn one. Memory is one
+  arena of fixed-size slots, allocated on first use.
+*/
+#ifndef RideBuddySprites_h
+#define RideBuddySprites_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define EYE_SPRITE_SLOT_BYTES 512 // Largest sprite: 64 columns x 8 pages
+
+enum EyeSpriteShape {
+  EYE_SPRITE_RBOX,    // Rounded box (NEUTRAL, DISTRACTED, ...)
+  EYE_SPRITE_SLEEP_U, // "U" shaped sleeping eye
+  EYE_SPRITE_SCARED   // Ring with pupil
+};
+
+struct EyeSpriteKey {
+  uint8_t shape;
+  uint8_t w;      // Sprite width in pixels
+  uint8_t h;      // Sprite height in pixels
+  uint8_t radius; // Corner or disc radius
+};
+
+class EyeSpriteCache {
+  public:
+    EyeSpriteCache(uint8_t bufferWidth, uint8_t bufferPages, uint16_t budgetBytes);
+    ~EyeSpriteCache();
+
+    // Sets the RAM budget; 0 disables the cache. Drops all cached sprites.
+    void setBudget(uint16_t budgetBytes);
+    uint16_t budget() const { return _budget; }
+    uint8_t slotCount() const { return _budget / EYE_SPRITE_SLOT_BYTES; }
+
+    // Whether a sprite of this size fits in a slot at all
+    bool fits(const EyeSpriteKey& key) const;
+    // True if the key's rectangle at (left, top) is on screen and still empty
+    bool canCapture(const uint8_t* buffer, const EyeSpriteKey& key, int16_t left, int16_t top) const;
+    // Blits a cached sprite with its top-left corner at (left, top). Returns false on a miss.
+    bool draw(uint8_t* buffer, const EyeSpriteKey& key, int16_t left, int16_t top);
+    // Captures the freshly drawn rectangle at (left, top), evicting the least recently used slot
+    void store(const uint8_t* buffer, const EyeSpriteKey& key, int16_t left, int16_t top);
+
+    uint32_t hits() const { return _hits; }
+    uint32_t misses() const { return _misses; }
+    void resetStats() { _hits = 0; _misses = 0; }
+
+  private:
+    struct Slot {
+      EyeSpriteKey key;
+      uint16_t lastUsed;
+      bool valid;
+    };
+
+    uint8_t _bufferWidth;
+    uint8_t _bufferPages;
+    uint16_t _budget;
+    uint8_t* _arena;
+    Slot* _slots;
+    uint16_t _clock;
+    uint32_t _hits;
+    uint32_t _misses;
+
+    bool allocate();
+    void release();
+    int8_t find(const EyeSpriteKey& key) const;
+};
+
+#endif
@@ -0,0 +1,26 @@
+// Generated by clipenc from angry.h - do not edit.
+// Single-frame still, see RideBuddyClip.h for the format.
+// Fitted to a 128x128 panel.
+#ifndef ANGRY_128X128_H
+#define ANGRY_128X128_H
+
+#include "../../RideBuddyClip.h"
+
+const uint8_t angry_still[] PROGMEM = {
+  0x52, 0x43, 0x02, 0x01, 0x0C, 0x10, 0x10, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x88, 0x00, 0x01, 0x80, 0x80, 0x80, 0xC0, 0x80, 0xE0, 0x07, 0x60,
+  0x70, 0x70, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0xB7, 0x00, 0x07, 0x80, 0x80, 0xC0, 0xE0, 0xE0, 0x70,
+  0x70, 0x60, 0x80, 0xE0, 0x01, 0xC0, 0xC0, 0x80, 0x80, 0x9F, 0x00, 0x03, 0x02, 0x02, 0x81, 0x81,
+  0x80, 0xC1, 0x87, 0xC0, 0x0D, 0xC1, 0xC3, 0xC3, 0xC7, 0xCF, 0xCE, 0xDC, 0xFC, 0xF8, 0xF8, 0xF0,
+  0xF0, 0xE0, 0xE0, 0x80, 0xC0, 0x00, 0x80, 0x99, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x0D, 0xE0, 0xE0,
+  0xF0, 0xF0, 0xF8, 0xF8, 0xDC, 0xDE, 0xCE, 0xCF, 0xC7, 0xC3, 0xC3, 0xC1, 0x87, 0xC0, 0x80, 0xC1,
+  0x03, 0x81, 0x83, 0x02, 0x02, 0x9B, 0x00, 0x00, 0xFC, 0xA0, 0xFF, 0x08, 0xFE, 0x3E, 0x7C, 0x78,
+  0xF8, 0xF8, 0x3C, 0x1E, 0x03, 0x85, 0x00, 0x08, 0x03, 0x1E, 0x78, 0xF0, 0xF8, 0x7C, 0x7C, 0x3E,
+  0xFE, 0xA0, 0xFF, 0x00, 0xFC, 0x9B, 0x00, 0xA2, 0xFF, 0x95, 0x00, 0xA2, 0xFF, 0x9B, 0x00, 0xA2,
+  0xFF, 0x95, 0x00, 0xA2, 0xFF, 0x9B, 0x00, 0x00, 0x3F, 0xA0, 0xFF, 0x00, 0x7F, 0x95, 0x00, 0x00,
+  0x7F, 0xA0, 0xFF, 0x00, 0x3F, 0x9D, 0x00, 0x01, 0x01, 0x01, 0x9B, 0x03, 0x00, 0x01, 0x99, 0x00,
+  0x00, 0x01, 0x9B, 0x03, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x86, 0x00, 0x01, 0x0C, 0x0C, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFB, 0x00,
+};
+
+#endif // ANGRY_128X128_H
@@ -0,0 +1,376 @@
+// Generated by clipenc from battery.h - do not edit.
+// Keyframe + XOR-delta clip, see RideBuddyClip.h for the format.
+// Fitted to a 128x128 panel.
+#ifndef BATTERY_128X128_H
+#define BATTERY_128X128_H
+
+#include "../../RideBuddyClip.h"
+
+const uint8_t battery_clip[] PROGMEM = {
+  0x52, 0x43, 0x02, 0x19, 0x0C, 0x10, 0x10, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x4B, 0x01, 0x00, 0x00,
+  0xF1, 0x01, 0x00, 0x00, 0xCE, 0x02, 0x00, 0x00, 0xC3, 0x03, 0x00, 0x00, 0xC0, 0x04, 0x00, 0x00,
+  0xBF, 0x05, 0x00, 0x00, 0xC2, 0x06, 0x00, 0x00, 0xC2, 0x07, 0x00, 0x00, 0xBF, 0x08, 0x00, 0x00,
+  0xC5, 0x09, 0x00, 0x00, 0x94, 0x0A, 0x00, 0x00, 0x6B, 0x0B, 0x00, 0x00, 0x65, 0x0C, 0x00, 0x00,
+  0x34, 0x0D, 0x00, 0x00, 0xDF, 0x0D, 0x00, 0x00, 0xA1, 0x0E, 0x00, 0x00, 0x77, 0x0F, 0x00, 0x00,
+  0x5A, 0x10, 0x00, 0x00, 0x1F, 0x11, 0x00, 0x00, 0xF5, 0x11, 0x00, 0x00, 0xC3, 0x12, 0x00, 0x00,
+  0x9A, 0x13, 0x00, 0x00, 0x9C, 0x14, 0x00, 0x00, 0x93, 0x15, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x96, 0x00, 0x87, 0x80, 0x95, 0x00, 0x87,
+  0x80, 0x96, 0x00, 0x00, 0x40, 0xAF, 0x00, 0x05, 0x80, 0xE0, 0xF8, 0xFC, 0xFC, 0xFE, 0x8B, 0xFF,
+  0x04, 0xFE, 0xFE, 0x7C, 0x78, 0x60, 0x87, 0x00, 0x04, 0x40, 0x70, 0x78, 0x7C, 0x7E, 0x8B, 0xFF,
+  0x05, 0xFE, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x83, 0x00, 0x00, 0x20, 0x81, 0x00, 0x05, 0x70, 0x70,
+  0x00, 0x00, 0x70, 0x70, 0x80, 0x00, 0x01, 0x02, 0x02, 0xAA, 0x00, 0x02, 0x18, 0x1B, 0xDF, 0x81,
+  0xEF, 0x05, 0xE7, 0x87, 0x07, 0x07, 0x47, 0x43, 0x81, 0x03, 0x0A, 0x0B, 0x1B, 0x1B, 0x8B, 0xC3,
+  0xE3, 0xFF, 0xFD, 0x7D, 0x1D, 0x01, 0x84, 0x00, 0x09, 0x01, 0x3D, 0xFD, 0xFD, 0xFF, 0xC3, 0x8B,
+  0x1B, 0x1B, 0x0B, 0x82, 0x03, 0x0C, 0x43, 0x07, 0x27, 0x87, 0xC7, 0xE7, 0xEF, 0xED, 0xEF, 0xEF,
+  0x5B, 0x1A, 0x18, 0x85, 0x00, 0x00, 0x7F, 0x83, 0xFF, 0x0C, 0x7F, 0x3F, 0x00, 0x00, 0x04, 0x04,
+  0x00, 0x10, 0x10, 0x00, 0x04, 0x00, 0x10, 0xA5, 0x00, 0x07, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F,
+  0x1F, 0x3F, 0x81, 0x3E, 0x09, 0xBE, 0xBE, 0x3E, 0x5E, 0x5F, 0x0F, 0x2F, 0x17, 0x03, 0x01, 0x8A,
+  0x00, 0x09, 0x01, 0x03, 0x0F, 0x2F, 0x0F, 0x5F, 0x5E, 0x3E, 0xBE, 0xBE, 0x80, 0x3E, 0x08, 0x3F,
+  0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0x8B, 0x00, 0x01, 0x3E, 0x3E, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x89, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xCF, 0x00, 0x80, 0x80, 0x86, 0x00, 0x04, 0x40,
+  0x00, 0x08, 0x20, 0x10, 0xAE, 0x00, 0x00, 0x04, 0x8F, 0x00, 0x00, 0x80, 0x8D, 0x00, 0x00, 0x80,
+  0x96, 0x00, 0x01, 0x01, 0x20, 0x81, 0x00, 0x05, 0xB0, 0x90, 0x00, 0x00, 0xB0, 0xB0, 0x80, 0x00,
+  0x01, 0x02, 0x02, 0xAC, 0x00, 0x01, 0x04, 0x30, 0x80, 0x00, 0x05, 0x08, 0x08, 0x28, 0x20, 0x40,
+  0xC4, 0x81, 0x04, 0x06, 0x18, 0x08, 0x00, 0x90, 0x48, 0x00, 0x04, 0x80, 0x06, 0x86, 0x00, 0x03,
+  0x02, 0x06, 0x06, 0x04, 0x81, 0x00, 0x02, 0x10, 0x00, 0x00, 0x80, 0x04, 0x00, 0x84, 0x80, 0x00,
+  0x05, 0x08, 0x08, 0x00, 0x02, 0x00, 0x30, 0x87, 0x00, 0x09, 0x01, 0x83, 0x02, 0x02, 0x03, 0x03,
+  0x02, 0x02, 0x83, 0xC3, 0x83, 0x00, 0x00, 0x10, 0xB0, 0x00, 0x02, 0x01, 0x00, 0x00, 0x80, 0x02,
+  0x98, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x90, 0x00, 0x07, 0x01, 0x03, 0x03, 0x41, 0x41,
+  0x03, 0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x86,
+  0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xDF, 0x00, 0x00, 0x40,
+  0xB4, 0x00, 0x87, 0x80, 0x95, 0x00, 0x87, 0x80, 0x8C, 0x00, 0x03, 0x0C, 0x00, 0x80, 0x40, 0x82,
+  0x00, 0x02, 0x10, 0x20, 0x18, 0xAE, 0x00, 0x05, 0x80, 0xE0, 0xF8, 0xFC, 0xFE, 0xFE, 0x8B, 0xFF,
+  0x04, 0xFE, 0xFE, 0xFC, 0xF8, 0xE0, 0x87, 0x00, 0x04, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0x8B, 0xFF,
+  0x05, 0xFE, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x86, 0x00, 0x08, 0x02, 0x00, 0x00, 0xE0, 0xE0, 0x00,
+  0x00, 0xE0, 0xE0, 0xAE, 0x00, 0x0B, 0x0C, 0x2F, 0xFF, 0xDF, 0xDB, 0xDF, 0xDF, 0x9F, 0x1F, 0x5F,
+  0x1F, 0x9F, 0x82, 0x1F, 0x81, 0x2F, 0x05, 0x8F, 0xCF, 0xE7, 0xE7, 0x77, 0x07, 0x85, 0x00, 0x08,
+  0x03, 0x7B, 0xFB, 0xFB, 0xE3, 0x87, 0x17, 0x37, 0x27, 0x82, 0x0F, 0x05, 0x9F, 0x1F, 0x5F, 0x5F,
+  0x1F, 0x9F, 0x82, 0xDF, 0x02, 0x5F, 0x18, 0x10, 0x86, 0x00, 0x00, 0x7F, 0x84, 0xFF, 0x09, 0x7E,
+  0x00, 0x00, 0x04, 0x04, 0x00, 0x10, 0x10, 0x00, 0x04, 0xA6, 0x00, 0x15, 0x01, 0x03, 0x07, 0x0F,
+  0x0F, 0x1F, 0x1E, 0x3C, 0x3D, 0x39, 0x38, 0x38, 0xB8, 0xB8, 0x1C, 0x5C, 0x5E, 0x0E, 0x2F, 0x17,
+  0x03, 0x01, 0x8A, 0x00, 0x14, 0x01, 0x07, 0x07, 0x2E, 0x5E, 0x5C, 0x1C, 0xBC, 0xB8, 0x38, 0x38,
+  0x3D, 0x3C, 0x3E, 0x3E, 0x1F, 0x9F, 0x0F, 0x0F, 0x07, 0x03, 0x8D, 0x00, 0x02, 0x3B, 0x3F, 0x01,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x88, 0x00, 0x02, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD0, 0x00, 0x06, 0x80, 0x00, 0x00, 0x80,
+  0x80, 0x00, 0x80, 0x81, 0x00, 0x05, 0x20, 0x00, 0x00, 0x02, 0x02, 0x04, 0xAD, 0x00, 0x87, 0x80,
+  0x96, 0x00, 0x86, 0x80, 0x91, 0x00, 0x00, 0x01, 0x87, 0x00, 0x03, 0x10, 0x40, 0x00, 0x10, 0xA6,
+  0x00, 0x05, 0x80, 0xE0, 0xF8, 0xFC, 0xFE, 0xFE, 0x8B, 0xFF, 0x04, 0xFE, 0xFE, 0xF8, 0xF8, 0xE0,
+  0x87, 0x00, 0x05, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0x8A, 0xFF, 0x05, 0xFE, 0xFE, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8A, 0x00, 0x0A, 0x04, 0x02, 0x80, 0x00, 0x00, 0xE0, 0xE0, 0x04, 0x00, 0xE0, 0xE0,
+  0x81, 0x00, 0x00, 0x04, 0xA2, 0x00, 0x04, 0x04, 0x0C, 0x2F, 0xEF, 0xEF, 0x80, 0xDF, 0x04, 0x9F,
+  0x1F, 0x5F, 0x1F, 0x9F, 0x80, 0x1F, 0x01, 0x0F, 0x0F, 0x81, 0x2F, 0x06, 0x8F, 0xCF, 0xE7, 0xE7,
+  0x65, 0x05, 0x04, 0x84, 0x00, 0x05, 0x06, 0x36, 0xF6, 0xF6, 0x87, 0x0F, 0x81, 0x2F, 0x00, 0x0F,
+  0x82, 0x1F, 0x03, 0x5F, 0x1F, 0x1F, 0x9F, 0x82, 0xDF, 0x02, 0x5B, 0x1A, 0x18, 0x8C, 0x00, 0x00,
+  0x7F, 0x84, 0xFF, 0x09, 0x7F, 0x00, 0x00, 0x04, 0x04, 0x00, 0x10, 0x10, 0x00, 0x04, 0xA0, 0x00,
+  0x15, 0x01, 0x03, 0x07, 0x4F, 0x1F, 0x1F, 0x1E, 0x3C, 0x3D, 0x3C, 0x38, 0x38, 0xB8, 0xBC, 0x3C,
+  0x5C, 0x5E, 0x0E, 0x2F, 0x17, 0x03, 0x01, 0x8A, 0x00, 0x15, 0x01, 0x17, 0x2F, 0x2E, 0x5C, 0x5C,
+  0x18, 0xB8, 0xB8, 0x38, 0x38, 0x39, 0x3D, 0x3C, 0x3E, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x43, 0x01,
+  0x92, 0x00, 0x01, 0x3A, 0x3E, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0x89, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xCF, 0x00,
+  0x06, 0x04, 0x08, 0x00, 0x04, 0x00, 0x04, 0x08, 0x82, 0x00, 0x05, 0x01, 0x00, 0x02, 0x40, 0x00,
+  0x80, 0xAA, 0x00, 0x86, 0x80, 0x96, 0x00, 0x86, 0x80, 0x94, 0x00, 0x01, 0x10, 0x10, 0x84, 0x00,
+  0x00, 0x40, 0x81, 0x00, 0x03, 0x01, 0x01, 0x40, 0x20, 0xA1, 0x00, 0x05, 0xC0, 0xF0, 0xF8, 0xFC,
+  0xFE, 0xFE, 0x8A, 0xFF, 0x05, 0xFE, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x86, 0x00, 0x05, 0xC0, 0xF0,
+  0xF8, 0xFC, 0xFE, 0xFE, 0x8B, 0xFF, 0x04, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x8E, 0x00, 0x0C, 0x04,
+  0x0C, 0x00, 0x00, 0x80, 0xB8, 0xB8, 0x80, 0x80, 0xB8, 0xB8, 0x80, 0x80, 0xA2, 0x00, 0x04, 0x10,
+  0x17, 0x5F, 0xDB, 0xDB, 0x80, 0xDF, 0x13, 0x9F, 0x0F, 0x4F, 0x8F, 0x8F, 0x0F, 0x0F, 0x07, 0x07,
+  0x17, 0x17, 0x37, 0x17, 0x97, 0xC7, 0xF3, 0xF3, 0xF2, 0x32, 0x02, 0x84, 0x00, 0x05, 0x04, 0x35,
+  0xE7, 0xE7, 0x8F, 0x0F, 0x80, 0x2F, 0x81, 0x0F, 0x05, 0x1F, 0x9F, 0x9F, 0x5F, 0x1F, 0x1F, 0x82,
+  0xDF, 0x03, 0xEF, 0x6F, 0x0F, 0x0C, 0x90, 0x00, 0x11, 0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0x7F, 0x7F,
+  0x3F, 0x1F, 0x00, 0x00, 0x04, 0x04, 0x00, 0x10, 0x10, 0x00, 0x04, 0x9C, 0x00, 0x07, 0x01, 0x03,
+  0x07, 0x0F, 0x0F, 0x1F, 0x1E, 0x3E, 0x81, 0x3C, 0x80, 0xBC, 0x06, 0x5C, 0x5E, 0x0E, 0x2F, 0x07,
+  0x03, 0x01, 0x8A, 0x00, 0x15, 0x01, 0x03, 0x17, 0x2E, 0x0E, 0x5C, 0x5C, 0x38, 0xB8, 0xB8, 0x38,
+  0x3C, 0x3D, 0x3E, 0x3E, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x83, 0x01, 0x96, 0x00, 0x01, 0x0F, 0x0F,
+  0xAD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xDA, 0x00,
+  0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD5, 0x00, 0x00, 0x60, 0x85, 0x00, 0x02,
+  0x04, 0x14, 0x0C, 0xF0, 0x00, 0x00, 0x80, 0x88, 0x00, 0x03, 0x02, 0x0A, 0x02, 0x06, 0xA5, 0x00,
+  0x87, 0x80, 0x96, 0x00, 0x86, 0x80, 0x97, 0x00, 0x03, 0x01, 0x00, 0x00, 0x20, 0x82, 0x00, 0x00,
+  0x01, 0x83, 0x00, 0x01, 0x20, 0x40, 0x9D, 0x00, 0x05, 0xC0, 0xE0, 0xF8, 0xFC, 0xFE, 0xFE, 0x8B,
+  0xFF, 0x04, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x87, 0x00, 0x05, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE,
+  0x8A, 0xFF, 0x05, 0xFE, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x91, 0x00, 0x00, 0x02, 0x81, 0x00, 0x05,
+  0xC0, 0x80, 0x00, 0x0C, 0x80, 0xC0, 0xA0, 0x00, 0x0D, 0x10, 0x10, 0x1F, 0xDF, 0xDB, 0xDB, 0xDF,
+  0xDF, 0x9F, 0x1F, 0x5F, 0x4F, 0x8F, 0x8F, 0x81, 0x0F, 0x0A, 0x07, 0x27, 0x37, 0x17, 0x87, 0xE6,
+  0xF6, 0xF2, 0x72, 0x02, 0x02, 0x83, 0x00, 0x06, 0x02, 0x02, 0x72, 0xF2, 0xF3, 0xC7, 0x97, 0x81,
+  0x17, 0x81, 0x07, 0x04, 0x8F, 0x8F, 0x2F, 0x2F, 0x8F, 0x83, 0xEF, 0x02, 0x6F, 0x0E, 0x08, 0x93,
+  0x00, 0x11, 0xFC, 0xFD, 0xFD, 0xFC, 0xFC, 0xFD, 0xFF, 0xFC, 0xFC, 0x00, 0x00, 0x04, 0x04, 0x00,
+  0x10, 0x10, 0x00, 0x04, 0x99, 0x00, 0x08, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3E, 0x3E, 0x3D,
+  0x80, 0x3C, 0x09, 0xBC, 0xBC, 0x3C, 0x5C, 0x5E, 0x0F, 0x2F, 0x17, 0x03, 0x01, 0x8A, 0x00, 0x08,
+  0x03, 0x17, 0x2F, 0x2F, 0x1E, 0x5E, 0x1C, 0xBC, 0xBC, 0x80, 0x3C, 0x09, 0x3E, 0x3E, 0x3F, 0x1F,
+  0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0x96, 0x00, 0x07, 0x01, 0x03, 0x03, 0xFB, 0xFB, 0x03, 0x03,
+  0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x86, 0x00, 0x02,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD4, 0x00, 0x01, 0x80, 0x80, 0x88, 0x00, 0x02,
+  0x10, 0x40, 0x10, 0xEA, 0x00, 0x02, 0x0C, 0x04, 0x08, 0x83, 0x00, 0x01, 0x06, 0x04, 0x82, 0x00,
+  0x00, 0x80, 0xA4, 0x00, 0x87, 0x80, 0x96, 0x00, 0x86, 0x80, 0x9A, 0x00, 0x09, 0x10, 0x18, 0x01,
+  0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x02, 0x80, 0x00, 0x02, 0x28, 0x00, 0x01, 0x9C, 0x00, 0x06,
+  0x80, 0xE0, 0xF8, 0xF8, 0xFC, 0xFE, 0xFE, 0x8A, 0xFF, 0x05, 0xFE, 0xFE, 0xFC, 0xF8, 0xE0, 0x80,
+  0x86, 0x00, 0x05, 0x40, 0x70, 0xF8, 0xFC, 0xFE, 0xFE, 0x8A, 0xFF, 0x05, 0xFE, 0xFE, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x95, 0x00, 0x0B, 0x02, 0x00, 0x00, 0x80, 0xB8, 0xB8, 0x80, 0x80, 0xB4, 0xB8, 0x80,
+  0x80, 0x9C, 0x00, 0x01, 0x0C, 0x0F, 0x84, 0xEF, 0x04, 0x8F, 0x2F, 0x2F, 0x8F, 0x8F, 0x81, 0x0F,
+  0x09, 0x07, 0x27, 0x37, 0x17, 0x97, 0xC6, 0xF6, 0x76, 0x16, 0x06, 0x84, 0x00, 0x01, 0x01, 0x3D,
+  0x80, 0xFD, 0x05, 0xF1, 0xC3, 0x8B, 0x1B, 0x1B, 0x0B, 0x81, 0x03, 0x05, 0x47, 0x47, 0x27, 0x27,
+  0x87, 0xCF, 0x80, 0xEF, 0x03, 0xDF, 0x5B, 0x1B, 0x10, 0x96, 0x00, 0x11, 0x3F, 0x7F, 0x7F, 0xFF,
+  0xFF, 0x7F, 0x7F, 0x3F, 0x1F, 0x00, 0x00, 0x04, 0x04, 0x00, 0x10, 0x10, 0x00, 0x04, 0x95, 0x00,
+  0x16, 0x80, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3E, 0x3E, 0x3C, 0x3C, 0xBC, 0xBC,
+  0x3C, 0x5C, 0x5E, 0x0E, 0x2F, 0x17, 0x03, 0x01, 0x8A, 0x00, 0x06, 0x01, 0x03, 0x17, 0x2F, 0x0F,
+  0x5F, 0x5E, 0x80, 0xBE, 0x81, 0x3E, 0x07, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0x9C,
+  0x00, 0x01, 0x0F, 0x1F, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0x89, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD0, 0x00, 0x02, 0x20, 0x60,
+  0x50, 0x84, 0x00, 0x02, 0x08, 0x18, 0x08, 0x80, 0x00, 0x02, 0x01, 0x02, 0x02, 0xEC, 0x00, 0x04,
+  0x80, 0x40, 0x00, 0x08, 0x08, 0x85, 0x00, 0x03, 0x40, 0x40, 0x04, 0x08, 0xA1, 0x00, 0x87, 0x80,
+  0x96, 0x00, 0x86, 0x80, 0xC9, 0x00, 0x05, 0x80, 0xE0, 0xF8, 0xFC, 0xFE, 0xFE, 0x8B, 0xFF, 0x05,
+  0xFE, 0xFE, 0xFC, 0xF8, 0xE0, 0x80, 0x86, 0x00, 0x05, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0x8A,
+  0xFF, 0x05, 0xFE, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x95, 0x00, 0x00, 0x10, 0x82, 0x00, 0x07, 0xC0,
+  0xC0, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x20, 0x99, 0x00, 0x05, 0x08, 0x0C, 0x0F, 0xEF, 0xED, 0xED,
+  0x80, 0xEF, 0x04, 0x8F, 0x0F, 0x27, 0x87, 0x87, 0x82, 0x07, 0x80, 0x17, 0x06, 0x87, 0xC3, 0xF3,
+  0xF2, 0x72, 0x12, 0x02, 0x84, 0x00, 0x09, 0x0B, 0x7B, 0xFB, 0xFB, 0xE3, 0x83, 0x13, 0x13, 0x17,
+  0x17, 0x81, 0x07, 0x0D, 0x8F, 0xCF, 0x2F, 0x2F, 0x0F, 0x8F, 0xEF, 0xFF, 0xDF, 0xDF, 0xDB, 0x5B,
+  0x18, 0x18, 0x98, 0x00, 0x11, 0xFC, 0xFD, 0xFD, 0xFC, 0xFC, 0xFD, 0xFD, 0xFE, 0xFC, 0x00, 0x00,
+  0x04, 0x04, 0x00, 0x10, 0x00, 0x00, 0x04, 0x94, 0x00, 0x03, 0x01, 0x07, 0x0F, 0x0F, 0x80, 0x1F,
+  0x80, 0x3E, 0x0B, 0x3C, 0x3C, 0xBC, 0xBC, 0x3C, 0x5E, 0x5E, 0x2F, 0x2F, 0x17, 0x03, 0x01, 0x89,
+  0x00, 0x09, 0x01, 0x03, 0x17, 0x2F, 0x2F, 0x1F, 0x5E, 0x3E, 0xBC, 0xBC, 0x80, 0x3C, 0x09, 0x3F,
+  0x3E, 0x3E, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0x9B, 0x00, 0x07, 0x01, 0x01, 0x03, 0x7F,
+  0x7F, 0x03, 0x01, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0x86, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD6, 0x00, 0x01, 0x10, 0x30,
+  0x83, 0x00, 0x04, 0xC0, 0x60, 0x00, 0x10, 0x20, 0xED, 0x00, 0x00, 0x01, 0x84, 0x00, 0x04, 0x10,
+  0x30, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x87, 0x80, 0x96, 0x00, 0x86, 0x80, 0x9D, 0x00, 0x02, 0x10,
+  0x30, 0x20, 0x87, 0x00, 0x03, 0x02, 0x00, 0x00, 0x20, 0x98, 0x00, 0x05, 0x80, 0xE0, 0xF8, 0xFC,
+  0xFE, 0xFE, 0x8B, 0xFF, 0x04, 0xFE, 0xFC, 0xF8, 0xF8, 0xE0, 0x87, 0x00, 0x05, 0xC0, 0xF0, 0xF8,
+  0xFC, 0xFE, 0xFE, 0x8A, 0xFF, 0x05, 0xFE, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x00, 0x09, 0x10,
+  0x00, 0xE0, 0xE0, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x08, 0x97, 0x00, 0x04, 0x10, 0x18, 0x1B, 0xDB,
+  0xDF, 0x80, 0xEF, 0x05, 0xCF, 0x8F, 0x2F, 0x2F, 0x87, 0x87, 0x81, 0x07, 0x80, 0x17, 0x07, 0x13,
+  0x83, 0xE3, 0xF3, 0xF3, 0x7A, 0x1A, 0x02, 0x84, 0x00, 0x13, 0x03, 0x3B, 0xFB, 0xFB, 0xC3, 0x87,
+  0x17, 0x37, 0x17, 0x17, 0x07, 0x07, 0x0F, 0x0F, 0x8F, 0x8F, 0x6F, 0x0F, 0x8F, 0xCF, 0x80, 0xFF,
+  0x04, 0xDF, 0xDF, 0x5B, 0x18, 0x18, 0x9A, 0x00, 0x00, 0x7F, 0x84, 0xFF, 0x09, 0x7E, 0x00, 0x00,
+  0x04, 0x04, 0x00, 0x10, 0x00, 0x00, 0x04, 0x92, 0x00, 0x03, 0x01, 0x03, 0x0F, 0x0F, 0x80, 0x1F,
+  0x01, 0x3E, 0x3E, 0x80, 0x3C, 0x09, 0xBC, 0xBC, 0x3E, 0x5E, 0x5E, 0x0F, 0x2F, 0x17, 0x03, 0x01,
+  0x89, 0x00, 0x09, 0x01, 0x03, 0x17, 0x2F, 0x2F, 0x0E, 0x5E, 0x1C, 0xBC, 0xBC, 0x80, 0x3C, 0x09,
+  0x3E, 0x3E, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0x9F, 0x00, 0x03, 0x01, 0x3B, 0x3B,
+  0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x88, 0x00, 0x03,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD3, 0x00, 0x04, 0x10, 0x00, 0x00, 0x11, 0x33,
+  0x80, 0x00, 0x07, 0x80, 0x80, 0x00, 0xC0, 0x62, 0x00, 0x10, 0x20, 0xEB, 0x00, 0x04, 0x80, 0x80,
+  0x01, 0x00, 0x06, 0x82, 0x00, 0x04, 0x10, 0x31, 0x00, 0x00, 0x11, 0xAB, 0x00, 0x00, 0x80, 0x95,
+  0x00, 0x00, 0x80, 0xA6, 0x00, 0x07, 0x11, 0x30, 0x20, 0x00, 0x80, 0x40, 0x00, 0x40, 0x82, 0x00,
+  0x05, 0x42, 0x00, 0x00, 0x20, 0x06, 0x02, 0x96, 0x00, 0x01, 0x40, 0x10, 0x8E, 0x00, 0x00, 0x01,
+  0x80, 0x00, 0x01, 0x08, 0x20, 0x86, 0x00, 0x06, 0x80, 0x20, 0x08, 0x04, 0x02, 0x00, 0x01, 0x89,
+  0x00, 0x06, 0x01, 0x00, 0x02, 0x04, 0x00, 0x10, 0x40, 0x9B, 0x00, 0x09, 0x10, 0x80, 0x58, 0x58,
+  0x80, 0x80, 0x58, 0x58, 0x80, 0x88, 0x97, 0x00, 0x0D, 0x08, 0x03, 0x40, 0x00, 0x04, 0x34, 0x30,
+  0x30, 0xD0, 0x90, 0x70, 0x30, 0x18, 0x98, 0x81, 0x08, 0x80, 0x38, 0x07, 0x34, 0x04, 0x15, 0x05,
+  0x05, 0x4C, 0x1C, 0x02, 0x83, 0x00, 0x0C, 0x02, 0x11, 0x49, 0x0D, 0x1D, 0x45, 0x90, 0x20, 0x10,
+  0x18, 0x18, 0x08, 0x08, 0x80, 0x00, 0x01, 0x80, 0x30, 0x80, 0x10, 0x07, 0x20, 0x20, 0x00, 0x20,
+  0x30, 0x74, 0x14, 0x18, 0x9A, 0x00, 0x08, 0x40, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x61,
+  0x9A, 0x00, 0x02, 0x01, 0x02, 0x04, 0x80, 0x00, 0x10, 0x01, 0x21, 0x02, 0x03, 0x04, 0x04, 0x84,
+  0x04, 0x00, 0x62, 0x02, 0x50, 0x20, 0x28, 0x14, 0x02, 0x01, 0x8D, 0x00, 0x12, 0x21, 0x52, 0x02,
+  0x20, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x08, 0x04, 0x02, 0x01,
+  0x9F, 0x00, 0x03, 0x01, 0x34, 0x34, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0x88, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD3, 0x00,
+  0x04, 0x10, 0x00, 0x00, 0x01, 0x03, 0x80, 0x00, 0x04, 0x82, 0x82, 0x00, 0x00, 0x02, 0xEE, 0x00,
+  0x06, 0x8C, 0x84, 0x04, 0x00, 0x06, 0xC0, 0xC0, 0x81, 0x00, 0x06, 0x01, 0x80, 0x00, 0x10, 0x00,
+  0x00, 0x10, 0xEB, 0x00, 0x07, 0x01, 0x00, 0x02, 0x02, 0x80, 0x40, 0x00, 0x40, 0x82, 0x00, 0x00,
+  0x41, 0x80, 0x00, 0x01, 0x06, 0x02, 0xCF, 0x00, 0x00, 0x08, 0x98, 0x00, 0x02, 0x02, 0x06, 0x04,
+  0x80, 0x00, 0x08, 0x80, 0x78, 0x78, 0x80, 0x80, 0x38, 0x78, 0x80, 0x80, 0x97, 0x00, 0x01, 0x14,
+  0x14, 0x81, 0x34, 0x07, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x90, 0x84, 0x00, 0x07, 0x28,
+  0x08, 0x19, 0x11, 0x13, 0x13, 0x02, 0x04, 0x83, 0x00, 0x08, 0x06, 0x17, 0x17, 0x11, 0x01, 0x09,
+  0x18, 0x18, 0x08, 0x82, 0x00, 0x05, 0x80, 0x00, 0x80, 0x30, 0x00, 0x10, 0x80, 0x30, 0x03, 0x10,
+  0x10, 0x02, 0x22, 0x9C, 0x00, 0x08, 0xC3, 0x82, 0x82, 0x03, 0x03, 0x82, 0x82, 0xC3, 0xE3, 0x83,
+  0x00, 0x00, 0x10, 0x99, 0x00, 0x03, 0x01, 0x00, 0x02, 0x00, 0x81, 0x04, 0x05, 0x80, 0x00, 0x02,
+  0x00, 0x00, 0x10, 0x91, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x04, 0xAA, 0x00, 0x07, 0x01, 0x03,
+  0x03, 0xF4, 0xF4, 0x03, 0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0x86, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD1, 0x00, 0x02,
+  0x40, 0x80, 0x40, 0x84, 0x00, 0x01, 0x02, 0x02, 0xF1, 0x00, 0x08, 0x0C, 0x04, 0x04, 0x10, 0x00,
+  0xC2, 0xC0, 0x00, 0x80, 0x80, 0x00, 0x05, 0x82, 0x44, 0x01, 0x00, 0x00, 0x10, 0xEC, 0x00, 0x02,
+  0x20, 0x1A, 0x02, 0x83, 0x00, 0x07, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0xAE, 0x00,
+  0x01, 0x80, 0x80, 0x86, 0x00, 0x82, 0x80, 0x8B, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x08, 0x98,
+  0x00, 0x03, 0x02, 0x06, 0x04, 0x20, 0x80, 0x00, 0x05, 0x20, 0x30, 0x00, 0x00, 0xE0, 0x30, 0x99,
+  0x00, 0x0D, 0x14, 0x00, 0x00, 0x02, 0x02, 0x00, 0x38, 0x28, 0x58, 0x98, 0xC8, 0x9C, 0xFC, 0x8C,
+  0x81, 0x0C, 0x0A, 0x24, 0xA4, 0xA4, 0xC8, 0x7E, 0x12, 0x1A, 0x18, 0x18, 0x05, 0x04, 0x83, 0x00,
+  0x09, 0x05, 0x18, 0x18, 0x1A, 0x1A, 0x7E, 0xEC, 0xA4, 0xA4, 0x04, 0x81, 0x0C, 0x05, 0x8C, 0xEC,
+  0x8C, 0xFC, 0x98, 0x68, 0x80, 0x18, 0x03, 0x08, 0x0A, 0x00, 0x20, 0x9C, 0x00, 0x08, 0x83, 0x02,
+  0x02, 0x03, 0x03, 0x02, 0x02, 0x83, 0xC3, 0xA1, 0x00, 0x03, 0x01, 0x01, 0x02, 0x03, 0x80, 0x02,
+  0x05, 0x83, 0x03, 0x01, 0x01, 0x00, 0x10, 0x90, 0x00, 0x01, 0x01, 0x01, 0x83, 0x03, 0x02, 0x02,
+  0x01, 0x01, 0xA5, 0x00, 0x07, 0x01, 0x03, 0x03, 0xC5, 0xC5, 0x03, 0x03, 0x01, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x86, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xD1, 0x00, 0x05, 0x02, 0x04, 0x00, 0x80, 0x02, 0x02, 0x83, 0x00, 0x05,
+  0x04, 0x08, 0x82, 0x00, 0x04, 0x02, 0xEB, 0x00, 0x00, 0xC0, 0x84, 0x00, 0x00, 0x03, 0xA8, 0x00,
+  0x86, 0x80, 0x96, 0x00, 0x87, 0x80, 0xA2, 0x00, 0x05, 0x20, 0x20, 0x00, 0x00, 0x02, 0x02, 0x81,
+  0x00, 0x00, 0x80, 0x99, 0x00, 0x05, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0x8A, 0xFF, 0x05, 0xFE,
+  0xFE, 0xFC, 0xF8, 0xF0, 0x40, 0x86, 0x00, 0x05, 0x80, 0xE0, 0xF8, 0xFC, 0xFE, 0xFE, 0x8B, 0xFF,
+  0x05, 0xFE, 0xFC, 0xFC, 0xF8, 0xE0, 0x80, 0x9C, 0x00, 0x08, 0x80, 0xB8, 0xF8, 0xC0, 0xC0, 0xF8,
+  0xF8, 0xC1, 0x80, 0x97, 0x00, 0x0C, 0x18, 0x1B, 0x5F, 0xEF, 0xEF, 0xED, 0xE7, 0xE7, 0xC7, 0x87,
+  0x27, 0x03, 0xC3, 0x82, 0x03, 0x04, 0x0B, 0x1B, 0x1B, 0x8D, 0xE1, 0x80, 0xFD, 0x01, 0x3D, 0x01,
+  0x84, 0x00, 0x0A, 0x01, 0x1D, 0x7D, 0xFD, 0xFD, 0xE1, 0xC5, 0x8D, 0x1D, 0x1B, 0x0B, 0x81, 0x03,
+  0x0C, 0x43, 0x43, 0x03, 0x07, 0x87, 0xE7, 0xF7, 0xE7, 0xE7, 0xED, 0xED, 0x2F, 0x0C, 0x9B, 0x00,
+  0x11, 0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0x7F, 0x7F, 0x3F, 0x1F, 0x00, 0x00, 0x04, 0x04, 0x00, 0x10,
+  0x10, 0x00, 0x04, 0x91, 0x00, 0x07, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x81, 0x3E,
+  0x80, 0xBE, 0x06, 0x5E, 0x5F, 0x0F, 0x2F, 0x07, 0x03, 0x01, 0x8A, 0x00, 0x09, 0x01, 0x03, 0x17,
+  0x2F, 0x0F, 0x5F, 0x5E, 0x3E, 0xBE, 0xBE, 0x81, 0x3E, 0x07, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07,
+  0x03, 0x01, 0xA1, 0x00, 0x01, 0x0F, 0x0F, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0x89, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD1, 0x00,
+  0x05, 0x02, 0x04, 0x00, 0x81, 0x02, 0x02, 0x83, 0x00, 0x06, 0x0C, 0x08, 0x8A, 0x00, 0x04, 0x0E,
+  0x08, 0xEA, 0x00, 0x03, 0xC1, 0x01, 0x04, 0x01, 0x81, 0x00, 0x02, 0x03, 0x00, 0x02, 0xF4, 0x00,
+  0x00, 0x60, 0x81, 0x00, 0x0A, 0x60, 0x00, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x99, 0x00, 0x10,
+  0xAF, 0x00, 0x00, 0x80, 0x9C, 0x00, 0x00, 0x04, 0x9D, 0x00, 0x0A, 0x02, 0x00, 0x80, 0x78, 0x38,
+  0xC0, 0xC0, 0x38, 0x38, 0xD1, 0x80, 0x98, 0x00, 0x0B, 0x04, 0x04, 0x34, 0x34, 0x32, 0x38, 0x38,
+  0xD8, 0x98, 0x78, 0x1C, 0x5C, 0x82, 0x0C, 0x09, 0x24, 0x3C, 0x2C, 0x9A, 0x67, 0x0B, 0x0B, 0x0F,
+  0x07, 0x03, 0x84, 0x00, 0x0A, 0x03, 0x07, 0x0F, 0x0B, 0x1B, 0x67, 0xD2, 0xAA, 0x32, 0x34, 0x04,
+  0x81, 0x0C, 0x0C, 0xDC, 0x5C, 0x5C, 0x18, 0x18, 0x38, 0x28, 0x3C, 0x3C, 0x36, 0x36, 0x34, 0x14,
+  0x9B, 0x00, 0x08, 0xC3, 0x82, 0x82, 0x03, 0x03, 0x82, 0x82, 0xC3, 0xE3, 0xA0, 0x00, 0x03, 0x01,
+  0x01, 0x02, 0x03, 0x81, 0x06, 0x05, 0x82, 0x02, 0x01, 0x01, 0x00, 0x10, 0x90, 0x00, 0x03, 0x01,
+  0x03, 0x02, 0x02, 0x80, 0x06, 0x04, 0x02, 0x03, 0x02, 0x01, 0x01, 0xA4, 0x00, 0x07, 0x01, 0x03,
+  0x03, 0x70, 0xF0, 0x03, 0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0x86, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD1, 0x00, 0x03,
+  0x10, 0x20, 0x00, 0x11, 0x85, 0x00, 0x06, 0x08, 0x00, 0x08, 0x00, 0x00, 0x0C, 0x08, 0xEA, 0x00,
+  0x04, 0x01, 0x01, 0x04, 0x01, 0x02, 0x82, 0x00, 0x06, 0x02, 0x00, 0x10, 0x20, 0x00, 0x80, 0x80,
+  0xED, 0x00, 0x06, 0x02, 0x66, 0x00, 0x01, 0x21, 0x21, 0x60, 0x82, 0x00, 0x04, 0x42, 0x02, 0x19,
+  0x40, 0x10, 0xCC, 0x00, 0x00, 0x01, 0x9E, 0x00, 0x0D, 0x02, 0x00, 0x02, 0x00, 0x00, 0x20, 0x20,
+  0x04, 0x00, 0x20, 0x20, 0x10, 0x00, 0x01, 0x97, 0x00, 0x00, 0x04, 0x88, 0x00, 0x00, 0x10, 0x82,
+  0x00, 0x08, 0x08, 0x18, 0x10, 0x01, 0x00, 0x00, 0x04, 0x0C, 0x04, 0x85, 0x00, 0x05, 0x08, 0x04,
+  0x00, 0x00, 0x01, 0x10, 0x84, 0x00, 0x00, 0x10, 0x84, 0x00, 0x00, 0x04, 0xA0, 0x00, 0x08, 0x83,
+  0x02, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x82, 0xA2, 0x00, 0x00, 0x01, 0x82, 0x00, 0x02, 0x04,
+  0x00, 0x02, 0x9A, 0x00, 0x00, 0x04, 0xA8, 0x00, 0x07, 0x01, 0x03, 0x02, 0x44, 0xC4, 0x02, 0x03,
+  0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x86, 0x00, 0x03,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD1, 0x00, 0x03, 0x10, 0x20, 0x01, 0x10, 0x85,
+  0x00, 0x02, 0xC0, 0x00, 0x40, 0xEF, 0x00, 0x05, 0x10, 0x10, 0x00, 0x06, 0x00, 0x80, 0x82, 0x00,
+  0x04, 0x10, 0x61, 0xC0, 0x80, 0x82, 0xED, 0x00, 0x02, 0x02, 0x06, 0x08, 0x80, 0x01, 0x09, 0x00,
+  0x00, 0x10, 0x20, 0x00, 0x00, 0x40, 0x00, 0x03, 0x46, 0xEF, 0x00, 0x0E, 0x12, 0x30, 0x00, 0x00,
+  0x80, 0x10, 0x18, 0x84, 0x80, 0x50, 0x18, 0x80, 0x98, 0x21, 0x10, 0x96, 0x00, 0x0C, 0x04, 0x04,
+  0x4C, 0x6C, 0x68, 0x60, 0x60, 0x20, 0x20, 0xE0, 0x20, 0xA0, 0x20, 0x81, 0x10, 0x80, 0x70, 0x02,
+  0x38, 0x08, 0x19, 0x80, 0x1B, 0x00, 0x0A, 0x84, 0x00, 0x09, 0x06, 0x1D, 0x19, 0x19, 0x29, 0x98,
+  0x58, 0x78, 0x70, 0x70, 0x80, 0x10, 0x06, 0x30, 0x20, 0xA0, 0x20, 0xE0, 0x20, 0xA0, 0x80, 0x60,
+  0x80, 0x6C, 0x01, 0x2C, 0x08, 0x9B, 0x00, 0x00, 0x40, 0x84, 0x80, 0x00, 0x61, 0x9F, 0x00, 0x04,
+  0x01, 0x02, 0x02, 0x05, 0x06, 0x81, 0x08, 0x04, 0x00, 0x04, 0x04, 0x02, 0x01, 0x90, 0x00, 0x04,
+  0x01, 0x02, 0x04, 0x04, 0x0C, 0x81, 0x08, 0x03, 0x06, 0x04, 0x02, 0x02, 0xA6, 0x00, 0x03, 0x01,
+  0x24, 0x24, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x88,
+  0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD3, 0x00, 0x03, 0x01, 0x20, 0x00,
+  0x50, 0x83, 0x00, 0x05, 0xC0, 0x04, 0x48, 0x00, 0x10, 0x10, 0xEC, 0x00, 0x05, 0x11, 0x10, 0x00,
+  0x04, 0x00, 0x84, 0x80, 0x00, 0x08, 0x40, 0x40, 0x00, 0x41, 0xC0, 0x01, 0x02, 0x08, 0x10, 0xEC,
+  0x00, 0x03, 0x80, 0x08, 0x00, 0x0C, 0x81, 0x00, 0x00, 0x20, 0x81, 0x00, 0x03, 0x03, 0x26, 0xC0,
+  0x40, 0xCF, 0x00, 0x00, 0x08, 0x98, 0x00, 0x10, 0x01, 0x00, 0x11, 0x30, 0x00, 0x00, 0x80, 0x30,
+  0x38, 0x80, 0x80, 0x70, 0x38, 0x80, 0x98, 0x20, 0x10, 0x96, 0x00, 0x0C, 0x04, 0x04, 0x4C, 0x6C,
+  0x6C, 0x60, 0x60, 0x20, 0x20, 0xE0, 0x20, 0xA0, 0x30, 0x81, 0x10, 0x05, 0x70, 0x70, 0x78, 0x38,
+  0x08, 0x19, 0x80, 0x1B, 0x00, 0x0A, 0x84, 0x00, 0x00, 0x06, 0x80, 0x19, 0x01, 0x08, 0x98, 0x81,
+  0x70, 0x80, 0x10, 0x06, 0x20, 0x20, 0xA0, 0x20, 0xE0, 0x20, 0xA0, 0x80, 0x60, 0x03, 0x68, 0x68,
+  0x28, 0x20, 0x9C, 0x00, 0x08, 0xC3, 0x82, 0x82, 0x83, 0x83, 0x82, 0x82, 0x83, 0xE3, 0x9F, 0x00,
+  0x05, 0x01, 0x02, 0x02, 0x04, 0x06, 0x0C, 0x80, 0x08, 0x05, 0x04, 0x04, 0x06, 0x02, 0x01, 0x10,
+  0x90, 0x00, 0x02, 0x02, 0x04, 0x04, 0x81, 0x08, 0x04, 0x09, 0x06, 0x04, 0x02, 0x02, 0xA4, 0x00,
+  0x07, 0x01, 0x03, 0x03, 0x60, 0xE0, 0x03, 0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x86, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xD1, 0x00, 0x05, 0x08, 0x00, 0x00, 0x20, 0x01, 0x51, 0x84, 0x00, 0x06, 0x04, 0x0C, 0x02, 0x10,
+  0x90, 0x40, 0x80, 0xEA, 0x00, 0x05, 0x01, 0x00, 0x00, 0x30, 0x00, 0x04, 0x80, 0x00, 0x01, 0x43,
+  0x40, 0x80, 0x00, 0x03, 0x01, 0x00, 0x08, 0x10, 0xEA, 0x00, 0x05, 0x02, 0x02, 0x82, 0x02, 0x40,
+  0x0C, 0x80, 0x00, 0x00, 0x10, 0x80, 0x00, 0x05, 0x80, 0x00, 0x00, 0x25, 0xC0, 0x42, 0xAA, 0x00,
+  0x82, 0x80, 0x88, 0x00, 0x00, 0x80, 0x91, 0x00, 0x00, 0x08, 0x98, 0x00, 0x02, 0x05, 0x00, 0x01,
+  0x80, 0x00, 0x08, 0xC0, 0x38, 0x38, 0xC0, 0xC0, 0x38, 0x38, 0xC0, 0x80, 0x98, 0x00, 0x0B, 0x14,
+  0x34, 0x34, 0x36, 0x36, 0x38, 0x38, 0xD8, 0x98, 0x78, 0x18, 0x58, 0x81, 0x0C, 0x05, 0x04, 0x34,
+  0x34, 0x3C, 0x8C, 0x64, 0x81, 0x0D, 0x00, 0x05, 0x84, 0x00, 0x00, 0x01, 0x80, 0x0D, 0x0F, 0x3C,
+  0x64, 0xAC, 0xB4, 0x34, 0x34, 0x04, 0x0C, 0x0C, 0x18, 0x18, 0xD8, 0x18, 0x78, 0x18, 0x58, 0x82,
+  0x30, 0x02, 0x70, 0x0C, 0x08, 0x9B, 0x00, 0x08, 0xC3, 0x82, 0x82, 0x03, 0x03, 0x82, 0x82, 0xC3,
+  0xE3, 0xA0, 0x00, 0x04, 0x01, 0x01, 0x02, 0x03, 0x02, 0x80, 0x06, 0x05, 0x02, 0x02, 0x01, 0x01,
+  0x00, 0x10, 0x8F, 0x00, 0x03, 0x01, 0x01, 0x03, 0x02, 0x81, 0x06, 0x04, 0x07, 0x03, 0x02, 0x01,
+  0x01, 0xA4, 0x00, 0x07, 0x01, 0x03, 0x03, 0x70, 0xF0, 0x03, 0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x86, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xD1, 0x00, 0x00, 0x08, 0x80, 0x00, 0x01, 0x01, 0x01, 0x82, 0x00, 0x08, 0x08,
+  0x04, 0x00, 0x04, 0x02, 0x01, 0x81, 0x44, 0x82, 0xE9, 0x00, 0x05, 0x08, 0x00, 0x04, 0x00, 0xF0,
+  0x40, 0x81, 0x00, 0x06, 0x03, 0x00, 0x00, 0x80, 0x00, 0x80, 0x10, 0xEC, 0x00, 0x81, 0x02, 0x0E,
+  0x40, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x40, 0x00, 0x80, 0x02, 0x01, 0x05, 0x00, 0x02, 0xAA,
+  0x00, 0x00, 0x80, 0x8C, 0x00, 0x00, 0x80, 0x8D, 0x00, 0x00, 0x01, 0x9C, 0x00, 0x00, 0x04, 0x82,
+  0x00, 0x0A, 0xC0, 0x38, 0x3A, 0xC2, 0xC0, 0x38, 0x38, 0xC0, 0x80, 0x00, 0x20, 0x96, 0x00, 0x07,
+  0x14, 0x34, 0x30, 0x02, 0x02, 0x08, 0x08, 0x48, 0x81, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x08,
+  0x81, 0x00, 0x00, 0x20, 0x8E, 0x00, 0x0E, 0x20, 0x08, 0x80, 0x08, 0x08, 0x0C, 0x04, 0x04, 0x00,
+  0x00, 0xC0, 0x00, 0x08, 0x28, 0x48, 0x82, 0x00, 0x00, 0x30, 0x9D, 0x00, 0x08, 0xC3, 0x82, 0x82,
+  0x03, 0x03, 0x82, 0x82, 0xC3, 0xE3, 0xAA, 0x00, 0x00, 0x01, 0x94, 0x00, 0x02, 0x01, 0x00, 0x00,
+  0x81, 0x02, 0x02, 0x00, 0x00, 0x01, 0xA5, 0x00, 0x07, 0x01, 0x03, 0x03, 0x70, 0xF0, 0x03, 0x03,
+  0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x86, 0x00, 0x03,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD0, 0x00, 0x02, 0x10, 0x40, 0x20, 0x86, 0x00,
+  0x01, 0x08, 0x04, 0x80, 0x00, 0x03, 0x81, 0x01, 0x04, 0x02, 0xE9, 0x00, 0x08, 0x08, 0x20, 0x24,
+  0x00, 0xC0, 0x40, 0x00, 0x00, 0x80, 0x80, 0x00, 0x04, 0x08, 0x90, 0x00, 0x80, 0x11, 0xF0, 0x00,
+  0x0B, 0x80, 0x00, 0x00, 0x10, 0x11, 0x00, 0x20, 0x40, 0x02, 0x00, 0x02, 0x01, 0xAE, 0x00, 0x81,
+  0x80, 0x99, 0x00, 0x00, 0x01, 0x9F, 0x00, 0x00, 0x08, 0x80, 0x00, 0x05, 0x20, 0x22, 0x02, 0x00,
+  0x20, 0x20, 0x80, 0x00, 0x03, 0x20, 0x00, 0x00, 0x01, 0x95, 0x00, 0x0E, 0x04, 0x34, 0x30, 0x30,
+  0x70, 0x90, 0x98, 0x78, 0x18, 0x58, 0x18, 0x18, 0x1C, 0x1C, 0x0C, 0x80, 0x34, 0x02, 0xA4, 0x4C,
+  0x1C, 0x80, 0x0C, 0x00, 0x05, 0x84, 0x00, 0x00, 0x07, 0x80, 0x0C, 0x05, 0x1C, 0x44, 0x84, 0x34,
+  0x3C, 0x3C, 0x83, 0x08, 0x05, 0x18, 0x50, 0x30, 0x10, 0x30, 0x10, 0x80, 0x00, 0x02, 0x30, 0x34,
+  0x14, 0x9B, 0x00, 0x80, 0x02, 0x05, 0x03, 0x03, 0x02, 0x02, 0x03, 0x82, 0x87, 0x00, 0x00, 0x10,
+  0x95, 0x00, 0x04, 0x01, 0x03, 0x03, 0x07, 0x07, 0x81, 0x06, 0x03, 0x02, 0x02, 0x01, 0x01, 0x91,
+  0x00, 0x09, 0x01, 0x00, 0x02, 0x02, 0x04, 0x04, 0x00, 0x00, 0x03, 0x02, 0xA6, 0x00, 0x07, 0x01,
+  0x02, 0x02, 0x40, 0xC0, 0x02, 0x02, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0x86, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD0, 0x00,
+  0x02, 0x10, 0x41, 0x20, 0x87, 0x00, 0x06, 0x20, 0x40, 0x00, 0x00, 0x80, 0x08, 0x18, 0xEA, 0x00,
+  0x02, 0x02, 0x21, 0x21, 0x82, 0x00, 0x00, 0x88, 0x80, 0x00, 0x01, 0x88, 0x14, 0xCE, 0x00, 0x00,
+  0x80, 0xA1, 0x00, 0x08, 0x40, 0x02, 0x00, 0x00, 0x01, 0x00, 0x20, 0x01, 0x02, 0x82, 0x00, 0x01,
+  0x06, 0x04, 0xB7, 0x00, 0x00, 0x40, 0x93, 0x00, 0x02, 0x08, 0x20, 0x80, 0x98, 0x00, 0x0B, 0x01,
+  0x08, 0x00, 0x00, 0x80, 0x10, 0x11, 0x80, 0x80, 0x10, 0x18, 0x80, 0x82, 0x00, 0x00, 0x01, 0x92,
+  0x00, 0x01, 0x14, 0x16, 0x80, 0x34, 0x06, 0x30, 0x00, 0x40, 0x00, 0x40, 0x00, 0x80, 0x82, 0x10,
+  0x81, 0x00, 0x02, 0x20, 0x48, 0x10, 0x80, 0x00, 0x00, 0x02, 0x84, 0x00, 0x09, 0x02, 0x20, 0x81,
+  0x01, 0x21, 0x10, 0x18, 0x18, 0x38, 0x38, 0x80, 0x08, 0x80, 0x00, 0x0B, 0x30, 0x50, 0x90, 0x70,
+  0x30, 0x10, 0x02, 0x08, 0x18, 0x98, 0x28, 0x0A, 0x9B, 0x00, 0x00, 0xC1, 0x84, 0x80, 0x00, 0x61,
+  0x87, 0x00, 0x00, 0x10, 0x96, 0x00, 0x03, 0x02, 0x01, 0x05, 0x05, 0x81, 0x04, 0x03, 0x00, 0x02,
+  0x00, 0x01, 0x95, 0x00, 0x06, 0x04, 0x04, 0x00, 0x02, 0x03, 0x02, 0x01, 0xA6, 0x00, 0x05, 0x01,
+  0x01, 0x20, 0x20, 0x01, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0x87, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD1, 0x00, 0x02, 0x19,
+  0x08, 0x08, 0x81, 0x00, 0x01, 0x20, 0x20, 0x80, 0x00, 0x06, 0x20, 0x41, 0x18, 0x00, 0x04, 0x08,
+  0x1C, 0xEA, 0x00, 0x13, 0x02, 0x01, 0x01, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04,
+  0x80, 0x04, 0x00, 0x00, 0x01, 0x00, 0x30, 0x20, 0xC8, 0x00, 0x00, 0x80, 0x9E, 0x00, 0x04, 0x02,
+  0x06, 0x05, 0xC8, 0x02, 0x81, 0x00, 0x09, 0x04, 0x01, 0x00, 0x40, 0x00, 0x00, 0x20, 0x30, 0x06,
+  0x04, 0x95, 0x00, 0x00, 0x20, 0x81, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x01, 0x10, 0x40, 0x86, 0x00,
+  0x00, 0x40, 0x94, 0x00, 0x00, 0x20, 0x99, 0x00, 0x0B, 0x03, 0x01, 0x00, 0x00, 0x80, 0x30, 0x31,
+  0x80, 0x80, 0x30, 0x38, 0x80, 0x98, 0x00, 0x02, 0x1C, 0x1A, 0x70, 0x80, 0x30, 0x01, 0x00, 0x40,
+  0x80, 0x00, 0x01, 0x80, 0x10, 0x82, 0x00, 0x09, 0x08, 0x08, 0x18, 0x18, 0x01, 0x00, 0x04, 0x0C,
+  0x0C, 0x06, 0x84, 0x00, 0x08, 0x04, 0x21, 0x80, 0x00, 0x00, 0x11, 0x00, 0x00, 0x20, 0x8B, 0x00,
+  0x04, 0x0A, 0x1A, 0x9A, 0x0A, 0x0A, 0x9B, 0x00, 0x02, 0xC1, 0x80, 0x80, 0x80, 0x81, 0x02, 0x80,
+  0x81, 0x63, 0xA1, 0x00, 0x02, 0x02, 0x01, 0x01, 0x80, 0x04, 0x99, 0x00, 0x01, 0x02, 0x20, 0x80,
+  0x00, 0x00, 0x02, 0xA9, 0x00, 0x03, 0x01, 0x01, 0x6A, 0x6A, 0x80, 0x01, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x86, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xD0, 0x00, 0x01, 0x08, 0x08, 0x83, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x10,
+  0xF2, 0x00, 0x02, 0x04, 0x04, 0x88, 0x84, 0x00, 0x07, 0x10, 0x00, 0x40, 0x40, 0x00, 0x20, 0x00,
+  0x40, 0x9E, 0x00, 0x87, 0x80, 0x96, 0x00, 0x86, 0x80, 0x9E, 0x00, 0x00, 0x01, 0x87, 0x00, 0x02,
+  0x08, 0x10, 0x14, 0x9A, 0x00, 0x05, 0x80, 0xE0, 0xF8, 0xFC, 0xFE, 0xFE, 0x8B, 0xFF, 0x04, 0xFE,
+  0xFC, 0xF8, 0xF0, 0xE0, 0x87, 0x00, 0x05, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0x8A, 0xFF, 0x05,
+  0xFE, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x9D, 0x00, 0x06, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x08,
+  0x98, 0x00, 0x03, 0x18, 0x18, 0x1B, 0xDF, 0x81, 0xEF, 0x05, 0xCF, 0x8F, 0x0F, 0x27, 0x07, 0x87,
+  0x82, 0x07, 0x80, 0x13, 0x06, 0x83, 0xE3, 0xFB, 0xFB, 0x7B, 0x1B, 0x02, 0x84, 0x00, 0x06, 0x03,
+  0x3B, 0xFB, 0xFB, 0xF3, 0xC3, 0x8B, 0x80, 0x1B, 0x01, 0x03, 0x03, 0x80, 0x07, 0x04, 0xC7, 0x07,
+  0x27, 0x87, 0xCF, 0x81, 0xEF, 0x03, 0xDF, 0x5B, 0x18, 0x10, 0x9A, 0x00, 0x11, 0xFC, 0xFF, 0xFF,
+  0xFC, 0xFC, 0xFF, 0xFF, 0xFC, 0xFC, 0x00, 0x00, 0x04, 0x04, 0x00, 0x10, 0x10, 0x00, 0x04, 0x92,
+  0x00, 0x06, 0x01, 0x03, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x80, 0x3E, 0x0B, 0x3C, 0x3C, 0xBC, 0xBC,
+  0x3E, 0x5E, 0x5E, 0x0F, 0x2F, 0x17, 0x03, 0x01, 0x89, 0x00, 0x0B, 0x01, 0x03, 0x17, 0x2F, 0x0F,
+  0x5F, 0x5E, 0x1E, 0xBE, 0xBC, 0x3C, 0x3C, 0x80, 0x3E, 0x07, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07,
+  0x03, 0x01, 0x9D, 0x00, 0x08, 0x01, 0x03, 0x07, 0xEF, 0xFF, 0x07, 0x03, 0x03, 0x01, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x85, 0x00, 0x02, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD1, 0x00, 0x05, 0x10, 0x00, 0x20, 0x00, 0x00, 0x01, 0x82, 0x00,
+  0x01, 0xC0, 0xC0, 0xF2, 0x00, 0x01, 0x02, 0x05, 0x87, 0x00, 0x04, 0x10, 0x00, 0x01, 0x02, 0x01,
+  0x9E, 0x00, 0x86, 0x80, 0x96, 0x00, 0x87, 0x80, 0xA0, 0x00, 0x01, 0x52, 0x60, 0x87, 0x00, 0x00,
+  0x40, 0x99, 0x00, 0x05, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0x8A, 0xFF, 0x05, 0xFE, 0xFE, 0xFC,
+  0xF8, 0xE0, 0xC0, 0x86, 0x00, 0x05, 0x80, 0xE0, 0xF8, 0xFC, 0xFE, 0xFE, 0x8A, 0xFF, 0x05, 0xFE,
+  0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0x9E, 0x00, 0x08, 0x70, 0x70, 0x00, 0x00, 0x60, 0x70, 0x00, 0x02,
+  0x02, 0x96, 0x00, 0x02, 0x0C, 0x0F, 0x6F, 0x82, 0xEF, 0x0E, 0x8F, 0x0F, 0x6F, 0x8F, 0xCF, 0x8F,
+  0x0F, 0x0F, 0x07, 0x07, 0x17, 0x37, 0x37, 0x17, 0x86, 0x80, 0xF6, 0x01, 0x32, 0x02, 0x84, 0x00,
+  0x01, 0x03, 0x1B, 0x80, 0xFB, 0x05, 0xE3, 0x8B, 0x1B, 0x13, 0x13, 0x17, 0x81, 0x07, 0x04, 0x87,
+  0x8F, 0x2F, 0x2F, 0x8F, 0x80, 0xEF, 0x04, 0xDF, 0xDB, 0xDB, 0x1B, 0x10, 0x9B, 0x00, 0x00, 0x7F,
+  0x83, 0xFF, 0x0A, 0x7F, 0x3F, 0x00, 0x00, 0x04, 0x04, 0x00, 0x10, 0x10, 0x00, 0x04, 0x91, 0x00,
+  0x0B, 0x41, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3E, 0x3E, 0x3D, 0x3C, 0x3C, 0x80, 0xBC, 0x06,
+  0x5C, 0x5E, 0x0E, 0x2F, 0x17, 0x03, 0x01, 0x8A, 0x00, 0x0B, 0x01, 0x03, 0x07, 0x2F, 0x0F, 0x5E,
+  0x5E, 0x3E, 0xBC, 0xBC, 0x3C, 0x3C, 0x80, 0x3E, 0x06, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x01,
+  0xA1, 0x00, 0x01, 0x1F, 0x3F, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0x89, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD1, 0x00, 0x03, 0x10,
+  0x00, 0x10, 0x20, 0x85, 0x00, 0x06, 0x04, 0x80, 0x0C, 0x80, 0x00, 0x00, 0x08, 0xEC, 0x00, 0x80,
+  0x10, 0x85, 0x00, 0x02, 0x01, 0x00, 0x01, 0x9D, 0x00, 0x87, 0x80, 0x96, 0x00, 0x86, 0x80, 0xA5,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x40, 0x84, 0x00, 0x00, 0x50, 0x94, 0x00, 0x06, 0x80, 0xE0,
+  0xF8, 0xF8, 0xFC, 0xFE, 0xFE, 0x8A, 0xFF, 0x05, 0xFE, 0xFE, 0xFC, 0xF8, 0xE0, 0x80, 0x86, 0x00,
+  0x05, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0x8A, 0xFF, 0x05, 0xFE, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0,
+  0x9D, 0x00, 0x09, 0x10, 0x08, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0x96, 0x00, 0x04,
+  0x04, 0x0D, 0xED, 0xEF, 0xEF, 0x80, 0xDF, 0x02, 0x1F, 0x5F, 0x5F, 0x84, 0x1F, 0x09, 0x3F, 0x6F,
+  0x2F, 0x2F, 0x8F, 0xED, 0xED, 0x6D, 0x0D, 0x04, 0x84, 0x00, 0x08, 0x02, 0x7A, 0xF2, 0xF6, 0xE6,
+  0x87, 0x27, 0x2F, 0x2F, 0x81, 0x0F, 0x80, 0x1F, 0x03, 0x5F, 0x5F, 0x1F, 0x9F, 0x80, 0xDF, 0x04,
+  0xDB, 0xDB, 0x5B, 0x1A, 0x18, 0x9E, 0x00, 0x11, 0xFC, 0xFD, 0xFD, 0xFC, 0xFC, 0xFD, 0xFD, 0xFC,
+  0xFC, 0x00, 0x00, 0x04, 0x04, 0x00, 0x10, 0x10, 0x00, 0x04, 0x8E, 0x00, 0x15, 0x01, 0x03, 0x07,
+  0x0F, 0x0F, 0x1F, 0x1E, 0x3C, 0x3D, 0x39, 0x38, 0x38, 0xB8, 0xB8, 0x38, 0x5C, 0x5C, 0x0E, 0x2F,
+  0x17, 0x03, 0x01, 0x8A, 0x00, 0x06, 0x01, 0x07, 0x07, 0x0E, 0x5E, 0x5C, 0x1C, 0x80, 0xB8, 0x0B,
+  0x38, 0x39, 0x3D, 0x3C, 0x3E, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0xA1, 0x00, 0x07, 0x01,
+  0x03, 0x03, 0x7F, 0xFF, 0x03, 0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0x86, 0x00,
+};
+
+const uint8_t BATTERY_FRAME_COUNT = 25;
+
+#endif // BATTERY_128X128_H
@@ -0,0 +1,339 @@
+// Generated by clipenc from cry.h - do not edit.
+// Keyframe + XOR-delta clip, see RideBuddyClip.h for the format.
+// Fitted to a 128x128 panel.
+#ifndef CRY_128X128_H
+#define CRY_128X128_H
+
+#include "../../RideBuddyClip.h"
+
+const uint8_t cry_clip[] PROGMEM = {
+  0x52, 0x43, 0x02, 0x19, 0x0C, 0x10, 0x10, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x41, 0x01, 0x00, 0x00,
+  0x12, 0x02, 0x00, 0x00, 0xD4, 0x02, 0x00, 0x00, 0xA7, 0x03, 0x00, 0x00, 0x8E, 0x04, 0x00, 0x00,
+  0x73, 0x05, 0x00, 0x00, 0x58, 0x06, 0x00, 0x00, 0x2C, 0x07, 0x00, 0x00, 0xE1, 0x07, 0x00, 0x00,
+  0x7A, 0x08, 0x00, 0x00, 0x0B, 0x09, 0x00, 0x00, 0x9A, 0x09, 0x00, 0x00, 0x4C, 0x0A, 0x00, 0x00,
+  0xFF, 0x0A, 0x00, 0x00, 0xD6, 0x0B, 0x00, 0x00, 0xC4, 0x0C, 0x00, 0x00, 0xAC, 0x0D, 0x00, 0x00,
+  0x8D, 0x0E, 0x00, 0x00, 0x76, 0x0F, 0x00, 0x00, 0x42, 0x10, 0x00, 0x00, 0x36, 0x11, 0x00, 0x00,
+  0x14, 0x12, 0x00, 0x00, 0xF9, 0x12, 0x00, 0x00, 0xBE, 0x13, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x9F, 0x00, 0x01, 0x80, 0xC0, 0x83, 0xE0, 0x00, 0xC0,
+  0x93, 0x00, 0x00, 0xC0, 0x83, 0xE0, 0x01, 0xC0, 0x80, 0xC2, 0x00, 0x84, 0xE0, 0x81, 0xF0, 0x80,
+  0xF8, 0x03, 0xFC, 0xFC, 0xFE, 0xFE, 0x88, 0xFF, 0x00, 0xF8, 0x8F, 0x00, 0x00, 0xF8, 0x88, 0xFF,
+  0x03, 0xFE, 0xFE, 0xFC, 0xFC, 0x80, 0xF8, 0x81, 0xF0, 0x84, 0xE0, 0xAF, 0x00, 0x9A, 0xFF, 0x00,
+  0x7F, 0x8F, 0x00, 0x00, 0x7F, 0x9A, 0xFF, 0xAF, 0x00, 0x04, 0x03, 0xFF, 0xFF, 0x1F, 0x1F, 0x83,
+  0x3F, 0x02, 0x7F, 0xFF, 0x7F, 0x82, 0x3F, 0x01, 0xFF, 0xFF, 0x80, 0x3F, 0x04, 0x7F, 0xFF, 0x3F,
+  0x0F, 0x07, 0x91, 0x00, 0x04, 0x07, 0x0F, 0x3F, 0xFF, 0x7F, 0x80, 0x3F, 0x01, 0xFF, 0xFF, 0x82,
+  0x3F, 0x02, 0x7F, 0xFF, 0x7F, 0x83, 0x3F, 0x04, 0x1F, 0x1F, 0xFF, 0xFF, 0x03, 0xAF, 0x00, 0x02,
+  0x03, 0x07, 0x07, 0x85, 0x00, 0x02, 0x3E, 0x3F, 0x1C, 0x80, 0x00, 0x0A, 0x40, 0xF0, 0xFF, 0xF0,
+  0xC0, 0x00, 0x00, 0x3C, 0x7F, 0x7E, 0x30, 0x93, 0x00, 0x0A, 0x30, 0x7E, 0x7F, 0x3C, 0x00, 0x00,
+  0xC0, 0xF0, 0xFF, 0xF0, 0x40, 0x80, 0x00, 0x02, 0x1C, 0x3F, 0x3E, 0x85, 0x00, 0x02, 0x03, 0x07,
+  0x03, 0xBA, 0x00, 0x02, 0x7C, 0x7C, 0x30, 0x81, 0x00, 0x80, 0x01, 0xA1, 0x00, 0x80, 0x01, 0x81,
+  0x00, 0x02, 0x10, 0x7E, 0x7C, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x97,
+  0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA1, 0x00, 0x83, 0x20,
+  0x00, 0x40, 0x93, 0x00, 0x00, 0x40, 0x83, 0x20, 0xC4, 0x00, 0x80, 0x20, 0x81, 0x00, 0x00, 0x10,
+  0x80, 0x00, 0x00, 0x08, 0xB3, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x10, 0x81, 0x00, 0x80, 0x20,
+  0xFF, 0x00, 0xAE, 0x00, 0x03, 0xF0, 0xE0, 0x00, 0x00, 0x83, 0x20, 0x03, 0x40, 0x00, 0x40, 0x00,
+  0x80, 0x20, 0x02, 0x00, 0x00, 0x80, 0x80, 0x20, 0x04, 0x40, 0x00, 0xC0, 0x00, 0x04, 0x91, 0x00,
+  0x04, 0x04, 0x00, 0xC0, 0x00, 0x40, 0x80, 0x20, 0x84, 0x00, 0x02, 0x40, 0x00, 0x40, 0x83, 0x20,
+  0x03, 0x00, 0x00, 0xE0, 0xE0, 0xB0, 0x00, 0x02, 0x33, 0x79, 0x79, 0x85, 0x00, 0x02, 0xCE, 0xC0,
+  0xFC, 0x80, 0x00, 0x0A, 0x40, 0x70, 0x00, 0xF0, 0xC0, 0x00, 0x00, 0x3C, 0x9E, 0x7F, 0x30, 0x93,
+  0x00, 0x0A, 0x30, 0x7F, 0x9E, 0x3C, 0x00, 0x00, 0xC0, 0xF0, 0x00, 0x70, 0x40, 0x80, 0x00, 0x02,
+  0xFC, 0xC0, 0xCE, 0x85, 0x00, 0x02, 0x7F, 0x79, 0x73, 0xBA, 0x00, 0x02, 0x7D, 0x7D, 0x31, 0x80,
+  0x00, 0x0A, 0x1C, 0x3E, 0x3E, 0x3F, 0x18, 0x00, 0x00, 0x7C, 0x7F, 0x7F, 0x38, 0x94, 0x00, 0x09,
+  0x7E, 0xFF, 0x7C, 0x00, 0x00, 0x18, 0x3F, 0x3E, 0x1E, 0x0C, 0x80, 0x00, 0x02, 0x11, 0x7F, 0x7D,
+  0xC6, 0x00, 0x00, 0x0C, 0xB1, 0x00, 0x00, 0x08, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0x9A, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x99, 0x00, 0x82,
+  0x80, 0x9C, 0x00, 0x80, 0x80, 0xC2, 0x00, 0x84, 0xC0, 0x80, 0xE0, 0x81, 0xF0, 0x00, 0xF8, 0x80,
+  0xFC, 0x88, 0xFF, 0x00, 0xFC, 0x90, 0x00, 0x00, 0xFC, 0x88, 0xFF, 0x04, 0xFE, 0xFC, 0xFC, 0xF8,
+  0xF8, 0x81, 0xF0, 0x81, 0xE0, 0x82, 0xC0, 0xAE, 0x00, 0x9B, 0xFF, 0x90, 0x00, 0x9B, 0xFF, 0xAF,
+  0x00, 0x01, 0x77, 0x7F, 0x82, 0x1F, 0x81, 0x3F, 0x01, 0x7F, 0xFF, 0x82, 0x3F, 0x0A, 0xFF, 0xFF,
+  0x3F, 0x3F, 0x1F, 0x1F, 0xFF, 0xFF, 0x0F, 0x07, 0x01, 0x90, 0x00, 0x0A, 0x01, 0x0F, 0x9F, 0xFF,
+  0xFF, 0x1F, 0x1F, 0x3F, 0x3F, 0xFF, 0x7F, 0x82, 0x3F, 0x01, 0xFF, 0xFF, 0x81, 0x3F, 0x81, 0x1F,
+  0x80, 0xFF, 0xBA, 0x00, 0x03, 0xF0, 0xFC, 0xFF, 0x70, 0x80, 0x00, 0x02, 0xC0, 0xF0, 0xC1, 0x81,
+  0x00, 0x00, 0x80, 0x96, 0x00, 0x80, 0x03, 0x80, 0x00, 0x03, 0x70, 0xFF, 0xFE, 0x70, 0x82, 0x00,
+  0x00, 0x01, 0x86, 0x00, 0x01, 0x01, 0x01, 0xBA, 0x00, 0x80, 0x01, 0x86, 0x00, 0x03, 0xE0, 0xF8,
+  0xFF, 0xE0, 0x95, 0x00, 0x03, 0xF0, 0xFE, 0xF8, 0xC0, 0x85, 0x00, 0x03, 0xF0, 0xF8, 0xFF, 0xF0,
+  0xD1, 0x00, 0x81, 0x03, 0x95, 0x00, 0x02, 0x01, 0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xAD, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x92,
+  0x00, 0x82, 0x80, 0x9C, 0x00, 0x81, 0x80, 0xC1, 0x00, 0x83, 0xC0, 0x81, 0xE0, 0x81, 0xF0, 0x04,
+  0xF8, 0xF8, 0xFC, 0xFE, 0xFE, 0x87, 0xFF, 0x01, 0xFE, 0xF0, 0x8F, 0x00, 0x00, 0xFC, 0x88, 0xFF,
+  0x04, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0x81, 0xF0, 0x81, 0xE0, 0x82, 0xC0, 0xAE, 0x00, 0x00, 0x3F,
+  0x9A, 0xFF, 0x00, 0x7F, 0x8F, 0x00, 0x9B, 0xFF, 0xAF, 0x00, 0x01, 0x07, 0xFF, 0x81, 0x1F, 0x82,
+  0x3F, 0x02, 0x7F, 0xFF, 0x7F, 0x82, 0x3F, 0x09, 0xFF, 0xFF, 0x3F, 0x1F, 0x1F, 0xFF, 0xFF, 0x9F,
+  0x0F, 0x03, 0x90, 0x00, 0x0A, 0x01, 0x07, 0x1F, 0x7F, 0xFF, 0x7F, 0x3F, 0x3F, 0x7F, 0xFF, 0xFF,
+  0x82, 0x3F, 0x01, 0xFF, 0xFF, 0x82, 0x3F, 0x81, 0x1F, 0x02, 0xFF, 0xFF, 0x03, 0xAF, 0x00, 0x02,
+  0x1F, 0x1F, 0x0E, 0x84, 0x00, 0x03, 0xE0, 0xFF, 0xFF, 0xF0, 0x80, 0x00, 0x09, 0xC0, 0xF0, 0xFF,
+  0xFE, 0xE0, 0x00, 0x00, 0x07, 0x0F, 0x0F, 0x93, 0x00, 0x04, 0xE0, 0xF8, 0xFE, 0xFF, 0x70, 0x80,
+  0x00, 0x01, 0xFF, 0xFF, 0x82, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x84, 0x00, 0x03, 0x03, 0x0F, 0x0F,
+  0x06, 0xB9, 0x00, 0x80, 0x03, 0x00, 0x01, 0x81, 0x00, 0x80, 0x01, 0x9A, 0x00, 0x01, 0x01, 0x01,
+  0x81, 0x00, 0x80, 0xFF, 0x00, 0x30, 0x81, 0x00, 0x01, 0x79, 0x39, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA5, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0x97, 0x00, 0x01, 0x80, 0xC0, 0x82, 0xE0, 0x01, 0xC0, 0x80, 0x92, 0x00, 0x01, 0x80,
+  0xC0, 0x83, 0xE0, 0x01, 0xC0, 0x80, 0xC1, 0x00, 0x85, 0xE0, 0x81, 0xF0, 0x01, 0xF8, 0xF8, 0x80,
+  0xFC, 0x00, 0xFE, 0x89, 0xFF, 0x00, 0x80, 0x8F, 0x00, 0x00, 0xFC, 0x88, 0xFF, 0x03, 0xFE, 0xFE,
+  0xFC, 0xFC, 0x80, 0xF8, 0x81, 0xF0, 0x84, 0xE0, 0xAE, 0x00, 0x00, 0x3F, 0x9A, 0xFF, 0x00, 0x07,
+  0x8F, 0x00, 0x9B, 0xFF, 0xAF, 0x00, 0x02, 0x23, 0x7F, 0x7F, 0x80, 0x1F, 0x82, 0x3F, 0x02, 0x7F,
+  0xFF, 0x7F, 0x82, 0x3F, 0x01, 0xFF, 0x7F, 0x80, 0x3F, 0x04, 0xFF, 0xFF, 0xBF, 0x0F, 0x03, 0x90,
+  0x00, 0x04, 0x01, 0x07, 0x1F, 0xFF, 0xFF, 0x81, 0x3F, 0x01, 0xFF, 0xFF, 0x82, 0x3F, 0x01, 0xFF,
+  0xFF, 0x83, 0x3F, 0x80, 0x1F, 0x02, 0x7F, 0x7F, 0x01, 0xAF, 0x00, 0x02, 0xC0, 0xF0, 0xE0, 0x84,
+  0x00, 0x03, 0x70, 0xFE, 0xFF, 0x70, 0x81, 0x00, 0x02, 0x0E, 0x0F, 0x0E, 0x80, 0x00, 0x02, 0x03,
+  0x07, 0x07, 0x94, 0x00, 0x09, 0x0E, 0x1F, 0x0F, 0x06, 0x00, 0x00, 0x18, 0x3E, 0x3F, 0x1C, 0x81,
+  0x00, 0x80, 0x07, 0x85, 0x00, 0x00, 0xC0, 0xB1, 0x00, 0x02, 0x01, 0x03, 0x03, 0x93, 0x00, 0x00,
+  0xC0, 0x96, 0x00, 0x00, 0x80, 0x88, 0x00, 0x03, 0xC0, 0xF8, 0xE0, 0x80, 0x84, 0x00, 0x02, 0x06,
+  0x1F, 0x0F, 0xC8, 0x00, 0x02, 0x02, 0x07, 0x07, 0x95, 0x00, 0x01, 0x0F, 0x0E, 0x87, 0x00, 0x03,
+  0x01, 0x03, 0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA1, 0x00, 0x02, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x9C, 0x00, 0x02, 0x80, 0x80, 0xC0, 0x82,
+  0xE0, 0x01, 0xC0, 0x80, 0x92, 0x00, 0x01, 0x80, 0xC0, 0x83, 0xE0, 0x01, 0xC0, 0x80, 0xC1, 0x00,
+  0x01, 0xC0, 0xC0, 0x83, 0xE0, 0x81, 0xF0, 0x01, 0xF8, 0xF8, 0x80, 0xFC, 0x00, 0xFE, 0x89, 0xFF,
+  0x90, 0x00, 0x89, 0xFF, 0x00, 0xFE, 0x80, 0xFC, 0x01, 0xF8, 0xF8, 0x81, 0xF0, 0x83, 0xE0, 0x01,
+  0xC0, 0xC0, 0xAE, 0x00, 0x9B, 0xFF, 0x90, 0x00, 0x9A, 0xFF, 0x00, 0x7F, 0xAE, 0x00, 0x02, 0x01,
+  0x0F, 0xFF, 0x80, 0x1F, 0x83, 0x3F, 0x01, 0x7F, 0xFF, 0x82, 0x3F, 0x02, 0x7F, 0xFF, 0x7F, 0x80,
+  0x3F, 0x04, 0xFF, 0xFF, 0x1F, 0x0F, 0x03, 0x90, 0x00, 0x04, 0x03, 0x07, 0x1F, 0xFF, 0xFF, 0x80,
+  0x3F, 0x02, 0x7F, 0xFF, 0xFF, 0x82, 0x3F, 0x01, 0xFF, 0xFF, 0x83, 0x3F, 0x80, 0x1F, 0x01, 0xFF,
+  0x1F, 0xB0, 0x00, 0x02, 0x1E, 0x1F, 0x0E, 0x84, 0x00, 0x02, 0xF0, 0xFC, 0xFF, 0x81, 0x00, 0x02,
+  0x80, 0xFE, 0xCF, 0x81, 0x00, 0x02, 0xF1, 0xF1, 0x80, 0x94, 0x00, 0x02, 0x01, 0x03, 0x03, 0x81,
+  0x00, 0x01, 0x8F, 0xF0, 0x81, 0x00, 0x03, 0xE0, 0xFC, 0xFC, 0xE0, 0x84, 0x00, 0x02, 0x0C, 0x1F,
+  0x1F, 0xC1, 0x00, 0x80, 0x1F, 0x03, 0x1E, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0x94, 0x00, 0x09, 0xE0,
+  0xFC, 0xFC, 0xC0, 0x00, 0x00, 0x3E, 0x3F, 0x3F, 0x1F, 0x81, 0x00, 0x01, 0x01, 0x01, 0xED, 0x00,
+  0x02, 0x01, 0x03, 0x03, 0x89, 0x00, 0x01, 0x0C, 0x0C, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0x9B, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA2, 0x00,
+  0x08, 0x80, 0xC0, 0xC0, 0x80, 0x80, 0xC0, 0xC0, 0x80, 0x80, 0x92, 0x00, 0x87, 0x80, 0xC2, 0x00,
+  0x82, 0xC0, 0x81, 0xE0, 0x80, 0xF0, 0x05, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0x88, 0xFF, 0x00,
+  0xE0, 0x8F, 0x00, 0x00, 0xFE, 0x88, 0xFF, 0x04, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0x80, 0xF0, 0x81,
+  0xE0, 0x82, 0xC0, 0x00, 0x80, 0xAF, 0x00, 0x9A, 0xFF, 0x00, 0x1F, 0x8F, 0x00, 0x9B, 0xFF, 0xAF,
+  0x00, 0x02, 0x63, 0xFF, 0x7F, 0x83, 0x1F, 0x80, 0x3F, 0x00, 0xFF, 0x83, 0x3F, 0x01, 0xFF, 0x7F,
+  0x80, 0x1F, 0x04, 0x7F, 0xFF, 0x1F, 0x07, 0x03, 0x90, 0x00, 0x0C, 0x03, 0x07, 0x1F, 0xFF, 0xFF,
+  0x3F, 0x1F, 0x1F, 0x3F, 0xFF, 0x7F, 0x1F, 0x1F, 0x80, 0x3F, 0x02, 0xFF, 0x7F, 0x3F, 0x84, 0x1F,
+  0x02, 0x0F, 0xFF, 0xFF, 0xB0, 0x00, 0x02, 0x38, 0x3E, 0x38, 0x84, 0x00, 0x03, 0x80, 0xF0, 0xFC,
+  0xC0, 0x81, 0x00, 0x01, 0xE0, 0xFF, 0x81, 0x00, 0x01, 0x80, 0xF1, 0x95, 0x00, 0x02, 0x03, 0x87,
+  0x03, 0x81, 0x00, 0x01, 0xFF, 0xC4, 0x82, 0x00, 0x01, 0xF8, 0xC0, 0x85, 0x00, 0x03, 0x08, 0x1F,
+  0x3E, 0x18, 0xB9, 0x00, 0x03, 0x01, 0x01, 0x03, 0x01, 0x80, 0x00, 0x03, 0x3E, 0x3F, 0x3F, 0x3E,
+  0x80, 0x00, 0x80, 0x3F, 0x00, 0x18, 0x93, 0x00, 0x09, 0xF8, 0xFF, 0xFC, 0xF0, 0x00, 0x00, 0x7C,
+  0x7F, 0x7F, 0x3E, 0x80, 0x00, 0x03, 0x03, 0x07, 0x07, 0x03, 0xED, 0x00, 0x00, 0x01, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA5, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xA5, 0x00, 0x86, 0x80, 0xE1, 0x00, 0x80, 0x80, 0x81, 0xC0, 0x80, 0xE0, 0x80,
+  0xF0, 0x04, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0x88, 0xFF, 0x00, 0xE0, 0x8F, 0x00, 0x00, 0xFE, 0x87,
+  0xFF, 0x04, 0xFE, 0xFE, 0xFC, 0xF8, 0xF8, 0x80, 0xF0, 0x80, 0xE0, 0x81, 0xC0, 0x80, 0x80, 0xB0,
+  0x00, 0x9A, 0xFF, 0x00, 0x0F, 0x8F, 0x00, 0x9A, 0xFF, 0x00, 0x01, 0xAF, 0x00, 0x03, 0x01, 0x0F,
+  0x3F, 0x0F, 0x84, 0x1F, 0x03, 0x3F, 0xFF, 0x7F, 0x3F, 0x80, 0x1F, 0x02, 0x3F, 0xFF, 0xFF, 0x80,
+  0x1F, 0x04, 0x3F, 0xFF, 0x1F, 0x0F, 0x03, 0x90, 0x00, 0x04, 0x01, 0x07, 0x0F, 0x7F, 0x7F, 0x80,
+  0x1F, 0x02, 0x7F, 0xFF, 0x7F, 0x80, 0x1F, 0x04, 0x3F, 0x3F, 0xFF, 0x7F, 0x3F, 0x84, 0x1F, 0x02,
+  0x0F, 0x1F, 0x03, 0xB1, 0x00, 0x02, 0xE0, 0xFC, 0xC0, 0x84, 0x00, 0x02, 0x06, 0x0F, 0x07, 0x81,
+  0x00, 0x02, 0x78, 0xFF, 0xFC, 0x80, 0x00, 0x03, 0x78, 0xFF, 0xFE, 0x78, 0x94, 0x00, 0x01, 0xE0,
+  0xFC, 0x80, 0x00, 0x03, 0xE0, 0xFF, 0xFE, 0xF0, 0x80, 0x00, 0x03, 0x0C, 0x1F, 0x1F, 0x1C, 0x84,
+  0x00, 0x02, 0xF0, 0xFC, 0xE0, 0xB1, 0x00, 0x02, 0x03, 0x03, 0x01, 0x84, 0x00, 0x02, 0xF0, 0xFC,
+  0xE0, 0xA1, 0x00, 0x05, 0x0F, 0x1F, 0x1F, 0x0F, 0x00, 0x00, 0x80, 0x01, 0x8C, 0x00, 0x80, 0x01,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x87, 0x00, 0x02, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x95, 0x00, 0x81, 0x80, 0x80, 0xC0, 0x01,
+  0xE0, 0xE0, 0x80, 0xF0, 0x00, 0xF8, 0x88, 0xFC, 0x00, 0xF8, 0x8F, 0x00, 0x01, 0xF0, 0xF8, 0x88,
+  0xFC, 0x00, 0xF8, 0x80, 0xF0, 0x03, 0xE0, 0xE0, 0xC0, 0xC0, 0x82, 0x80, 0xB4, 0x00, 0x9A, 0xFF,
+  0x8F, 0x00, 0x00, 0x7F, 0x99, 0xFF, 0xB2, 0x00, 0x02, 0x87, 0xFF, 0x0F, 0x85, 0x1F, 0x01, 0x7F,
+  0x3F, 0x82, 0x1F, 0x00, 0xFF, 0x82, 0x1F, 0x03, 0xFF, 0x0F, 0x07, 0x01, 0x90, 0x00, 0x03, 0x03,
+  0x07, 0x9F, 0xFF, 0x81, 0x1F, 0x00, 0xFF, 0x82, 0x1F, 0x02, 0x3F, 0x7F, 0x3F, 0x84, 0x1F, 0x03,
+  0x0F, 0xFF, 0xFF, 0xC3, 0xB2, 0x00, 0x02, 0x07, 0x0F, 0x07, 0x84, 0x00, 0x02, 0xF0, 0xF8, 0x40,
+  0x82, 0x00, 0x01, 0x07, 0x06, 0x80, 0x00, 0x02, 0x7C, 0xFF, 0x78, 0x94, 0x00, 0x01, 0x07, 0x07,
+  0x81, 0x00, 0x01, 0x0F, 0x07, 0x82, 0x00, 0x00, 0xE0, 0xEE, 0x00, 0x02, 0xC0, 0xF0, 0xFC, 0x80,
+  0x00, 0x03, 0xE0, 0xFE, 0xFF, 0xF8, 0x80, 0x00, 0x03, 0x1C, 0x3F, 0x3F, 0x1C, 0xED, 0x00, 0x01,
+  0x01, 0x01, 0x81, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x9B,
+  0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x9C, 0x00,
+  0x80, 0x80, 0x89, 0xC0, 0x00, 0x80, 0x8E, 0x00, 0x84, 0x80, 0x83, 0xC0, 0x80, 0x80, 0xBF, 0x00,
+  0x00, 0xF8, 0x82, 0xFC, 0x82, 0xFE, 0x8E, 0xFF, 0x00, 0x1F, 0x8E, 0x00, 0x8F, 0xFF, 0x82, 0xFE,
+  0x82, 0xFC, 0x00, 0x78, 0xB2, 0x00, 0x03, 0x01, 0x07, 0x0F, 0x0F, 0x84, 0x1F, 0x02, 0xFF, 0xFF,
+  0x3F, 0x81, 0x1F, 0x01, 0x9F, 0xFF, 0x81, 0x1F, 0x03, 0xFF, 0xFF, 0x07, 0x03, 0x8F, 0x00, 0x02,
+  0x01, 0x07, 0x0F, 0x88, 0x1F, 0x03, 0x3F, 0x7F, 0xFF, 0x3F, 0x83, 0x1F, 0x80, 0x0F, 0x00, 0x03,
+  0xBE, 0x00, 0x02, 0x77, 0x67, 0x03, 0x81, 0x00, 0x02, 0x03, 0x03, 0x01, 0x9E, 0x00, 0x01, 0x04,
+  0x0E, 0x82, 0x00, 0x02, 0x07, 0x0F, 0x06, 0x84, 0x00, 0x02, 0xF0, 0xF8, 0xC0, 0xCB, 0x00, 0x02,
+  0xF0, 0xF0, 0x40, 0x92, 0x00, 0x02, 0x1C, 0x3E, 0x18, 0x91, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x8C, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x8C, 0x00, 0x01, 0xF0, 0xF0, 0x84, 0xF8,
+  0x80, 0xFC, 0x81, 0xFE, 0x80, 0xFF, 0x85, 0xFE, 0x00, 0x7E, 0x8E, 0x00, 0x88, 0xFE, 0x00, 0xFF,
+  0x81, 0xFE, 0x80, 0xFC, 0x84, 0xF8, 0x01, 0xF0, 0xF0, 0xB4, 0x00, 0x04, 0x01, 0x07, 0x87, 0x0F,
+  0x0F, 0x83, 0x1F, 0x01, 0xFF, 0x3F, 0x82, 0x1F, 0x00, 0xFF, 0x80, 0x1F, 0x04, 0x0F, 0x0F, 0xDF,
+  0x07, 0x03, 0x90, 0x00, 0x04, 0x03, 0x8F, 0xFF, 0x8F, 0x0F, 0x86, 0x1F, 0x01, 0x3F, 0x3F, 0x83,
+  0x1F, 0x80, 0x0F, 0x00, 0x07, 0xBF, 0x00, 0x02, 0x22, 0x37, 0x07, 0x82, 0x00, 0x01, 0x07, 0x03,
+  0x80, 0x00, 0x02, 0x07, 0x07, 0x06, 0x92, 0x00, 0x80, 0x01, 0x80, 0x00, 0x01, 0x06, 0x07, 0x81,
+  0x00, 0x02, 0x20, 0x78, 0x78, 0x85, 0x00, 0x00, 0xC0, 0xFB, 0x00, 0x02, 0x07, 0x07, 0x06, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x8E, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x8C, 0x00, 0x01, 0x08, 0x08, 0x82,
+  0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x85, 0x01, 0x00,
+  0x80, 0x8E, 0x00, 0x00, 0xC0, 0x83, 0x00, 0x81, 0x01, 0x09, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02,
+  0x02, 0x00, 0x04, 0x04, 0x82, 0x00, 0x01, 0x08, 0x08, 0xB6, 0x00, 0x00, 0x88, 0x86, 0x00, 0x00,
+  0xC0, 0x82, 0x00, 0x01, 0x20, 0x80, 0x81, 0x00, 0x00, 0x20, 0x93, 0x00, 0x02, 0x88, 0x00, 0x60,
+  0x88, 0x00, 0x00, 0x40, 0x86, 0x00, 0x01, 0x08, 0x01, 0xBE, 0x00, 0x02, 0x02, 0x00, 0x20, 0x83,
+  0x00, 0x00, 0x04, 0x80, 0x00, 0x02, 0x04, 0x00, 0x01, 0x92, 0x00, 0x00, 0x01, 0x88, 0x00, 0x03,
+  0x20, 0x40, 0x06, 0x30, 0xEE, 0x00, 0x00, 0x80, 0x91, 0x00, 0x02, 0x05, 0x00, 0x01, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x8E, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x9A, 0x00, 0x80, 0x80, 0x03, 0xC0, 0xC0, 0xE0, 0xE0,
+  0x87, 0xF0, 0x01, 0xE0, 0xC0, 0x8E, 0x00, 0x00, 0xC0, 0x87, 0xE0, 0x04, 0xF0, 0xE0, 0xE0, 0xC0,
+  0xC0, 0x80, 0x80, 0xBC, 0x00, 0x00, 0xFC, 0x82, 0xFE, 0x93, 0xFF, 0x00, 0x3F, 0x8E, 0x00, 0x94,
+  0xFF, 0x82, 0xFE, 0x00, 0xFC, 0xB2, 0x00, 0x03, 0x01, 0x07, 0x0F, 0x0F, 0x84, 0x1F, 0x02, 0xBF,
+  0xFF, 0x3F, 0x82, 0x1F, 0x00, 0xFF, 0x81, 0x1F, 0x03, 0x3F, 0x0F, 0x07, 0x03, 0x90, 0x00, 0x03,
+  0x03, 0x07, 0x1F, 0x3F, 0x81, 0x1F, 0x00, 0x3F, 0x82, 0x1F, 0x02, 0xFF, 0xFF, 0xBF, 0x84, 0x1F,
+  0x03, 0x0F, 0x8F, 0x07, 0x01, 0xB3, 0x00, 0x02, 0x80, 0xE0, 0xC0, 0x84, 0x00, 0x01, 0x71, 0x43,
+  0x83, 0x00, 0x00, 0x08, 0x81, 0x00, 0x00, 0x80, 0x94, 0x00, 0x02, 0x80, 0xF0, 0xC0, 0x80, 0x00,
+  0x02, 0x06, 0x0F, 0x06, 0x81, 0x00, 0x02, 0x01, 0x03, 0x03, 0x84, 0x00, 0x02, 0x0C, 0x1F, 0x3E,
+  0xB4, 0x00, 0x80, 0x03, 0x90, 0x00, 0x02, 0x38, 0x7F, 0x3C, 0x93, 0x00, 0x02, 0x03, 0x07, 0x03,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA1, 0x00, 0x02, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x95, 0x00, 0x81, 0x80, 0x80, 0xC0, 0x01,
+  0xE0, 0xE0, 0x80, 0xF0, 0x00, 0xF8, 0x88, 0xFC, 0x00, 0xF8, 0x8F, 0x00, 0x01, 0xF0, 0xF8, 0x88,
+  0xFC, 0x02, 0xF8, 0xF0, 0xF0, 0x80, 0xE0, 0x01, 0xC0, 0xC0, 0x82, 0x80, 0xB4, 0x00, 0x9A, 0xFF,
+  0x8F, 0x00, 0x9A, 0xFF, 0xB2, 0x00, 0x02, 0x87, 0xFF, 0x0F, 0x85, 0x1F, 0x01, 0x7F, 0x3F, 0x82,
+  0x1F, 0x00, 0xFF, 0x82, 0x1F, 0x03, 0xBF, 0x0F, 0x07, 0x01, 0x90, 0x00, 0x03, 0x03, 0x07, 0x9F,
+  0xFF, 0x81, 0x1F, 0x00, 0xFF, 0x82, 0x1F, 0x02, 0x3F, 0xFF, 0x3F, 0x84, 0x1F, 0x03, 0x0F, 0xFF,
+  0xFF, 0x43, 0xB2, 0x00, 0x02, 0x07, 0x0F, 0x07, 0x84, 0x00, 0x02, 0xF0, 0xF8, 0x40, 0x82, 0x00,
+  0x01, 0x07, 0x06, 0x80, 0x00, 0x02, 0x7E, 0xFF, 0x70, 0x94, 0x00, 0x01, 0x07, 0x07, 0x81, 0x00,
+  0x01, 0x0F, 0x07, 0x82, 0x00, 0x00, 0xE0, 0xEE, 0x00, 0x02, 0xC0, 0xF8, 0xF8, 0x80, 0x00, 0x03,
+  0xE0, 0xFE, 0xFF, 0xF8, 0x80, 0x00, 0x03, 0x1C, 0x3F, 0x3F, 0x1C, 0xED, 0x00, 0x01, 0x01, 0x01,
+  0x81, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x9B, 0x00, 0x02,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA5, 0x00, 0x85, 0x80, 0x94, 0x00,
+  0x01, 0x80, 0x80, 0x81, 0x00, 0x01, 0x80, 0x80, 0xC2, 0x00, 0x80, 0x80, 0x81, 0xC0, 0x80, 0xE0,
+  0x81, 0xF0, 0x03, 0xF8, 0xFC, 0xFC, 0xFE, 0x88, 0xFF, 0x00, 0xFE, 0x8F, 0x00, 0x00, 0xFC, 0x88,
+  0xFF, 0x04, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0x80, 0xF0, 0x01, 0xE0, 0xE0, 0x81, 0xC0, 0x81, 0x80,
+  0xAF, 0x00, 0x9B, 0xFF, 0x8F, 0x00, 0x9B, 0xFF, 0xB0, 0x00, 0x02, 0x07, 0x7F, 0x0F, 0x84, 0x1F,
+  0x03, 0x3F, 0xFF, 0xFF, 0x3F, 0x81, 0x1F, 0x02, 0xFF, 0xFF, 0x3F, 0x80, 0x1F, 0x04, 0xFF, 0xFF,
+  0x0F, 0x07, 0x01, 0x90, 0x00, 0x09, 0x07, 0x0F, 0x3F, 0xFF, 0x3F, 0x1F, 0x1F, 0x3F, 0xFF, 0xFF,
+  0x81, 0x1F, 0x03, 0x3F, 0xFF, 0xFF, 0x3F, 0x84, 0x1F, 0x03, 0x0F, 0x1F, 0x0F, 0x01, 0xB0, 0x00,
+  0x02, 0x78, 0x7F, 0x7C, 0x85, 0x00, 0x01, 0x07, 0x07, 0x81, 0x00, 0x09, 0x18, 0x3F, 0x3F, 0x38,
+  0x00, 0x00, 0x08, 0x1F, 0x3F, 0x1E, 0x93, 0x00, 0x09, 0xC0, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x70,
+  0xFC, 0xFF, 0x7C, 0x81, 0x00, 0x02, 0x0F, 0x0F, 0x0E, 0x84, 0x00, 0x03, 0x38, 0x7F, 0x7C, 0x30,
+  0xBA, 0x00, 0x02, 0x38, 0x7F, 0x3C, 0xA1, 0x00, 0x03, 0x01, 0x03, 0x07, 0x03, 0x87, 0x00, 0x01,
+  0xE0, 0x80, 0xEE, 0x00, 0x00, 0x04, 0x88, 0x00, 0x02, 0x03, 0x07, 0x03, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0x95, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0x9F, 0x00, 0x01, 0x80, 0xC0, 0x82, 0xE0, 0x01, 0xC0, 0xC0, 0x92, 0x00, 0x02, 0x80, 0xC0,
+  0xC0, 0x82, 0xE0, 0x01, 0xC0, 0x80, 0xC2, 0x00, 0x84, 0xE0, 0x81, 0xF0, 0x80, 0xF8, 0x03, 0xFC,
+  0xFC, 0xFE, 0xFE, 0x88, 0xFF, 0x00, 0xF0, 0x8F, 0x00, 0x00, 0xF8, 0x88, 0xFF, 0x05, 0xFE, 0xFE,
+  0xFC, 0xFC, 0xF8, 0xF8, 0x81, 0xF0, 0x85, 0xE0, 0xAF, 0x00, 0x9A, 0xFF, 0x00, 0x7F, 0x8F, 0x00,
+  0x9B, 0xFF, 0xAF, 0x00, 0x02, 0x03, 0xFF, 0xFF, 0x80, 0x1F, 0x82, 0x3F, 0x02, 0x7F, 0xFF, 0x7F,
+  0x82, 0x3F, 0x01, 0xFF, 0xFF, 0x80, 0x3F, 0x04, 0x7F, 0xFF, 0x3F, 0x0F, 0x03, 0x91, 0x00, 0x04,
+  0x07, 0x0F, 0x7F, 0xFF, 0x7F, 0x80, 0x3F, 0x01, 0xFF, 0xFF, 0x82, 0x3F, 0x02, 0x7F, 0xFF, 0x7F,
+  0x82, 0x3F, 0x80, 0x1F, 0x02, 0xFF, 0xFF, 0x03, 0xAF, 0x00, 0x02, 0x06, 0x0F, 0x0F, 0x85, 0x00,
+  0x02, 0x3E, 0x7F, 0x38, 0x80, 0x00, 0x0A, 0xC0, 0xF0, 0xFF, 0xE0, 0x80, 0x00, 0x00, 0xF0, 0xFF,
+  0xFE, 0xF0, 0x93, 0x00, 0x0A, 0xE0, 0xFE, 0xFF, 0xF0, 0x00, 0x00, 0x80, 0xE0, 0xFF, 0xF0, 0x80,
+  0x80, 0x00, 0x02, 0x3C, 0x3F, 0x3C, 0x85, 0x00, 0x02, 0x0F, 0x0F, 0x06, 0xBA, 0x00, 0x02, 0xF0,
+  0xF8, 0xC0, 0x80, 0x00, 0x00, 0x01, 0x80, 0x03, 0x00, 0x01, 0x80, 0x00, 0x01, 0x01, 0x01, 0x95,
+  0x00, 0x01, 0x01, 0x01, 0x80, 0x00, 0x03, 0x01, 0x03, 0x07, 0x03, 0x81, 0x00, 0x02, 0xC0, 0xF8,
+  0xF0, 0xC6, 0x00, 0x00, 0x01, 0xB1, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0x99, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x9F,
+  0x00, 0x85, 0x80, 0x94, 0x00, 0x86, 0x80, 0xC1, 0x00, 0x82, 0xC0, 0x81, 0xE0, 0x81, 0xF0, 0x04,
+  0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0x88, 0xFF, 0x00, 0xFC, 0x90, 0x00, 0x00, 0xFE, 0x88, 0xFF, 0x04,
+  0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0x81, 0xF0, 0x81, 0xE0, 0x82, 0xC0, 0xAE, 0x00, 0x9B, 0xFF, 0x90,
+  0x00, 0x9A, 0xFF, 0x00, 0x7F, 0xAF, 0x00, 0x02, 0x07, 0x1F, 0x0F, 0x84, 0x1F, 0x0A, 0x3F, 0x7F,
+  0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x3F, 0x3F, 0xFF, 0x3F, 0x80, 0x1F, 0x04, 0xFF, 0xFF, 0x1F, 0x07,
+  0x01, 0x90, 0x00, 0x04, 0x03, 0x07, 0x0F, 0xFF, 0xFF, 0x80, 0x1F, 0x02, 0x3F, 0xFF, 0x7F, 0x82,
+  0x3F, 0x02, 0xFF, 0xFF, 0x3F, 0x84, 0x1F, 0x02, 0x0F, 0x1F, 0x03, 0xBB, 0x00, 0x01, 0xF0, 0x80,
+  0x82, 0x00, 0x02, 0x0F, 0x0F, 0x04, 0x80, 0x00, 0x80, 0x0F, 0x94, 0x00, 0x02, 0x06, 0x0F, 0x0F,
+  0x81, 0x00, 0x01, 0x1F, 0x0F, 0x82, 0x00, 0x01, 0x81, 0xE1, 0x86, 0x00, 0x01, 0xF0, 0x80, 0xBA,
+  0x00, 0x02, 0x07, 0x0F, 0x07, 0x81, 0x00, 0x02, 0xC0, 0xF8, 0xE0, 0x81, 0x00, 0x02, 0xE0, 0xF8,
+  0xC0, 0x95, 0x00, 0x01, 0xF0, 0xC0, 0x80, 0x00, 0x03, 0xF0, 0xFC, 0xFF, 0xF0, 0x80, 0x00, 0x03,
+  0x04, 0x0F, 0x0F, 0x0E, 0x84, 0x00, 0x02, 0x02, 0x07, 0x07, 0xC1, 0x00, 0x80, 0x07, 0x06, 0x03,
+  0x00, 0x00, 0x07, 0x0F, 0x0F, 0x07, 0x94, 0x00, 0x03, 0x03, 0x07, 0x07, 0x03, 0x80, 0x00, 0x01,
+  0x01, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA1, 0x00, 0x02, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x98, 0x00, 0x82, 0x80, 0x9D, 0x00, 0x80, 0x80, 0xC1,
+  0x00, 0x00, 0x40, 0x83, 0xC0, 0x81, 0xE0, 0x80, 0xF0, 0x04, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0x87,
+  0xFF, 0x01, 0xFE, 0xF0, 0x8F, 0x00, 0x01, 0xF8, 0xFE, 0x87, 0xFF, 0x00, 0xFE, 0x80, 0xFC, 0x01,
+  0xF8, 0xF8, 0x80, 0xF0, 0x81, 0xE0, 0x82, 0xC0, 0xAF, 0x00, 0x9A, 0xFF, 0x00, 0x3F, 0x8F, 0x00,
+  0x9B, 0xFF, 0xAF, 0x00, 0x02, 0x63, 0xFF, 0x7F, 0x81, 0x1F, 0x81, 0x3F, 0x02, 0x7F, 0xFF, 0x7F,
+  0x81, 0x3F, 0x0A, 0x7F, 0xFF, 0xFF, 0x3F, 0x1F, 0x1F, 0xBF, 0xFF, 0x9F, 0x0F, 0x03, 0x91, 0x00,
+  0x09, 0x03, 0x0F, 0xFF, 0xFF, 0x3F, 0x1F, 0x1F, 0x3F, 0xFF, 0xFF, 0x82, 0x3F, 0x02, 0xFF, 0xFF,
+  0xBF, 0x80, 0x3F, 0x81, 0x1F, 0x03, 0xDF, 0xFF, 0xFF, 0x81, 0xB9, 0x00, 0x03, 0x80, 0xE0, 0xFF,
+  0xE0, 0x81, 0x00, 0x02, 0x80, 0xC1, 0x01, 0x81, 0x00, 0x01, 0x01, 0x01, 0x94, 0x00, 0x09, 0x03,
+  0x07, 0x07, 0x01, 0x00, 0x00, 0x40, 0xF8, 0xFF, 0xF0, 0x82, 0x00, 0x01, 0x03, 0x01, 0x85, 0x00,
+  0x01, 0x01, 0x01, 0xBA, 0x00, 0x81, 0x07, 0x86, 0x00, 0x02, 0xE0, 0xF8, 0xE0, 0x95, 0x00, 0x03,
+  0xC0, 0xF8, 0xFC, 0xC0, 0x80, 0x00, 0x01, 0x01, 0x01, 0x81, 0x00, 0x02, 0xE0, 0xFC, 0xFC, 0xD1,
+  0x00, 0x03, 0x03, 0x0F, 0x0F, 0x07, 0x95, 0x00, 0x03, 0x03, 0x07, 0x07, 0x03, 0x86, 0x00, 0x02,
+  0x01, 0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA1, 0x00, 0x02, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x91, 0x00, 0x04, 0x80, 0x80, 0xC0, 0xE0, 0xF0,
+  0x81, 0xE0, 0x01, 0xC0, 0x80, 0x91, 0x00, 0x01, 0x80, 0xC0, 0x80, 0xE0, 0x04, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x80, 0xC2, 0x00, 0x84, 0xE0, 0x81, 0xF0, 0x80, 0xF8, 0x02, 0xFC, 0xFC, 0xFE, 0x89, 0xFF,
+  0x00, 0xFC, 0x8F, 0x00, 0x00, 0xFE, 0x89, 0xFF, 0x00, 0xFE, 0x80, 0xFC, 0x01, 0xF8, 0xF8, 0x82,
+  0xF0, 0x83, 0xE0, 0xAF, 0x00, 0x9B, 0xFF, 0x8F, 0x00, 0x9B, 0xFF, 0xAF, 0x00, 0x04, 0x87, 0xFF,
+  0xDF, 0x1F, 0x1F, 0x83, 0x3F, 0x02, 0x7F, 0xFF, 0x7F, 0x81, 0x3F, 0x02, 0x7F, 0xFF, 0xFF, 0x80,
+  0x3F, 0x04, 0x7F, 0xFF, 0x1F, 0x0F, 0x07, 0x90, 0x00, 0x0A, 0x01, 0x07, 0x1F, 0x3F, 0xFF, 0x7F,
+  0x3F, 0x3F, 0x7F, 0xFF, 0xFF, 0x82, 0x3F, 0x02, 0x7F, 0xFF, 0x7F, 0x82, 0x3F, 0x80, 0x1F, 0x02,
+  0x9F, 0x1F, 0x03, 0xAF, 0x00, 0x80, 0x07, 0x85, 0x00, 0x01, 0x06, 0xCF, 0x81, 0x00, 0x03, 0x80,
+  0xF0, 0xFF, 0x80, 0x80, 0x00, 0x03, 0xF8, 0xFF, 0xE0, 0x80, 0x95, 0x00, 0x01, 0xF1, 0x80, 0x80,
+  0x00, 0x02, 0x03, 0xFF, 0xC0, 0x80, 0x00, 0x03, 0x80, 0xFC, 0xF0, 0xC0, 0x84, 0x00, 0x03, 0x1C,
+  0x3F, 0x3F, 0x08, 0xBA, 0x00, 0x02, 0x1E, 0x1F, 0x1E, 0x80, 0x00, 0x00, 0x07, 0x80, 0x0F, 0x06,
+  0x06, 0x00, 0x00, 0x03, 0x07, 0x07, 0x03, 0x94, 0x00, 0x05, 0x78, 0xFF, 0xFF, 0xFE, 0x30, 0x0C,
+  0x80, 0x1F, 0x06, 0x0F, 0x00, 0x00, 0x01, 0x03, 0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xA4, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0x98, 0x00, 0x01, 0x80, 0xC0, 0x83, 0xE0, 0x01, 0xC0, 0x80, 0x92, 0x00, 0x01, 0x80, 0xC0,
+  0x83, 0xE0, 0x01, 0x80, 0x80, 0xC1, 0x00, 0x85, 0xE0, 0x81, 0xF0, 0x01, 0xF8, 0xF8, 0x80, 0xFC,
+  0x00, 0xFE, 0x88, 0xFF, 0x00, 0xFE, 0x90, 0x00, 0x00, 0xFE, 0x88, 0xFF, 0x05, 0xFE, 0xFE, 0xFC,
+  0xFC, 0xF8, 0xF8, 0x82, 0xF0, 0x84, 0xE0, 0xAE, 0x00, 0x9B, 0xFF, 0x90, 0x00, 0x9B, 0xFF, 0xAF,
+  0x00, 0x01, 0xE7, 0xFF, 0x80, 0x1F, 0x83, 0x3F, 0x02, 0xFF, 0xFF, 0x7F, 0x81, 0x3F, 0x02, 0xFF,
+  0xFF, 0x7F, 0x80, 0x3F, 0x04, 0xFF, 0xFF, 0x1F, 0x07, 0x03, 0x90, 0x00, 0x04, 0x03, 0x0F, 0x1F,
+  0xFF, 0xFF, 0x80, 0x3F, 0x02, 0x7F, 0xFF, 0x7F, 0x81, 0x3F, 0x02, 0x7F, 0xFF, 0xFF, 0x83, 0x3F,
+  0x04, 0x1F, 0x1F, 0xFF, 0xFF, 0xC7, 0xB0, 0x00, 0x01, 0x01, 0x01, 0x85, 0x00, 0x02, 0x80, 0xF7,
+  0xF7, 0x81, 0x00, 0x03, 0x38, 0x7F, 0x7F, 0x78, 0x80, 0x00, 0x02, 0x0F, 0x1F, 0x0E, 0x94, 0x00,
+  0x09, 0xF0, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x70, 0xFF, 0xFE, 0x70, 0x81, 0x00, 0x02, 0x0F, 0x0F,
+  0x0E, 0x84, 0x00, 0x80, 0x01, 0xB1, 0x00, 0x01, 0x38, 0x3C, 0x84, 0x00, 0x81, 0x07, 0xA1, 0x00,
+  0x80, 0x01, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xA6, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x9E, 0x00, 0x01,
+  0x80, 0xC0, 0x82, 0xE0, 0x02, 0xC0, 0xC0, 0x80, 0x92, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x80, 0xE0,
+  0x02, 0xC0, 0x80, 0x80, 0xC1, 0x00, 0x81, 0xC0, 0x82, 0xE0, 0x80, 0xF0, 0x01, 0xF8, 0xF8, 0x80,
+  0xFC, 0x00, 0xFE, 0x88, 0xFF, 0x00, 0xFC, 0x8F, 0x00, 0x00, 0xE0, 0x89, 0xFF, 0x04, 0xFE, 0xFC,
+  0xFC, 0xF8, 0xF8, 0x81, 0xF0, 0x81, 0xE0, 0x81, 0xC0, 0x00, 0x40, 0xAE, 0x00, 0x9B, 0xFF, 0x8F,
+  0x00, 0x00, 0x3F, 0x9A, 0xFF, 0xAF, 0x00, 0x02, 0x01, 0xFF, 0xFF, 0x81, 0x1F, 0x82, 0x3F, 0x01,
+  0xFF, 0x7F, 0x82, 0x3F, 0x01, 0xFF, 0xFF, 0x80, 0x3F, 0x04, 0x7F, 0xFF, 0xFF, 0x1F, 0x07, 0x91,
+  0x00, 0x0A, 0x03, 0x0F, 0x1F, 0xFF, 0xFF, 0x3F, 0x1F, 0x3F, 0x7F, 0xFF, 0x7F, 0x81, 0x3F, 0x02,
+  0x7F, 0xFF, 0xFF, 0x81, 0x3F, 0x81, 0x1F, 0x02, 0x3F, 0x7F, 0x03, 0xB1, 0x00, 0x01, 0xE1, 0x80,
+  0x84, 0x00, 0x02, 0x02, 0xCF, 0x07, 0x81, 0x00, 0x02, 0x3C, 0x3F, 0x3C, 0x80, 0x00, 0x03, 0x06,
+  0x1F, 0x1F, 0x1E, 0x93, 0x00, 0x03, 0x0C, 0x1E, 0x1F, 0x0F, 0x80, 0x00, 0x02, 0x3C, 0x7F, 0x3E,
+  0x82, 0x00, 0x01, 0xC7, 0x07, 0x85, 0x00, 0x02, 0x80, 0xF0, 0x80, 0xB0, 0x00, 0x80, 0x07, 0x84,
+  0x00, 0x02, 0x1E, 0x1F, 0x1E, 0x88, 0x00, 0x00, 0xE0, 0x9D, 0x00, 0x01, 0xE0, 0xE0, 0x81, 0x00,
+  0x03, 0x0C, 0x1F, 0x1F, 0x0C, 0x84, 0x00, 0x02, 0x03, 0x07, 0x07, 0xC7, 0x00, 0x02, 0x07, 0x0F,
+  0x07, 0x95, 0x00, 0x01, 0x06, 0x0E, 0x81, 0x00, 0x80, 0x07, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xA0, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xA2, 0x00, 0x01, 0x80, 0xC0, 0x84, 0x80, 0x93, 0x00, 0x86, 0x80, 0xC2, 0x00, 0x83, 0xC0,
+  0x80, 0xE0, 0x81, 0xF0, 0x04, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0x88, 0xFF, 0x00, 0xFC, 0x8F, 0x00,
+  0x00, 0xFC, 0x88, 0xFF, 0x04, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0x81, 0xF0, 0x80, 0xE0, 0x82, 0xC0,
+  0x00, 0x80, 0xAF, 0x00, 0x9B, 0xFF, 0x8F, 0x00, 0x9B, 0xFF, 0xAF, 0x00, 0x02, 0x01, 0xFF, 0xFF,
+  0x84, 0x1F, 0x03, 0x3F, 0x3F, 0x7F, 0x7F, 0x82, 0x3F, 0x09, 0xFF, 0xFF, 0x3F, 0x1F, 0x1F, 0x7F,
+  0xFF, 0x7F, 0x0F, 0x03, 0x90, 0x00, 0x0A, 0x01, 0x07, 0x0F, 0xFF, 0xFF, 0x3F, 0x1F, 0x1F, 0x3F,
+  0xFF, 0xFF, 0x81, 0x1F, 0x03, 0x3F, 0xFF, 0xFF, 0x3F, 0x84, 0x1F, 0x03, 0x0F, 0xFF, 0xFF, 0xC1,
+  0xAF, 0x00, 0x02, 0x30, 0x7C, 0x7C, 0x85, 0x00, 0x02, 0xC0, 0xF8, 0xE0, 0x81, 0x00, 0x02, 0x80,
+  0xFF, 0x03, 0x81, 0x00, 0x00, 0xFF, 0x95, 0x00, 0x03, 0x06, 0x0F, 0x0F, 0x03, 0x80, 0x00, 0x01,
+  0x1F, 0xDF, 0x82, 0x00, 0x01, 0xC0, 0xE1, 0x86, 0x00, 0x02, 0x3D, 0x3F, 0x30, 0xBA, 0x00, 0x80,
+  0x03, 0x80, 0x00, 0x0A, 0x3C, 0x7F, 0x7F, 0x7E, 0x30, 0x00, 0x00, 0xFE, 0xFF, 0xFE, 0x78, 0x93,
+  0x00, 0x10, 0xE0, 0xF8, 0xFC, 0xE0, 0x00, 0x00, 0xF0, 0xFE, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x02,
+  0x0F, 0x0F, 0x06, 0xEC, 0x00, 0x03, 0x01, 0x03, 0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xA3, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA6,
+  0x00, 0x00, 0x80, 0x82, 0x00, 0x01, 0x80, 0x80, 0xE1, 0x00, 0x82, 0x80, 0x80, 0xC0, 0x80, 0xE0,
+  0x80, 0xF0, 0x04, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0x87, 0xFF, 0x00, 0xFC, 0x8F, 0x00, 0x01, 0xF0,
+  0xFE, 0x87, 0xFF, 0x03, 0xFE, 0xFC, 0xFC, 0xF8, 0x80, 0xF0, 0x80, 0xE0, 0x80, 0xC0, 0x82, 0x80,
+  0xAF, 0x00, 0x00, 0x07, 0x9A, 0xFF, 0x8F, 0x00, 0x00, 0x7F, 0x9A, 0xFF, 0xB0, 0x00, 0x02, 0x03,
+  0x3F, 0x3F, 0x84, 0x1F, 0x02, 0x3F, 0x3F, 0xFF, 0x83, 0x3F, 0x01, 0xFF, 0x7F, 0x80, 0x1F, 0x04,
+  0x3F, 0xFF, 0x1F, 0x07, 0x01, 0x90, 0x00, 0x03, 0x03, 0x0F, 0x1F, 0xFF, 0x80, 0x1F, 0x0A, 0x3F,
+  0xFF, 0xFF, 0x3F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0xFF, 0x3F, 0x84, 0x1F, 0x02, 0x0F, 0x1F, 0x0F,
+  0xB2, 0x00, 0x01, 0x80, 0xC0, 0x85, 0x00, 0x02, 0x0F, 0x0F, 0x0E, 0x80, 0x00, 0x09, 0xE0, 0xF8,
+  0xFF, 0xE0, 0x00, 0x00, 0x80, 0xF0, 0xFF, 0xF0, 0x94, 0x00, 0x01, 0x18, 0xFF, 0x80, 0x00, 0x04,
+  0x80, 0xE0, 0xFF, 0xF0, 0xC0, 0x80, 0x00, 0x02, 0x3E, 0x7F, 0x3C, 0x84, 0x00, 0x02, 0x80, 0xF0,
+  0xE0, 0xB1, 0x00, 0x03, 0x04, 0x0F, 0x0F, 0x06, 0x83, 0x00, 0x02, 0x80, 0xE0, 0xC0, 0x82, 0x00,
+  0x80, 0x01, 0x80, 0x00, 0x80, 0x03, 0x94, 0x00, 0x05, 0x7C, 0xFF, 0xFE, 0x38, 0x00, 0x01, 0x80,
+  0x03, 0x00, 0x01, 0x8A, 0x00, 0x02, 0x03, 0x07, 0x07, 0xBB, 0x00, 0x02, 0x01, 0x03, 0x03, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xC8, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x96, 0x00, 0x82, 0x80, 0x09, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0,
+  0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0x85, 0xF8, 0x00, 0xE0, 0x8F, 0x00, 0x00, 0xF0, 0x88, 0xF8, 0x01,
+  0xF0, 0xF0, 0x80, 0xE0, 0x01, 0xC0, 0xC0, 0x81, 0x80, 0xB7, 0x00, 0x00, 0xFE, 0x98, 0xFF, 0x00,
+  0x1F, 0x8F, 0x00, 0x98, 0xFF, 0x01, 0xFE, 0xFE, 0xB1, 0x00, 0x03, 0x01, 0x07, 0x8F, 0x0F, 0x84,
+  0x1F, 0x02, 0x3F, 0xFF, 0x3F, 0x82, 0x1F, 0x00, 0x7F, 0x81, 0x1F, 0x03, 0x3F, 0x1F, 0x07, 0x03,
+  0x90, 0x00, 0x03, 0x01, 0x07, 0x0F, 0xFF, 0x81, 0x1F, 0x01, 0x3F, 0xBF, 0x81, 0x1F, 0x02, 0x3F,
+  0xFF, 0x7F, 0x84, 0x1F, 0x03, 0x0F, 0xCF, 0xFF, 0xC7, 0xB2, 0x00, 0x03, 0x18, 0x3E, 0x3F, 0x18,
+  0x83, 0x00, 0x02, 0x40, 0xF0, 0xE0, 0x82, 0x00, 0x01, 0x0E, 0x0F, 0x80, 0x00, 0x02, 0x80, 0xFE,
+  0xE0, 0x94, 0x00, 0x02, 0x1E, 0x1F, 0x0E, 0x80, 0x00, 0x01, 0x07, 0x07, 0x8C, 0x00, 0x02, 0x01,
+  0x03, 0x01, 0xC9, 0x00, 0x03, 0x03, 0x07, 0x03, 0x01, 0x93, 0x00, 0x01, 0x80, 0xE0, 0x81, 0x00,
+  0x02, 0x80, 0xE0, 0x80, 0x81, 0x00, 0x02, 0xF8, 0xFE, 0xF0, 0xED, 0x00, 0x80, 0x03, 0x80, 0x00,
+  0x02, 0x03, 0x07, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x9B, 0x00, 0x02, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x9D, 0x00, 0x8A, 0x80, 0x93,
+  0x00, 0x86, 0x80, 0xC2, 0x00, 0x00, 0x78, 0x81, 0xF8, 0x81, 0xFC, 0x81, 0xFE, 0x8C, 0xFF, 0x00,
+  0x7F, 0x8E, 0x00, 0x00, 0x7F, 0x8C, 0xFF, 0x81, 0xFE, 0x81, 0xFC, 0x81, 0xF8, 0xB4, 0x00, 0x00,
+  0x03, 0x80, 0x0F, 0x83, 0x1F, 0x02, 0x3F, 0xFF, 0x3F, 0x82, 0x1F, 0x00, 0xFF, 0x80, 0x1F, 0x04,
+  0x0F, 0xFF, 0xFF, 0x07, 0x03, 0x90, 0x00, 0x03, 0x03, 0x0F, 0x7F, 0x7F, 0x87, 0x1F, 0x01, 0x3F,
+  0xFF, 0x84, 0x1F, 0x80, 0x0F, 0x00, 0x01, 0xBE, 0x00, 0x02, 0x73, 0x67, 0x03, 0x81, 0x00, 0x02,
+  0x03, 0x07, 0x03, 0x80, 0x00, 0x01, 0x01, 0x03, 0x99, 0x00, 0x01, 0x06, 0x07, 0x82, 0x00, 0x01,
+  0x1E, 0x1F, 0x85, 0x00, 0x01, 0xE0, 0xC0, 0xE4, 0x00, 0x02, 0x70, 0x78, 0x60, 0x91, 0x00, 0x01,
+  0x07, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x8D, 0x00,
+};
+
+const uint8_t CRY_FRAME_COUNT = 25;
+
+#endif // CRY_128X128_H
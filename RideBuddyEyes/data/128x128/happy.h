@@ -0,0 +1,501 @@
+// Generated by clipenc from happy.h - do not edit.
+// Keyframe + XOR-delta clip, see RideBuddyClip.h for the format.
+// Fitted to a 128x128 panel.
+#ifndef HAPPY_128X128_H
+#define HAPPY_128X128_H
+
+#include "../../RideBuddyClip.h"
+
+const uint8_t happy_clip[] PROGMEM = {
+  0x52, 0x43, 0x02, 0x19, 0x0C, 0x10, 0x10, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00,
+  0x25, 0x02, 0x00, 0x00, 0x29, 0x03, 0x00, 0x00, 0x65, 0x04, 0x00, 0x00, 0x97, 0x05, 0x00, 0x00,
+  0xBB, 0x06, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x38, 0x09, 0x00, 0x00, 0x81, 0x0A, 0x00, 0x00,
+  0xBA, 0x0B, 0x00, 0x00, 0x01, 0x0D, 0x00, 0x00, 0x42, 0x0E, 0x00, 0x00, 0x92, 0x0F, 0x00, 0x00,
+  0xD8, 0x10, 0x00, 0x00, 0x15, 0x12, 0x00, 0x00, 0x5F, 0x13, 0x00, 0x00, 0xA5, 0x14, 0x00, 0x00,
+  0xE0, 0x15, 0x00, 0x00, 0x2F, 0x17, 0x00, 0x00, 0x75, 0x18, 0x00, 0x00, 0xC6, 0x19, 0x00, 0x00,
+  0x03, 0x1B, 0x00, 0x00, 0x45, 0x1C, 0x00, 0x00, 0x6E, 0x1D, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x98, 0x00, 0x04, 0x80, 0xC0, 0xC0, 0xE0, 0x60, 0x80, 0x70, 0x82,
+  0x38, 0x81, 0x78, 0x03, 0xF0, 0xF0, 0xE0, 0xC0, 0x8C, 0x00, 0x04, 0x80, 0xE0, 0xF0, 0xF0, 0x70,
+  0x80, 0x78, 0x82, 0x38, 0x81, 0x70, 0x03, 0xE0, 0xC0, 0xC0, 0x80, 0xBF, 0x00, 0x06, 0x90, 0x88,
+  0xC4, 0xC2, 0xC3, 0xC1, 0xC1, 0x8F, 0xC0, 0x02, 0xC1, 0x80, 0x80, 0x88, 0x00, 0x02, 0x80, 0x80,
+  0xC1, 0x8F, 0xC0, 0x06, 0xC1, 0xC1, 0xC3, 0xC2, 0xC6, 0x88, 0x90, 0xB6, 0x00, 0x01, 0xE0, 0xFC,
+  0x81, 0xFF, 0x02, 0x1F, 0x07, 0x07, 0x92, 0x03, 0x04, 0x07, 0x0F, 0x1F, 0xFF, 0xFC, 0x81, 0x00,
+  0x05, 0xC0, 0xFC, 0xFE, 0x1F, 0x0F, 0x07, 0x92, 0x03, 0x02, 0x07, 0x07, 0x1F, 0x81, 0xFF, 0x01,
+  0xFE, 0xE0, 0xB2, 0x00, 0x83, 0xFF, 0x98, 0x00, 0x01, 0xFF, 0xFF, 0x81, 0x00, 0x80, 0xFF, 0x98,
+  0x00, 0x83, 0xFF, 0xB2, 0x00, 0x83, 0xFF, 0x98, 0x00, 0x01, 0xFF, 0xFF, 0x81, 0x00, 0x80, 0xFF,
+  0x98, 0x00, 0x83, 0xFF, 0xB2, 0x00, 0x02, 0x03, 0x0F, 0x3F, 0x80, 0x7F, 0x03, 0xFE, 0xFC, 0xF8,
+  0xF8, 0x90, 0xF0, 0x05, 0xF8, 0x78, 0x7C, 0x3F, 0x3F, 0x0F, 0x82, 0x00, 0x05, 0x0F, 0x3F, 0x3F,
+  0x7C, 0x78, 0xF8, 0x90, 0xF0, 0x03, 0xF8, 0xF8, 0xFC, 0xFE, 0x80, 0x7F, 0x02, 0x3F, 0x1F, 0x01,
+  0xCB, 0x00, 0x04, 0x08, 0x06, 0x08, 0x08, 0x18, 0x80, 0x10, 0x86, 0x20, 0x80, 0x10, 0x04, 0x18,
+  0x08, 0x0C, 0x06, 0x04, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA7, 0x00,
+  0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x97, 0x00, 0x09, 0x80, 0x40, 0x20, 0xA0,
+  0x90, 0x50, 0x40, 0x48, 0x48, 0x00, 0x81, 0x04, 0x07, 0x44, 0x44, 0x40, 0x40, 0x80, 0x80, 0x00,
+  0x40, 0x8C, 0x00, 0x04, 0x40, 0x80, 0x80, 0x88, 0x48, 0x80, 0x44, 0x81, 0x04, 0x09, 0x00, 0x48,
+  0x48, 0x40, 0x40, 0x90, 0xA0, 0x00, 0x40, 0x80, 0xBD, 0x00, 0x07, 0x80, 0x58, 0x4C, 0x06, 0x03,
+  0x02, 0x01, 0x01, 0x8F, 0x00, 0x03, 0x01, 0x40, 0x40, 0x80, 0x86, 0x00, 0x03, 0x80, 0x40, 0x40,
+  0x01, 0x8F, 0x00, 0x07, 0x01, 0x01, 0x02, 0x01, 0x04, 0x4C, 0x50, 0x80, 0xB6, 0x00, 0x00, 0x02,
+  0x81, 0x00, 0x03, 0x10, 0x00, 0x04, 0x00, 0x8F, 0x02, 0x03, 0x00, 0x00, 0x04, 0x08, 0x84, 0x00,
+  0x06, 0x20, 0x02, 0x01, 0x00, 0x08, 0x04, 0x00, 0x90, 0x02, 0x03, 0x00, 0x04, 0x00, 0x10, 0xFF,
+  0x00, 0xFF, 0x00, 0xB4, 0x00, 0x02, 0x02, 0x00, 0x20, 0x80, 0x40, 0x81, 0x80, 0x00, 0x88, 0x8D,
+  0x80, 0x07, 0x88, 0x88, 0x80, 0x04, 0x42, 0x00, 0x20, 0x08, 0x82, 0x00, 0x07, 0x08, 0x20, 0x00,
+  0x42, 0x04, 0x80, 0x88, 0x88, 0x8D, 0x80, 0x04, 0x88, 0x80, 0x84, 0x80, 0x80, 0x80, 0x40, 0x02,
+  0x20, 0x10, 0x01, 0xCB, 0x00, 0x07, 0x0C, 0x05, 0x0C, 0x0C, 0x10, 0x18, 0x18, 0x00, 0x86, 0x30,
+  0x07, 0x00, 0x08, 0x18, 0x14, 0x0C, 0x08, 0x04, 0x04, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xA7, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x95, 0x00,
+  0x07, 0x80, 0xC0, 0xE0, 0x70, 0x30, 0x38, 0x1C, 0x1C, 0x81, 0x0E, 0x81, 0x0F, 0x05, 0x0E, 0x1E,
+  0x1E, 0x1C, 0x38, 0x30, 0x90, 0x00, 0x04, 0x30, 0x38, 0x1C, 0x1E, 0x0E, 0x83, 0x0F, 0x80, 0x0E,
+  0x07, 0x1E, 0x1C, 0x18, 0x38, 0x30, 0x60, 0xC0, 0x80, 0xBA, 0x00, 0x05, 0x80, 0xC0, 0xC0, 0xC2,
+  0xE1, 0xE1, 0x92, 0xE0, 0x80, 0xC0, 0x00, 0x80, 0x86, 0x00, 0x80, 0xC0, 0x94, 0xE0, 0x04, 0xE1,
+  0xC2, 0xC0, 0xC0, 0x80, 0xB4, 0x00, 0x01, 0xF8, 0xFE, 0x80, 0xFF, 0x03, 0x7F, 0x0F, 0x03, 0x03,
+  0x80, 0x01, 0x8B, 0x00, 0x80, 0x01, 0x05, 0x03, 0x03, 0x07, 0x1F, 0xFF, 0xFE, 0x81, 0x00, 0x05,
+  0xF0, 0xFE, 0xFF, 0x0F, 0x07, 0x03, 0x80, 0x01, 0x8C, 0x00, 0x80, 0x01, 0x02, 0x03, 0x07, 0x0F,
+  0x82, 0xFF, 0x00, 0x80, 0xB2, 0x00, 0x82, 0xFF, 0x00, 0xFD, 0x98, 0x00, 0x01, 0xFF, 0xFF, 0x81,
+  0x00, 0x80, 0xFF, 0x98, 0x00, 0x83, 0xFF, 0xB2, 0x00, 0x00, 0x7F, 0x82, 0xFF, 0x89, 0x80, 0x8B,
+  0x00, 0x03, 0x80, 0xFF, 0xFF, 0x38, 0x80, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x95, 0x00, 0x01, 0x80,
+  0x80, 0x82, 0xFF, 0x00, 0x3F, 0xB3, 0x00, 0x8F, 0x07, 0x06, 0x06, 0x06, 0x46, 0x4E, 0xCE, 0xAE,
+  0x8E, 0x80, 0x0E, 0x05, 0x06, 0x06, 0x07, 0x03, 0x01, 0x01, 0x81, 0x00, 0x04, 0x01, 0x01, 0x03,
+  0x07, 0x07, 0x80, 0x06, 0x80, 0x0E, 0x03, 0x4E, 0x8E, 0x86, 0x8E, 0x83, 0x0E, 0x88, 0x0F, 0x80,
+  0x07, 0xCB, 0x00, 0x08, 0x03, 0x0D, 0x13, 0x23, 0x63, 0x76, 0xF6, 0xF6, 0xFE, 0x88, 0xFC, 0x06,
+  0xF4, 0x76, 0x66, 0x32, 0x1B, 0x0F, 0x03, 0xE9, 0x00, 0x80, 0x01, 0x83, 0x03, 0x80, 0x01, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xB0, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0x96, 0x00, 0x08, 0xC0, 0x60, 0x30, 0x18, 0x1C, 0x0E, 0x0F, 0x07, 0x07, 0x80, 0x03,
+  0x81, 0x01, 0x80, 0x03, 0x01, 0x06, 0x04, 0x91, 0x00, 0x04, 0x80, 0x60, 0x30, 0x38, 0x3C, 0x81,
+  0x1C, 0x80, 0x0C, 0x00, 0x1C, 0x80, 0x18, 0x04, 0x30, 0x30, 0x60, 0xC0, 0x80, 0xBA, 0x00, 0x04,
+  0x80, 0x80, 0xC0, 0xC6, 0xE1, 0x94, 0xE0, 0x03, 0xC0, 0xC0, 0x80, 0x80, 0x85, 0x00, 0x02, 0x80,
+  0xC0, 0xC0, 0x94, 0xE0, 0x04, 0xE1, 0xC2, 0xC4, 0xC0, 0x80, 0xB5, 0x00, 0x00, 0xFE, 0x81, 0xFF,
+  0x03, 0x0F, 0x07, 0x03, 0x03, 0x90, 0x01, 0x06, 0x03, 0x03, 0x07, 0x1F, 0xFF, 0xFE, 0xE0, 0x80,
+  0x00, 0x06, 0x80, 0xFE, 0xFF, 0x1F, 0x07, 0x03, 0x03, 0x91, 0x01, 0x02, 0x03, 0x07, 0x0F, 0x82,
+  0xFF, 0x00, 0xF8, 0xB2, 0x00, 0x83, 0xFF, 0x80, 0x00, 0x83, 0x20, 0x80, 0x40, 0x00, 0x80, 0x8B,
+  0x00, 0x80, 0xFF, 0x80, 0x00, 0x80, 0xFF, 0x8A, 0x00, 0x80, 0x40, 0x85, 0x20, 0x80, 0x00, 0x83,
+  0xFF, 0xAF, 0x00, 0x04, 0x20, 0x30, 0x18, 0x1F, 0x1F, 0x81, 0x0F, 0x80, 0x07, 0x83, 0x03, 0x01,
+  0x02, 0x00, 0x80, 0x40, 0x06, 0x00, 0x00, 0x01, 0x00, 0x02, 0x02, 0x04, 0x83, 0x00, 0x02, 0x7F,
+  0x7F, 0x3F, 0x80, 0x00, 0x02, 0x7F, 0x7F, 0xFF, 0x81, 0x00, 0x04, 0x08, 0x04, 0x02, 0x02, 0x01,
+  0x81, 0x00, 0x03, 0x40, 0xC0, 0xC0, 0x42, 0x83, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x81, 0x0F, 0x03,
+  0x1F, 0x1F, 0x18, 0x30, 0xC2, 0x00, 0x07, 0x7F, 0xBF, 0x3E, 0x3E, 0x7C, 0x7C, 0xF8, 0xF8, 0x80,
+  0xF0, 0x82, 0xE0, 0x84, 0xC0, 0x81, 0xE0, 0x80, 0xF0, 0x80, 0xF8, 0x06, 0xFC, 0x7C, 0x7E, 0x3E,
+  0x3F, 0xFF, 0x3F, 0xD6, 0x00, 0x08, 0x03, 0x0C, 0x30, 0xC0, 0x80, 0x00, 0x00, 0x80, 0x80, 0x81,
+  0xC1, 0x81, 0xC3, 0x01, 0x83, 0x83, 0x82, 0xC3, 0x81, 0xC1, 0x01, 0x81, 0x80, 0x80, 0x00, 0x04,
+  0xC0, 0x60, 0x18, 0x07, 0x01, 0xDB, 0x00, 0x07, 0x01, 0x02, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F,
+  0x89, 0xFF, 0x80, 0x7F, 0x05, 0x3F, 0x1F, 0x0F, 0x0F, 0x02, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xA7, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x95, 0x00,
+  0x08, 0x40, 0x30, 0x18, 0x0C, 0x07, 0x03, 0x03, 0x01, 0x01, 0x9F, 0x00, 0x01, 0x01, 0x01, 0xCC,
+  0x00, 0x08, 0xE0, 0xF0, 0xF0, 0xF9, 0xF8, 0xF8, 0xFC, 0x7C, 0x7C, 0x8E, 0x3C, 0x06, 0x78, 0x78,
+  0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x82, 0x00, 0x06, 0x80, 0xC0, 0xF0, 0xF8, 0xF8, 0x78, 0x78, 0x8F,
+  0x3C, 0x02, 0x7C, 0x7C, 0xFC, 0x80, 0xF8, 0x02, 0xF0, 0xF0, 0xC0, 0xB4, 0x00, 0x82, 0xFF, 0x01,
+  0x07, 0x01, 0x95, 0x00, 0x00, 0x03, 0x80, 0xFF, 0x81, 0x00, 0x03, 0xFF, 0xFF, 0x07, 0x01, 0x95,
+  0x00, 0x00, 0x01, 0x82, 0xFF, 0x00, 0xFE, 0xB3, 0x00, 0x82, 0xFF, 0x00, 0xC0, 0x81, 0xE0, 0x01,
+  0xE4, 0xE4, 0x81, 0xC8, 0x01, 0x08, 0x10, 0x80, 0x00, 0x03, 0x20, 0x40, 0x40, 0x80, 0x84, 0x00,
+  0x80, 0xFF, 0x80, 0x00, 0x02, 0xF8, 0xFF, 0xFF, 0x82, 0x00, 0x03, 0x80, 0x00, 0x40, 0x60, 0x81,
+  0x00, 0x05, 0x10, 0x08, 0xC8, 0xCC, 0x44, 0x44, 0x82, 0xE4, 0x02, 0xE0, 0xC0, 0xC0, 0x82, 0xFF,
+  0x00, 0x7F, 0xAF, 0x00, 0x02, 0x04, 0x06, 0x06, 0x80, 0x03, 0x82, 0x01, 0x85, 0x00, 0x02, 0x10,
+  0x10, 0xF0, 0x80, 0xC0, 0x00, 0x80, 0x87, 0x00, 0x02, 0x0F, 0x0F, 0x07, 0x80, 0x00, 0x02, 0x0F,
+  0x0F, 0x1F, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x01, 0xF0, 0xF0, 0x85,
+  0x00, 0x82, 0x01, 0x80, 0x03, 0x02, 0x07, 0x06, 0x06, 0xC2, 0x00, 0x07, 0x0F, 0xF7, 0x87, 0x0F,
+  0x0F, 0x1F, 0x1F, 0x1E, 0x80, 0x3E, 0x03, 0x3C, 0x3C, 0x7C, 0x7C, 0x86, 0x78, 0x80, 0x7C, 0x00,
+  0x3C, 0x81, 0x3E, 0x80, 0x1F, 0x04, 0x0F, 0x0F, 0xC7, 0x3F, 0x07, 0xD7, 0x00, 0x07, 0x03, 0x0C,
+  0x10, 0x60, 0x80, 0xC0, 0xE0, 0xE0, 0x84, 0xF0, 0x80, 0xE0, 0x86, 0xF0, 0x08, 0xE0, 0xE0, 0xC0,
+  0x80, 0x60, 0x30, 0x0C, 0x07, 0x01, 0xDE, 0x00, 0x05, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x80,
+  0x3F, 0x84, 0x7F, 0x08, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x03, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA9, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0x9E, 0x00, 0x83, 0x02, 0x05, 0x06, 0x04, 0x0C, 0x08, 0x08, 0x10, 0x92, 0x00, 0x04, 0x40, 0x20,
+  0x30, 0x18, 0x18, 0x80, 0x0C, 0x80, 0x04, 0xC5, 0x00, 0x00, 0x80, 0x98, 0xC0, 0x01, 0x80, 0x80,
+  0x86, 0x00, 0x00, 0x80, 0x84, 0xC0, 0x81, 0xE0, 0x8E, 0xC0, 0x00, 0x80, 0xB5, 0x00, 0x01, 0xE0,
+  0xFE, 0x81, 0xFF, 0x01, 0x1F, 0x07, 0x80, 0x03, 0x8E, 0x01, 0x06, 0x03, 0x03, 0x07, 0x0F, 0x1F,
+  0xFF, 0xFC, 0x81, 0x00, 0x07, 0xE0, 0xFC, 0xFF, 0x1F, 0x0F, 0x07, 0x03, 0x03, 0x8E, 0x01, 0x80,
+  0x03, 0x01, 0x07, 0x1F, 0x81, 0xFF, 0x01, 0xFE, 0xC0, 0xB2, 0x00, 0x83, 0xFF, 0x01, 0x00, 0x00,
+  0x86, 0x40, 0x01, 0x80, 0x80, 0x8B, 0x00, 0x01, 0xFF, 0xFF, 0x81, 0x00, 0x80, 0xFF, 0x8A, 0x00,
+  0x00, 0x80, 0x83, 0x40, 0x02, 0x00, 0x20, 0x60, 0x81, 0x00, 0x83, 0xFF, 0xAF, 0x00, 0x03, 0x20,
+  0x30, 0x30, 0x3F, 0x80, 0x1F, 0x00, 0x0F, 0x80, 0x0E, 0x85, 0x06, 0x03, 0x82, 0x80, 0x80, 0x40,
+  0x80, 0x00, 0x03, 0x02, 0x02, 0x04, 0x08, 0x83, 0x00, 0x01, 0xFF, 0x7F, 0x81, 0x00, 0x02, 0x7F,
+  0x7F, 0xFF, 0x81, 0x00, 0x03, 0x08, 0x04, 0x04, 0x02, 0x82, 0x00, 0x04, 0x40, 0x40, 0xC2, 0x46,
+  0x46, 0x83, 0x06, 0x80, 0x0E, 0x01, 0x0F, 0x0F, 0x80, 0x1F, 0x03, 0x3F, 0x30, 0x30, 0x20, 0xC1,
+  0x00, 0x08, 0xFF, 0x3E, 0x7E, 0x7C, 0x78, 0xF8, 0xF8, 0xF0, 0xF0, 0x80, 0xE0, 0x8B, 0xC0, 0x80,
+  0xE0, 0x80, 0xF0, 0x07, 0xF8, 0xF8, 0xFC, 0x7C, 0x7E, 0x3E, 0xFF, 0x3F, 0xD6, 0x00, 0x03, 0x07,
+  0x18, 0x60, 0x80, 0x80, 0x00, 0x80, 0x81, 0x83, 0xC3, 0x03, 0x83, 0x83, 0x03, 0x83, 0x84, 0xC3,
+  0x0A, 0x83, 0x81, 0x81, 0x01, 0x00, 0x00, 0x80, 0x60, 0x38, 0x0E, 0x01, 0xDB, 0x00, 0x06, 0x03,
+  0x06, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x8B, 0xFF, 0x80, 0x7F, 0x05, 0x3F, 0x1F, 0x0F, 0x06, 0x03,
+  0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA6, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0x94, 0x00, 0x09, 0x80, 0x40, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x03, 0x01,
+  0x01, 0x87, 0x00, 0x01, 0x01, 0x01, 0x93, 0x00, 0x01, 0x06, 0x03, 0x82, 0x01, 0x01, 0x00, 0x00,
+  0x82, 0x01, 0x07, 0x03, 0x02, 0x06, 0x0C, 0x10, 0x30, 0x40, 0x80, 0xB7, 0x00, 0x02, 0x80, 0xE0,
+  0xF0, 0x80, 0xF8, 0x02, 0xFC, 0xFC, 0x7C, 0x90, 0x3C, 0x05, 0x7C, 0x78, 0xF8, 0xF8, 0xF0, 0xC0,
+  0x82, 0x00, 0x06, 0x80, 0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x7C, 0x90, 0x3C, 0x02, 0x7C, 0xFC, 0xFC,
+  0x80, 0xF8, 0x01, 0xF0, 0xE0, 0xB4, 0x00, 0x82, 0xFF, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x80,
+  0xFF, 0x81, 0x00, 0x03, 0xFF, 0xFF, 0x07, 0x01, 0x95, 0x00, 0x01, 0x01, 0x0F, 0x82, 0xFF, 0xB3,
+  0x00, 0x82, 0xFF, 0x80, 0xE0, 0x84, 0x64, 0x02, 0x0C, 0x08, 0x08, 0x80, 0x00, 0x04, 0x20, 0x20,
+  0x40, 0x40, 0x80, 0x83, 0x00, 0x80, 0xFF, 0x80, 0x00, 0x02, 0x80, 0xFF, 0xFF, 0x82, 0x00, 0x03,
+  0x80, 0x40, 0x40, 0x20, 0x81, 0x00, 0x02, 0x08, 0x08, 0x0C, 0x84, 0x64, 0x81, 0xE0, 0x00, 0xF8,
+  0x82, 0xFF, 0xB0, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x01, 0x88, 0x00, 0x07, 0x10, 0x10, 0xF0,
+  0xE8, 0xC0, 0xC0, 0x80, 0x80, 0x86, 0x00, 0x02, 0x0F, 0x07, 0x07, 0x80, 0x00, 0x02, 0x07, 0x0F,
+  0x0F, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x08, 0x80, 0x80, 0xC0, 0xC0, 0xE8, 0xE8, 0xF8, 0x08,
+  0x08, 0x86, 0x00, 0x81, 0x01, 0x80, 0x03, 0x00, 0x06, 0xC2, 0x00, 0x03, 0x07, 0x7F, 0x87, 0x07,
+  0x80, 0x0F, 0x01, 0x1F, 0x1E, 0x80, 0x3E, 0x82, 0x3C, 0x00, 0x7C, 0x80, 0x78, 0x01, 0x7C, 0x7C,
+  0x81, 0x3C, 0x81, 0x3E, 0x01, 0x1F, 0x1F, 0x80, 0x0F, 0x03, 0x07, 0xC7, 0x3F, 0x07, 0xD7, 0x00,
+  0x07, 0x01, 0x06, 0x18, 0x20, 0x40, 0xE0, 0xF0, 0xF0, 0x84, 0xF8, 0x03, 0xF0, 0xF0, 0xE0, 0xF0,
+  0x85, 0xF8, 0x07, 0xF0, 0xF0, 0xE0, 0xC0, 0x60, 0x18, 0x0C, 0x03, 0xDF, 0x00, 0x05, 0x01, 0x03,
+  0x03, 0x07, 0x0F, 0x0F, 0x80, 0x1F, 0x84, 0x3F, 0x01, 0x1F, 0x1F, 0x80, 0x0F, 0x03, 0x07, 0x03,
+  0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA9, 0x00, 0x02, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x95, 0x00, 0x07, 0xC0, 0xE0, 0x70, 0x3C, 0x1E, 0x0F, 0x0F, 0x07,
+  0x81, 0x03, 0x01, 0x01, 0x01, 0x81, 0x03, 0x02, 0x07, 0x07, 0x0E, 0x92, 0x00, 0x03, 0x1C, 0x0E,
+  0x0F, 0x0F, 0x80, 0x07, 0x81, 0x03, 0x80, 0x07, 0x06, 0x0F, 0x0E, 0x1E, 0x3C, 0x70, 0xE0, 0x80,
+  0xBB, 0x00, 0x03, 0x80, 0xC0, 0xC2, 0xC1, 0x95, 0xC0, 0x01, 0x80, 0x80, 0x86, 0x00, 0x00, 0x80,
+  0x96, 0xC0, 0x03, 0xC1, 0xC6, 0xC8, 0x80, 0xB5, 0x00, 0x01, 0xF0, 0xFE, 0x80, 0xFF, 0x02, 0x7F,
+  0x1F, 0x07, 0x80, 0x03, 0x8D, 0x01, 0x80, 0x03, 0x04, 0x07, 0x0F, 0x3F, 0xFF, 0xFC, 0x81, 0x00,
+  0x04, 0xE0, 0xFE, 0xFF, 0x1F, 0x07, 0x80, 0x03, 0x8E, 0x01, 0x80, 0x03, 0x01, 0x07, 0x1F, 0x81,
+  0xFF, 0x00, 0xFE, 0xB3, 0x00, 0x82, 0xFF, 0x80, 0x00, 0x86, 0x40, 0x01, 0x80, 0x80, 0x8B, 0x00,
+  0x01, 0xFF, 0xFF, 0x81, 0x00, 0x80, 0xFF, 0x89, 0x00, 0x01, 0x80, 0x80, 0x82, 0x40, 0x81, 0x20,
+  0x81, 0x00, 0x82, 0xFF, 0xB0, 0x00, 0x09, 0x20, 0x30, 0x30, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x0E,
+  0x0E, 0x86, 0x06, 0x00, 0x86, 0x80, 0x80, 0x01, 0x00, 0x00, 0x80, 0x02, 0x01, 0x04, 0x08, 0x83,
+  0x00, 0x01, 0xFF, 0x7F, 0x81, 0x00, 0x02, 0x7F, 0x7F, 0xFF, 0x81, 0x00, 0x03, 0x08, 0x04, 0x04,
+  0x02, 0x82, 0x00, 0x05, 0x40, 0x40, 0x86, 0x46, 0x42, 0x02, 0x83, 0x06, 0x03, 0x0E, 0x0E, 0x0F,
+  0x0F, 0x80, 0x1F, 0x02, 0x38, 0x30, 0x30, 0xC2, 0x00, 0x08, 0xFF, 0x3E, 0x3E, 0x7C, 0x78, 0xF8,
+  0xF8, 0xF0, 0xF0, 0x80, 0xE0, 0x8B, 0xC0, 0x80, 0xE0, 0x80, 0xF0, 0x07, 0xF8, 0xF8, 0xFC, 0x7C,
+  0x7E, 0x3E, 0xFF, 0x3F, 0xD6, 0x00, 0x03, 0x07, 0x18, 0x60, 0x80, 0x80, 0x00, 0x03, 0x01, 0x81,
+  0x81, 0x83, 0x81, 0xC3, 0x80, 0x83, 0x02, 0x03, 0x83, 0x83, 0x82, 0xC3, 0x0B, 0x83, 0x83, 0x81,
+  0x01, 0x01, 0x00, 0x00, 0x80, 0x60, 0x30, 0x0E, 0x01, 0xDB, 0x00, 0x06, 0x03, 0x06, 0x0F, 0x1F,
+  0x3F, 0x7F, 0x7F, 0x8C, 0xFF, 0x07, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x06, 0x03, 0x01, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA6, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0x95, 0x00, 0x08, 0xC0, 0x30, 0x18, 0x0C, 0x07, 0x03, 0x03, 0x01, 0x01, 0x87, 0x00, 0x80,
+  0x01, 0x92, 0x00, 0x03, 0x0C, 0x07, 0x03, 0x03, 0x82, 0x01, 0x01, 0x00, 0x00, 0x81, 0x01, 0x06,
+  0x03, 0x03, 0x0F, 0x0E, 0x18, 0x30, 0x40, 0xB8, 0x00, 0x03, 0xC0, 0xE0, 0xF0, 0xF9, 0x80, 0xF8,
+  0x01, 0xFC, 0x7C, 0x8E, 0x3C, 0x06, 0x78, 0x78, 0xF8, 0xF8, 0xF0, 0xF0, 0xC0, 0x83, 0x00, 0x06,
+  0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x78, 0x8E, 0x3C, 0x01, 0x7C, 0x7C, 0x81, 0xF8, 0x02, 0xF9,
+  0xF0, 0xE0, 0xB4, 0x00, 0x82, 0xFF, 0x01, 0x07, 0x01, 0x95, 0x00, 0x00, 0x01, 0x80, 0xFF, 0x81,
+  0x00, 0x03, 0xFF, 0xFF, 0x1F, 0x03, 0x95, 0x00, 0x01, 0x01, 0x07, 0x82, 0xFF, 0xB3, 0x00, 0x82,
+  0xFF, 0x03, 0xC0, 0xC0, 0xE0, 0xE8, 0x80, 0xE0, 0x81, 0xC8, 0x01, 0x08, 0x10, 0x80, 0x00, 0x03,
+  0x20, 0x40, 0x40, 0x80, 0x84, 0x00, 0x80, 0xFF, 0x81, 0x00, 0x01, 0xFF, 0xFF, 0x82, 0x00, 0x03,
+  0x80, 0x80, 0x40, 0x60, 0x81, 0x00, 0x06, 0x10, 0x08, 0xC8, 0x48, 0x48, 0x44, 0x64, 0x81, 0xE4,
+  0x00, 0xE0, 0x80, 0xC0, 0x82, 0xFF, 0xB0, 0x00, 0x04, 0x06, 0x06, 0x07, 0x03, 0x03, 0x82, 0x01,
+  0x85, 0x00, 0x06, 0x10, 0x10, 0xF0, 0xD0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x01, 0x83, 0x00,
+  0x02, 0x0F, 0x0F, 0x07, 0x80, 0x00, 0x02, 0x08, 0x0F, 0x1F, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00,
+  0x06, 0x80, 0x80, 0xC0, 0xC0, 0xF0, 0xF0, 0x10, 0x84, 0x00, 0x82, 0x01, 0x80, 0x03, 0x03, 0x07,
+  0x06, 0x06, 0x04, 0xC1, 0x00, 0x07, 0x0F, 0x7F, 0x87, 0x0F, 0x0F, 0x1F, 0x1F, 0x1E, 0x80, 0x3E,
+  0x02, 0x3C, 0x3C, 0x7C, 0x88, 0x78, 0x80, 0x7C, 0x00, 0x3C, 0x80, 0x3E, 0x80, 0x1F, 0x04, 0x0F,
+  0x0F, 0xC7, 0x3F, 0x07, 0xD7, 0x00, 0x07, 0x03, 0x0C, 0x18, 0x60, 0x80, 0xC0, 0xE0, 0xE0, 0x85,
+  0xF0, 0x01, 0xE0, 0xE0, 0x86, 0xF0, 0x08, 0xE0, 0xE0, 0xC0, 0x80, 0x60, 0x30, 0x0C, 0x07, 0x01,
+  0xDE, 0x00, 0x05, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x80, 0x3F, 0x84, 0x7F, 0x08, 0x3F, 0x3F,
+  0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA9,
+  0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x95, 0x00, 0x07, 0xC0, 0x70, 0x38,
+  0x1C, 0x0E, 0x07, 0x03, 0x03, 0x80, 0x01, 0x82, 0x00, 0x81, 0x01, 0x00, 0x03, 0x93, 0x00, 0x01,
+  0x0E, 0x07, 0x80, 0x03, 0x84, 0x01, 0x08, 0x03, 0x03, 0x07, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xC0,
+  0xB9, 0x00, 0x03, 0xC0, 0xC0, 0xE0, 0xF1, 0x96, 0xF0, 0x02, 0xE0, 0xE0, 0xC0, 0x84, 0x00, 0x02,
+  0x80, 0xC0, 0xE0, 0x97, 0xF0, 0x03, 0xE1, 0xE0, 0xC0, 0x80, 0xB4, 0x00, 0x82, 0xFF, 0x02, 0x07,
+  0x03, 0x01, 0x92, 0x00, 0x05, 0x01, 0x03, 0x07, 0xFF, 0xFF, 0xFC, 0x81, 0x00, 0x04, 0xFF, 0xFF,
+  0x0F, 0x03, 0x01, 0x92, 0x00, 0x02, 0x01, 0x03, 0x07, 0x82, 0xFF, 0x00, 0xFC, 0xB2, 0x00, 0x00,
+  0xF8, 0x82, 0xFF, 0x81, 0x00, 0x81, 0x10, 0x04, 0x30, 0x20, 0x20, 0x60, 0x40, 0x80, 0x00, 0x00,
+  0x80, 0x87, 0x00, 0x80, 0xFF, 0x80, 0x00, 0x02, 0xFE, 0xFF, 0xFF, 0x85, 0x00, 0x00, 0x80, 0x81,
+  0x00, 0x03, 0x60, 0x20, 0x20, 0x30, 0x84, 0x10, 0x80, 0x00, 0x82, 0xFF, 0x00, 0x7F, 0xB0, 0x00,
+  0x03, 0x30, 0x18, 0x1F, 0x1F, 0x81, 0x0F, 0x81, 0x07, 0x83, 0x03, 0x03, 0x00, 0x40, 0xC0, 0x40,
+  0x80, 0x00, 0x02, 0x01, 0x01, 0x02, 0x84, 0x00, 0x02, 0x3F, 0x1F, 0x01, 0x80, 0x00, 0x02, 0x1F,
+  0x3F, 0x3F, 0x81, 0x00, 0x03, 0x04, 0x02, 0x00, 0x01, 0x82, 0x00, 0x04, 0x40, 0x40, 0xC0, 0x43,
+  0x43, 0x82, 0x03, 0x80, 0x07, 0x81, 0x0F, 0x04, 0x1F, 0x1F, 0x18, 0x18, 0x30, 0xC2, 0x00, 0x01,
+  0x3F, 0xDF, 0x80, 0x3E, 0x03, 0x7C, 0x7C, 0xF8, 0xF8, 0x81, 0xF0, 0x8A, 0xE0, 0x80, 0xF0, 0x80,
+  0xF8, 0x07, 0xFC, 0x7C, 0x7E, 0x7E, 0x3E, 0x3F, 0xFF, 0x1F, 0xD6, 0x00, 0x03, 0x03, 0x1C, 0x70,
+  0xC0, 0x80, 0x00, 0x80, 0x80, 0x00, 0x81, 0x81, 0xC1, 0x80, 0x81, 0x03, 0x03, 0x83, 0x81, 0x81,
+  0x80, 0xC1, 0x80, 0x81, 0x00, 0x80, 0x81, 0x00, 0x03, 0xC0, 0x60, 0x18, 0x07, 0xDC, 0x00, 0x05,
+  0x03, 0x06, 0x0F, 0x1F, 0x3F, 0x7F, 0x8D, 0xFF, 0x06, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x06, 0x03,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA7, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0x94, 0x00, 0x0B, 0x80, 0xA0, 0x40, 0x20, 0x12, 0x09, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0xA3, 0x00, 0x09, 0x02, 0x00, 0x04, 0x00, 0x09, 0x12, 0x20,
+  0x40, 0xA0, 0x80, 0xB9, 0x00, 0x02, 0x20, 0x10, 0x00, 0x81, 0x08, 0x90, 0x88, 0x05, 0x08, 0x00,
+  0x10, 0x00, 0x20, 0x80, 0x83, 0x00, 0x05, 0x40, 0x20, 0x10, 0x00, 0x08, 0x08, 0x90, 0x88, 0x81,
+  0x08, 0x03, 0x10, 0x10, 0x20, 0x40, 0xBA, 0x00, 0x01, 0x02, 0x01, 0x92, 0x00, 0x02, 0x01, 0x02,
+  0x04, 0x9E, 0x00, 0x02, 0x01, 0x02, 0x04, 0xB8, 0x00, 0x00, 0xF8, 0x82, 0x00, 0x80, 0xC0, 0x00,
+  0xC8, 0x81, 0xD8, 0x04, 0xF8, 0xA8, 0x30, 0x70, 0x70, 0x80, 0x00, 0x03, 0xC0, 0x40, 0x80, 0x80,
+  0x8A, 0x00, 0x00, 0x02, 0x85, 0x00, 0x02, 0x80, 0x80, 0xC0, 0x81, 0x00, 0x03, 0x70, 0x30, 0x20,
+  0xB8, 0x84, 0xD8, 0x02, 0xC0, 0xC0, 0x80, 0x82, 0x00, 0x00, 0x80, 0xAF, 0x00, 0x04, 0x08, 0x3C,
+  0x1E, 0x19, 0x18, 0x80, 0x0C, 0x00, 0x0E, 0x81, 0x06, 0x83, 0x03, 0x0A, 0x21, 0x60, 0x10, 0x90,
+  0x80, 0x80, 0x00, 0x01, 0x01, 0x02, 0x01, 0x83, 0x00, 0x02, 0x20, 0x10, 0x0E, 0x80, 0x00, 0x02,
+  0x10, 0x20, 0x20, 0x81, 0x00, 0x03, 0x06, 0x03, 0x00, 0x01, 0x80, 0x00, 0x06, 0x80, 0x80, 0x90,
+  0x90, 0x31, 0x53, 0x53, 0x81, 0x03, 0x00, 0x02, 0x80, 0x06, 0x00, 0x0E, 0x80, 0x0C, 0x04, 0x18,
+  0x18, 0x1F, 0x16, 0x3C, 0xC2, 0x00, 0x0E, 0x20, 0x38, 0x31, 0x31, 0x21, 0x63, 0x42, 0xC6, 0xC4,
+  0xCC, 0x8C, 0x88, 0x88, 0x98, 0x98, 0x87, 0x18, 0x0E, 0x98, 0x88, 0x8C, 0x8C, 0x84, 0xC6, 0xC6,
+  0xC2, 0x43, 0x61, 0x61, 0x31, 0xB0, 0x80, 0x18, 0xD6, 0x00, 0x06, 0x03, 0x1B, 0x6C, 0xF0, 0xC0,
+  0x80, 0xC0, 0x80, 0x60, 0x00, 0x61, 0x81, 0x31, 0x80, 0x61, 0x03, 0xC3, 0x63, 0x61, 0x71, 0x80,
+  0x31, 0x0B, 0x71, 0x61, 0x61, 0x60, 0xC0, 0xC0, 0x80, 0x40, 0xE0, 0x78, 0x1E, 0x06, 0xDC, 0x00,
+  0x08, 0x03, 0x07, 0x0C, 0x18, 0x30, 0x60, 0xE0, 0xC0, 0xC0, 0x87, 0x80, 0x09, 0xC0, 0xC0, 0xE0,
+  0x60, 0x70, 0x30, 0x18, 0x0C, 0x07, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA7,
+  0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x95, 0x00, 0x07, 0x80, 0xC0, 0x60,
+  0x30, 0x38, 0x1C, 0x1E, 0x0E, 0x85, 0x0F, 0x04, 0x1F, 0x1E, 0x3C, 0x38, 0x60, 0x92, 0x00, 0x05,
+  0x70, 0x38, 0x3C, 0x1E, 0x1F, 0x1F, 0x82, 0x0F, 0x08, 0x0E, 0x0E, 0x1E, 0x1C, 0x1C, 0x38, 0x30,
+  0xE0, 0xC0, 0xBB, 0x00, 0x04, 0x80, 0xC0, 0xC4, 0xC3, 0xE1, 0x92, 0xE0, 0x81, 0xC0, 0x00, 0x80,
+  0x86, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x92, 0xE0, 0x04, 0xE1, 0xC1, 0xC6, 0xC8, 0x80, 0xB5, 0x00,
+  0x01, 0xF8, 0xFE, 0x80, 0xFF, 0x04, 0x7F, 0x0F, 0x07, 0x03, 0x03, 0x90, 0x01, 0x05, 0x03, 0x03,
+  0x0F, 0x3F, 0xFF, 0xFC, 0x81, 0x00, 0x06, 0xF0, 0xFE, 0xFF, 0x1F, 0x07, 0x03, 0x03, 0x90, 0x01,
+  0x03, 0x03, 0x03, 0x07, 0x1F, 0x81, 0xFF, 0x00, 0xFE, 0xB3, 0x00, 0x82, 0xFF, 0x82, 0x00, 0x80,
+  0x20, 0x81, 0x40, 0x01, 0xC0, 0x80, 0x8B, 0x00, 0x01, 0xFF, 0xFF, 0x81, 0x00, 0x80, 0xFF, 0x89,
+  0x00, 0x00, 0x80, 0x80, 0x40, 0x00, 0x60, 0x83, 0x20, 0x81, 0x00, 0x82, 0xFF, 0xB0, 0x00, 0x07,
+  0x20, 0x20, 0x30, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x81, 0x0E, 0x84, 0x06, 0x02, 0x82, 0x80, 0x80,
+  0x80, 0x00, 0x03, 0x01, 0x02, 0x02, 0x04, 0x84, 0x00, 0x01, 0x7F, 0x7F, 0x81, 0x00, 0x02, 0x7F,
+  0x7F, 0xFF, 0x81, 0x00, 0x04, 0x08, 0x04, 0x02, 0x02, 0x01, 0x82, 0x00, 0x03, 0x88, 0x82, 0x06,
+  0x46, 0x82, 0x06, 0x81, 0x0E, 0x00, 0x0F, 0x80, 0x1F, 0x03, 0x3F, 0x30, 0x30, 0x20, 0xC2, 0x00,
+  0x06, 0xFF, 0x3E, 0x3E, 0x7C, 0x7C, 0xF8, 0xF8, 0x80, 0xF0, 0x81, 0xE0, 0x88, 0xC0, 0x81, 0xE0,
+  0x01, 0xF0, 0xF0, 0x80, 0xF8, 0x05, 0xFC, 0x7C, 0x7E, 0x3E, 0xFF, 0x3F, 0xD6, 0x00, 0x03, 0x07,
+  0x18, 0x60, 0x80, 0x80, 0x00, 0x00, 0x01, 0x80, 0x81, 0x02, 0x83, 0xC3, 0xC3, 0x80, 0x83, 0x00,
+  0x03, 0x82, 0x83, 0x00, 0xC3, 0x80, 0x83, 0x0A, 0x81, 0x81, 0x01, 0x01, 0x00, 0x00, 0x80, 0x60,
+  0x38, 0x0E, 0x01, 0xDA, 0x00, 0x06, 0x01, 0x03, 0x06, 0x0F, 0x3F, 0x7F, 0x7F, 0x8D, 0xFF, 0x07,
+  0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x04, 0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xA6, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x94, 0x00, 0x08, 0x80, 0x60,
+  0x30, 0x38, 0x1C, 0x0E, 0x0F, 0x07, 0x07, 0x84, 0x03, 0x80, 0x07, 0x02, 0x0F, 0x0E, 0x18, 0x91,
+  0x00, 0x03, 0x20, 0x1C, 0x0E, 0x0F, 0x80, 0x07, 0x84, 0x03, 0x08, 0x07, 0x07, 0x0E, 0x0E, 0x1C,
+  0x38, 0x30, 0x40, 0x80, 0xB8, 0x00, 0x04, 0x80, 0xC0, 0xE0, 0xF2, 0xF1, 0x81, 0xF8, 0x8F, 0x78,
+  0x00, 0xF8, 0x80, 0xF0, 0x01, 0xE0, 0xC0, 0x83, 0x00, 0x05, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8,
+  0x90, 0x78, 0x81, 0xF8, 0x04, 0xF1, 0xF2, 0xE0, 0xC0, 0x80, 0xB3, 0x00, 0x00, 0xE0, 0x82, 0xFF,
+  0x01, 0x03, 0x01, 0x94, 0x00, 0x03, 0x03, 0x07, 0xFF, 0xFF, 0x81, 0x00, 0x04, 0xF0, 0xFF, 0xFF,
+  0x07, 0x01, 0x94, 0x00, 0x01, 0x01, 0x03, 0x82, 0xFF, 0x00, 0xE0, 0xB2, 0x00, 0x83, 0xFF, 0x01,
+  0xC0, 0xC0, 0x84, 0xC8, 0x02, 0x88, 0x10, 0x10, 0x81, 0x00, 0x03, 0x40, 0x40, 0x80, 0x80, 0x84,
+  0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x80, 0x00, 0x80, 0xFF, 0x83, 0x00, 0x02, 0x80, 0x00, 0x40, 0x81,
+  0x00, 0x03, 0x10, 0x10, 0x08, 0x88, 0x83, 0xC8, 0x80, 0xC0, 0x00, 0x80, 0x82, 0xFF, 0x00, 0x3F,
+  0xAF, 0x00, 0x04, 0x08, 0x0C, 0x06, 0x07, 0x07, 0x80, 0x03, 0x82, 0x01, 0x83, 0x00, 0x05, 0x21,
+  0x20, 0xD0, 0xD0, 0x80, 0x80, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x1F, 0x0F, 0x0F, 0x80,
+  0x00, 0x02, 0x0F, 0x1F, 0x1F, 0x81, 0x00, 0x01, 0x01, 0x01, 0x82, 0x00, 0x06, 0x80, 0xC0, 0xD0,
+  0xD1, 0xF0, 0x10, 0x10, 0x81, 0x00, 0x82, 0x01, 0x80, 0x03, 0x04, 0x07, 0x07, 0x06, 0x06, 0x0C,
+  0xC2, 0x00, 0x05, 0x1F, 0xE7, 0x0F, 0x0F, 0x1F, 0x1F, 0x80, 0x3E, 0x02, 0x3C, 0x7C, 0x7C, 0x80,
+  0x78, 0x87, 0xF8, 0x01, 0x78, 0x78, 0x80, 0x7C, 0x80, 0x3E, 0x06, 0x3F, 0x1F, 0x1F, 0x0F, 0x8F,
+  0x7F, 0x07, 0xD7, 0x00, 0x05, 0x07, 0x1C, 0x30, 0x40, 0x80, 0xC0, 0x81, 0xE0, 0x81, 0xF0, 0x80,
+  0xE0, 0x02, 0xC0, 0xE0, 0xE0, 0x82, 0xF0, 0x80, 0xE0, 0x07, 0xC0, 0xC0, 0x80, 0xC0, 0x20, 0x18,
+  0x06, 0x01, 0xDD, 0x00, 0x07, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x3F, 0x3F, 0x88, 0x7F, 0x07,
+  0x3F, 0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xA8, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x97, 0x00, 0x05, 0x20, 0x12,
+  0x09, 0x08, 0x04, 0x06, 0x80, 0x02, 0x81, 0x03, 0x06, 0x07, 0x06, 0x06, 0x0E, 0x0F, 0x1B, 0x04,
+  0x90, 0x00, 0x06, 0x20, 0x14, 0x00, 0x08, 0x00, 0x04, 0x04, 0x84, 0x02, 0x09, 0x06, 0x04, 0x0D,
+  0x09, 0x12, 0x34, 0x28, 0x70, 0xC0, 0x80, 0xBB, 0x00, 0x00, 0x09, 0x93, 0x00, 0x06, 0x80, 0x08,
+  0x08, 0x00, 0x10, 0x20, 0x80, 0x86, 0x00, 0x00, 0x08, 0x91, 0x00, 0x00, 0x80, 0x80, 0x00, 0x04,
+  0x09, 0x03, 0x10, 0x20, 0x40, 0xB3, 0x00, 0x00, 0xE0, 0x9B, 0x00, 0x04, 0x02, 0x04, 0x00, 0x00,
+  0xFC, 0x80, 0x00, 0x00, 0xF0, 0x98, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x1C, 0xB2, 0x00, 0x00,
+  0xFF, 0x84, 0x00, 0x0A, 0x20, 0x20, 0x28, 0x20, 0x20, 0x00, 0x00, 0x40, 0xD8, 0x00, 0x10, 0x82,
+  0x00, 0x00, 0x80, 0x87, 0x00, 0x00, 0x1F, 0x88, 0x00, 0x03, 0x80, 0x00, 0x40, 0x20, 0x82, 0x00,
+  0x03, 0x18, 0xC0, 0xC0, 0x84, 0x80, 0xAC, 0x05, 0x2C, 0x2C, 0x24, 0x20, 0x00, 0x40, 0x82, 0x00,
+  0x00, 0xC0, 0xAF, 0x00, 0x09, 0x0C, 0x0A, 0x00, 0x04, 0x04, 0x00, 0x02, 0x02, 0x00, 0x00, 0x80,
+  0x01, 0x83, 0x00, 0x06, 0x31, 0x30, 0x20, 0x00, 0x40, 0x00, 0x80, 0x87, 0x00, 0x02, 0x10, 0x00,
+  0x08, 0x81, 0x00, 0x00, 0x10, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x07, 0x80, 0x40, 0x00, 0x10,
+  0x31, 0x00, 0x10, 0x18, 0x81, 0x00, 0x80, 0x01, 0x0A, 0x00, 0x00, 0x02, 0x02, 0x00, 0x04, 0x04,
+  0x01, 0x00, 0x0A, 0x04, 0xC1, 0x00, 0x0E, 0x10, 0x90, 0x88, 0x00, 0x10, 0x00, 0x21, 0x20, 0x00,
+  0x02, 0x40, 0x40, 0x44, 0x04, 0x00, 0x87, 0x80, 0x0D, 0x04, 0x04, 0x40, 0x42, 0x42, 0x00, 0x00,
+  0x21, 0x20, 0x00, 0x10, 0x00, 0x48, 0x40, 0xD8, 0x00, 0x06, 0x04, 0x10, 0x28, 0x20, 0x40, 0x20,
+  0x00, 0x80, 0x10, 0x81, 0x08, 0x80, 0x10, 0x02, 0x20, 0x10, 0x10, 0x82, 0x08, 0x80, 0x10, 0x06,
+  0x20, 0x20, 0x40, 0xA0, 0x10, 0x14, 0x01, 0xDE, 0x00, 0x07, 0x01, 0x02, 0x04, 0x08, 0x00, 0x10,
+  0x20, 0x20, 0x87, 0x40, 0x08, 0x60, 0x20, 0x30, 0x10, 0x08, 0x08, 0x04, 0x02, 0x01, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA8, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0x95, 0x00, 0x07, 0xC0, 0xE0, 0x70, 0x30, 0x1C, 0x1C, 0x0E, 0x0E, 0x85, 0x0F, 0x04, 0x1F,
+  0x1E, 0x3E, 0x3C, 0x60, 0x92, 0x00, 0x04, 0x70, 0x38, 0x3E, 0x1E, 0x1F, 0x85, 0x0F, 0x07, 0x0E,
+  0x1E, 0x1C, 0x38, 0x30, 0x60, 0xC0, 0x80, 0xBA, 0x00, 0x04, 0x80, 0xC0, 0xC4, 0xE3, 0xE1, 0x95,
+  0xE0, 0x02, 0xC0, 0xC0, 0x80, 0x84, 0x00, 0x02, 0x80, 0xC0, 0xC0, 0x95, 0xE0, 0x04, 0xE1, 0xE2,
+  0xC4, 0xC0, 0x80, 0xB4, 0x00, 0x00, 0xF0, 0x82, 0xFF, 0x03, 0x0F, 0x03, 0x03, 0x01, 0x8F, 0x00,
+  0x06, 0x01, 0x01, 0x03, 0x07, 0x1F, 0xFF, 0xFE, 0x81, 0x00, 0x07, 0xE0, 0xFE, 0xFF, 0x0F, 0x07,
+  0x03, 0x01, 0x01, 0x8F, 0x00, 0x03, 0x01, 0x03, 0x03, 0x0F, 0x82, 0xFF, 0xB3, 0x00, 0x83, 0xFF,
+  0x02, 0x00, 0x00, 0x20, 0x80, 0x00, 0x82, 0x20, 0x01, 0x40, 0x40, 0x8B, 0x00, 0x01, 0xFF, 0xFF,
+  0x81, 0x00, 0x80, 0xFF, 0x85, 0x00, 0x00, 0x80, 0x81, 0x00, 0x04, 0x40, 0x60, 0x20, 0x20, 0x30,
+  0x82, 0x10, 0x81, 0x00, 0x82, 0xFF, 0x00, 0x01, 0xAF, 0x00, 0x04, 0x20, 0x30, 0x18, 0x1F, 0x1F,
+  0x81, 0x0F, 0x81, 0x07, 0x82, 0x03, 0x0B, 0x02, 0x04, 0x40, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x02, 0x04, 0x83, 0x00, 0x01, 0x3F, 0x3F, 0x81, 0x00, 0x02, 0x3F, 0x3F, 0x7F, 0x81, 0x00,
+  0x04, 0x04, 0x02, 0x02, 0x01, 0x01, 0x81, 0x00, 0x03, 0x40, 0xC0, 0xC0, 0x43, 0x82, 0x03, 0x81,
+  0x07, 0x81, 0x0F, 0x04, 0x1F, 0x1F, 0x18, 0x30, 0x30, 0xC2, 0x00, 0x01, 0x7F, 0x9F, 0x80, 0x3E,
+  0x03, 0x7C, 0x7C, 0xF8, 0xF8, 0x81, 0xF0, 0x8A, 0xE0, 0x80, 0xF0, 0x80, 0xF8, 0x07, 0xFC, 0x7C,
+  0x7E, 0x3E, 0x3E, 0x3F, 0xDF, 0x3F, 0xD6, 0x00, 0x03, 0x03, 0x1C, 0x30, 0xC0, 0x80, 0x00, 0x80,
+  0x80, 0x83, 0xC1, 0x03, 0x81, 0x81, 0x03, 0x83, 0x84, 0xC1, 0x02, 0x81, 0x80, 0x80, 0x80, 0x00,
+  0x04, 0xC0, 0x60, 0x18, 0x07, 0x01, 0xDB, 0x00, 0x06, 0x03, 0x06, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F,
+  0x8B, 0xFF, 0x07, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x06, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xA7, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x95, 0x00,
+  0x06, 0x80, 0xC0, 0x70, 0x38, 0x1C, 0x0E, 0x0E, 0x80, 0x07, 0x86, 0x03, 0x02, 0x07, 0x06, 0x08,
+  0x91, 0x00, 0x03, 0x10, 0x0C, 0x0E, 0x0E, 0x81, 0x07, 0x81, 0x03, 0x08, 0x07, 0x06, 0x06, 0x0C,
+  0x0C, 0x18, 0x30, 0x60, 0xC0, 0xBA, 0x00, 0x04, 0x80, 0xC0, 0xE0, 0xE3, 0xE1, 0x93, 0xF0, 0x80,
+  0xE0, 0x01, 0xC0, 0x80, 0x84, 0x00, 0x01, 0x80, 0xC0, 0x80, 0xE0, 0x93, 0xF0, 0x04, 0xE0, 0xE1,
+  0xE2, 0xC0, 0xC0, 0xB4, 0x00, 0x00, 0xC0, 0x82, 0xFF, 0x03, 0x07, 0x03, 0x01, 0x01, 0x90, 0x00,
+  0x06, 0x01, 0x03, 0x03, 0x0F, 0xFF, 0xFF, 0xE0, 0x80, 0x00, 0x06, 0xC0, 0xFF, 0xFF, 0x0F, 0x03,
+  0x03, 0x01, 0x91, 0x00, 0x02, 0x01, 0x03, 0x07, 0x82, 0xFF, 0x00, 0xF8, 0xB2, 0x00, 0x83, 0xFF,
+  0x80, 0x80, 0x82, 0x90, 0x00, 0x10, 0x80, 0x20, 0x00, 0x40, 0x80, 0x00, 0x00, 0x80, 0x87, 0x00,
+  0x80, 0xFF, 0x80, 0x00, 0x80, 0xFF, 0x85, 0x00, 0x00, 0x80, 0x81, 0x00, 0x03, 0x60, 0x20, 0x20,
+  0x10, 0x84, 0x90, 0x02, 0x80, 0x80, 0x00, 0x83, 0xFF, 0xAF, 0x00, 0x02, 0x10, 0x18, 0x08, 0x80,
+  0x0F, 0x80, 0x07, 0x81, 0x03, 0x82, 0x01, 0x04, 0x00, 0x43, 0x40, 0x80, 0xA0, 0x80, 0x00, 0x03,
+  0x01, 0x01, 0x02, 0x02, 0x83, 0x00, 0x02, 0x3F, 0x3F, 0x1F, 0x80, 0x00, 0x80, 0x3F, 0x81, 0x00,
+  0x03, 0x04, 0x02, 0x01, 0x01, 0x82, 0x00, 0x04, 0xA0, 0xE0, 0xE3, 0x21, 0x21, 0x81, 0x01, 0x81,
+  0x03, 0x80, 0x07, 0x81, 0x0F, 0x01, 0x18, 0x18, 0xC2, 0x00, 0x02, 0x3F, 0xDF, 0x1F, 0x80, 0x3E,
+  0x04, 0x7C, 0x7C, 0x78, 0xF8, 0xF8, 0x82, 0xF0, 0x84, 0xE0, 0x81, 0xF0, 0x81, 0xF8, 0x08, 0x7C,
+  0x7C, 0x7E, 0x3E, 0x3F, 0x3F, 0x1F, 0xFF, 0x1F, 0xD6, 0x00, 0x09, 0x01, 0x0E, 0x38, 0x60, 0x80,
+  0x00, 0x80, 0x80, 0xC0, 0xC0, 0x81, 0xE0, 0x05, 0xE1, 0xE1, 0xC1, 0xC1, 0x81, 0xC1, 0x81, 0xE1,
+  0x80, 0xE0, 0x09, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x80, 0x40, 0x30, 0x0C, 0x03, 0xDC, 0x00, 0x06,
+  0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x3F, 0x80, 0x7F, 0x86, 0xFF, 0x80, 0x7F, 0x06, 0x3F, 0x1F,
+  0x1F, 0x0F, 0x07, 0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA7, 0x00, 0x02,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x95, 0x00, 0x08, 0xC0, 0x30, 0x38, 0x1C, 0x0E,
+  0x07, 0x07, 0x03, 0x03, 0x80, 0x01, 0x82, 0x00, 0x81, 0x01, 0x93, 0x00, 0x02, 0x06, 0x03, 0x03,
+  0x82, 0x01, 0xC6, 0x00, 0x04, 0xC0, 0xE0, 0xF0, 0xF1, 0xF0, 0x80, 0xF8, 0x8F, 0x78, 0x00, 0xF8,
+  0x80, 0xF0, 0x02, 0xE0, 0xC0, 0x80, 0x83, 0x00, 0x01, 0xC0, 0xE0, 0x80, 0xF0, 0x00, 0xF8, 0x8F,
+  0x78, 0x81, 0xF8, 0x04, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xB4, 0x00, 0x82, 0xFF, 0x01, 0x07, 0x01,
+  0x94, 0x00, 0x04, 0x01, 0x07, 0xFF, 0xFF, 0xFC, 0x81, 0x00, 0x04, 0xFF, 0xFF, 0x0F, 0x03, 0x01,
+  0x93, 0x00, 0x01, 0x01, 0x03, 0x82, 0xFF, 0x00, 0xFC, 0xB3, 0x00, 0x82, 0xFF, 0x00, 0x80, 0x80,
+  0xC0, 0x81, 0xC8, 0x04, 0x88, 0x00, 0x10, 0x10, 0x20, 0x80, 0x00, 0x03, 0x40, 0x00, 0x80, 0x80,
+  0x84, 0x00, 0x80, 0xFF, 0x80, 0x00, 0x02, 0xFC, 0xFF, 0xFF, 0x83, 0x00, 0x02, 0x80, 0x80, 0x40,
+  0x81, 0x00, 0x04, 0x10, 0x90, 0x10, 0x88, 0x88, 0x83, 0xC8, 0x02, 0xC0, 0x80, 0x80, 0x83, 0xFF,
+  0xB0, 0x00, 0x04, 0x0C, 0x0E, 0x06, 0x07, 0x07, 0x80, 0x03, 0x82, 0x01, 0x81, 0x00, 0x06, 0x01,
+  0x21, 0x20, 0xE0, 0xC0, 0x80, 0x80, 0x80, 0x00, 0x01, 0x01, 0x01, 0x83, 0x00, 0x02, 0x1F, 0x1F,
+  0x0F, 0x80, 0x00, 0x02, 0x1F, 0x1F, 0x3F, 0x81, 0x00, 0x01, 0x02, 0x01, 0x82, 0x00, 0x06, 0x80,
+  0x80, 0xD0, 0xC0, 0xE1, 0x10, 0x10, 0x80, 0x00, 0x82, 0x01, 0x80, 0x03, 0x80, 0x07, 0x03, 0x0F,
+  0x0E, 0x0C, 0x08, 0xC1, 0x00, 0x0A, 0x1F, 0xFF, 0x0F, 0x0F, 0x1F, 0x1F, 0x3E, 0x3E, 0x3C, 0x7C,
+  0x7C, 0x80, 0x78, 0x89, 0xF8, 0x01, 0x78, 0x78, 0x80, 0x7C, 0x02, 0x3E, 0x3E, 0x3F, 0x80, 0x1F,
+  0x02, 0x8F, 0x7F, 0x0F, 0xD7, 0x00, 0x06, 0x03, 0x1C, 0x30, 0x40, 0x80, 0x80, 0xC0, 0x80, 0xE0,
+  0x81, 0xF0, 0x80, 0xE0, 0x00, 0xC0, 0x80, 0xE0, 0x81, 0xF0, 0x80, 0xE0, 0x07, 0xC0, 0xC0, 0x80,
+  0xC0, 0x60, 0x18, 0x0E, 0x03, 0xDD, 0x00, 0x07, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x3F, 0x3F,
+  0x88, 0x7F, 0x07, 0x3F, 0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xA8, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x95, 0x00,
+  0x08, 0x80, 0xC0, 0xE0, 0x70, 0x30, 0x38, 0x1C, 0x1C, 0x1E, 0x82, 0x0E, 0x80, 0x1E, 0x03, 0x3C,
+  0x3C, 0x78, 0x60, 0x92, 0x00, 0x04, 0xC0, 0x70, 0x78, 0x3C, 0x3C, 0x85, 0x1E, 0x07, 0x1C, 0x1C,
+  0x38, 0x30, 0x70, 0xE0, 0xC0, 0x80, 0xBA, 0x00, 0x05, 0x80, 0xC0, 0xC0, 0xC2, 0xC1, 0xE1, 0x92,
+  0xE0, 0x80, 0xC0, 0x00, 0x80, 0x86, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x92, 0xE0, 0x05, 0xE1, 0xC1,
+  0xC2, 0xC0, 0xC0, 0x80, 0xB4, 0x00, 0x01, 0xF0, 0xFE, 0x81, 0xFF, 0x03, 0x0F, 0x07, 0x03, 0x03,
+  0x90, 0x01, 0x05, 0x03, 0x03, 0x07, 0x1F, 0xFF, 0xFC, 0x81, 0x00, 0x06, 0xE0, 0xFE, 0xFF, 0x1F,
+  0x07, 0x03, 0x03, 0x91, 0x01, 0x02, 0x03, 0x07, 0x0F, 0x82, 0xFF, 0xB3, 0x00, 0x82, 0xFF, 0x02,
+  0x01, 0x00, 0x00, 0x84, 0x20, 0x02, 0x60, 0x40, 0x40, 0x8C, 0x00, 0x01, 0xFF, 0xFF, 0x81, 0x00,
+  0x80, 0xFF, 0x8A, 0x00, 0x02, 0x40, 0x40, 0x60, 0x84, 0x20, 0x81, 0x00, 0x82, 0xFF, 0x00, 0x17,
+  0xAF, 0x00, 0x04, 0x30, 0x30, 0x18, 0x1F, 0x1F, 0x80, 0x0F, 0x80, 0x07, 0x84, 0x03, 0x0B, 0x02,
+  0x80, 0x80, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x04, 0x83, 0x00, 0x01, 0x7F, 0x7F,
+  0x81, 0x00, 0x02, 0x7F, 0x7F, 0xFF, 0x81, 0x00, 0x04, 0x0C, 0x04, 0x02, 0x00, 0x01, 0x82, 0x00,
+  0x02, 0x80, 0xC0, 0x02, 0x84, 0x03, 0x81, 0x07, 0x81, 0x0F, 0x03, 0x1C, 0x18, 0x10, 0x10, 0xC1,
+  0x00, 0x07, 0x7F, 0xBF, 0x3E, 0x3E, 0x7C, 0x7C, 0xF8, 0xF8, 0x80, 0xF0, 0x81, 0xE0, 0x85, 0xC0,
+  0x81, 0xE0, 0x80, 0xF0, 0x80, 0xF8, 0x06, 0xFC, 0x7E, 0x7E, 0x3F, 0x3F, 0xDF, 0x3F, 0xD6, 0x00,
+  0x03, 0x03, 0x1C, 0x70, 0xC0, 0x80, 0x00, 0x01, 0x80, 0x80, 0x82, 0xC1, 0x01, 0xC3, 0xC3, 0x80,
+  0x83, 0x82, 0xC3, 0x81, 0xC1, 0x01, 0x81, 0x80, 0x80, 0x00, 0x04, 0xC0, 0x60, 0x18, 0x07, 0x01,
+  0xDB, 0x00, 0x07, 0x03, 0x06, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x8A, 0xFF, 0x07, 0x7F, 0x7F,
+  0x3F, 0x1F, 0x1F, 0x0F, 0x02, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA7, 0x00,
+  0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x94, 0x00, 0x07, 0x80, 0x60, 0x30, 0x18,
+  0x0E, 0x07, 0x07, 0x03, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x02, 0x03, 0x03, 0x06, 0x92, 0x00,
+  0x04, 0x0E, 0x07, 0x07, 0x03, 0x03, 0x85, 0x01, 0x08, 0x03, 0x03, 0x07, 0x07, 0x0E, 0x1C, 0x30,
+  0x60, 0x80, 0xB7, 0x00, 0x03, 0x80, 0xE0, 0xF0, 0xF0, 0x81, 0xF8, 0x80, 0x78, 0x8C, 0x38, 0x80,
+  0x78, 0x04, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x82, 0x00, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8,
+  0x78, 0x78, 0x8D, 0x38, 0x01, 0x78, 0x78, 0x82, 0xF8, 0x02, 0xF2, 0xE0, 0xC0, 0xB4, 0x00, 0x82,
+  0xFF, 0x01, 0x03, 0x01, 0x94, 0x00, 0x04, 0x01, 0x03, 0xFF, 0xFF, 0xFE, 0x81, 0x00, 0x03, 0xFF,
+  0xFF, 0x07, 0x01, 0x95, 0x00, 0x01, 0x01, 0x1F, 0x81, 0xFF, 0x00, 0xFE, 0xB3, 0x00, 0x82, 0xFF,
+  0x01, 0xC0, 0xC0, 0x82, 0xE0, 0x81, 0xC8, 0x01, 0x08, 0x10, 0x80, 0x00, 0x03, 0x60, 0x40, 0x40,
+  0x80, 0x84, 0x00, 0x80, 0xFF, 0x81, 0x00, 0x01, 0xFF, 0xFF, 0x82, 0x00, 0x03, 0x80, 0x80, 0x40,
+  0x60, 0x81, 0x00, 0x05, 0x10, 0x08, 0xC8, 0xC8, 0xCC, 0xC4, 0x82, 0xE4, 0x80, 0xC0, 0x00, 0xFC,
+  0x82, 0xFF, 0xAF, 0x00, 0x03, 0x04, 0x06, 0x06, 0x07, 0x80, 0x03, 0x81, 0x01, 0x85, 0x00, 0x06,
+  0x10, 0x10, 0xF0, 0xD0, 0xC0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x0F, 0x0F,
+  0x07, 0x80, 0x00, 0x02, 0x08, 0x0F, 0x1F, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x06, 0x80, 0x80,
+  0xC0, 0xC0, 0xF0, 0xF0, 0x10, 0x84, 0x00, 0x82, 0x01, 0x80, 0x03, 0x03, 0x07, 0x06, 0x04, 0x04,
+  0xC1, 0x00, 0x0D, 0x0F, 0x77, 0x87, 0x0F, 0x0F, 0x1F, 0x1F, 0x1E, 0x3E, 0x3E, 0x3C, 0x3C, 0x7C,
+  0x7C, 0x88, 0x78, 0x80, 0x7C, 0x00, 0x3C, 0x80, 0x3E, 0x80, 0x1F, 0x04, 0x0F, 0x0F, 0xC7, 0x7F,
+  0x07, 0xD7, 0x00, 0x07, 0x03, 0x0C, 0x18, 0x60, 0xC0, 0xC0, 0xE0, 0xE0, 0x85, 0xF0, 0x01, 0xE0,
+  0xE0, 0x86, 0xF0, 0x08, 0xE0, 0xE0, 0xC0, 0x80, 0x60, 0x30, 0x1C, 0x06, 0x01, 0xDE, 0x00, 0x08,
+  0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x83, 0x7F, 0x80, 0x3F, 0x06, 0x1F, 0x1F,
+  0x0F, 0x0F, 0x07, 0x03, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA9, 0x00, 0x02,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x95, 0x00, 0x07, 0x80, 0xC0, 0x60, 0x70, 0x38,
+  0x18, 0x1C, 0x1E, 0x83, 0x0E, 0x80, 0x1E, 0x03, 0x3C, 0x3C, 0x78, 0xE0, 0x92, 0x00, 0x04, 0xE0,
+  0x70, 0x3C, 0x3C, 0x3E, 0x80, 0x1E, 0x81, 0x0E, 0x08, 0x1E, 0x1C, 0x1C, 0x38, 0x38, 0x70, 0xE0,
+  0xC0, 0x80, 0xBA, 0x00, 0x04, 0x80, 0xC0, 0xC4, 0xC2, 0xE1, 0x94, 0xE0, 0x02, 0xC0, 0xC0, 0x80,
+  0x86, 0x00, 0x02, 0x80, 0xC0, 0xC0, 0x93, 0xE0, 0x05, 0xE1, 0xE1, 0xC2, 0xC0, 0xC0, 0x80, 0xB4,
+  0x00, 0x01, 0xC0, 0xFE, 0x81, 0xFF, 0x02, 0x0F, 0x07, 0x03, 0x91, 0x01, 0x05, 0x03, 0x03, 0x07,
+  0x1F, 0xFF, 0xFE, 0x81, 0x00, 0x06, 0xE0, 0xFE, 0xFF, 0x1F, 0x07, 0x03, 0x03, 0x91, 0x01, 0x02,
+  0x03, 0x07, 0x0F, 0x82, 0xFF, 0x00, 0xF0, 0xB2, 0x00, 0x83, 0xFF, 0x01, 0x00, 0x00, 0x85, 0x20,
+  0x01, 0x40, 0x40, 0x8C, 0x00, 0x01, 0xFF, 0xFF, 0x81, 0x00, 0x80, 0xFF, 0x8A, 0x00, 0x02, 0x40,
+  0x40, 0x60, 0x85, 0x20, 0x80, 0x00, 0x83, 0xFF, 0xAF, 0x00, 0x02, 0x20, 0x30, 0x30, 0x80, 0x1F,
+  0x80, 0x0F, 0x00, 0x0E, 0x82, 0x07, 0x0E, 0x03, 0x02, 0x06, 0x04, 0x84, 0x80, 0x40, 0x40, 0x00,
+  0x00, 0x01, 0x01, 0x02, 0x02, 0x04, 0x83, 0x00, 0x01, 0x7F, 0x3F, 0x81, 0x00, 0x02, 0x3F, 0x7F,
+  0x7F, 0x81, 0x00, 0x04, 0x08, 0x04, 0x02, 0x00, 0x01, 0x81, 0x00, 0x06, 0x40, 0x40, 0xC6, 0x44,
+  0x42, 0x02, 0x03, 0x82, 0x07, 0x01, 0x0E, 0x0E, 0x80, 0x0F, 0x80, 0x1F, 0x02, 0x30, 0x30, 0x20,
+  0xC1, 0x00, 0x07, 0x7F, 0xBF, 0x3E, 0x3E, 0x7C, 0x7C, 0xF8, 0xF8, 0x80, 0xF0, 0x82, 0xE0, 0x84,
+  0xC0, 0x82, 0xE0, 0x01, 0xF0, 0xF0, 0x80, 0xF8, 0x06, 0xFC, 0x7C, 0x7E, 0x3E, 0x3F, 0xFF, 0x3F,
+  0xD6, 0x00, 0x03, 0x03, 0x1C, 0x60, 0xC0, 0x80, 0x00, 0x03, 0x80, 0x80, 0x81, 0x81, 0x80, 0xC1,
+  0x00, 0xC3, 0x80, 0x83, 0x02, 0x03, 0x83, 0x83, 0x80, 0xC3, 0x01, 0xC1, 0xC1, 0x80, 0x81, 0x81,
+  0x00, 0x04, 0x80, 0x60, 0x18, 0x0E, 0x01, 0xDB, 0x00, 0x06, 0x03, 0x06, 0x0F, 0x1F, 0x3F, 0x7F,
+  0x7F, 0x8C, 0xFF, 0x06, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x06, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xA7, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x94, 0x00,
+  0x08, 0x80, 0x40, 0x30, 0x18, 0x0C, 0x0E, 0x07, 0x03, 0x03, 0x88, 0x01, 0x02, 0x03, 0x07, 0x06,
+  0x91, 0x00, 0x04, 0x10, 0x0E, 0x0F, 0x07, 0x07, 0x80, 0x03, 0x81, 0x01, 0x80, 0x03, 0x07, 0x07,
+  0x07, 0x0E, 0x0C, 0x18, 0x30, 0x60, 0x80, 0xB8, 0x00, 0x03, 0xC0, 0xE0, 0xF0, 0xF1, 0x81, 0xF8,
+  0x90, 0x78, 0x05, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0x80, 0x83, 0x00, 0x04, 0xC0, 0xE0, 0xF0, 0xF0,
+  0xF8, 0x91, 0x78, 0x81, 0xF8, 0x03, 0xF1, 0xF2, 0xE0, 0xC0, 0xB4, 0x00, 0x82, 0xFF, 0x01, 0x07,
+  0x01, 0x94, 0x00, 0x04, 0x01, 0x03, 0xFF, 0xFF, 0xFE, 0x81, 0x00, 0x03, 0xFF, 0xFF, 0x0F, 0x03,
+  0x95, 0x00, 0x01, 0x03, 0x1F, 0x81, 0xFF, 0x00, 0xFE, 0xB3, 0x00, 0x82, 0xFF, 0x06, 0xC0, 0xC0,
+  0xE0, 0xE8, 0xE0, 0xE0, 0xE8, 0x81, 0xC8, 0x01, 0x08, 0x10, 0x80, 0x00, 0x80, 0x40, 0x00, 0x80,
+  0x84, 0x00, 0x80, 0xFF, 0x80, 0x00, 0x02, 0xC0, 0xFF, 0xFF, 0x82, 0x00, 0x03, 0x80, 0x80, 0x40,
+  0x40, 0x81, 0x00, 0x06, 0x10, 0x08, 0xC8, 0x48, 0x48, 0x4C, 0x64, 0x80, 0xE4, 0x00, 0xE0, 0x80,
+  0xC0, 0x00, 0xF8, 0x82, 0xFF, 0xAF, 0x00, 0x02, 0x04, 0x06, 0x06, 0x80, 0x03, 0x81, 0x01, 0x86,
+  0x00, 0x06, 0x10, 0x10, 0xF0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02,
+  0x0F, 0x0F, 0x07, 0x80, 0x00, 0x02, 0x0F, 0x0F, 0x1F, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00,
+  0x80, 0x80, 0xC0, 0x03, 0xE0, 0xF0, 0x00, 0x08, 0x84, 0x00, 0x81, 0x01, 0x80, 0x03, 0x03, 0x07,
+  0x06, 0x06, 0x04, 0xC1, 0x00, 0x09, 0x0F, 0xF7, 0x87, 0x0F, 0x0F, 0x1F, 0x1F, 0x1E, 0x3E, 0x3E,
+  0x80, 0x3C, 0x00, 0x7C, 0x88, 0x78, 0x03, 0x7C, 0x7C, 0x3C, 0x3C, 0x80, 0x3E, 0x80, 0x1F, 0x04,
+  0x0F, 0x0F, 0xC7, 0x3F, 0x07, 0xD7, 0x00, 0x06, 0x03, 0x0C, 0x18, 0x60, 0xC0, 0xE0, 0xE0, 0x81,
+  0xF0, 0x80, 0xF8, 0x05, 0xF0, 0xF0, 0xE0, 0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x80, 0xF0, 0x07, 0xE0,
+  0xE0, 0xC0, 0x60, 0x30, 0x0C, 0x07, 0x01, 0xDE, 0x00, 0x06, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F,
+  0x1F, 0x87, 0x3F, 0x01, 0x1F, 0x1F, 0x80, 0x0F, 0x02, 0x07, 0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xA9, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x97,
+  0x00, 0x03, 0x80, 0xC0, 0xE0, 0xE0, 0x81, 0x70, 0x81, 0x78, 0x05, 0x70, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xC0, 0x94, 0x00, 0x08, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0x70, 0x70, 0x78, 0x78, 0x82, 0x70, 0x03,
+  0xE0, 0xC0, 0xC0, 0x80, 0xBD, 0x00, 0x06, 0x80, 0x88, 0xC4, 0xC6, 0xC3, 0xC1, 0xC1, 0x8A, 0xC0,
+  0x80, 0xC1, 0x00, 0xC3, 0x80, 0xC0, 0x01, 0x80, 0x80, 0x88, 0x00, 0x01, 0x80, 0x80, 0x80, 0xC0,
+  0x03, 0xC7, 0xC3, 0xC1, 0xC1, 0x8A, 0xC0, 0x05, 0xC1, 0xC1, 0xC3, 0xC6, 0x8C, 0x90, 0xB6, 0x00,
+  0x01, 0xC0, 0xFC, 0x81, 0xFF, 0x02, 0x1F, 0x0F, 0x07, 0x92, 0x03, 0x05, 0x07, 0x0F, 0x1F, 0xFF,
+  0xFC, 0x80, 0x80, 0x00, 0x06, 0x80, 0xFC, 0xFE, 0x3F, 0x0F, 0x07, 0x07, 0x91, 0x03, 0x02, 0x07,
+  0x0F, 0x1F, 0x81, 0xFF, 0x01, 0xFE, 0xE0, 0xB2, 0x00, 0x82, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0x83,
+  0x40, 0x80, 0x80, 0x8C, 0x00, 0x02, 0xFF, 0xFF, 0x03, 0x80, 0x00, 0x80, 0xFF, 0x8A, 0x00, 0x80,
+  0x80, 0x85, 0x40, 0x80, 0x00, 0x83, 0xFF, 0xAF, 0x00, 0x03, 0x40, 0x40, 0x60, 0x7F, 0x81, 0x3F,
+  0x02, 0x1F, 0x1C, 0x1C, 0x85, 0x0C, 0x02, 0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0x02, 0x06, 0x04,
+  0x08, 0x84, 0x00, 0x01, 0xFF, 0x7F, 0x81, 0x00, 0x02, 0x7F, 0xFF, 0xFF, 0x81, 0x00, 0x04, 0x10,
+  0x08, 0x0C, 0x04, 0x02, 0x82, 0x00, 0x02, 0x18, 0x10, 0x04, 0x82, 0x0C, 0x82, 0x1C, 0x81, 0x3F,
+  0x03, 0x7F, 0x7F, 0x60, 0x40, 0xC2, 0x00, 0x01, 0xFF, 0x7D, 0x80, 0xF8, 0x03, 0xF0, 0xF0, 0xE0,
+  0xE0, 0x81, 0xC0, 0x8A, 0x80, 0x81, 0xC0, 0x0B, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFD,
+  0x7F, 0xFF, 0x01, 0x01, 0xD4, 0x00, 0x03, 0x07, 0x38, 0x60, 0x80, 0x80, 0x01, 0x00, 0x03, 0x80,
+  0x83, 0x83, 0x87, 0x01, 0x07, 0x07, 0x85, 0x87, 0x00, 0x83, 0x80, 0x03, 0x06, 0x01, 0x01, 0x81,
+  0xC0, 0x30, 0x1C, 0x03, 0xDA, 0x00, 0x06, 0x01, 0x02, 0x04, 0x0E, 0x3F, 0x7F, 0x7F, 0x8D, 0xFF,
+  0x07, 0x7F, 0x7F, 0x3F, 0x1F, 0x0E, 0x04, 0x02, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xA6, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x96, 0x00, 0x08, 0xC0,
+  0x60, 0x30, 0x1C, 0x0E, 0x0E, 0x07, 0x03, 0x03, 0x87, 0x01, 0x02, 0x03, 0x03, 0x06, 0x91, 0x00,
+  0x03, 0x10, 0x0E, 0x0F, 0x0F, 0x80, 0x07, 0x84, 0x03, 0x07, 0x07, 0x07, 0x0E, 0x0E, 0x18, 0x30,
+  0x60, 0xC0, 0xB8, 0x00, 0x05, 0x80, 0xC0, 0xE0, 0xF0, 0xF1, 0xF0, 0x81, 0xF8, 0x8D, 0x78, 0x00,
+  0xF8, 0x80, 0xF0, 0x02, 0xE0, 0xE0, 0x80, 0x83, 0x00, 0x02, 0x80, 0xC0, 0xE0, 0x81, 0xF0, 0x00,
+  0xF8, 0x8C, 0x78, 0x80, 0xF8, 0x81, 0xF0, 0x02, 0xE1, 0xE0, 0xC0, 0xB4, 0x00, 0x00, 0xFE, 0x81,
+  0xFF, 0x02, 0x0F, 0x03, 0x01, 0x93, 0x00, 0x01, 0x01, 0x03, 0x80, 0xFF, 0x81, 0x00, 0x05, 0xFE,
+  0xFF, 0x3F, 0x07, 0x01, 0x01, 0x92, 0x00, 0x02, 0x01, 0x03, 0x0F, 0x82, 0xFF, 0xB3, 0x00, 0x82,
+  0xFF, 0x85, 0x80, 0x80, 0x90, 0x01, 0x30, 0x20, 0x81, 0x00, 0x01, 0x80, 0x80, 0x85, 0x00, 0x80,
+  0xFF, 0x81, 0x00, 0x01, 0xFF, 0xFF, 0x84, 0x00, 0x01, 0x80, 0x80, 0x81, 0x00, 0x02, 0x20, 0x30,
+  0x10, 0x80, 0x90, 0x86, 0x80, 0x82, 0xFF, 0xB0, 0x00, 0x05, 0x08, 0x0C, 0x0E, 0x0F, 0x07, 0x07,
+  0x80, 0x03, 0x87, 0x01, 0x03, 0x00, 0xE0, 0xA0, 0x80, 0x81, 0x00, 0x01, 0x01, 0x02, 0x83, 0x00,
+  0x02, 0x3F, 0x1F, 0x1F, 0x81, 0x00, 0x01, 0x3F, 0x3F, 0x81, 0x00, 0x02, 0x02, 0x00, 0x01, 0x82,
+  0x00, 0x05, 0x80, 0xA0, 0xE0, 0xE0, 0x21, 0x21, 0x83, 0x01, 0x81, 0x03, 0x80, 0x07, 0x03, 0x0F,
+  0x0F, 0x0C, 0x08, 0xC2, 0x00, 0x0A, 0x1F, 0xEF, 0x0F, 0x1F, 0x1F, 0x3E, 0x3E, 0x3C, 0x7C, 0x7C,
+  0x78, 0x80, 0xF8, 0x88, 0xF0, 0x81, 0xF8, 0x02, 0x78, 0x7C, 0x7C, 0x80, 0x3E, 0x04, 0x3F, 0x1F,
+  0x9F, 0xFF, 0x0F, 0xD6, 0x00, 0x09, 0x01, 0x07, 0x18, 0x60, 0x80, 0x00, 0x80, 0x80, 0xC0, 0xC0,
+  0x83, 0xE0, 0x03, 0xC0, 0xC0, 0x80, 0xC0, 0x84, 0xE0, 0x09, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x80,
+  0x60, 0x18, 0x0C, 0x03, 0xDD, 0x00, 0x05, 0x03, 0x07, 0x0F, 0x1F, 0x1F, 0x3F, 0x80, 0x7F, 0x86,
+  0xFF, 0x08, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xA8, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x96, 0x00,
+  0x08, 0x80, 0xC0, 0x70, 0x38, 0x1C, 0x1C, 0x0E, 0x0E, 0x0F, 0x85, 0x07, 0x04, 0x0F, 0x0F, 0x0E,
+  0x1C, 0x10, 0x90, 0x00, 0x01, 0x70, 0x38, 0x80, 0x1E, 0x85, 0x0F, 0x07, 0x0E, 0x0E, 0x1C, 0x1C,
+  0x38, 0x30, 0x60, 0xC0, 0xBA, 0x00, 0x05, 0x80, 0xC0, 0xC0, 0xC4, 0xE3, 0xE1, 0x94, 0xE0, 0x02,
+  0xC0, 0xC0, 0x80, 0x85, 0x00, 0x80, 0xC0, 0x95, 0xE0, 0x03, 0xE1, 0xC2, 0xC0, 0x80, 0xB5, 0x00,
+  0x00, 0xFE, 0x81, 0xFF, 0x04, 0x1F, 0x07, 0x03, 0x01, 0x01, 0x8E, 0x00, 0x07, 0x01, 0x01, 0x03,
+  0x03, 0x0F, 0xFF, 0xFF, 0xFC, 0x81, 0x00, 0x07, 0xFE, 0xFF, 0x1F, 0x07, 0x03, 0x03, 0x01, 0x01,
+  0x8D, 0x00, 0x80, 0x01, 0x02, 0x03, 0x07, 0x1F, 0x81, 0xFF, 0x00, 0xFC, 0xB3, 0x00, 0x82, 0xFF,
+  0x85, 0x00, 0x00, 0x40, 0x8F, 0x00, 0x80, 0xFF, 0x81, 0x00, 0x01, 0xFF, 0xFF, 0x99, 0x00, 0x82,
+  0xFF, 0xB0, 0x00, 0x03, 0x30, 0x18, 0x18, 0x1F, 0x81, 0x0F, 0x00, 0x06, 0x80, 0x07, 0x81, 0x03,
+  0x05, 0x02, 0x02, 0x84, 0x80, 0x80, 0x40, 0x81, 0x00, 0x00, 0x02, 0x85, 0x00, 0x02, 0x7F, 0x7F,
+  0x3F, 0x81, 0x00, 0x02, 0x7F, 0xFF, 0x80, 0x89, 0x00, 0x04, 0x40, 0x40, 0xC0, 0x42, 0x42, 0x82,
+  0x03, 0x04, 0x07, 0x07, 0x06, 0x06, 0x0E, 0x80, 0x0F, 0x03, 0x1F, 0x1F, 0x18, 0x30, 0xC2, 0x00,
+  0x07, 0x07, 0xFF, 0x3E, 0x3E, 0x3C, 0x7C, 0x78, 0xF8, 0x80, 0xF0, 0x82, 0xE0, 0x85, 0xC0, 0x81,
+  0xE0, 0x80, 0xF0, 0x08, 0xF8, 0xF8, 0x7C, 0x7C, 0x3E, 0x3E, 0xBE, 0xFF, 0x1F, 0xD7, 0x00, 0x08,
+  0x03, 0x0C, 0x30, 0x40, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0x83, 0xE1, 0x04, 0xE3, 0xE3, 0xC3, 0xE3,
+  0xE3, 0x84, 0xE1, 0x08, 0xE0, 0xC0, 0xC0, 0x80, 0xC0, 0x60, 0x18, 0x0C, 0x03, 0xDD, 0x00, 0x05,
+  0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x80, 0x3F, 0x86, 0x7F, 0x08, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F,
+  0x0F, 0x07, 0x03, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xA8, 0x00, 0x02, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x98, 0x00, 0x07, 0x80, 0xC0, 0xC0, 0xE0, 0x60, 0x70,
+  0x70, 0x30, 0x82, 0x38, 0x07, 0x3C, 0x38, 0x38, 0x78, 0x78, 0x70, 0xF0, 0xE0, 0x8C, 0x00, 0x05,
+  0xC0, 0xE0, 0xF0, 0x70, 0x78, 0x78, 0x85, 0x38, 0x80, 0x70, 0x03, 0x60, 0xE0, 0xC0, 0xC0, 0xBE,
+  0x00, 0x07, 0x80, 0x80, 0xC8, 0xC4, 0xC2, 0xC3, 0xC1, 0xC1, 0x90, 0xC0, 0x01, 0x80, 0x80, 0x88,
+  0x00, 0x02, 0x80, 0x80, 0xC1, 0x90, 0xC0, 0x06, 0xC1, 0xC1, 0xC2, 0xC6, 0xC8, 0x90, 0x80, 0xB5,
+  0x00, 0x01, 0xC0, 0xFC, 0x81, 0xFF, 0x02, 0x1F, 0x07, 0x07, 0x92, 0x03, 0x05, 0x07, 0x0F, 0x1F,
+  0xFF, 0xFC, 0x80, 0x80, 0x00, 0x05, 0x80, 0xFC, 0xFE, 0x1F, 0x0F, 0x07, 0x93, 0x03, 0x01, 0x07,
+  0x1F, 0x81, 0xFF, 0x01, 0xFE, 0xE0, 0xB2, 0x00, 0x83, 0xFF, 0x98, 0x00, 0x80, 0xFF, 0x80, 0x00,
+  0x80, 0xFF, 0x98, 0x00, 0x83, 0xFF, 0xB2, 0x00, 0x83, 0xFF, 0x88, 0xC0, 0x01, 0x80, 0x80, 0x8B,
+  0x00, 0x01, 0xFF, 0xFF, 0x81, 0x00, 0x80, 0xFF, 0x8C, 0x00, 0x01, 0x80, 0x80, 0x87, 0xC0, 0x83,
+  0xFF, 0xB3, 0x00, 0x8D, 0x03, 0x07, 0x02, 0x03, 0x03, 0x05, 0x04, 0x80, 0x80, 0x40, 0x84, 0x00,
+  0x02, 0x06, 0x07, 0x03, 0x81, 0x00, 0x04, 0x01, 0x03, 0x03, 0x06, 0x04, 0x84, 0x00, 0x00, 0x80,
+  0x80, 0x00, 0x90, 0x03, 0xCA, 0x00, 0x06, 0x03, 0x0F, 0x1B, 0x62, 0x46, 0xE4, 0xE4, 0x81, 0xFC,
+  0x85, 0xF8, 0x81, 0xFC, 0x07, 0xE4, 0x64, 0x26, 0x1A, 0x07, 0x03, 0x00, 0x01, 0xE4, 0x00, 0x00,
+  0x01, 0x80, 0x03, 0x85, 0x07, 0x80, 0x03, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xAE, 0x00,
+};
+
+const uint8_t HAPPY_FRAME_COUNT = 25;
+
+#endif // HAPPY_128X128_H
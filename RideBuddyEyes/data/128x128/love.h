@@ -0,0 +1,28 @@
+// Generated by clipenc from love.h - do not edit.
+// Single-frame still, see RideBuddyClip.h for the format.
+// Fitted to a 128x128 panel.
+#ifndef LOVE_128X128_H
+#define LOVE_128X128_H
+
+#include "../../RideBuddyClip.h"
+
+const uint8_t love_still[] PROGMEM = {
+  0x52, 0x43, 0x02, 0x01, 0x0C, 0x10, 0x10, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x91, 0x00, 0x0F, 0xC0, 0xE0, 0x30, 0x98,
+  0xD8, 0xC8, 0xCC, 0x0C, 0x0C, 0x08, 0x18, 0x30, 0x70, 0x60, 0xF0, 0xF0, 0x80, 0xF8, 0x01, 0xFC,
+  0xFC, 0x80, 0xF8, 0x02, 0xF0, 0xE0, 0xC0, 0x85, 0x00, 0x0E, 0xC0, 0xE0, 0x30, 0x98, 0xD8, 0xC8,
+  0xCC, 0x0C, 0x08, 0x18, 0x18, 0x30, 0x60, 0x60, 0xF0, 0x80, 0xF8, 0x80, 0xFC, 0x80, 0xF8, 0x02,
+  0xF0, 0xE0, 0x80, 0xBF, 0x00, 0x11, 0x3F, 0xF0, 0xC0, 0x83, 0x03, 0x01, 0x01, 0x04, 0x0E, 0x6E,
+  0x66, 0xF0, 0xF8, 0xFF, 0xF9, 0xFF, 0x6F, 0x7F, 0x80, 0x9F, 0x82, 0xFF, 0x00, 0x3F, 0x84, 0x00,
+  0x14, 0x0F, 0x7F, 0xE0, 0xC0, 0x83, 0x03, 0x01, 0x00, 0x0C, 0x4E, 0x6F, 0x66, 0xF0, 0xFC, 0xFE,
+  0xF7, 0x6F, 0x7F, 0x5F, 0x9F, 0x9F, 0x82, 0xFF, 0x01, 0x7F, 0x1F, 0xC1, 0x00, 0x16, 0x01, 0x03,
+  0x07, 0x0F, 0x1F, 0x3E, 0x3F, 0x7F, 0xFF, 0xFE, 0xF9, 0xEF, 0xF9, 0xFC, 0xF9, 0x67, 0x32, 0x39,
+  0x1F, 0x0F, 0x07, 0x03, 0x01, 0x89, 0x00, 0x16, 0x01, 0x03, 0x07, 0x0F, 0x1E, 0x3E, 0x7F, 0x7F,
+  0xFF, 0xFC, 0xE3, 0xE7, 0xFD, 0xF9, 0xF2, 0x66, 0x39, 0x19, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0xCC,
+  0x00, 0x0C, 0x01, 0x01, 0x03, 0x01, 0x01, 0x00, 0x30, 0x10, 0x38, 0x60, 0x40, 0x80, 0x80, 0x8B,
+  0x00, 0x0B, 0x80, 0xC0, 0x40, 0x28, 0x18, 0x10, 0x10, 0x00, 0x01, 0x01, 0x03, 0x01, 0xE2, 0x00,
+  0x80, 0x01, 0x86, 0x02, 0x02, 0x03, 0x01, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xAD, 0x00,
+};
+
+#endif // LOVE_128X128_H
@@ -0,0 +1,225 @@
+// Generated by clipenc from shy.h - do not edit.
+// Keyframe + XOR-delta clip, see RideBuddyClip.h for the format.
+// Fitted to a 128x128 panel.
+#ifndef SHY_128X128_H
+#define SHY_128X128_H
+
+#include "../../RideBuddyClip.h"
+
+const uint8_t shy_clip[] PROGMEM = {
+  0x52, 0x43, 0x02, 0x19, 0x0C, 0x10, 0x10, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00,
+  0xA4, 0x01, 0x00, 0x00, 0xAF, 0x01, 0x00, 0x00, 0x91, 0x02, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00,
+  0xD0, 0x03, 0x00, 0x00, 0x39, 0x04, 0x00, 0x00, 0x19, 0x05, 0x00, 0x00, 0xDC, 0x05, 0x00, 0x00,
+  0xAC, 0x06, 0x00, 0x00, 0x1D, 0x07, 0x00, 0x00, 0xE6, 0x07, 0x00, 0x00, 0xCB, 0x08, 0x00, 0x00,
+  0x0B, 0x09, 0x00, 0x00, 0x16, 0x09, 0x00, 0x00, 0x45, 0x09, 0x00, 0x00, 0x0B, 0x0A, 0x00, 0x00,
+  0x83, 0x0A, 0x00, 0x00, 0x5D, 0x0B, 0x00, 0x00, 0xBB, 0x0B, 0x00, 0x00, 0xD8, 0x0B, 0x00, 0x00,
+  0xFE, 0x0B, 0x00, 0x00, 0x36, 0x0C, 0x00, 0x00, 0x41, 0x0C, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x82, 0x00, 0x00, 0x70, 0x82, 0xF8, 0x07,
+  0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0xBF, 0x00, 0x07, 0x80, 0x80, 0xC0, 0xC0, 0xE0,
+  0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x00, 0x70, 0xA2, 0x00, 0x03, 0x01, 0x01, 0x03, 0x03, 0x80, 0x07,
+  0x01, 0x0F, 0x0F, 0x80, 0x1F, 0x0B, 0x3F, 0x3F, 0x7E, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0,
+  0xE0, 0xC0, 0xA5, 0x00, 0x09, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0x7E, 0x80,
+  0x3F, 0x80, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA3, 0x00, 0x07, 0x80,
+  0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0x80, 0xF8, 0x0E, 0xFC, 0xFC, 0xFE, 0x7E, 0x7F, 0x3F,
+  0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x01, 0xA5, 0x00, 0x03, 0x01, 0x03, 0x07, 0x07,
+  0x80, 0x0F, 0x07, 0x1F, 0x3F, 0x3F, 0x7F, 0x7E, 0x7E, 0xFC, 0xFC, 0x80, 0xF8, 0x01, 0xF0, 0xF0,
+  0x80, 0xE0, 0x02, 0xC0, 0x80, 0x80, 0xA0, 0x00, 0x00, 0x07, 0x82, 0x0F, 0x05, 0x07, 0x07, 0x03,
+  0x03, 0x01, 0x01, 0xC3, 0x00, 0x0B, 0x01, 0x01, 0x03, 0x83, 0x07, 0x07, 0x0F, 0x0F, 0x8F, 0x0F,
+  0x0F, 0x07, 0x9A, 0x00, 0x00, 0x40, 0x81, 0x00, 0x00, 0x80, 0x8A, 0x00, 0x00, 0x80, 0xBB, 0x00,
+  0x15, 0x70, 0x38, 0x0E, 0x07, 0xC0, 0x70, 0x1C, 0x07, 0x03, 0xE0, 0x78, 0x1C, 0x07, 0x03, 0xE0,
+  0x78, 0x1C, 0x07, 0x81, 0x70, 0x38, 0x0C, 0x9D, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00, 0x01, 0x81,
+  0x00, 0x00, 0x01, 0x8A, 0x00, 0x03, 0x08, 0x0C, 0x1C, 0x08, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xFA, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xC5, 0x00, 0x00, 0x08, 0x82, 0x00, 0x00, 0x40, 0xFF, 0x00, 0xA8, 0x00, 0x00,
+  0x40, 0x81, 0x00, 0x00, 0x80, 0x8A, 0x00, 0x00, 0x80, 0xBB, 0x00, 0x00, 0x10, 0x8F, 0x00, 0x00,
+  0x10, 0x9F, 0x00, 0x00, 0x01, 0xE1, 0x00, 0x03, 0x08, 0x0C, 0x1C, 0x08, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFA, 0x00, 0x01, 0x01, 0x73, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x81, 0x00, 0x00, 0x78,
+  0x82, 0xF8, 0x07, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0xBF, 0x00, 0x07, 0x80, 0x80,
+  0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x00, 0x70, 0xA2, 0x00, 0x07, 0x01, 0x01, 0x03,
+  0x03, 0x07, 0x07, 0x0F, 0x0F, 0x80, 0x1F, 0x05, 0x3F, 0x3F, 0x7F, 0x7E, 0xFE, 0xFC, 0x80, 0xF8,
+  0x03, 0xF0, 0xF0, 0xE0, 0x80, 0xA5, 0x00, 0x0B, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC,
+  0xFE, 0x7E, 0x3F, 0x3F, 0x80, 0x1F, 0x03, 0x0F, 0x0F, 0x07, 0x07, 0x80, 0x03, 0x01, 0x01, 0x01,
+  0xA3, 0x00, 0x07, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0x80, 0xF8, 0x0E, 0xFC, 0xFC,
+  0xFE, 0x7E, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x01, 0xA5, 0x00, 0x00,
+  0x01, 0x80, 0x07, 0x0A, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7E, 0x7E, 0xFE, 0xFC, 0xFC, 0x80,
+  0xF8, 0x07, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0xA0, 0x00, 0x0B, 0x0F, 0x0F, 0x1F,
+  0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0xC3, 0x00, 0x05, 0x01, 0x01, 0x03, 0x03,
+  0x87, 0x07, 0x80, 0x0F, 0x05, 0x8F, 0x0F, 0x07, 0x00, 0x00, 0x80, 0xEA, 0x00, 0x15, 0x30, 0x18,
+  0x0E, 0x03, 0x00, 0x30, 0x1E, 0x07, 0x01, 0x20, 0x38, 0x1E, 0x07, 0x01, 0x70, 0x38, 0x0E, 0x07,
+  0x01, 0x30, 0x18, 0x0C, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0x00,
+  0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x80, 0x00,
+  0x00, 0x70, 0x82, 0xF8, 0x07, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0xBF, 0x00, 0x07,
+  0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x00, 0x70, 0xA2, 0x00, 0x07, 0x01,
+  0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x80, 0x1F, 0x0C, 0x3F, 0x3F, 0x7F, 0x7E, 0xFE, 0xFC,
+  0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0xA5, 0x00, 0x0B, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8,
+  0xFC, 0xFC, 0xFE, 0x7E, 0x3F, 0x3F, 0x80, 0x1F, 0x80, 0x0F, 0x05, 0x07, 0x07, 0x03, 0x03, 0x01,
+  0x01, 0xA3, 0x00, 0x05, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0x80, 0xF0, 0x80, 0xF8, 0x09, 0xFC,
+  0xFE, 0x7E, 0x7E, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x80, 0x07, 0x00, 0x01, 0xA5, 0x00, 0x0E,
+  0x01, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7E, 0x7E, 0xFE, 0xFC, 0xFC, 0x80,
+  0xF8, 0x07, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0xA0, 0x00, 0x0B, 0x07, 0x0F, 0x1F,
+  0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0xC3, 0x00, 0x0B, 0x01, 0x01, 0x03, 0x03,
+  0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x0F, 0x07, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0x84, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x1E, 0x1F, 0x3F, 0x3F, 0x80, 0x3E, 0x80, 0x7E,
+  0x80, 0x7C, 0x01, 0xFC, 0xFC, 0x82, 0xF8, 0x83, 0xF0, 0x01, 0xE0, 0xE0, 0xA3, 0x00, 0x01, 0xC0,
+  0xE0, 0x84, 0xF0, 0x85, 0xF8, 0x00, 0xFC, 0x84, 0x7C, 0x03, 0x7E, 0x7E, 0x3C, 0x18, 0x9E, 0x00,
+  0x01, 0x60, 0xF0, 0x80, 0xF8, 0x80, 0xFC, 0x05, 0x7C, 0x7E, 0x7E, 0x3E, 0x3E, 0x3F, 0x81, 0x1F,
+  0x80, 0x0F, 0x82, 0x07, 0x01, 0x03, 0x03, 0xA3, 0x00, 0x02, 0x01, 0x03, 0x03, 0x81, 0x07, 0x81,
+  0x0F, 0x80, 0x1F, 0x09, 0x3F, 0x3F, 0x3E, 0x3E, 0x7E, 0x7E, 0x7C, 0x7C, 0xFC, 0xFC, 0x81, 0xF8,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x81, 0x00,
+  0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x01,
+  0x00, 0x20, 0x87, 0xF8, 0x8B, 0xF0, 0x80, 0xE0, 0x00, 0xC0, 0xA3, 0x00, 0x00, 0xC0, 0x80, 0xE0,
+  0x89, 0xF0, 0x88, 0xF8, 0x01, 0x78, 0x20, 0x9E, 0x00, 0x01, 0x60, 0xF0, 0x81, 0xF8, 0x05, 0xFC,
+  0xFD, 0x7D, 0x7D, 0x7F, 0x7F, 0x80, 0x3F, 0x80, 0x1F, 0x80, 0x0F, 0x82, 0x07, 0x01, 0x03, 0x01,
+  0xA3, 0x00, 0x01, 0x01, 0x03, 0x82, 0x07, 0x80, 0x0F, 0x81, 0x1F, 0x81, 0x3F, 0x02, 0x7E, 0x7E,
+  0x7C, 0x80, 0xFC, 0x80, 0xF8, 0x00, 0x70, 0xA2, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xDD, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x82, 0x00, 0x00, 0x70, 0x82, 0xF8, 0x07, 0xF0, 0xF0, 0xE0,
+  0xE0, 0xC0, 0xC0, 0x80, 0x80, 0xBF, 0x00, 0x07, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0,
+  0x82, 0xF8, 0x00, 0x70, 0xA2, 0x00, 0x03, 0x01, 0x01, 0x03, 0x03, 0x80, 0x07, 0x03, 0x0F, 0x0F,
+  0x1F, 0x1F, 0x80, 0x3F, 0x09, 0x7E, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0xA5,
+  0x00, 0x0B, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0x7E, 0x3F, 0x3F, 0x80, 0x1F,
+  0x01, 0x0F, 0x0F, 0x80, 0x07, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA3, 0x00, 0x07, 0x80, 0x80, 0xC0,
+  0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0x80, 0xF8, 0x07, 0xFC, 0xFC, 0x7E, 0x7E, 0x7F, 0x3F, 0x3F, 0x1F,
+  0x80, 0x0F, 0x03, 0x07, 0x07, 0x03, 0x01, 0xA5, 0x00, 0x0E, 0x01, 0x03, 0x07, 0x07, 0x0F, 0x0F,
+  0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7E, 0x7E, 0xFC, 0xFC, 0x80, 0xF8, 0x01, 0xF0, 0xF0, 0x80, 0xE0,
+  0x02, 0xC0, 0x80, 0x80, 0xA0, 0x00, 0x00, 0x07, 0x82, 0x0F, 0x05, 0x07, 0x07, 0x03, 0x03, 0x01,
+  0x01, 0xC3, 0x00, 0x0D, 0x01, 0x01, 0x03, 0x83, 0x07, 0x07, 0x0F, 0x0F, 0x8F, 0x0F, 0x0F, 0x07,
+  0x00, 0x80, 0xEA, 0x00, 0x15, 0x20, 0x38, 0x0E, 0x07, 0xC0, 0x70, 0x1C, 0x07, 0x03, 0xE0, 0x78,
+  0x1C, 0x07, 0x03, 0xE0, 0x38, 0x1C, 0x07, 0x81, 0x60, 0x38, 0x0C, 0xEF, 0x00, 0x00, 0x01, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x8E, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x83, 0x00, 0x01, 0x38, 0x7C, 0x80, 0xFC, 0x80, 0xF8, 0x07,
+  0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0xBB, 0x00, 0x05, 0x80, 0x80, 0xC0, 0xC0, 0xE0,
+  0xE0, 0x80, 0xF0, 0x01, 0xF8, 0xF8, 0x80, 0xFC, 0x01, 0x7C, 0x78, 0xA4, 0x00, 0x07, 0x01, 0x01,
+  0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x80, 0x1F, 0x01, 0x3F, 0xBF, 0x80, 0xFE, 0x05, 0xFC, 0xFC,
+  0xF8, 0xF8, 0xF0, 0xE0, 0xA6, 0x00, 0x09, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xBF,
+  0xBF, 0x80, 0x1F, 0x05, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x80, 0x01, 0xA4, 0x00, 0x01, 0x80,
+  0xC0, 0x80, 0xE0, 0x03, 0xF0, 0xF0, 0xF8, 0xF8, 0x80, 0xFC, 0x01, 0x7E, 0x7E, 0x80, 0x3F, 0x02,
+  0x1F, 0x0F, 0x0F, 0x80, 0x07, 0x01, 0x03, 0x03, 0xA7, 0x00, 0x02, 0x01, 0x03, 0x03, 0x80, 0x07,
+  0x00, 0x0F, 0x80, 0x1F, 0x05, 0x3F, 0x3F, 0x7E, 0x7E, 0xFC, 0xFC, 0x80, 0xF8, 0x80, 0xF0, 0x03,
+  0xE0, 0xE0, 0xC0, 0x80, 0x9F, 0x00, 0x03, 0x03, 0x07, 0x0F, 0x0F, 0x80, 0x07, 0x03, 0x03, 0x03,
+  0x01, 0x01, 0xC6, 0x00, 0x80, 0x01, 0x06, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x07, 0x07, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x81, 0x00, 0x02, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x88, 0x00, 0x00, 0xC0, 0x82, 0xE0, 0x02, 0xC0, 0x80,
+  0x80, 0xC6, 0x00, 0x05, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0x80, 0xF0, 0x01, 0xE0, 0x40, 0xA0,
+  0x00, 0x16, 0x01, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x7F, 0x7F, 0xFE, 0xFE, 0xFC,
+  0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0x80, 0xAB, 0x00, 0x05, 0x80, 0x80, 0xC0, 0xE0,
+  0xE0, 0xF0, 0x80, 0xF8, 0x0D, 0xFC, 0xFE, 0x7E, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x07,
+  0x03, 0x03, 0x01, 0xAE, 0x00, 0x06, 0x01, 0x01, 0x83, 0x83, 0xC7, 0xCF, 0xEF, 0x82, 0xFF, 0x00,
+  0xFC, 0xA6, 0x00, 0x00, 0x7E, 0x82, 0xFF, 0x05, 0xEF, 0xE7, 0xC3, 0xC3, 0x81, 0x80, 0xAE, 0x00,
+  0x18, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0x7F, 0x3F,
+  0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0xA9, 0x00, 0x17, 0x01, 0x01, 0x03,
+  0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0,
+  0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0x9F, 0x00, 0x00, 0x07, 0x82, 0x0F, 0x04, 0x07, 0x07, 0x03, 0x01,
+  0x01, 0xC7, 0x00, 0x08, 0x01, 0x01, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x07, 0x07, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x82, 0x00, 0x02, 0x3C, 0x7E,
+  0x7E, 0x81, 0x7C, 0x81, 0xFC, 0x86, 0xF8, 0x83, 0xF0, 0x01, 0xE0, 0xE0, 0xA4, 0x00, 0x01, 0xE0,
+  0xE0, 0x83, 0xF0, 0x86, 0xF8, 0x01, 0xFC, 0xFC, 0x83, 0x7C, 0x02, 0x7E, 0x7C, 0x3C, 0x9F, 0x00,
+  0x80, 0xF8, 0x80, 0xFC, 0x05, 0x7C, 0x7E, 0x7E, 0x3E, 0x3E, 0x3F, 0x81, 0x1F, 0x80, 0x0F, 0x82,
+  0x07, 0x02, 0x03, 0x03, 0x01, 0xA4, 0x00, 0x02, 0x01, 0x03, 0x03, 0x82, 0x07, 0x81, 0x0F, 0x80,
+  0x1F, 0x06, 0x3F, 0x3F, 0x3E, 0x3E, 0x7E, 0x7E, 0x7C, 0x80, 0xFC, 0x02, 0xF8, 0xF8, 0x70, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x84, 0x00, 0x00, 0x80, 0x80, 0xC0,
+  0x80, 0x80, 0xCD, 0x00, 0x80, 0x80, 0x02, 0xC0, 0x80, 0x80, 0x9F, 0x00, 0x01, 0x03, 0x07, 0x80,
+  0x0F, 0x82, 0x1F, 0x80, 0x3F, 0x05, 0x3E, 0x7E, 0x7E, 0x7C, 0x7C, 0xFC, 0x81, 0xF8, 0x80, 0xF0,
+  0x01, 0xE0, 0xC0, 0xA4, 0x00, 0x01, 0xE0, 0xE0, 0x80, 0xF0, 0x80, 0xF8, 0x08, 0xFC, 0xFC, 0x7C,
+  0x7E, 0x7E, 0x3E, 0x3E, 0x3F, 0x3F, 0x82, 0x1F, 0x81, 0x0F, 0x00, 0x07, 0xA0, 0x00, 0x00, 0xC0,
+  0x80, 0xE0, 0x80, 0xF0, 0x80, 0xF8, 0x01, 0xFC, 0xFC, 0x80, 0x7E, 0x03, 0x3F, 0x3F, 0x1F, 0x1F,
+  0x80, 0x0F, 0x80, 0x07, 0x00, 0x03, 0xA5, 0x00, 0x01, 0x03, 0x03, 0x80, 0x07, 0x01, 0x0F, 0x0F,
+  0x80, 0x1F, 0x04, 0x3F, 0x3F, 0x3E, 0x7E, 0x7E, 0x80, 0xFC, 0x81, 0xF8, 0x04, 0xF0, 0xF0, 0xE0,
+  0xE0, 0xC0, 0x9F, 0x00, 0x01, 0x01, 0x03, 0x80, 0x07, 0x80, 0x03, 0x01, 0x01, 0x01, 0xC7, 0x00,
+  0x01, 0x80, 0x00, 0x80, 0x01, 0x00, 0x83, 0x80, 0x03, 0x01, 0x01, 0x80, 0x9C, 0x00, 0x00, 0x01,
+  0xCA, 0x00, 0x15, 0x20, 0x18, 0x0C, 0x07, 0xC0, 0x70, 0x1C, 0x0F, 0x03, 0xC0, 0x70, 0x1C, 0x0F,
+  0x03, 0xE0, 0x38, 0x1C, 0x07, 0x01, 0x60, 0x38, 0x1C, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0x82, 0x00, 0x00, 0x70, 0x82, 0xF8, 0x01, 0xF0, 0xF0, 0x80, 0xE0, 0x02, 0xC0,
+  0x80, 0x80, 0xBF, 0x00, 0x07, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x00,
+  0x70, 0xA2, 0x00, 0x01, 0x01, 0x01, 0x80, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x80, 0x1F, 0x0B,
+  0x3F, 0x3F, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xA5, 0x00, 0x09, 0xC0,
+  0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0x7E, 0x80, 0x3F, 0x80, 0x1F, 0x00, 0x0F, 0x80,
+  0x07, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA3, 0x00, 0x07, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0,
+  0xF0, 0x80, 0xF8, 0x0E, 0xFC, 0xFC, 0xFE, 0x7E, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07,
+  0x07, 0x03, 0x01, 0xA5, 0x00, 0x03, 0x01, 0x03, 0x07, 0x07, 0x80, 0x0F, 0x00, 0x1F, 0x80, 0x3F,
+  0x03, 0x7E, 0x7E, 0xFC, 0xFC, 0x80, 0xF8, 0x01, 0xF0, 0xF0, 0x80, 0xE0, 0x02, 0xC0, 0xC0, 0x80,
+  0xA0, 0x00, 0x00, 0x07, 0x82, 0x0F, 0x05, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0xC3, 0x00, 0x03,
+  0x01, 0x01, 0x03, 0x83, 0x80, 0x07, 0x04, 0x0F, 0x8F, 0x0F, 0x0F, 0x07, 0x9A, 0x00, 0x00, 0x40,
+  0xCE, 0x00, 0x15, 0x60, 0x38, 0x0E, 0x07, 0xC0, 0x70, 0x1C, 0x07, 0x03, 0xE0, 0x78, 0x1C, 0x07,
+  0x03, 0xE0, 0x38, 0x1C, 0x07, 0x81, 0x60, 0x38, 0x0C, 0xEF, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00,
+  0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x89, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x8C, 0x00, 0x00, 0x20, 0xF9, 0x00, 0x00, 0x04,
+  0x87, 0x00, 0x00, 0x80, 0x84, 0x00, 0x00, 0x20, 0xF6, 0x00, 0x00, 0x10, 0xB5, 0x00, 0x00, 0x40,
+  0x8A, 0x00, 0x00, 0x40, 0xF9, 0x00, 0x00, 0x08, 0xFF, 0x00, 0xFF, 0x00, 0x88, 0x00, 0x03, 0x08,
+  0x0C, 0x1C, 0x08, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFA, 0x00, 0x01, 0x01, 0xA1, 0x00, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x05, 0x73, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x20, 0x7C, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x8D, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x08, 0x0C,
+  0x1C, 0x08, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0x80, 0x00, 0x00, 0x70, 0x82, 0xF8, 0x07, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80,
+  0x80, 0xBF, 0x00, 0x07, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x00, 0x70,
+  0xA2, 0x00, 0x05, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x80, 0x0F, 0x0E, 0x1F, 0x1F, 0x3F, 0x3F,
+  0x7F, 0x7E, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0xA5, 0x00, 0x0C, 0x80, 0xE0,
+  0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0x7E, 0x7F, 0x3F, 0x3F, 0x80, 0x1F, 0x07, 0x0F, 0x0F,
+  0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0xA4, 0x00, 0x07, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0,
+  0xF0, 0x80, 0xF8, 0x03, 0xFC, 0xFC, 0x7E, 0x7E, 0x80, 0x3F, 0x02, 0x1F, 0x0F, 0x0F, 0x80, 0x07,
+  0x00, 0x03, 0xA6, 0x00, 0x0D, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7E, 0x7E,
+  0xFE, 0xFC, 0xFC, 0x80, 0xF8, 0x07, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0xA0, 0x00,
+  0x01, 0x07, 0x0F, 0x80, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0x03, 0x03, 0x03, 0x01, 0x01, 0xC2, 0x00,
+  0x0B, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x0F, 0x07, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x84, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x80, 0x00, 0x02, 0x1E, 0x3E, 0x3F,
+  0x80, 0x3E, 0x80, 0x7E, 0x80, 0x7C, 0x01, 0xFC, 0xFC, 0x83, 0xF8, 0x83, 0xF0, 0x01, 0xE0, 0xC0,
+  0xA4, 0x00, 0x01, 0xE0, 0xE0, 0x83, 0xF0, 0x85, 0xF8, 0x80, 0xFC, 0x82, 0x7C, 0x80, 0x7E, 0x00,
+  0x3C, 0x9E, 0x00, 0x00, 0x70, 0x81, 0xF8, 0x04, 0xFC, 0xFC, 0x7C, 0x7C, 0x7E, 0x80, 0x3E, 0x00,
+  0x3F, 0x80, 0x1F, 0x80, 0x0F, 0x82, 0x07, 0x02, 0x03, 0x03, 0x01, 0xA4, 0x00, 0x01, 0x03, 0x03,
+  0x82, 0x07, 0x81, 0x0F, 0x80, 0x1F, 0x00, 0x3F, 0x80, 0x3E, 0x00, 0x7E, 0x80, 0x7C, 0x01, 0xFC,
+  0xFC, 0x80, 0xF8, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0x80, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0x82, 0x00, 0x00, 0x70, 0x82, 0xF8, 0x07, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0xBF,
+  0x00, 0x05, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0x80, 0xF0, 0x81, 0xF8, 0x00, 0x70, 0xA2, 0x00,
+  0x07, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x80, 0x1F, 0x80, 0x3F, 0x09, 0x7E, 0xFE,
+  0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0xA5, 0x00, 0x09, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8,
+  0xF8, 0xFC, 0xFC, 0xFE, 0x7E, 0x80, 0x3F, 0x80, 0x1F, 0x07, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03,
+  0x01, 0x01, 0xA3, 0x00, 0x07, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0x80, 0xF8, 0x07,
+  0xFC, 0xFC, 0x7E, 0x7E, 0x7F, 0x3F, 0x3F, 0x1F, 0x80, 0x0F, 0x03, 0x07, 0x07, 0x03, 0x01, 0xA5,
+  0x00, 0x0E, 0x01, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7E, 0xFE, 0xFC,
+  0xFC, 0x80, 0xF8, 0x07, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0xA0, 0x00, 0x00, 0x07,
+  0x81, 0x0F, 0x80, 0x07, 0x03, 0x03, 0x03, 0x01, 0x01, 0xC3, 0x00, 0x0B, 0x01, 0x01, 0x03, 0x83,
+  0x07, 0x07, 0x0F, 0x0F, 0x8F, 0x0F, 0x0F, 0x07, 0xED, 0x00, 0x14, 0x18, 0x0E, 0x07, 0x40, 0x70,
+  0x1C, 0x07, 0x01, 0xE0, 0x78, 0x1C, 0x07, 0x03, 0x60, 0x38, 0x0C, 0x07, 0x01, 0x60, 0x38, 0x0C,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x03, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xDA, 0x00, 0x00, 0x08, 0xAD, 0x00,
+  0x05, 0x08, 0x00, 0x10, 0x00, 0x00, 0x20, 0xC2, 0x00, 0x00, 0x08, 0xB6, 0x00, 0x00, 0x80, 0xB5,
+  0x00, 0x02, 0x08, 0x00, 0x10, 0x80, 0x00, 0x02, 0x40, 0x00, 0x80, 0x86, 0x00, 0x00, 0x20, 0xA8,
+  0x00, 0x00, 0x08, 0xFF, 0x00, 0xC2, 0x00, 0x04, 0x60, 0x20, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00,
+  0x02, 0x82, 0x00, 0x04, 0x80, 0x40, 0x10, 0x00, 0x80, 0xF2, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00,
+  0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x89, 0x00, 0x01, 0x03, 0x83, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x04, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x08, 0x0C, 0x1C, 0x08, 0x00, 0x00, 0x00, 0x01, 0x06,
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xA1, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x08,
+  0x0C, 0x1C, 0x08, 0x00, 0x00, 0x00, 0x01, 0x01, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x82, 0x00,
+  0x00, 0x70, 0x82, 0xF8, 0x07, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0xBF, 0x00, 0x07,
+  0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x00, 0x70, 0xA2, 0x00, 0x03, 0x01,
+  0x01, 0x03, 0x03, 0x80, 0x07, 0x01, 0x0F, 0x0F, 0x80, 0x1F, 0x0B, 0x3F, 0x3F, 0x7E, 0xFE, 0xFC,
+  0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0xA5, 0x00, 0x09, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8,
+  0xFC, 0xFC, 0xFE, 0x7E, 0x80, 0x3F, 0x80, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0x03, 0x03, 0x03, 0x01,
+  0x01, 0xA3, 0x00, 0x07, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0x80, 0xF8, 0x0E, 0xFC,
+  0xFC, 0x7E, 0x7E, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x01, 0xA5, 0x00,
+  0x03, 0x01, 0x03, 0x07, 0x07, 0x80, 0x0F, 0x00, 0x1F, 0x80, 0x3F, 0x03, 0x7E, 0x7E, 0xFC, 0xFC,
+  0x80, 0xF8, 0x01, 0xF0, 0xF0, 0x80, 0xE0, 0x02, 0xC0, 0x80, 0x80, 0xA0, 0x00, 0x00, 0x07, 0x82,
+  0x0F, 0x05, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0xC3, 0x00, 0x0B, 0x01, 0x01, 0x03, 0x83, 0x07,
+  0x07, 0x0F, 0x0F, 0x8F, 0x0F, 0x0F, 0x07, 0x9A, 0x00, 0x00, 0x40, 0xCE, 0x00, 0x15, 0x60, 0x38,
+  0x0E, 0x07, 0xC0, 0x70, 0x1C, 0x07, 0x03, 0xE0, 0x78, 0x1C, 0x07, 0x03, 0xE0, 0x78, 0x1C, 0x07,
+  0x81, 0x60, 0x38, 0x0C, 0xEF, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0x89, 0x00,
+};
+
+const uint8_t SHY_FRAME_COUNT = 25;
+
+#endif // SHY_128X128_H
@@ -0,0 +1,19 @@
+// Generated by clipenc from angry.h - do not edit.
+// Single-frame still, see RideBuddyClip.h for the format.
+// Fitted to a 128x32 panel.
+#ifndef ANGRY_128X32_H
+#define ANGRY_128X32_H
+
+#include "../../RideBuddyClip.h"
+
+const uint8_t angry_still[] PROGMEM = {
+  0x52, 0x43, 0x02, 0x01, 0x0C, 0x10, 0x04, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x04,
+  0x10, 0x90, 0x98, 0x98, 0x88, 0x81, 0x8C, 0x08, 0x98, 0xB8, 0xB0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80,
+  0x80, 0x8B, 0x00, 0x08, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0xB0, 0xB8, 0x98, 0x81, 0x8C, 0x04,
+  0x88, 0x98, 0x98, 0x90, 0x10, 0xCB, 0x00, 0x00, 0xFE, 0x8F, 0xFF, 0x03, 0x0F, 0x0E, 0x0E, 0x07,
+  0x81, 0x00, 0x03, 0x07, 0x0E, 0x0E, 0x0F, 0x8F, 0xFF, 0x00, 0xFE, 0xCB, 0x00, 0x00, 0x7F, 0x8F,
+  0xFF, 0x89, 0x00, 0x8F, 0xFF, 0x00, 0x7F, 0xCC, 0x00, 0x8E, 0x01, 0x8B, 0x00, 0x8E, 0x01, 0x82,
+  0x00, 0x00, 0x20, 0x9F, 0x00,
+};
+
+#endif // ANGRY_128X32_H
@@ -0,0 +1,147 @@
+// Generated by clipenc from battery.h - do not edit.
+// Keyframe + XOR-delta clip, see RideBuddyClip.h for the format.
+// Fitted to a 128x32 panel.
+#ifndef BATTERY_128X32_H
+#define BATTERY_128X32_H
+
+#include "../../RideBuddyClip.h"
+
+const uint8_t battery_clip[] PROGMEM = {
+  0x52, 0x43, 0x02, 0x19, 0x0C, 0x10, 0x04, 0x00, 0x6C, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0xBF, 0x01, 0x00, 0x00, 0x29, 0x02, 0x00, 0x00,
+  0x93, 0x02, 0x00, 0x00, 0xFD, 0x02, 0x00, 0x00, 0x65, 0x03, 0x00, 0x00, 0xCD, 0x03, 0x00, 0x00,
+  0x1D, 0x04, 0x00, 0x00, 0x62, 0x04, 0x00, 0x00, 0xA4, 0x04, 0x00, 0x00, 0x0A, 0x05, 0x00, 0x00,
+  0x47, 0x05, 0x00, 0x00, 0x79, 0x05, 0x00, 0x00, 0xB7, 0x05, 0x00, 0x00, 0xF5, 0x05, 0x00, 0x00,
+  0x35, 0x06, 0x00, 0x00, 0x69, 0x06, 0x00, 0x00, 0xAE, 0x06, 0x00, 0x00, 0xF9, 0x06, 0x00, 0x00,
+  0x3A, 0x07, 0x00, 0x00, 0x8B, 0x07, 0x00, 0x00, 0xDD, 0x07, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xA9,
+  0x00, 0x03, 0x80, 0xE0, 0xE0, 0xF0, 0x83, 0xF8, 0x02, 0xF0, 0xF0, 0xE0, 0x82, 0x00, 0x02, 0xC0,
+  0xE0, 0xF0, 0x83, 0xF8, 0x0E, 0xF0, 0xF0, 0xE0, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x00,
+  0xC0, 0x08, 0x10, 0x10, 0xD3, 0x00, 0x0D, 0x07, 0x1F, 0x3F, 0x3F, 0x7B, 0x7B, 0x79, 0xF1, 0xF3,
+  0xF7, 0x7B, 0x7F, 0x1F, 0x07, 0x80, 0x00, 0x0E, 0x01, 0x0F, 0x1F, 0x7B, 0xF7, 0xF3, 0xF1, 0x71,
+  0x7B, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x06, 0x80, 0x00, 0x0A, 0x0F, 0x0F, 0x7F, 0x0F, 0x0F, 0x00,
+  0x02, 0x04, 0x04, 0x02, 0x04, 0xFF, 0x00, 0x9F, 0x00, 0x03, 0xFF, 0x00, 0xCA, 0x00, 0x01, 0x58,
+  0x08, 0x80, 0x00, 0x03, 0x40, 0x08, 0x16, 0x14, 0xD7, 0x00, 0x06, 0x04, 0x0C, 0x02, 0x12, 0x04,
+  0x00, 0x04, 0x88, 0x00, 0x02, 0x04, 0x02, 0x02, 0x87, 0x00, 0x04, 0x10, 0x10, 0x81, 0x10, 0x11,
+  0x80, 0x00, 0x00, 0x04, 0xFF, 0x00, 0xA1, 0x00, 0x02, 0xD3, 0x00, 0x00, 0x80, 0xD4, 0x00, 0x03,
+  0xC0, 0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x03, 0xF0, 0xF0, 0xE0, 0xC0, 0x81, 0x00, 0x03, 0x80, 0xE0,
+  0xF0, 0xF0, 0x82, 0xF8, 0x03, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x06, 0x02, 0x18, 0x08, 0xC0,
+  0x00, 0xC4, 0x06, 0xD4, 0x00, 0x03, 0x02, 0x0F, 0x1F, 0x3F, 0x80, 0x7F, 0x06, 0x67, 0xE7, 0xE7,
+  0xF7, 0x7B, 0x1F, 0x0F, 0x81, 0x00, 0x0D, 0x0F, 0x1F, 0x3F, 0xF7, 0xE7, 0xE3, 0x63, 0x7F, 0x7F,
+  0xFF, 0x3F, 0x3F, 0x0F, 0x06, 0x81, 0x00, 0x09, 0x0F, 0x0F, 0x7F, 0x1F, 0x0F, 0x00, 0x02, 0x04,
+  0x04, 0x02, 0xFF, 0x00, 0xA0, 0x00, 0x02, 0xCB, 0x00, 0x08, 0x80, 0x00, 0x80, 0x80, 0x00, 0x00,
+  0x40, 0x10, 0x30, 0xD1, 0x00, 0x03, 0xC0, 0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x03, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x81, 0x00, 0x03, 0x80, 0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x03, 0xF0, 0xF0, 0xE0, 0xC0, 0x83,
+  0x00, 0x08, 0x21, 0x90, 0x00, 0xC0, 0x20, 0xC4, 0x08, 0x04, 0x20, 0xCF, 0x00, 0x03, 0x02, 0x0F,
+  0x1F, 0xBF, 0x80, 0x7F, 0x07, 0x67, 0xE3, 0xE7, 0xF7, 0x7B, 0x1F, 0x0F, 0x02, 0x80, 0x00, 0x0D,
+  0x07, 0x1F, 0x7B, 0xF7, 0xE7, 0xE7, 0x67, 0x77, 0x7F, 0x7F, 0x3F, 0xBF, 0x1F, 0x07, 0x84, 0x00,
+  0x09, 0x0F, 0x0F, 0x7F, 0x0F, 0x0F, 0x00, 0x02, 0x04, 0x04, 0x02, 0xFF, 0x00, 0xA0, 0x00, 0x02,
+  0xCB, 0x00, 0x81, 0x20, 0x04, 0x00, 0x00, 0x10, 0x90, 0x80, 0xCF, 0x00, 0x03, 0x80, 0xE0, 0xF0,
+  0xF0, 0x82, 0xF8, 0x03, 0xF0, 0xF0, 0xE0, 0xC0, 0x81, 0x00, 0x03, 0x80, 0xE0, 0xF0, 0xF0, 0x82,
+  0xF8, 0x03, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x00, 0x09, 0x04, 0x24, 0x20, 0x80, 0xE0, 0x88, 0xE0,
+  0x81, 0x09, 0x04, 0xCD, 0x00, 0x0E, 0x04, 0x0F, 0x1F, 0x3F, 0x7F, 0x7B, 0x6B, 0x63, 0xE3, 0xE7,
+  0xF7, 0x7F, 0x1D, 0x0D, 0x01, 0x80, 0x00, 0x06, 0x07, 0x1F, 0x7B, 0x77, 0xE7, 0xE3, 0xE7, 0x80,
+  0x7F, 0x03, 0x3F, 0xBF, 0x1F, 0x03, 0x86, 0x00, 0x09, 0x07, 0x0F, 0x3F, 0x0F, 0x07, 0x00, 0x02,
+  0x04, 0x04, 0x02, 0xCE, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x02, 0xCC, 0x00, 0x01, 0x80, 0x0C, 0x80,
+  0x00, 0x03, 0x02, 0x16, 0x30, 0x30, 0xCC, 0x00, 0x03, 0x80, 0xE0, 0xF0, 0xF0, 0x83, 0xF8, 0x02,
+  0xF0, 0xE0, 0xC0, 0x82, 0x00, 0x03, 0xC0, 0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x03, 0xF0, 0xF0, 0xE0,
+  0x80, 0x85, 0x00, 0x09, 0x01, 0x10, 0x04, 0x00, 0x80, 0x21, 0x80, 0x00, 0x04, 0x08, 0xCB, 0x00,
+  0x0E, 0x04, 0x07, 0x1F, 0x3F, 0x7F, 0x7F, 0x7B, 0x6B, 0xE3, 0xE3, 0xF7, 0x7F, 0x7F, 0x1D, 0x01,
+  0x80, 0x00, 0x07, 0x01, 0x0D, 0x7F, 0x7F, 0xF7, 0xE7, 0xE3, 0x6B, 0x80, 0x7F, 0x03, 0x3F, 0x1F,
+  0x0F, 0x02, 0x87, 0x00, 0x09, 0x1E, 0x1F, 0xFE, 0x1F, 0x1E, 0x00, 0x02, 0x04, 0x04, 0x02, 0xFF,
+  0x00, 0xA0, 0x00, 0x02, 0xCB, 0x00, 0x09, 0x20, 0x28, 0x08, 0x00, 0x30, 0x20, 0x00, 0x00, 0x8C,
+  0x04, 0xCB, 0x00, 0x03, 0xC0, 0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x03, 0xF0, 0xF0, 0xE0, 0xC0, 0x81,
+  0x00, 0x03, 0x80, 0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x03, 0xF0, 0xF0, 0xE0, 0xC0, 0x87, 0x00, 0x08,
+  0x04, 0x07, 0x11, 0x88, 0xE0, 0x81, 0xE0, 0x86, 0x01, 0xCB, 0x00, 0x03, 0x02, 0x8F, 0x1F, 0x3F,
+  0x80, 0x7F, 0x07, 0x6B, 0xE3, 0xE3, 0xF7, 0x7F, 0x1F, 0x0F, 0x03, 0x80, 0x00, 0x0D, 0x07, 0x1F,
+  0x7F, 0x7B, 0xF7, 0xF3, 0xF1, 0x7B, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x07, 0x89, 0x00, 0x09, 0x07,
+  0x0F, 0x7F, 0x0F, 0x07, 0x00, 0x02, 0x04, 0x04, 0x02, 0xFF, 0x00, 0xA0, 0x00, 0x02, 0xCA, 0x00,
+  0x09, 0x04, 0x8C, 0x80, 0x20, 0x00, 0x02, 0x06, 0x00, 0x81, 0x21, 0xCB, 0x00, 0x03, 0xC0, 0xE0,
+  0xF0, 0xF0, 0x82, 0xF8, 0x03, 0xF0, 0xF0, 0xE0, 0xC0, 0x81, 0x00, 0x03, 0x80, 0xE0, 0xF0, 0xF0,
+  0x82, 0xF8, 0x03, 0xF0, 0xF0, 0xE0, 0xC0, 0x89, 0x00, 0x06, 0x40, 0x00, 0x00, 0x80, 0x00, 0x80,
+  0x40, 0xCB, 0x00, 0x0E, 0x02, 0x0F, 0x3F, 0x3F, 0x7F, 0x77, 0x7B, 0x63, 0xE3, 0xF7, 0xF7, 0x7B,
+  0x1D, 0x0D, 0x01, 0x80, 0x00, 0x0D, 0x0F, 0x1F, 0x7D, 0x75, 0xF7, 0xE3, 0x63, 0x7B, 0x77, 0x7B,
+  0x3F, 0x3F, 0x1F, 0x06, 0x8A, 0x00, 0x09, 0x1E, 0x1F, 0xFE, 0x1F, 0x1F, 0x00, 0x02, 0x04, 0x00,
+  0x02, 0xFF, 0x00, 0xA0, 0x00, 0x02, 0xCC, 0x00, 0x07, 0x10, 0x04, 0x04, 0x00, 0x40, 0x08, 0x1C,
+  0x04, 0xCA, 0x00, 0x03, 0xC0, 0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x03, 0xF0, 0xF0, 0xE0, 0xC0, 0x81,
+  0x00, 0x03, 0x80, 0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x03, 0xF0, 0xF0, 0xE0, 0xC0, 0x89, 0x00, 0x08,
+  0x04, 0x04, 0x00, 0x40, 0xC0, 0x00, 0xC1, 0x20, 0x04, 0xC9, 0x00, 0x0E, 0x06, 0x0F, 0x1F, 0x3F,
+  0x7B, 0x77, 0x7B, 0x63, 0xE3, 0xF7, 0xF7, 0x7D, 0x1D, 0x0F, 0x01, 0x80, 0x00, 0x0D, 0x07, 0x1F,
+  0x7B, 0x77, 0xF7, 0xE3, 0x63, 0x7B, 0x7F, 0x7B, 0x3F, 0x3F, 0x1F, 0x06, 0x8B, 0x00, 0x09, 0x0F,
+  0x1F, 0x7F, 0x1F, 0x0F, 0x00, 0x02, 0x04, 0x00, 0x02, 0xFF, 0x00, 0xA0, 0x00, 0x03, 0xCB, 0x00,
+  0x08, 0x80, 0x14, 0x35, 0x05, 0x00, 0x58, 0x08, 0x5D, 0x04, 0xD6, 0x00, 0x00, 0x40, 0x81, 0x00,
+  0x00, 0x40, 0x95, 0x00, 0x09, 0x05, 0x04, 0x08, 0xC8, 0x20, 0x80, 0x29, 0xA0, 0x07, 0x01, 0xC8,
+  0x00, 0x16, 0x01, 0x10, 0x20, 0x00, 0x0C, 0x08, 0x04, 0x80, 0x00, 0x10, 0x80, 0x42, 0x02, 0x08,
+  0x01, 0x00, 0x00, 0x01, 0x0A, 0x00, 0x04, 0x80, 0x14, 0x81, 0x00, 0x04, 0x04, 0x00, 0x20, 0x10,
+  0x04, 0x8B, 0x00, 0x04, 0x08, 0x10, 0x40, 0x10, 0x08, 0xFF, 0x00, 0xA5, 0x00, 0x03, 0xCB, 0x00,
+  0x08, 0xA0, 0x24, 0xB1, 0x81, 0x00, 0x19, 0x80, 0x41, 0x40, 0xF4, 0x00, 0x09, 0x11, 0x31, 0x08,
+  0x88, 0x60, 0x80, 0x69, 0x80, 0x03, 0x01, 0xC8, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x08, 0x81,
+  0x00, 0x0B, 0x10, 0x00, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x02, 0x00, 0x04, 0x80, 0x00,
+  0x00, 0x08, 0x92, 0x00, 0x04, 0x19, 0x10, 0xC1, 0x10, 0x19, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x00,
+  0xA1, 0x00, 0x03, 0xCB, 0x00, 0x08, 0x28, 0x68, 0x90, 0x80, 0x80, 0x01, 0x30, 0x10, 0x40, 0xF4,
+  0x00, 0x08, 0x14, 0x37, 0x40, 0x00, 0x40, 0x08, 0x41, 0x00, 0x01, 0xC9, 0x00, 0x00, 0x04, 0x80,
+  0x00, 0x15, 0x04, 0x00, 0x02, 0x12, 0x12, 0x0C, 0x0C, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x06, 0x0C, 0x10, 0x12, 0x1A, 0x06, 0x91, 0x00, 0x04, 0x11, 0x10, 0x81, 0x10, 0x11,
+  0xFF, 0x00, 0xA5, 0x00, 0x02, 0xCB, 0x00, 0x08, 0x83, 0x08, 0x01, 0x00, 0x10, 0x00, 0x02, 0x09,
+  0x03, 0xCA, 0x00, 0x03, 0xC0, 0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x03, 0xF0, 0xF0, 0xE0, 0x80, 0x81,
+  0x00, 0x03, 0xC0, 0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x03, 0xF0, 0xF0, 0xE0, 0xC0, 0x8B, 0x00, 0x05,
+  0x04, 0x84, 0xE1, 0x81, 0xE0, 0x98, 0xCA, 0x00, 0x0D, 0x07, 0x1F, 0x3F, 0x3F, 0x7B, 0x77, 0x79,
+  0xF1, 0xF1, 0xF7, 0x7F, 0x3F, 0x1F, 0x07, 0x80, 0x00, 0x0E, 0x01, 0x0F, 0x1F, 0x7F, 0xFF, 0xF7,
+  0xF1, 0x71, 0x79, 0x73, 0x7F, 0x3F, 0x1F, 0x0F, 0x02, 0x8B, 0x00, 0x09, 0x07, 0x0F, 0x3F, 0x0F,
+  0x07, 0x00, 0x02, 0x04, 0x04, 0x02, 0xFF, 0x00, 0xA0, 0x00, 0x03, 0xCB, 0x00, 0x09, 0x93, 0x39,
+  0x01, 0x00, 0x10, 0x10, 0x00, 0x0B, 0x01, 0x02, 0xF4, 0x00, 0x07, 0x0C, 0x10, 0x88, 0x61, 0x81,
+  0x61, 0xDF, 0x04, 0xCD, 0x00, 0x07, 0x0C, 0x08, 0x06, 0x12, 0x12, 0x00, 0x08, 0x40, 0x86, 0x00,
+  0x05, 0x08, 0x10, 0x12, 0x12, 0x06, 0x0C, 0x81, 0x00, 0x00, 0x04, 0x8B, 0x00, 0x04, 0x19, 0x10,
+  0xC1, 0x10, 0x19, 0xFF, 0x00, 0xA5, 0x00, 0x03, 0xCB, 0x00, 0x09, 0x14, 0x35, 0x10, 0x00, 0x00,
+  0x10, 0x42, 0x82, 0x82, 0x02, 0xF3, 0x00, 0x08, 0x01, 0x1F, 0x15, 0x0D, 0x40, 0x20, 0x49, 0x47,
+  0x1C, 0xD2, 0x00, 0x00, 0x10, 0x87, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x04, 0x92, 0x00, 0x04,
+  0x11, 0x00, 0x81, 0x00, 0x11, 0xFF, 0x00, 0xA5, 0x00, 0x03, 0xCB, 0x00, 0x08, 0x44, 0x45, 0x30,
+  0x80, 0x00, 0x00, 0xD8, 0x08, 0x90, 0xF4, 0x00, 0x08, 0x01, 0x51, 0x41, 0x81, 0x24, 0xA4, 0x28,
+  0xE1, 0x5B, 0xCE, 0x00, 0x05, 0x10, 0x08, 0x24, 0x04, 0x08, 0x08, 0x83, 0x00, 0x09, 0x03, 0x00,
+  0x00, 0x04, 0x18, 0x08, 0x24, 0x20, 0x08, 0x10, 0x81, 0x00, 0x00, 0x02, 0x8B, 0x00, 0x03, 0x08,
+  0x10, 0x00, 0x10, 0xFF, 0x00, 0xA6, 0x00, 0x03, 0xCB, 0x00, 0x09, 0x50, 0x45, 0x2C, 0xA0, 0x00,
+  0x80, 0x9A, 0x9A, 0x34, 0x40, 0xF3, 0x00, 0x09, 0x10, 0x5A, 0x42, 0x80, 0x60, 0x84, 0x60, 0xE1,
+  0x4F, 0x08, 0xCD, 0x00, 0x06, 0x10, 0x08, 0x24, 0x04, 0x18, 0x08, 0x40, 0x82, 0x00, 0x00, 0x03,
+  0x80, 0x00, 0x05, 0x18, 0x08, 0x24, 0x30, 0x08, 0x10, 0x90, 0x00, 0x04, 0x19, 0x10, 0x81, 0x10,
+  0x11, 0xFF, 0x00, 0xA5, 0x00, 0x03, 0xCB, 0x00, 0x09, 0x12, 0x04, 0x4D, 0x20, 0x00, 0x90, 0x02,
+  0x11, 0x2C, 0x48, 0xF3, 0x00, 0x09, 0x31, 0x19, 0x0A, 0x80, 0x64, 0x80, 0x68, 0x80, 0x0F, 0x09,
+  0xCC, 0x00, 0x07, 0x0C, 0x08, 0x04, 0x12, 0x10, 0x00, 0x08, 0x40, 0x85, 0x00, 0x06, 0x02, 0x08,
+  0x10, 0x12, 0x04, 0x04, 0x08, 0x81, 0x00, 0x00, 0x02, 0x8B, 0x00, 0x04, 0x19, 0x10, 0xC1, 0x10,
+  0x19, 0xFF, 0x00, 0xA5, 0x00, 0x03, 0xCB, 0x00, 0x09, 0x22, 0x20, 0xC1, 0x00, 0x00, 0x12, 0x82,
+  0x83, 0x49, 0x0B, 0xF3, 0x00, 0x09, 0x21, 0x01, 0x08, 0x84, 0x74, 0x98, 0x68, 0x81, 0x43, 0x01,
+  0xCF, 0x00, 0x01, 0x02, 0x02, 0x88, 0x00, 0x04, 0x06, 0x08, 0x00, 0x12, 0x10, 0x92, 0x00, 0x04,
+  0x19, 0x10, 0xC1, 0x10, 0x19, 0xFF, 0x00, 0xA5, 0x00, 0x03, 0xCA, 0x00, 0x0A, 0x04, 0x6C, 0x60,
+  0x80, 0x00, 0x80, 0x02, 0xE2, 0x80, 0x59, 0x03, 0xF5, 0x00, 0x08, 0x28, 0x04, 0x55, 0x1C, 0x41,
+  0x01, 0x40, 0x00, 0x10, 0xCB, 0x00, 0x06, 0x0C, 0x08, 0x04, 0x14, 0x16, 0x10, 0x08, 0x83, 0x00,
+  0x00, 0x03, 0x81, 0x00, 0x04, 0x10, 0x00, 0x00, 0x04, 0x08, 0x81, 0x00, 0x00, 0x04, 0x8B, 0x00,
+  0x04, 0x11, 0x00, 0x81, 0x00, 0x11, 0x82, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x9F, 0x00, 0x03, 0xCA,
+  0x00, 0x0A, 0x04, 0x5D, 0x50, 0x00, 0x00, 0xA0, 0x00, 0xCC, 0x00, 0x0A, 0x06, 0xE6, 0x00, 0x00,
+  0x40, 0x8A, 0x00, 0x09, 0x10, 0x21, 0x80, 0x11, 0x85, 0x21, 0x80, 0x00, 0x03, 0x10, 0xC7, 0x00,
+  0x00, 0x04, 0x80, 0x00, 0x05, 0x08, 0x00, 0x14, 0x04, 0x04, 0x10, 0x84, 0x00, 0x03, 0x01, 0x00,
+  0x00, 0x04, 0x80, 0x00, 0x00, 0x10, 0x83, 0x00, 0x00, 0x01, 0x8B, 0x00, 0x03, 0x08, 0x10, 0x00,
+  0x10, 0x83, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x9F, 0x00, 0x03, 0xCB, 0x00, 0x09, 0x17, 0x12, 0x60,
+  0x04, 0x24, 0x20, 0xAD, 0x06, 0x10, 0x44, 0xE6, 0x00, 0x00, 0x40, 0x89, 0x00, 0x09, 0x01, 0x03,
+  0x1B, 0x80, 0x50, 0x83, 0x68, 0x80, 0x04, 0x03, 0xC8, 0x00, 0x00, 0x04, 0x82, 0x00, 0x00, 0x14,
+  0x87, 0x00, 0x00, 0x02, 0x81, 0x00, 0x02, 0x10, 0x00, 0x10, 0x83, 0x00, 0x00, 0x01, 0x8B, 0x00,
+  0x04, 0x08, 0x10, 0x80, 0x10, 0x10, 0xFF, 0x00, 0xA5, 0x00, 0x03, 0xCA, 0x00, 0x0A, 0x02, 0x24,
+  0xA2, 0x60, 0x05, 0x04, 0x64, 0x81, 0x86, 0x42, 0xC2, 0xD5, 0x00, 0x00, 0x40, 0x81, 0x00, 0x00,
+  0x40, 0x96, 0x00, 0x07, 0x13, 0x12, 0x00, 0x00, 0x02, 0x0E, 0x26, 0x04, 0xC9, 0x00, 0x1F, 0x01,
+  0x10, 0x20, 0x00, 0x04, 0x08, 0x04, 0x80, 0x00, 0x00, 0x82, 0x02, 0x00, 0x08, 0x01, 0x00, 0x00,
+  0x01, 0x08, 0x00, 0x02, 0x08, 0x00, 0x12, 0x00, 0x04, 0x08, 0x04, 0x00, 0x20, 0x10, 0x04, 0x8B,
+  0x00, 0x04, 0x11, 0x20, 0x01, 0x20, 0x01, 0xFF, 0x00, 0xA5, 0x00, 0x03, 0xCA, 0x00, 0x0A, 0x02,
+  0x26, 0x94, 0x01, 0x01, 0x00, 0x4C, 0x88, 0xC0, 0x50, 0x90, 0xD5, 0x00, 0x00, 0x40, 0x81, 0x00,
+  0x00, 0x40, 0x95, 0x00, 0x08, 0x01, 0x0D, 0x0C, 0x00, 0x40, 0x00, 0x46, 0x3E, 0x10, 0xC9, 0x00,
+  0x17, 0x05, 0x90, 0x20, 0x00, 0x00, 0x08, 0x00, 0x80, 0x00, 0x00, 0x82, 0x02, 0x00, 0x0A, 0x01,
+  0x00, 0x00, 0x01, 0x08, 0x00, 0x02, 0x08, 0x00, 0x12, 0x80, 0x00, 0x04, 0x04, 0x00, 0x20, 0x10,
+  0x02, 0x8B, 0x00, 0x04, 0x11, 0x30, 0x81, 0x30, 0x11, 0xFF, 0x00, 0xA5, 0x00, 0x02, 0xCB, 0x00,
+  0x02, 0x04, 0x44, 0x40, 0x80, 0x00, 0x03, 0x1A, 0x1A, 0x00, 0x02, 0xC7, 0x00, 0x03, 0xC0, 0xE0,
+  0xF0, 0xF0, 0x82, 0xF8, 0x03, 0xF0, 0xF0, 0xE0, 0xC0, 0x81, 0x00, 0x03, 0x80, 0xE0, 0xF0, 0xF0,
+  0x82, 0xF8, 0x03, 0xF0, 0xF0, 0xE0, 0xC0, 0x8D, 0x00, 0x06, 0x63, 0x00, 0x88, 0x00, 0x80, 0x00,
+  0x0C, 0xC7, 0x00, 0x0E, 0x02, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x77, 0x67, 0xE7, 0xE7, 0xFF, 0x7F,
+  0x1F, 0x0F, 0x02, 0x80, 0x00, 0x0D, 0x0F, 0x1F, 0x3F, 0xF7, 0xE7, 0xE3, 0xE7, 0x77, 0x7F, 0x7F,
+  0x3F, 0x3F, 0x1F, 0x07, 0x8D, 0x00, 0x09, 0x1E, 0x1F, 0xFE, 0x1F, 0x1E, 0x00, 0x02, 0x04, 0x04,
+  0x02, 0xFF, 0x00, 0xA0, 0x00,
+};
+
+const uint8_t BATTERY_FRAME_COUNT = 25;
+
+#endif // BATTERY_128X32_H
@@ -0,0 +1,156 @@
+// Generated by clipenc from cry.h - do not edit.
+// Keyframe + XOR-delta clip, see RideBuddyClip.h for the format.
+// Fitted to a 128x32 panel.
+#ifndef CRY_128X32_H
+#define CRY_128X32_H
+
+#include "../../RideBuddyClip.h"
+
+const uint8_t cry_clip[] PROGMEM = {
+  0x52, 0x43, 0x02, 0x19, 0x0C, 0x10, 0x04, 0x00, 0x6C, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0xD0, 0x01, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00,
+  0x96, 0x02, 0x00, 0x00, 0xF3, 0x02, 0x00, 0x00, 0x4F, 0x03, 0x00, 0x00, 0x9A, 0x03, 0x00, 0x00,
+  0xE2, 0x03, 0x00, 0x00, 0x1E, 0x04, 0x00, 0x00, 0x48, 0x04, 0x00, 0x00, 0x94, 0x04, 0x00, 0x00,
+  0xDF, 0x04, 0x00, 0x00, 0x35, 0x05, 0x00, 0x00, 0x96, 0x05, 0x00, 0x00, 0xF6, 0x05, 0x00, 0x00,
+  0x54, 0x06, 0x00, 0x00, 0xB2, 0x06, 0x00, 0x00, 0x0B, 0x07, 0x00, 0x00, 0x7C, 0x07, 0x00, 0x00,
+  0xD8, 0x07, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x93, 0x08, 0x00, 0x00, 0x02, 0xB3, 0x00, 0x00,
+  0x80, 0x80, 0xC0, 0x00, 0x80, 0x87, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x00, 0x80, 0xDF, 0x00, 0x83,
+  0xFC, 0x01, 0xFE, 0xFE, 0x84, 0xFF, 0x00, 0xFE, 0x85, 0x00, 0x00, 0xFE, 0x84, 0xFF, 0x01, 0xFE,
+  0xFE, 0x83, 0xFC, 0xD5, 0x00, 0x01, 0x11, 0x3F, 0x81, 0x07, 0x08, 0x7F, 0x6F, 0x07, 0xC7, 0xFF,
+  0x87, 0x6F, 0xFF, 0x43, 0x87, 0x00, 0x08, 0x43, 0xFF, 0x6F, 0x87, 0xFF, 0xC7, 0x07, 0x6F, 0x7F,
+  0x81, 0x07, 0x01, 0x3F, 0x11, 0xDB, 0x00, 0x04, 0x0E, 0x04, 0x00, 0x01, 0x01, 0x8F, 0x00, 0x04,
+  0x01, 0x01, 0x00, 0x04, 0x0F, 0xAF, 0x00, 0x03, 0xB4, 0x00, 0x80, 0x40, 0x89, 0x00, 0x80, 0x40,
+  0xE0, 0x00, 0x01, 0x04, 0x04, 0xA1, 0x00, 0x01, 0x04, 0x04, 0xD5, 0x00, 0x01, 0x50, 0xC8, 0x81,
+  0x00, 0x08, 0x80, 0xA8, 0x00, 0x40, 0x00, 0x80, 0x68, 0x20, 0x40, 0x87, 0x00, 0x08, 0x40, 0x20,
+  0x68, 0x80, 0x00, 0x40, 0x00, 0xA8, 0x80, 0x81, 0x00, 0x01, 0xC8, 0xD0, 0xDB, 0x00, 0x02, 0x2F,
+  0x05, 0x00, 0x80, 0x06, 0x02, 0x0E, 0x0F, 0x06, 0x88, 0x00, 0x01, 0x0F, 0x0E, 0x80, 0x06, 0x02,
+  0x00, 0x05, 0x2E, 0xAF, 0x00, 0x02, 0xB0, 0x00, 0x80, 0x80, 0x8C, 0x00, 0x01, 0x80, 0x80, 0xDF,
+  0x00, 0x80, 0xF8, 0x81, 0xFC, 0x01, 0xFE, 0xFE, 0x83, 0xFF, 0x86, 0x00, 0x00, 0xFE, 0x83, 0xFF,
+  0x01, 0xFE, 0xFE, 0x81, 0xFC, 0x80, 0xF8, 0xD5, 0x00, 0x01, 0x0F, 0x0F, 0x80, 0x07, 0x09, 0xC7,
+  0xFF, 0xC7, 0x07, 0xCF, 0x9F, 0x07, 0x8F, 0x0F, 0x03, 0x86, 0x00, 0x09, 0x01, 0x1F, 0x1F, 0x07,
+  0xC7, 0xFF, 0xC7, 0x07, 0x0F, 0x1F, 0x80, 0x07, 0x01, 0x0F, 0x1F, 0xDB, 0x00, 0x01, 0x01, 0x01,
+  0x81, 0x00, 0x02, 0x1C, 0x1F, 0x1C, 0x88, 0x00, 0x02, 0x1C, 0x1F, 0x08, 0x80, 0x00, 0x02, 0x0C,
+  0x0F, 0x0C, 0xB2, 0x00, 0x02, 0xAC, 0x00, 0x80, 0x80, 0x8C, 0x00, 0x80, 0x80, 0xDE, 0x00, 0x02,
+  0x78, 0xF8, 0xF8, 0x81, 0xFC, 0x01, 0xFE, 0xFE, 0x84, 0xFF, 0x86, 0x00, 0x84, 0xFF, 0x01, 0xFE,
+  0xFE, 0x81, 0xFC, 0x01, 0xF8, 0xF8, 0xD6, 0x00, 0x01, 0x7F, 0x37, 0x80, 0x07, 0x09, 0xFF, 0xFF,
+  0x07, 0x87, 0xFF, 0xFF, 0x07, 0x3F, 0x3F, 0x01, 0x86, 0x00, 0x09, 0xC3, 0xFF, 0xFF, 0x07, 0xFF,
+  0xFF, 0x07, 0x07, 0xFF, 0xE7, 0x80, 0x07, 0x01, 0x3F, 0x3F, 0xDB, 0x00, 0x05, 0x01, 0x01, 0x00,
+  0x00, 0x01, 0x01, 0x8B, 0x00, 0x07, 0x01, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0xB6, 0x00,
+  0x02, 0xAF, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x00, 0x80, 0x87, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x00,
+  0x80, 0xDF, 0x00, 0x83, 0xFC, 0x01, 0xFE, 0xFE, 0x84, 0xFF, 0x00, 0x38, 0x85, 0x00, 0x00, 0xFE,
+  0x84, 0xFF, 0x01, 0xFE, 0xFE, 0x83, 0xFC, 0xD5, 0x00, 0x01, 0x85, 0xCF, 0x80, 0x07, 0x09, 0xC7,
+  0xFF, 0xCF, 0x07, 0x37, 0x3F, 0x07, 0x1F, 0x3F, 0x03, 0x86, 0x00, 0x09, 0x01, 0x37, 0x7F, 0x37,
+  0x67, 0x7F, 0x67, 0x07, 0x3F, 0x3F, 0x81, 0x07, 0x01, 0x8F, 0x01, 0xD5, 0x00, 0x01, 0x01, 0x01,
+  0x87, 0x00, 0x01, 0x10, 0x38, 0x89, 0x00, 0x00, 0x38, 0x82, 0x00, 0x01, 0x1E, 0x1C, 0x80, 0x00,
+  0x01, 0x03, 0x07, 0xAE, 0x00, 0x02, 0xB1, 0x00, 0x01, 0x80, 0x80, 0x80, 0xC0, 0x00, 0x80, 0x87,
+  0x00, 0x00, 0x80, 0x80, 0xC0, 0x00, 0x80, 0xDF, 0x00, 0x00, 0xF8, 0x82, 0xFC, 0x01, 0xFE, 0xFE,
+  0x84, 0xFF, 0x86, 0x00, 0x84, 0xFF, 0x80, 0xFE, 0x82, 0xFC, 0x00, 0xF8, 0xD5, 0x00, 0x01, 0x73,
+  0x7F, 0x80, 0x07, 0x09, 0xC7, 0xFF, 0x07, 0x07, 0xFF, 0xBF, 0x07, 0xDF, 0xDF, 0x03, 0x86, 0x00,
+  0x09, 0x01, 0x17, 0x1F, 0x07, 0x0F, 0xFF, 0x07, 0x07, 0xEF, 0xEF, 0x80, 0x07, 0x01, 0x27, 0x7F,
+  0xDF, 0x00, 0x04, 0x07, 0x07, 0x00, 0x07, 0x07, 0x88, 0x00, 0x02, 0x1C, 0x1E, 0x08, 0x80, 0x07,
+  0x02, 0x00, 0x01, 0x21, 0xB0, 0x00, 0x02, 0xB4, 0x00, 0x82, 0x80, 0x87, 0x00, 0x83, 0x80, 0xDF,
+  0x00, 0x01, 0xF8, 0xF8, 0x81, 0xFC, 0x01, 0xFE, 0xFE, 0x84, 0xFF, 0x86, 0x00, 0x84, 0xFF, 0x01,
+  0xFE, 0xFE, 0x80, 0xFC, 0x80, 0xF8, 0xD6, 0x00, 0x01, 0x7F, 0x6F, 0x80, 0x07, 0x09, 0xC7, 0xEF,
+  0x07, 0x07, 0xFF, 0x0F, 0x07, 0xDF, 0x07, 0x01, 0x86, 0x00, 0x08, 0x03, 0xBF, 0x1F, 0x07, 0xFF,
+  0xAF, 0x07, 0x07, 0xEF, 0x81, 0x07, 0x01, 0x7F, 0x7F, 0xDB, 0x00, 0x02, 0x01, 0x01, 0x00, 0x80,
+  0x07, 0x02, 0x00, 0x07, 0x07, 0x88, 0x00, 0x08, 0x1F, 0x0E, 0x00, 0x0F, 0x0F, 0x00, 0x01, 0x03,
+  0x01, 0xAD, 0x00, 0x02, 0xB6, 0x00, 0x82, 0x80, 0xEE, 0x00, 0x81, 0xF8, 0x80, 0xFC, 0x01, 0xFE,
+  0xFE, 0x83, 0xFF, 0x00, 0x3C, 0x85, 0x00, 0x84, 0xFF, 0x01, 0xFE, 0xFE, 0x80, 0xFC, 0x80, 0xF8,
+  0x00, 0x10, 0xD5, 0x00, 0x02, 0x01, 0xE7, 0x87, 0x80, 0x07, 0x08, 0x3F, 0x3F, 0x07, 0xE7, 0xFF,
+  0x07, 0xE7, 0xFF, 0xE3, 0x86, 0x00, 0x09, 0x01, 0x03, 0xEF, 0x07, 0xCF, 0xFF, 0xC7, 0x07, 0x7F,
+  0x7F, 0x80, 0x07, 0x01, 0xC7, 0xE7, 0xD7, 0x00, 0x01, 0x01, 0x01, 0x80, 0x00, 0x01, 0x0E, 0x0C,
+  0x8E, 0x00, 0x04, 0x03, 0x07, 0x03, 0x01, 0x01, 0x84, 0x00, 0x01, 0x01, 0x01, 0xA7, 0x00, 0x02,
+  0xFF, 0x00, 0xAB, 0x00, 0x01, 0xF0, 0xF0, 0x80, 0xF8, 0x80, 0xFC, 0x84, 0xFE, 0x85, 0x00, 0x00,
+  0xFC, 0x84, 0xFE, 0x01, 0xFC, 0xFC, 0x81, 0xF8, 0x00, 0xF0, 0xD7, 0x00, 0x01, 0x3B, 0x3F, 0x80,
+  0x07, 0x09, 0xC7, 0xEF, 0x07, 0x07, 0x3F, 0x37, 0x07, 0xFF, 0xE3, 0x01, 0x86, 0x00, 0x07, 0x03,
+  0x3F, 0x07, 0x07, 0x3F, 0x07, 0x07, 0xCF, 0x81, 0x07, 0x01, 0x0F, 0x0F, 0xEF, 0x00, 0x08, 0x08,
+  0x1E, 0x00, 0x0C, 0x1F, 0x0E, 0x00, 0x07, 0x07, 0xAC, 0x00, 0x02, 0xFF, 0x00, 0xAA, 0x00, 0x80,
+  0xE0, 0x80, 0xF0, 0x85, 0xF8, 0x00, 0x78, 0x85, 0x00, 0x85, 0xF8, 0x81, 0xF0, 0x80, 0xE0, 0xD7,
+  0x00, 0x01, 0x03, 0x03, 0x80, 0x07, 0x08, 0xFF, 0xFF, 0x07, 0x07, 0x1F, 0x17, 0x07, 0x0F, 0x03,
+  0x86, 0x00, 0x00, 0x03, 0x80, 0x07, 0x04, 0x37, 0x07, 0x07, 0x3F, 0x3F, 0x80, 0x07, 0x01, 0xC3,
+  0xE3, 0xE4, 0x00, 0x01, 0x0C, 0x08, 0x87, 0x00, 0x01, 0x07, 0x06, 0x86, 0x00, 0x01, 0x01, 0x01,
+  0xA9, 0x00, 0x02, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0xC0, 0x82, 0xE0, 0x86, 0xF0, 0x85, 0x00, 0x85,
+  0xF0, 0x82, 0xE0, 0x00, 0xC0, 0xD8, 0x00, 0x0D, 0x01, 0x0B, 0x03, 0x07, 0x07, 0x57, 0x7F, 0x07,
+  0x07, 0x3F, 0x17, 0x07, 0x3F, 0x33, 0x86, 0x00, 0x08, 0x01, 0x1F, 0x1B, 0x07, 0x37, 0x07, 0x07,
+  0xE7, 0xE7, 0x80, 0x07, 0x01, 0x83, 0x03, 0xFB, 0x00, 0x01, 0x03, 0x03, 0xAA, 0x00, 0x03, 0xFF,
+  0x00, 0xA9, 0x00, 0x00, 0x20, 0x9B, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x20, 0xD9, 0x00, 0x00,
+  0x08, 0x80, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x28, 0x8B, 0x00, 0x00, 0x04, 0x81, 0x00, 0x01,
+  0x80, 0x18, 0xF5, 0x00, 0x00, 0x08, 0xB6, 0x00, 0x02, 0xFF, 0x00, 0xAA, 0x00, 0x00, 0xE0, 0x81,
+  0xF0, 0x80, 0xF8, 0x84, 0xFC, 0x85, 0x00, 0x00, 0xF8, 0x84, 0xFC, 0x01, 0xF8, 0xF8, 0x82, 0xF0,
+  0xD7, 0x00, 0x02, 0x01, 0xC3, 0x87, 0x80, 0x07, 0x00, 0xDF, 0x80, 0x07, 0x04, 0x2F, 0x07, 0x87,
+  0x03, 0x01, 0x86, 0x00, 0x08, 0x83, 0xC7, 0x07, 0x37, 0x37, 0x07, 0x07, 0x1F, 0x1F, 0x80, 0x07,
+  0x01, 0x7B, 0x73, 0xD8, 0x00, 0x01, 0x01, 0x01, 0x86, 0x00, 0x01, 0x0F, 0x06, 0x87, 0x00, 0x01,
+  0x01, 0x03, 0xB4, 0x00, 0x02, 0xFF, 0x00, 0xAB, 0x00, 0x01, 0xF0, 0xF0, 0x80, 0xF8, 0x80, 0xFC,
+  0x84, 0xFE, 0x85, 0x00, 0x00, 0xFC, 0x84, 0xFE, 0x01, 0xFC, 0xFC, 0x81, 0xF8, 0x00, 0xF0, 0xD7,
+  0x00, 0x01, 0x3B, 0x3F, 0x80, 0x07, 0x09, 0xC7, 0xEF, 0x07, 0x07, 0x3F, 0x37, 0x07, 0xFF, 0xC3,
+  0x01, 0x86, 0x00, 0x07, 0x03, 0x3F, 0x07, 0x07, 0x3F, 0x07, 0x07, 0xCF, 0x81, 0x07, 0x01, 0x0F,
+  0x0F, 0xEF, 0x00, 0x08, 0x08, 0x1E, 0x00, 0x0C, 0x1F, 0x0E, 0x00, 0x07, 0x07, 0xAC, 0x00, 0x02,
+  0xB6, 0x00, 0x81, 0x80, 0x88, 0x00, 0x04, 0x80, 0x80, 0x00, 0x80, 0x80, 0xDF, 0x00, 0x80, 0xF8,
+  0x81, 0xFC, 0x00, 0xFE, 0x84, 0xFF, 0x86, 0x00, 0x84, 0xFF, 0x03, 0xFE, 0xFE, 0xFC, 0xFC, 0x81,
+  0xF8, 0xD6, 0x00, 0x01, 0xE3, 0xFF, 0x81, 0x07, 0x08, 0x3F, 0x07, 0x07, 0x7F, 0x7F, 0x07, 0x7F,
+  0x7F, 0x03, 0x86, 0x00, 0x09, 0x03, 0xC7, 0xFF, 0x07, 0xEF, 0xFF, 0x07, 0x07, 0x3F, 0x37, 0x80,
+  0x07, 0x01, 0xF7, 0xE3, 0xDB, 0x00, 0x01, 0x06, 0x0F, 0x8F, 0x00, 0x01, 0x21, 0x03, 0x81, 0x00,
+  0x01, 0x10, 0x3C, 0xAD, 0x00, 0x02, 0xB3, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x00, 0x80, 0x87, 0x00,
+  0x00, 0x80, 0x80, 0xC0, 0x00, 0x80, 0xDF, 0x00, 0x83, 0xFC, 0x01, 0xFE, 0xFE, 0x84, 0xFF, 0x00,
+  0xFC, 0x85, 0x00, 0x00, 0xFE, 0x84, 0xFF, 0x01, 0xFE, 0xFE, 0x83, 0xFC, 0xD5, 0x00, 0x01, 0x31,
+  0x3F, 0x81, 0x07, 0x08, 0xFF, 0x6F, 0x07, 0xC7, 0xFF, 0x87, 0xCF, 0xFF, 0xC3, 0x87, 0x00, 0x08,
+  0xC3, 0xFF, 0xCF, 0x87, 0xFF, 0xC7, 0x07, 0x6F, 0x7F, 0x81, 0x07, 0x01, 0x3F, 0x31, 0xDB, 0x00,
+  0x02, 0x1E, 0x08, 0x00, 0x80, 0x01, 0x01, 0x00, 0x01, 0x89, 0x00, 0x07, 0x01, 0x00, 0x01, 0x03,
+  0x01, 0x00, 0x08, 0x1E, 0xAF, 0x00, 0x02, 0xB3, 0x00, 0x81, 0x80, 0x88, 0x00, 0x82, 0x80, 0xDF,
+  0x00, 0x01, 0xF8, 0xF8, 0x81, 0xFC, 0x01, 0xFE, 0xFE, 0x84, 0xFF, 0x86, 0x00, 0x84, 0xFF, 0x01,
+  0xFE, 0xFE, 0x81, 0xFC, 0x80, 0xF8, 0xD5, 0x00, 0x00, 0x03, 0x82, 0x07, 0x08, 0xCF, 0x07, 0x07,
+  0x37, 0x3F, 0x07, 0x3F, 0x3F, 0x03, 0x86, 0x00, 0x09, 0x01, 0x33, 0x3F, 0x07, 0x07, 0x7F, 0x07,
+  0x07, 0x9F, 0xDF, 0x81, 0x07, 0x00, 0xC7, 0xDB, 0x00, 0x08, 0x03, 0x03, 0x00, 0x00, 0x3E, 0x3C,
+  0x00, 0x3C, 0x3E, 0x88, 0x00, 0x08, 0x10, 0x3C, 0x10, 0x0C, 0x1F, 0x0C, 0x00, 0x03, 0x03, 0x80,
+  0x00, 0x01, 0x01, 0x03, 0xAA, 0x00, 0x02, 0xAF, 0x00, 0x80, 0x80, 0x8D, 0x00, 0x01, 0x80, 0x80,
+  0xDE, 0x00, 0x00, 0x08, 0x80, 0xF8, 0x80, 0xFC, 0x01, 0xFE, 0xFE, 0x84, 0xFF, 0x86, 0x00, 0x84,
+  0xFF, 0x01, 0xFE, 0xFE, 0x81, 0xFC, 0x01, 0xF8, 0xF8, 0xD6, 0x00, 0x01, 0x0F, 0x0F, 0x80, 0x07,
+  0x09, 0xCF, 0xFF, 0x07, 0x07, 0x9F, 0x1F, 0x07, 0x1F, 0x1F, 0x01, 0x86, 0x00, 0x09, 0x01, 0x3F,
+  0x3F, 0x07, 0xEF, 0xFF, 0x07, 0x07, 0x1F, 0x1F, 0x80, 0x07, 0x01, 0x1F, 0x1F, 0xDB, 0x00, 0x01,
+  0x03, 0x03, 0x81, 0x00, 0x01, 0x3C, 0x3E, 0x89, 0x00, 0x07, 0x3E, 0x3E, 0x00, 0x01, 0x01, 0x00,
+  0x1C, 0x1E, 0xB3, 0x00, 0x02, 0xAC, 0x00, 0x00, 0x80, 0x81, 0xC0, 0x00, 0x80, 0x86, 0x00, 0x00,
+  0x80, 0x81, 0xC0, 0x00, 0x80, 0xDF, 0x00, 0x82, 0xFC, 0x80, 0xFE, 0x84, 0xFF, 0x86, 0x00, 0x84,
+  0xFF, 0x80, 0xFE, 0x82, 0xFC, 0xD6, 0x00, 0x01, 0x3F, 0x3F, 0x80, 0x07, 0x09, 0x3F, 0xBF, 0x07,
+  0x87, 0xFF, 0x8F, 0x07, 0xFF, 0xC7, 0x03, 0x86, 0x00, 0x09, 0x03, 0x07, 0xDF, 0x07, 0x1F, 0xFF,
+  0x07, 0x87, 0xEF, 0x8F, 0x80, 0x07, 0x01, 0x7F, 0x77, 0xDB, 0x00, 0x02, 0x07, 0x07, 0x00, 0x80,
+  0x03, 0x02, 0x00, 0x03, 0x03, 0x88, 0x00, 0x05, 0x0E, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x80, 0x01,
+  0xB5, 0x00, 0x02, 0xAF, 0x00, 0x00, 0x80, 0x81, 0xC0, 0x00, 0x80, 0x87, 0x00, 0x00, 0x80, 0x80,
+  0xC0, 0x00, 0x80, 0xDF, 0x00, 0x83, 0xFC, 0x01, 0xFE, 0xFE, 0x84, 0xFF, 0x86, 0x00, 0x85, 0xFF,
+  0x01, 0xFE, 0xFE, 0x83, 0xFC, 0xD5, 0x00, 0x01, 0x1F, 0x1F, 0x80, 0x07, 0x09, 0x87, 0xFF, 0x0F,
+  0x07, 0xFF, 0xFF, 0x07, 0x3F, 0x7F, 0x03, 0x86, 0x00, 0x09, 0x01, 0xC7, 0xFF, 0xC7, 0xCF, 0xFF,
+  0xC7, 0x07, 0x3F, 0x3F, 0x80, 0x07, 0x01, 0x1F, 0x1F, 0xD7, 0x00, 0x00, 0x06, 0x80, 0x00, 0x80,
+  0x03, 0x8E, 0x00, 0x04, 0x01, 0x01, 0x00, 0x00, 0x01, 0xB6, 0x00, 0x02, 0xB2, 0x00, 0x00, 0x80,
+  0x80, 0xC0, 0x01, 0x80, 0x80, 0x87, 0x00, 0x04, 0x80, 0x80, 0xC0, 0xC0, 0x80, 0xDF, 0x00, 0x01,
+  0xF8, 0xF8, 0x81, 0xFC, 0x01, 0xFE, 0xFE, 0x84, 0xFF, 0x86, 0x00, 0x84, 0xFF, 0x01, 0xFE, 0xFE,
+  0x81, 0xFC, 0x02, 0xF8, 0xF8, 0x08, 0xD5, 0x00, 0x01, 0x0F, 0xDF, 0x80, 0x07, 0x09, 0x17, 0xBF,
+  0x07, 0x07, 0x7F, 0x6F, 0x07, 0x7F, 0x7F, 0x03, 0x86, 0x00, 0x09, 0x01, 0x77, 0x7F, 0x07, 0x6F,
+  0xFF, 0x07, 0x07, 0xBF, 0x3F, 0x80, 0x07, 0x01, 0x87, 0xCF, 0xD6, 0x00, 0x01, 0x03, 0x03, 0x80,
+  0x00, 0x01, 0x07, 0x07, 0x82, 0x00, 0x01, 0x3C, 0x30, 0x88, 0x00, 0x08, 0x30, 0x30, 0x00, 0x30,
+  0x3C, 0x10, 0x00, 0x07, 0x07, 0x80, 0x00, 0x01, 0x01, 0x03, 0xAA, 0x00, 0x02, 0xB4, 0x00, 0x82,
+  0x80, 0x88, 0x00, 0x82, 0x80, 0xDF, 0x00, 0x80, 0xF8, 0x80, 0xFC, 0x01, 0xFE, 0xFE, 0x84, 0xFF,
+  0x86, 0x00, 0x84, 0xFF, 0x01, 0xFE, 0xFE, 0x80, 0xFC, 0x80, 0xF8, 0xD6, 0x00, 0x01, 0xEF, 0xEF,
+  0x80, 0x07, 0x09, 0x87, 0xEF, 0x07, 0x07, 0xFF, 0x1F, 0x07, 0xFF, 0x0F, 0x01, 0x86, 0x00, 0x08,
+  0x03, 0x3F, 0x3F, 0x07, 0x7F, 0xFF, 0x07, 0x07, 0xDF, 0x81, 0x07, 0x01, 0x7F, 0x7F, 0xDB, 0x00,
+  0x08, 0x01, 0x01, 0x00, 0x06, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x88, 0x00, 0x08, 0x1E, 0x1E, 0x00,
+  0x0F, 0x0F, 0x04, 0x01, 0x03, 0x03, 0xAD, 0x00, 0x02, 0xB6, 0x00, 0x04, 0x80, 0x00, 0x00, 0x80,
+  0x80, 0xEE, 0x00, 0x00, 0x38, 0x80, 0xF8, 0x80, 0xFC, 0x01, 0xFE, 0xFE, 0x83, 0xFF, 0x00, 0xFE,
+  0x85, 0x00, 0x00, 0xFC, 0x83, 0xFF, 0x01, 0xFE, 0xFE, 0x80, 0xFC, 0x81, 0xF8, 0xD6, 0x00, 0x01,
+  0x87, 0x87, 0x80, 0x07, 0x09, 0x37, 0x3F, 0x07, 0xC7, 0xFF, 0xCF, 0x87, 0xFF, 0xC7, 0x01, 0x86,
+  0x00, 0x08, 0x03, 0xFF, 0x07, 0x87, 0xFF, 0xC7, 0x07, 0x7F, 0xFF, 0x80, 0x07, 0x01, 0x87, 0xC7,
+  0xD7, 0x00, 0x01, 0x03, 0x03, 0x80, 0x00, 0x08, 0x1C, 0x18, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x88, 0x00, 0x01, 0x0F, 0x0F, 0x80, 0x01, 0x83, 0x00, 0x01, 0x01, 0x03, 0xA7, 0x00, 0x02,
+  0xFF, 0x00, 0xAB, 0x00, 0x01, 0xF0, 0xF0, 0x81, 0xF8, 0x01, 0xFC, 0xFC, 0x83, 0xFE, 0x00, 0x7C,
+  0x85, 0x00, 0x00, 0xFC, 0x83, 0xFE, 0x01, 0xFC, 0xFC, 0x80, 0xF8, 0x80, 0xF0, 0xD7, 0x00, 0x01,
+  0x73, 0x7B, 0x80, 0x07, 0x08, 0xC7, 0xCF, 0x07, 0x07, 0x3F, 0x07, 0x87, 0xF7, 0x03, 0x86, 0x00,
+  0x08, 0x01, 0x73, 0x7F, 0x07, 0x37, 0x3F, 0x07, 0x07, 0x0F, 0x81, 0x07, 0x01, 0x1F, 0x1B, 0xE2,
+  0x00, 0x02, 0x01, 0x03, 0x01, 0x87, 0x00, 0x08, 0x18, 0x1C, 0x00, 0x18, 0x3C, 0x00, 0x00, 0x0F,
+  0x0C, 0xAC, 0x00, 0x02, 0xFF, 0x00, 0xA9, 0x00, 0x82, 0xE0, 0x80, 0xF0, 0x84, 0xF8, 0x85, 0x00,
+  0x01, 0xF0, 0xF0, 0x82, 0xF8, 0x81, 0xF0, 0x81, 0xE0, 0xD8, 0x00, 0x01, 0x03, 0x03, 0x80, 0x07,
+  0x08, 0xFF, 0x17, 0x07, 0x17, 0x3F, 0x07, 0x1F, 0x1F, 0x01, 0x86, 0x00, 0x07, 0x03, 0x0F, 0x07,
+  0x37, 0x37, 0x07, 0x07, 0x7F, 0x81, 0x07, 0x01, 0xC3, 0x01, 0xEF, 0x00, 0x01, 0x0C, 0x0E, 0x87,
+  0x00, 0x00, 0x03, 0xAA, 0x00,
+};
+
+const uint8_t CRY_FRAME_COUNT = 25;
+
+#endif // CRY_128X32_H
@@ -0,0 +1,198 @@
+// Generated by clipenc from driving.h - do not edit.
+// Keyframe + XOR-delta clip, see RideBuddyClip.h for the format.
+// Fitted to a 128x32 panel.
+#ifndef DRIVING_128X32_H
+#define DRIVING_128X32_H
+
+#include "../../RideBuddyClip.h"
+
+const uint8_t driving_clip[] PROGMEM = {
+  0x52, 0x43, 0x02, 0x19, 0x0C, 0x10, 0x04, 0x00, 0x6C, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x00,
+  0x2F, 0x01, 0x00, 0x00, 0x9A, 0x01, 0x00, 0x00, 0x15, 0x02, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00,
+  0xA5, 0x02, 0x00, 0x00, 0x1C, 0x03, 0x00, 0x00, 0xA6, 0x03, 0x00, 0x00, 0x32, 0x04, 0x00, 0x00,
+  0xB7, 0x04, 0x00, 0x00, 0x09, 0x05, 0x00, 0x00, 0x8E, 0x05, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00,
+  0x92, 0x06, 0x00, 0x00, 0xE8, 0x06, 0x00, 0x00, 0x6A, 0x07, 0x00, 0x00, 0xBC, 0x07, 0x00, 0x00,
+  0x10, 0x08, 0x00, 0x00, 0x9A, 0x08, 0x00, 0x00, 0x1A, 0x09, 0x00, 0x00, 0xA1, 0x09, 0x00, 0x00,
+  0x21, 0x0A, 0x00, 0x00, 0x92, 0x0A, 0x00, 0x00, 0xED, 0x0A, 0x00, 0x00, 0x02, 0xAF, 0x00, 0x01,
+  0xC0, 0xC0, 0x83, 0x80, 0x89, 0x00, 0x83, 0x80, 0x01, 0xC0, 0xC0, 0xE0, 0x00, 0x00, 0x07, 0x80,
+  0x0F, 0x80, 0x8F, 0x81, 0xCF, 0x01, 0xEF, 0xEF, 0x81, 0xE0, 0x01, 0xEF, 0xEF, 0x81, 0xCF, 0x01,
+  0x8F, 0x8F, 0x81, 0x0F, 0x00, 0x07, 0xDA, 0x00, 0x0C, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFC, 0x3E,
+  0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x82, 0x03, 0x81, 0x01, 0x81, 0x03, 0x80, 0x07, 0x0A, 0x0F,
+  0x1F, 0x1F, 0x3E, 0x7E, 0xFC, 0xF8, 0xF8, 0xF0, 0xC0, 0x80, 0xD2, 0x00, 0x01, 0xF0, 0xFE, 0x80,
+  0xFF, 0x02, 0x7F, 0x7B, 0x79, 0x80, 0xF0, 0x07, 0xB0, 0xE0, 0x60, 0x60, 0xE0, 0xC0, 0xE0, 0xE0,
+  0x84, 0xF0, 0x82, 0xE0, 0x09, 0x60, 0xE0, 0xF0, 0xB0, 0xF0, 0xF0, 0xF8, 0x79, 0x7F, 0x7F, 0x80,
+  0xFF, 0x01, 0xFC, 0xC0, 0xA6, 0x00, 0x03, 0xAE, 0x00, 0x00, 0x80, 0x98, 0x00, 0x00, 0x40, 0xEB,
+  0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x20, 0xFA, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x08, 0x81,
+  0x00, 0x04, 0x80, 0x00, 0x00, 0x08, 0x10, 0xD9, 0x00, 0x02, 0xF0, 0xF8, 0xF8, 0x80, 0x70, 0x06,
+  0x30, 0x60, 0xE0, 0xE0, 0x60, 0x40, 0x20, 0x85, 0x00, 0x80, 0x10, 0x10, 0x18, 0x1C, 0x9C, 0x9E,
+  0xCE, 0x8F, 0xEF, 0xFF, 0xF7, 0x7E, 0x78, 0x40, 0x00, 0x00, 0x01, 0x04, 0x40, 0xA6, 0x00, 0x03,
+  0xAF, 0x00, 0x01, 0x40, 0x40, 0x82, 0x00, 0x00, 0x80, 0x8F, 0x00, 0x05, 0x40, 0x00, 0x80, 0x00,
+  0x80, 0x80, 0xDC, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x20, 0x80, 0x00, 0x01, 0x20, 0x20, 0x81,
+  0x00, 0x02, 0x40, 0x00, 0x00, 0x80, 0x10, 0x04, 0x00, 0x06, 0x02, 0x00, 0x01, 0xD6, 0x00, 0x00,
+  0x80, 0x82, 0x00, 0x00, 0x80, 0x84, 0x00, 0x00, 0x04, 0x81, 0x00, 0x80, 0x02, 0x81, 0x00, 0x08,
+  0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xE0, 0x20, 0x00, 0x80, 0xE1, 0x00, 0x00, 0x80, 0x86, 0x00, 0x00,
+  0x10, 0x81, 0x00, 0x0F, 0x08, 0x0C, 0x0E, 0x0F, 0x07, 0xC5, 0x62, 0x7B, 0xFD, 0x3E, 0x3F, 0x1F,
+  0x0F, 0x0E, 0x04, 0x08, 0x82, 0x00, 0x00, 0x80, 0xA6, 0x00, 0x03, 0xB5, 0x00, 0x00, 0x80, 0x8A,
+  0x00, 0x01, 0x80, 0x80, 0x84, 0x00, 0x01, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0xD8, 0x00, 0x80,
+  0x10, 0x03, 0x90, 0x10, 0x10, 0x50, 0x81, 0x10, 0x00, 0x00, 0x80, 0x20, 0x01, 0x00, 0x00, 0x80,
+  0x10, 0x00, 0x50, 0x80, 0x10, 0x80, 0x00, 0x0D, 0x10, 0x00, 0x02, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0xCD, 0x00, 0x00, 0x80, 0x82, 0x00, 0x04, 0x80, 0x40, 0x01,
+  0x00, 0x10, 0x88, 0x00, 0x0C, 0x80, 0xF0, 0x7C, 0xDC, 0x7C, 0xF8, 0xE0, 0xF0, 0xF0, 0xE0, 0x00,
+  0x00, 0x02, 0x82, 0x00, 0x00, 0x80, 0xD6, 0x00, 0x00, 0x80, 0x81, 0xB0, 0x00, 0x20, 0x80, 0xE0,
+  0x03, 0x60, 0x60, 0xC0, 0x40, 0x82, 0x00, 0x0A, 0x08, 0x0E, 0x07, 0x07, 0x02, 0x00, 0x70, 0xBD,
+  0x9E, 0x87, 0x83, 0xB3, 0x00, 0x03, 0xAE, 0x00, 0x00, 0x80, 0x82, 0x00, 0x00, 0x80, 0x94, 0x00,
+  0x01, 0x40, 0xC0, 0xE9, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x80, 0xE3,
+  0x00, 0x00, 0x04, 0x82, 0x00, 0x02, 0x30, 0x70, 0x60, 0x82, 0x00, 0x08, 0xF0, 0xFC, 0x0C, 0x7C,
+  0x0C, 0x7C, 0xDC, 0xF8, 0x38, 0x81, 0x00, 0x02, 0x01, 0x40, 0x80, 0xDD, 0x00, 0x81, 0x30, 0x00,
+  0x20, 0x80, 0x60, 0x10, 0xE0, 0xE0, 0x43, 0x4F, 0x3E, 0x18, 0x10, 0x00, 0x0F, 0x07, 0x06, 0x00,
+  0x04, 0x1C, 0x3F, 0x07, 0x80, 0xB6, 0x00, 0x03, 0xCB, 0x00, 0x02, 0x80, 0x40, 0x40, 0xF2, 0x00,
+  0x03, 0x40, 0x00, 0x00, 0x80, 0x83, 0x00, 0x00, 0x01, 0xE1, 0x00, 0x03, 0x10, 0x30, 0x70, 0x60,
+  0x82, 0x00, 0x04, 0x0C, 0x00, 0xF0, 0x00, 0xFC, 0x85, 0x00, 0x02, 0x01, 0x40, 0x80, 0x82, 0x00,
+  0x00, 0x80, 0xD6, 0x00, 0x00, 0x80, 0x87, 0x00, 0x05, 0x03, 0x8F, 0x3E, 0x18, 0x10, 0x0E, 0x95,
+  0x00, 0x00, 0x80, 0xA6, 0x00, 0x03, 0xAE, 0x00, 0x00, 0x80, 0x82, 0x00, 0x01, 0x80, 0x80, 0x8A,
+  0x00, 0x01, 0x80, 0x80, 0x83, 0x00, 0x02, 0x80, 0xC0, 0xC0, 0xE1, 0x00, 0x08, 0x80, 0x00, 0x40,
+  0x40, 0x20, 0x00, 0x00, 0x30, 0x29, 0x81, 0x20, 0x00, 0x21, 0x81, 0x00, 0x01, 0x40, 0x00, 0x82,
+  0x10, 0xDA, 0x00, 0x00, 0x80, 0x81, 0x00, 0x0D, 0x04, 0x82, 0x40, 0x21, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x18, 0xDC, 0xF8, 0xF0, 0xC0, 0x81, 0xFE, 0x80, 0x00, 0x08, 0x84, 0xC0, 0xE0, 0xF0, 0xF0,
+  0xE0, 0x00, 0x00, 0x02, 0xD7, 0x00, 0x01, 0x80, 0x08, 0x80, 0x00, 0x03, 0xC0, 0x08, 0x00, 0x01,
+  0x85, 0x00, 0x10, 0x80, 0x03, 0x1F, 0x1F, 0x01, 0x00, 0x03, 0x08, 0x07, 0x07, 0x1C, 0x3F, 0x77,
+  0x7F, 0x1E, 0x0F, 0x03, 0x81, 0x00, 0x02, 0x01, 0x00, 0x08, 0xAC, 0x00, 0x02, 0xAE, 0x00, 0x83,
+  0xC0, 0x83, 0x80, 0x82, 0x00, 0x83, 0x80, 0x83, 0xC0, 0x05, 0x80, 0x40, 0x40, 0x80, 0x00, 0x00,
+  0x80, 0x80, 0xD7, 0x00, 0x03, 0x07, 0x0F, 0x8F, 0x8F, 0x80, 0xCF, 0x82, 0xEF, 0x00, 0xE0, 0x80,
+  0xF0, 0x01, 0xE0, 0xE7, 0x81, 0xEF, 0x80, 0xCF, 0x10, 0x8F, 0x8F, 0x0F, 0x0F, 0x01, 0x02, 0x02,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0xCD, 0x00, 0x0E, 0xC0, 0xE0, 0xF0,
+  0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x1F, 0x3F, 0x77, 0x67, 0xC3, 0x83, 0x83, 0x88, 0x01, 0x80, 0x03,
+  0x0B, 0x07, 0x07, 0x0F, 0x1F, 0x3F, 0x3F, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0xD1, 0x00, 0x01,
+  0xE0, 0xFC, 0x80, 0xFF, 0x02, 0x9F, 0x83, 0x81, 0x84, 0x80, 0x05, 0x83, 0x87, 0xCF, 0xFF, 0xFE,
+  0xFC, 0x82, 0xF8, 0x82, 0xF0, 0x04, 0xF8, 0xD8, 0xF8, 0x6C, 0x7C, 0x80, 0x3E, 0x80, 0x3F, 0x80,
+  0xFF, 0x01, 0xFC, 0x80, 0xA6, 0x00, 0x03, 0xAF, 0x00, 0x01, 0x20, 0x20, 0x80, 0x00, 0x80, 0x40,
+  0x80, 0x00, 0x00, 0x80, 0x85, 0x00, 0x01, 0x40, 0x40, 0x81, 0x00, 0x01, 0x20, 0x20, 0xE1, 0x00,
+  0x07, 0x88, 0x08, 0x48, 0x08, 0x08, 0x28, 0x08, 0x08, 0x80, 0x18, 0x00, 0x13, 0x80, 0x00, 0x0C,
+  0x10, 0x10, 0x18, 0x18, 0x08, 0x08, 0x28, 0x08, 0x08, 0x48, 0x08, 0x88, 0x08, 0xD9, 0x00, 0x04,
+  0x80, 0x00, 0x00, 0x08, 0x04, 0x81, 0x00, 0x08, 0x10, 0x38, 0x70, 0x64, 0xC0, 0x82, 0x82, 0x00,
+  0x00, 0x84, 0x01, 0x11, 0x00, 0x00, 0x02, 0x02, 0x00, 0x04, 0x00, 0x00, 0x10, 0x20, 0x00, 0x80,
+  0x00, 0x04, 0x08, 0x00, 0x00, 0x80, 0xD5, 0x00, 0x0F, 0x80, 0x9C, 0x9E, 0xBE, 0xBE, 0xFE, 0xFC,
+  0x7C, 0x5C, 0x78, 0x7B, 0x7F, 0x3F, 0x0F, 0x0E, 0x04, 0x82, 0x00, 0x0A, 0x08, 0x00, 0x00, 0x10,
+  0x10, 0x18, 0x38, 0x18, 0x8C, 0xCC, 0x8E, 0x80, 0xCE, 0x01, 0xCC, 0x40, 0x81, 0x00, 0x00, 0x40,
+  0xA6, 0x00, 0x03, 0xAE, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x20, 0x82, 0x00, 0x00, 0x40, 0x84, 0x00,
+  0x00, 0x80, 0x88, 0x00, 0x00, 0x40, 0xDF, 0x00, 0x03, 0x07, 0x80, 0x00, 0x40, 0x82, 0x00, 0x03,
+  0x10, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x07, 0x82, 0x00, 0x00, 0x20, 0x82, 0x00, 0x00, 0x06,
+  0xD8, 0x00, 0x0E, 0x80, 0x40, 0x00, 0x08, 0x04, 0x00, 0x80, 0x41, 0xE0, 0xF0, 0xE8, 0xE0, 0xC4,
+  0x80, 0x02, 0x80, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x83, 0x00, 0x09, 0x08, 0x00, 0x00,
+  0x20, 0x01, 0x02, 0x00, 0x00, 0x10, 0x20, 0xD1, 0x00, 0x13, 0xE0, 0x0C, 0x01, 0x00, 0x00, 0xE0,
+  0xD8, 0xDE, 0xFE, 0xFE, 0x7E, 0xBD, 0x3F, 0x1B, 0x27, 0x27, 0x87, 0x07, 0x0E, 0x0C, 0x84, 0x00,
+  0x04, 0x08, 0x00, 0x00, 0x20, 0x60, 0x80, 0xE0, 0x06, 0xB0, 0xB0, 0xF0, 0xF0, 0xF1, 0xF2, 0x78,
+  0x80, 0x00, 0x01, 0x03, 0x38, 0xA6, 0x00, 0x03, 0xB2, 0x00, 0x00, 0x20, 0x82, 0x00, 0x00, 0x40,
+  0x86, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0x20, 0xEB, 0x00, 0x00, 0x10, 0x87, 0x00, 0x00, 0x10,
+  0x82, 0x00, 0x00, 0x40, 0xE2, 0x00, 0x06, 0x81, 0x20, 0x70, 0x60, 0xE0, 0xC4, 0x80, 0x81, 0x00,
+  0x00, 0x01, 0x89, 0x00, 0x05, 0x04, 0x00, 0x00, 0x10, 0x00, 0x40, 0xD7, 0x00, 0x01, 0x08, 0x01,
+  0x80, 0x00, 0x0D, 0xC0, 0xC0, 0xC3, 0xC3, 0x07, 0xCE, 0xDC, 0xDC, 0xE0, 0xA1, 0x91, 0x0B, 0x06,
+  0x04, 0x88, 0x00, 0x00, 0x40, 0x87, 0xC0, 0xAB, 0x00, 0x03, 0xAE, 0x00, 0x00, 0xC0, 0x81, 0x00,
+  0x00, 0x20, 0x82, 0x00, 0x00, 0x40, 0x82, 0x00, 0x02, 0x80, 0x40, 0x40, 0x82, 0x00, 0x00, 0x20,
+  0xE3, 0x00, 0x08, 0x03, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x10, 0x80, 0x00, 0x00, 0x04,
+  0x81, 0x00, 0x00, 0x03, 0x85, 0x00, 0x03, 0x40, 0x00, 0x00, 0x04, 0xD8, 0x00, 0x0A, 0x80, 0x40,
+  0x00, 0x08, 0x04, 0x02, 0x80, 0xC0, 0xC0, 0x80, 0x88, 0x80, 0x00, 0x03, 0x02, 0x00, 0x00, 0x01,
+  0x85, 0x00, 0x03, 0x01, 0x00, 0x00, 0x02, 0x81, 0x00, 0x02, 0x10, 0x00, 0xC0, 0xD6, 0x00, 0x01,
+  0x80, 0x04, 0x81, 0x00, 0x0C, 0xF4, 0xF0, 0xF3, 0xF3, 0xB7, 0xBF, 0xFF, 0xFB, 0xDF, 0x9E, 0x0E,
+  0x1C, 0x08, 0x80, 0x00, 0x81, 0x04, 0x0F, 0x00, 0x00, 0x08, 0x18, 0x38, 0x3C, 0xAC, 0xBE, 0xF6,
+  0xFE, 0xDF, 0xDF, 0xCF, 0xC7, 0xC6, 0xC8, 0x80, 0x00, 0x01, 0x01, 0x18, 0xA6, 0x00, 0x02, 0xAE,
+  0x00, 0x00, 0xC0, 0x80, 0xE0, 0x83, 0xC0, 0x01, 0x80, 0x80, 0x82, 0x00, 0x01, 0x80, 0x80, 0x83,
+  0xC0, 0x81, 0xE0, 0x05, 0x80, 0x40, 0x40, 0x80, 0x00, 0x00, 0x80, 0x80, 0xD7, 0x00, 0x04, 0x07,
+  0x87, 0x87, 0xC7, 0xC7, 0x81, 0xE7, 0x80, 0xF7, 0x82, 0xF0, 0x80, 0xF7, 0x80, 0xE7, 0x80, 0xC7,
+  0x0F, 0x87, 0x87, 0x07, 0x01, 0x02, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0xCC, 0x00, 0x0D, 0x80, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0x7E, 0x3F, 0x1F, 0x0F, 0x07, 0x07,
+  0x03, 0x03, 0x80, 0x01, 0x85, 0x00, 0x10, 0x01, 0x01, 0x81, 0xC1, 0xE3, 0x73, 0xFF, 0xFF, 0x7F,
+  0x3F, 0x3F, 0x7E, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0xD1, 0x00, 0x01, 0xF0, 0xFE, 0x80, 0xFF, 0x01,
+  0x0F, 0x03, 0x85, 0x00, 0x03, 0x80, 0x80, 0xE0, 0xF0, 0x83, 0xF8, 0x09, 0xFC, 0xFC, 0xFE, 0xFF,
+  0xFB, 0x3D, 0x0E, 0x07, 0x03, 0x01, 0x81, 0x00, 0x02, 0x01, 0x07, 0x3F, 0x80, 0xFF, 0x00, 0xFC,
+  0xA7, 0x00, 0x03, 0xB1, 0x00, 0x00, 0x20, 0x82, 0x00, 0x00, 0x40, 0x86, 0x00, 0x00, 0x40, 0x82,
+  0x00, 0x06, 0x20, 0x00, 0x00, 0x20, 0x80, 0x40, 0x40, 0x80, 0x00, 0x80, 0x80, 0xEA, 0x00, 0x00,
+  0x10, 0x82, 0x00, 0x10, 0x40, 0x00, 0x80, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0xDD, 0x00, 0x00, 0x01, 0x80, 0x00, 0x0F, 0xC0, 0xF8, 0x7F, 0xEF,
+  0xFE, 0x3E, 0x80, 0xC0, 0xE0, 0x70, 0xF8, 0xF0, 0x70, 0x20, 0x00, 0x80, 0x81, 0x00, 0x00, 0x40,
+  0xD7, 0x00, 0x00, 0x02, 0x85, 0x00, 0x00, 0x80, 0x83, 0x00, 0x0C, 0x06, 0x07, 0x07, 0x00, 0x03,
+  0x01, 0x1F, 0x3B, 0x3D, 0x0E, 0x07, 0x03, 0x01, 0x83, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x04,
+  0xA7, 0x00, 0x03, 0xB0, 0x00, 0x00, 0x20, 0x9A, 0x00, 0x00, 0x80, 0xE1, 0x00, 0x00, 0x20, 0x80,
+  0x00, 0x00, 0x10, 0x90, 0x00, 0x03, 0x01, 0x00, 0x00, 0x01, 0xD6, 0x00, 0x00, 0x20, 0x80, 0x00,
+  0x00, 0x02, 0x8C, 0x00, 0x06, 0xC0, 0x18, 0x81, 0xD0, 0x08, 0xC0, 0x0E, 0x85, 0x00, 0x00, 0x80,
+  0x81, 0x00, 0x00, 0x40, 0xD1, 0x00, 0x01, 0x10, 0x02, 0x80, 0x00, 0x01, 0x10, 0x02, 0x86, 0x00,
+  0x0C, 0x80, 0x20, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x13, 0x89, 0x00,
+  0x00, 0x60, 0x80, 0x00, 0x00, 0x04, 0xA7, 0x00, 0x02, 0xAE, 0x00, 0x00, 0xC0, 0x81, 0xE0, 0x84,
+  0xC0, 0x00, 0x80, 0x81, 0x00, 0x00, 0x80, 0x83, 0xC0, 0x82, 0xE0, 0x00, 0xC0, 0xDF, 0x00, 0x04,
+  0x03, 0x87, 0x87, 0xC7, 0xC7, 0x80, 0xE7, 0x81, 0xF7, 0x00, 0xF3, 0x81, 0xF0, 0x00, 0xF3, 0x81,
+  0xF7, 0x80, 0xE7, 0x04, 0xC7, 0xC7, 0x87, 0x87, 0x03, 0xD8, 0x00, 0x0C, 0x80, 0xC0, 0xF0, 0xF8,
+  0xFC, 0xFE, 0x7E, 0x3F, 0x1F, 0x0F, 0x07, 0x07, 0x03, 0x80, 0x01, 0x81, 0x00, 0x81, 0xFF, 0x12,
+  0x00, 0x00, 0x80, 0xC0, 0xA1, 0x71, 0x3B, 0x1F, 0x0F, 0x07, 0x0F, 0x1F, 0x3F, 0xFE, 0xFC, 0xF8,
+  0xF0, 0xE0, 0x80, 0xD1, 0x00, 0x00, 0xFC, 0x80, 0xFF, 0x01, 0x3F, 0x03, 0x83, 0x00, 0x80, 0x80,
+  0x07, 0xC0, 0xC0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0xFE, 0x82, 0xFF, 0x01, 0xE3, 0x01, 0x86, 0x00,
+  0x01, 0x01, 0x0F, 0x80, 0xFF, 0x01, 0xFE, 0xF0, 0xA6, 0x00, 0x03, 0xB3, 0x00, 0x00, 0x20, 0x83,
+  0x00, 0x00, 0x40, 0x81, 0x00, 0x00, 0x40, 0xFF, 0x00, 0x85, 0x00, 0x00, 0x80, 0xDB, 0x00, 0x00,
+  0x10, 0x85, 0x00, 0x19, 0x04, 0x00, 0x00, 0x06, 0x3E, 0xFB, 0xDF, 0x7F, 0xF7, 0x0F, 0x7F, 0xFF,
+  0xFF, 0x00, 0x00, 0x80, 0xC1, 0xA0, 0x70, 0x38, 0x1C, 0x08, 0x08, 0x00, 0x00, 0x40, 0xE3, 0x00,
+  0x80, 0x80, 0x0E, 0xC0, 0x00, 0x07, 0x07, 0x06, 0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F,
+  0x03, 0x01, 0x86, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x10, 0xA6, 0x00, 0x03, 0xAE, 0x00, 0x00,
+  0x20, 0x82, 0x00, 0x01, 0x20, 0x20, 0x8B, 0x00, 0x01, 0x20, 0x20, 0xE7, 0x00, 0x05, 0x40, 0x00,
+  0x20, 0x00, 0x00, 0x10, 0x91, 0x00, 0x01, 0x80, 0x02, 0xD3, 0x00, 0x80, 0x80, 0x04, 0x00, 0x80,
+  0x00, 0x00, 0x10, 0x80, 0x00, 0x0F, 0x01, 0x00, 0x10, 0x08, 0x00, 0x0C, 0x3C, 0xFE, 0xF8, 0x86,
+  0x0B, 0x1F, 0xFF, 0xF7, 0xF0, 0x80, 0xE2, 0x00, 0x03, 0x03, 0x02, 0x00, 0xC0, 0x81, 0x00, 0x02,
+  0x20, 0x00, 0x01, 0x85, 0x00, 0x07, 0x03, 0x3F, 0x08, 0x00, 0x01, 0x00, 0x01, 0x03, 0xBD, 0x00,
+  0x02, 0xAE, 0x00, 0x00, 0xE0, 0x82, 0xF0, 0x83, 0xE0, 0x00, 0xC0, 0x81, 0x00, 0x00, 0xC0, 0x83,
+  0xE0, 0x82, 0xF0, 0x00, 0xE0, 0xDF, 0x00, 0x04, 0x81, 0xC3, 0xC3, 0xE3, 0xE3, 0x81, 0xF3, 0x03,
+  0xFB, 0x7B, 0x7B, 0x79, 0x81, 0x78, 0x03, 0x79, 0x7B, 0xFB, 0xFB, 0x80, 0xF3, 0x05, 0xE3, 0xE3,
+  0xC3, 0xC3, 0x83, 0x01, 0xD3, 0x00, 0x12, 0x80, 0x00, 0x80, 0x00, 0x80, 0xC0, 0xE0, 0xF8, 0xFC,
+  0xFE, 0x7F, 0xFF, 0xFF, 0xEF, 0xE7, 0xC3, 0xC3, 0x81, 0x01, 0x8C, 0x00, 0x0D, 0x01, 0x01, 0x03,
+  0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFE, 0xFC, 0xF8, 0xE0, 0xC0, 0xCD, 0x00, 0x04, 0x03, 0x02,
+  0x00, 0xC0, 0xFE, 0x80, 0xFF, 0x0D, 0x0F, 0x01, 0x01, 0x00, 0x01, 0x03, 0x07, 0x07, 0x0F, 0x1F,
+  0x3B, 0x7F, 0xFE, 0xFE, 0x80, 0xFC, 0x80, 0xFE, 0x80, 0xFC, 0x03, 0xF8, 0xF0, 0xE0, 0xE0, 0x85,
+  0xC0, 0x01, 0xC1, 0xC7, 0x81, 0xFF, 0x00, 0xF0, 0xA6, 0x00, 0x02, 0xAE, 0x00, 0x84, 0xF0, 0x82,
+  0xE0, 0x82, 0x00, 0x83, 0xE0, 0x83, 0xF0, 0xDF, 0x00, 0x04, 0x80, 0x81, 0xC3, 0xE3, 0xE3, 0x80,
+  0xF3, 0x01, 0xFB, 0xFB, 0x80, 0x7B, 0x82, 0x78, 0x03, 0x79, 0x7B, 0x7B, 0xFB, 0x80, 0xF3, 0x04,
+  0xE3, 0xE3, 0xC3, 0xC3, 0x83, 0xD6, 0x00, 0x0F, 0x80, 0x00, 0x80, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE,
+  0x7F, 0x1F, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x01, 0x8D, 0x00, 0x0D, 0x01, 0x01, 0x03, 0x03, 0x07,
+  0x0F, 0x1F, 0x3F, 0xFF, 0xFE, 0xFC, 0xF0, 0xE0, 0x80, 0xCD, 0x00, 0x03, 0x01, 0x01, 0x00, 0xF8,
+  0x81, 0xFF, 0x05, 0x1F, 0x1E, 0x1F, 0x3E, 0x3C, 0x3C, 0x80, 0x7C, 0x00, 0xD8, 0x81, 0xF8, 0x01,
+  0xFC, 0xFC, 0x82, 0xFE, 0x01, 0xFC, 0xFC, 0x80, 0xF8, 0x07, 0xFC, 0x6C, 0x7C, 0x3E, 0x36, 0x1E,
+  0x1E, 0x1F, 0x80, 0x0F, 0x80, 0xFF, 0x00, 0xFE, 0xA7, 0x00, 0x03, 0xAF, 0x00, 0x01, 0x08, 0x08,
+  0x81, 0x00, 0x01, 0x10, 0x10, 0x80, 0x00, 0x00, 0xE0, 0x85, 0x00, 0x01, 0x10, 0x10, 0x83, 0x00,
+  0x00, 0xE0, 0xDF, 0x00, 0x00, 0x40, 0x82, 0x02, 0x06, 0x0A, 0x02, 0x82, 0x02, 0x02, 0x06, 0x04,
+  0x80, 0x44, 0x0D, 0x04, 0x04, 0x02, 0x02, 0x82, 0x0A, 0x02, 0x02, 0x12, 0x02, 0x22, 0x02, 0x42,
+  0x80, 0xD3, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x20, 0x85, 0x00, 0x00, 0x04, 0x90, 0x00, 0x07,
+  0x01, 0x00, 0x82, 0x80, 0xC0, 0xC8, 0xD0, 0xC0, 0x80, 0x00, 0x02, 0x08, 0x10, 0x40, 0xCD, 0x00,
+  0x02, 0x02, 0x03, 0x01, 0x82, 0x00, 0x05, 0xE0, 0xE7, 0xE6, 0xEE, 0xCC, 0xCC, 0x80, 0x8C, 0x02,
+  0x68, 0x08, 0x08, 0x80, 0x00, 0x00, 0x02, 0x82, 0x00, 0x0F, 0x02, 0x00, 0x04, 0x06, 0x86, 0xC3,
+  0x77, 0x63, 0x33, 0x31, 0x19, 0x1D, 0x1E, 0x0E, 0x0E, 0x08, 0x80, 0x00, 0x01, 0x01, 0xE0, 0xA6,
+  0x00, 0x02, 0xAE, 0x00, 0x84, 0xF8, 0x82, 0xF0, 0x82, 0x00, 0x82, 0xF0, 0x84, 0xF8, 0xDD, 0x00,
+  0x0A, 0x80, 0x80, 0xC0, 0xE0, 0xE1, 0xF1, 0xF1, 0xF9, 0xF9, 0x79, 0x7D, 0x80, 0x3D, 0x84, 0x3C,
+  0x0C, 0x3D, 0x3D, 0x7D, 0x79, 0xF9, 0xF9, 0xF1, 0xF1, 0xE1, 0xE1, 0xC0, 0x80, 0x80, 0xD2, 0x00,
+  0x0F, 0x80, 0x00, 0x80, 0x00, 0xC0, 0xF0, 0xF8, 0xFE, 0xFF, 0x7F, 0x1F, 0x0F, 0x07, 0x03, 0x01,
+  0x01, 0x8C, 0x00, 0x10, 0x80, 0x80, 0xC0, 0xE0, 0xF0, 0xB1, 0xF9, 0xFF, 0x7F, 0x3F, 0x1F, 0x7F,
+  0xFF, 0xFE, 0xF8, 0xF0, 0xC0, 0xCD, 0x00, 0x03, 0x03, 0x02, 0x00, 0xFE, 0x81, 0xFF, 0x02, 0xE1,
+  0xE0, 0xE1, 0x81, 0xE0, 0x01, 0xB0, 0xB0, 0x80, 0xF0, 0x02, 0xF8, 0xFE, 0xFE, 0x86, 0xFF, 0x05,
+  0xFD, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x82, 0x00, 0x01, 0x01, 0x9F, 0x80, 0xFF, 0x00, 0xFE, 0xA7,
+  0x00, 0x03, 0xAF, 0x00, 0x01, 0x04, 0x04, 0x81, 0x00, 0x01, 0x08, 0x08, 0x88, 0x00, 0x01, 0x08,
+  0x08, 0x81, 0x00, 0x80, 0x04, 0xDE, 0x00, 0x0C, 0x40, 0x00, 0x00, 0x11, 0x01, 0x09, 0x01, 0x81,
+  0x05, 0x41, 0x01, 0x01, 0x03, 0x83, 0x22, 0x0C, 0x02, 0x03, 0x01, 0x41, 0x05, 0x85, 0x01, 0x09,
+  0x01, 0x11, 0x01, 0x20, 0x40, 0xE2, 0x00, 0x00, 0x01, 0x8D, 0x00, 0x0F, 0x40, 0x20, 0x80, 0x00,
+  0x49, 0x00, 0x90, 0x40, 0x20, 0x00, 0x40, 0x00, 0x00, 0x04, 0x00, 0x20, 0xD0, 0x00, 0x00, 0x02,
+  0x81, 0x00, 0x02, 0x02, 0x00, 0x10, 0x81, 0x50, 0x04, 0x00, 0x00, 0x40, 0x00, 0x08, 0x89, 0x00,
+  0x05, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x82, 0x00, 0x01, 0x01, 0x98, 0x80, 0x00, 0x00, 0x01,
+  0xA7, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x70, 0x84, 0x00, 0x00, 0x08, 0x82, 0x00, 0x02, 0x04, 0x00,
+  0x04, 0xDE, 0x00, 0x05, 0x40, 0x00, 0x00, 0x10, 0x00, 0x08, 0x80, 0x00, 0x04, 0x40, 0x00, 0x00,
+  0x02, 0x20, 0x83, 0x00, 0x00, 0x02, 0xE2, 0x00, 0x04, 0x40, 0x00, 0x00, 0x02, 0x01, 0x83, 0x00,
+  0x00, 0x01, 0x8C, 0x00, 0x0A, 0x80, 0x40, 0x20, 0xA0, 0x10, 0x18, 0x48, 0x94, 0xC0, 0x60, 0x20,
+  0x81, 0x00, 0x02, 0x08, 0x00, 0x80, 0xD4, 0x00, 0x02, 0x90, 0x10, 0x00, 0x84, 0x40, 0x80, 0x00,
+  0x00, 0x02, 0x88, 0x00, 0x05, 0x13, 0x09, 0x04, 0x02, 0x01, 0x01, 0xB1, 0x00, 0x02, 0xAE, 0x00,
+  0x00, 0xF0, 0x82, 0xF8, 0x84, 0xF0, 0x81, 0x00, 0x84, 0xF0, 0x82, 0xF8, 0xDE, 0x00, 0x0A, 0x80,
+  0xC0, 0xC0, 0xE1, 0xE1, 0xF1, 0xF1, 0xF9, 0xF9, 0x79, 0x7D, 0x80, 0x3D, 0x83, 0x3C, 0x0C, 0x3D,
+  0x7D, 0x7D, 0x79, 0xF9, 0xF9, 0xF1, 0xF1, 0xE1, 0xE1, 0xC1, 0x80, 0x80, 0xD2, 0x00, 0x10, 0x80,
+  0x00, 0x80, 0x00, 0x80, 0xE0, 0xF8, 0xFC, 0xFE, 0xFF, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x01,
+  0x8C, 0x00, 0x0F, 0x80, 0x80, 0xC0, 0xE0, 0x61, 0xB1, 0xFB, 0xFF, 0x7F, 0x3F, 0x3F, 0xFF, 0xFE,
+  0xF8, 0xF0, 0xC0, 0xCD, 0x00, 0x03, 0x03, 0x02, 0x00, 0xF8, 0x81, 0xFF, 0x02, 0xE7, 0xE0, 0xE1,
+  0x81, 0xE0, 0x06, 0xF0, 0xB0, 0xB0, 0xF0, 0xF0, 0xF8, 0xFC, 0x80, 0xFE, 0x80, 0xFF, 0x01, 0xFE,
+  0xFE, 0x80, 0xFF, 0x05, 0x1D, 0x0F, 0x07, 0x03, 0x01, 0x01, 0x82, 0x00, 0x00, 0x07, 0x81, 0xFF,
+  0xA7, 0x00,
+};
+
+const uint8_t DRIVING_FRAME_COUNT = 25;
+
+#endif // DRIVING_128X32_H
@@ -0,0 +1,219 @@
+// Generated by clipenc from happy.h - do not edit.
+// Keyframe + XOR-delta clip, see RideBuddyClip.h for the format.
+// Fitted to a 128x32 panel.
+#ifndef HAPPY_128X32_H
+#define HAPPY_128X32_H
+
+#include "../../RideBuddyClip.h"
+
+const uint8_t happy_clip[] PROGMEM = {
+  0x52, 0x43, 0x02, 0x19, 0x0C, 0x10, 0x04, 0x00, 0x6C, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0x00,
+  0x32, 0x01, 0x00, 0x00, 0x9E, 0x01, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00, 0xA3, 0x02, 0x00, 0x00,
+  0x14, 0x03, 0x00, 0x00, 0x9B, 0x03, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00, 0x9E, 0x04, 0x00, 0x00,
+  0x21, 0x05, 0x00, 0x00, 0x9A, 0x05, 0x00, 0x00, 0x17, 0x06, 0x00, 0x00, 0xA2, 0x06, 0x00, 0x00,
+  0x21, 0x07, 0x00, 0x00, 0xA9, 0x07, 0x00, 0x00, 0x30, 0x08, 0x00, 0x00, 0xB1, 0x08, 0x00, 0x00,
+  0x32, 0x09, 0x00, 0x00, 0xBD, 0x09, 0x00, 0x00, 0x40, 0x0A, 0x00, 0x00, 0xC8, 0x0A, 0x00, 0x00,
+  0x4E, 0x0B, 0x00, 0x00, 0xD4, 0x0B, 0x00, 0x00, 0x54, 0x0C, 0x00, 0x00, 0x02, 0xAC, 0x00, 0x0D,
+  0xE0, 0xB0, 0x98, 0x98, 0x8C, 0x8C, 0x8E, 0x86, 0x86, 0x8E, 0x8E, 0x8C, 0x9C, 0x80, 0x82, 0x00,
+  0x07, 0x80, 0x98, 0x8C, 0x8C, 0x8E, 0x8E, 0x86, 0x86, 0x80, 0x8C, 0x03, 0x98, 0x90, 0xB0, 0xC0,
+  0xD9, 0x00, 0x04, 0xFE, 0xFF, 0xFF, 0x07, 0x03, 0x87, 0x01, 0x07, 0x03, 0xFF, 0xFE, 0x00, 0xF8,
+  0xFF, 0x07, 0x03, 0x87, 0x01, 0x00, 0x03, 0x80, 0xFF, 0x00, 0xFC, 0xD7, 0x00, 0x04, 0x3F, 0xFF,
+  0xFF, 0xF0, 0xE0, 0x86, 0xC0, 0x08, 0xE0, 0xE0, 0x7F, 0x3F, 0x00, 0x0F, 0x7F, 0xF0, 0xE0, 0x86,
+  0xC0, 0x05, 0xE0, 0xE0, 0xFF, 0xFF, 0x7F, 0x1F, 0xE3, 0x00, 0x02, 0x02, 0x03, 0x06, 0x84, 0x04,
+  0x02, 0x06, 0x02, 0x03, 0xB7, 0x00, 0x03, 0xAB, 0x00, 0x0F, 0x80, 0x40, 0x20, 0x00, 0x14, 0x00,
+  0x0A, 0x08, 0x00, 0x00, 0x08, 0x08, 0x00, 0x10, 0x00, 0x80, 0x82, 0x00, 0x0D, 0x10, 0x00, 0x02,
+  0x08, 0x08, 0x00, 0x00, 0x0A, 0x08, 0x00, 0x10, 0x08, 0x00, 0x40, 0xD9, 0x00, 0x04, 0x01, 0x00,
+  0x00, 0x04, 0x02, 0x8B, 0x00, 0x03, 0x04, 0x00, 0x00, 0x02, 0xE7, 0x00, 0x04, 0x80, 0x80, 0x00,
+  0x00, 0x20, 0x84, 0x00, 0x02, 0x20, 0x00, 0x10, 0x82, 0x00, 0x02, 0x80, 0x00, 0x20, 0x88, 0x00,
+  0x02, 0x80, 0x00, 0x10, 0xE5, 0x00, 0x01, 0x04, 0x06, 0x82, 0x00, 0x03, 0x02, 0x04, 0x00, 0x02,
+  0xB7, 0x00, 0x03, 0xAC, 0x00, 0x04, 0x30, 0x48, 0x54, 0x4A, 0x4A, 0x81, 0x45, 0x03, 0x41, 0x41,
+  0x4A, 0x4C, 0x84, 0x00, 0x80, 0x48, 0x00, 0x41, 0x81, 0x45, 0x06, 0x43, 0x4A, 0x4E, 0x54, 0x68,
+  0x00, 0x80, 0xDE, 0x00, 0x84, 0x01, 0x81, 0x00, 0x00, 0x01, 0x80, 0x00, 0x02, 0x04, 0x00, 0x00,
+  0x84, 0x01, 0x83, 0x00, 0x00, 0x04, 0xD8, 0x00, 0x04, 0x40, 0x40, 0xC8, 0xD8, 0xD8, 0x80, 0xF8,
+  0x11, 0xF0, 0x70, 0x70, 0x30, 0xD0, 0xD0, 0xC0, 0x60, 0x20, 0x00, 0x10, 0x60, 0x48, 0xD0, 0xD0,
+  0xF0, 0x70, 0x70, 0x82, 0xF0, 0x05, 0xD0, 0xD8, 0xC0, 0x40, 0x40, 0x08, 0xE3, 0x00, 0x04, 0x01,
+  0x06, 0x0D, 0x1D, 0x1B, 0x81, 0x1A, 0x04, 0x18, 0x0D, 0x0D, 0x06, 0x01, 0xB6, 0x00, 0x03, 0xAC,
+  0x00, 0x00, 0x20, 0x80, 0x00, 0x01, 0x05, 0x00, 0x80, 0x02, 0x02, 0x06, 0x06, 0x05, 0x86, 0x00,
+  0x02, 0x04, 0x0A, 0x01, 0x80, 0x05, 0x06, 0x01, 0x01, 0x00, 0x02, 0x00, 0x00, 0x20, 0xDD, 0x00,
+  0x05, 0x40, 0x40, 0x41, 0xC1, 0x81, 0x81, 0x80, 0x01, 0x83, 0x00, 0x04, 0x04, 0x00, 0x04, 0x00,
+  0x00, 0x80, 0x01, 0x05, 0x81, 0x81, 0x41, 0x41, 0x40, 0x40, 0x81, 0x00, 0x00, 0x06, 0xD5, 0x00,
+  0x06, 0x04, 0x06, 0x38, 0x3C, 0x3C, 0x3B, 0x3B, 0x80, 0x39, 0x1E, 0x30, 0xC8, 0xC0, 0x51, 0x11,
+  0xF2, 0xF0, 0xF0, 0xD0, 0x90, 0x80, 0x90, 0xD0, 0xF8, 0xF0, 0xF2, 0xD1, 0x51, 0x40, 0x48, 0xC8,
+  0x39, 0x31, 0x31, 0x33, 0x3B, 0x3C, 0x3C, 0x38, 0x00, 0x04, 0xDF, 0x00, 0x07, 0x01, 0x06, 0x18,
+  0x33, 0x7D, 0xF6, 0xE6, 0xE6, 0x82, 0xE7, 0x06, 0xF6, 0x76, 0x3F, 0x11, 0x0C, 0x07, 0x01, 0xB3,
+  0x00, 0x02, 0xAB, 0x00, 0x06, 0xC0, 0xF0, 0xEC, 0xE6, 0xE3, 0x61, 0x61, 0x83, 0x60, 0x06, 0xE0,
+  0xE0, 0xC0, 0x80, 0x00, 0x00, 0x80, 0x80, 0xE0, 0x01, 0x61, 0x61, 0x83, 0x60, 0x81, 0xE0, 0x00,
+  0xC0, 0xD8, 0x00, 0x80, 0xFF, 0x09, 0xC3, 0xC0, 0xE0, 0xE0, 0xA0, 0xA0, 0x40, 0x00, 0xC0, 0x80,
+  0x80, 0x00, 0x0D, 0xFF, 0xFF, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x80, 0x80, 0xC0, 0x00, 0x40, 0xA0,
+  0xA0, 0x80, 0xE0, 0x00, 0xC0, 0x81, 0xFF, 0xD5, 0x00, 0x01, 0x02, 0x03, 0x81, 0x01, 0x81, 0x00,
+  0x03, 0x04, 0xFC, 0xB8, 0x78, 0x80, 0x70, 0x0D, 0xE0, 0xE3, 0xE3, 0xE0, 0xE3, 0xE7, 0xE0, 0xE0,
+  0x71, 0x70, 0x70, 0x78, 0xB8, 0x7C, 0x81, 0x00, 0x81, 0x01, 0x01, 0x03, 0x03, 0xE0, 0x00, 0x06,
+  0x03, 0x0C, 0x18, 0x3C, 0x3C, 0x7C, 0x7C, 0x81, 0xFC, 0x06, 0x7C, 0x7C, 0x3C, 0x1C, 0x0C, 0x06,
+  0x03, 0xB4, 0x00, 0x02, 0xAB, 0x00, 0x83, 0x80, 0x80, 0x81, 0x03, 0x83, 0x82, 0x82, 0x84, 0x80,
+  0x80, 0x81, 0x00, 0x80, 0x80, 0x02, 0x8C, 0xC6, 0xC6, 0x80, 0x82, 0x83, 0x80, 0xD9, 0x00, 0x80,
+  0xFF, 0x00, 0x07, 0x83, 0x81, 0x82, 0x01, 0x07, 0x03, 0xFF, 0xFE, 0x00, 0xFC, 0xFF, 0x07, 0x03,
+  0x81, 0x01, 0x81, 0x81, 0x02, 0x41, 0xC1, 0x03, 0x80, 0xFF, 0x00, 0xF8, 0xD5, 0x00, 0x03, 0x04,
+  0x04, 0x07, 0x07, 0x83, 0x03, 0x15, 0x09, 0xF8, 0xF0, 0xE1, 0xE3, 0xC2, 0xC0, 0x80, 0x8F, 0x8F,
+  0x80, 0x8F, 0x8F, 0x80, 0xC0, 0xC2, 0xC3, 0xE0, 0xE0, 0xF8, 0xF9, 0x0B, 0x82, 0x03, 0x80, 0x07,
+  0x00, 0x04, 0xDF, 0x00, 0x04, 0x03, 0x0E, 0x18, 0x30, 0x79, 0x87, 0xF9, 0x04, 0x79, 0x30, 0x1C,
+  0x07, 0x01, 0xB3, 0x00, 0x02, 0xAA, 0x00, 0x07, 0x80, 0xC0, 0xE8, 0xEC, 0xE6, 0x63, 0x61, 0x61,
+  0x81, 0x60, 0x01, 0x61, 0x61, 0x80, 0xE0, 0x03, 0x80, 0x00, 0x00, 0xC0, 0x80, 0xE0, 0x00, 0x63,
+  0x80, 0x61, 0x00, 0x60, 0x80, 0x61, 0x04, 0x63, 0xE6, 0xEC, 0xE8, 0xC0, 0xD8, 0x00, 0x80, 0xFF,
+  0x00, 0xC1, 0x81, 0xE0, 0x14, 0x20, 0x20, 0x00, 0x40, 0x80, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x80, 0xFF, 0x03, 0x00, 0x80, 0x80, 0x40, 0x00, 0x20, 0x20, 0x81, 0xE0, 0x01, 0xC0, 0xE3, 0x80,
+  0xFF, 0xD6, 0x00, 0x81, 0x01, 0x82, 0x00, 0x03, 0x04, 0xFE, 0xB8, 0x38, 0x80, 0x70, 0x0E, 0x60,
+  0x63, 0xE3, 0xE0, 0xE3, 0xE3, 0x60, 0x70, 0x71, 0x70, 0x78, 0x38, 0xBE, 0x7E, 0x02, 0x81, 0x00,
+  0x81, 0x01, 0x00, 0x03, 0xE0, 0x00, 0x04, 0x03, 0x06, 0x1C, 0x1C, 0x3E, 0x80, 0x7E, 0x00, 0x7C,
+  0x80, 0x7E, 0x05, 0x3E, 0x3E, 0x1C, 0x0C, 0x06, 0x01, 0xB4, 0x00, 0x02, 0xAB, 0x00, 0x05, 0x80,
+  0x90, 0x9C, 0x8E, 0x87, 0x83, 0x82, 0x81, 0x01, 0x83, 0x83, 0x80, 0x80, 0x81, 0x00, 0x80, 0x80,
+  0x00, 0x87, 0x80, 0x83, 0x00, 0x81, 0x80, 0x83, 0x03, 0x87, 0x8C, 0xB8, 0xA0, 0xD9, 0x00, 0x80,
+  0xFF, 0x00, 0x07, 0x83, 0x81, 0x82, 0x01, 0x06, 0x03, 0xFF, 0xFE, 0x00, 0xFC, 0xFF, 0x07, 0x82,
+  0x01, 0x80, 0x81, 0x03, 0xC1, 0x41, 0x41, 0x03, 0x80, 0xFF, 0xD6, 0x00, 0x03, 0x04, 0x04, 0x07,
+  0x07, 0x83, 0x03, 0x15, 0x0B, 0xF8, 0xF0, 0xE1, 0xE3, 0xC2, 0xC0, 0x80, 0x8F, 0x8F, 0x80, 0x8F,
+  0x8F, 0x80, 0xC0, 0xC2, 0xC3, 0xE0, 0xE0, 0xF8, 0xFB, 0x0B, 0x82, 0x03, 0x03, 0x07, 0x07, 0x06,
+  0x04, 0xDF, 0x00, 0x04, 0x03, 0x0E, 0x18, 0x30, 0x79, 0x87, 0xF9, 0x04, 0x71, 0x30, 0x1C, 0x07,
+  0x01, 0xB3, 0x00, 0x02, 0xAB, 0x00, 0x06, 0xC0, 0xF0, 0xEC, 0xE6, 0xE3, 0x61, 0x61, 0x81, 0x60,
+  0x0D, 0x61, 0x61, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0x62, 0x63, 0x80,
+  0x61, 0x07, 0x60, 0x61, 0x61, 0xE1, 0xE3, 0xE6, 0xF8, 0xC0, 0xD8, 0x00, 0x80, 0xFF, 0x09, 0x83,
+  0xE0, 0xC0, 0xE0, 0xA0, 0xA0, 0x40, 0x00, 0xC0, 0x80, 0x80, 0x00, 0x0D, 0xFF, 0xFF, 0x00, 0x00,
+  0xFF, 0x07, 0x00, 0x80, 0x80, 0xC0, 0x00, 0x40, 0xA0, 0xA0, 0x80, 0xE0, 0x01, 0xC0, 0x83, 0x80,
+  0xFF, 0xD6, 0x00, 0x01, 0x03, 0x03, 0x80, 0x01, 0x81, 0x00, 0x15, 0x04, 0xFC, 0xB8, 0x78, 0x70,
+  0x71, 0x70, 0xE0, 0xE3, 0xE3, 0xE0, 0xE2, 0xE7, 0xE0, 0xE0, 0x71, 0x70, 0x70, 0x78, 0xB8, 0x7C,
+  0x04, 0x80, 0x00, 0x81, 0x01, 0x01, 0x03, 0x03, 0xE0, 0x00, 0x06, 0x03, 0x0E, 0x18, 0x3C, 0x3C,
+  0x7C, 0x7C, 0x81, 0xFC, 0x06, 0x7C, 0x7C, 0x3C, 0x1C, 0x0C, 0x06, 0x03, 0xB4, 0x00, 0x02, 0xAB,
+  0x00, 0x04, 0x80, 0xD0, 0xCC, 0xC6, 0xC3, 0x80, 0xC1, 0x01, 0xC0, 0xC0, 0x80, 0xC1, 0x80, 0xC0,
+  0x80, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x01, 0xC3, 0xC3, 0x82, 0xC1, 0x05, 0xC3, 0xC3, 0xC6, 0xCC,
+  0xD0, 0x80, 0xD8, 0x00, 0x80, 0xFF, 0x01, 0x03, 0x01, 0x80, 0x40, 0x03, 0xC0, 0x80, 0x00, 0x80,
+  0x80, 0x00, 0x0C, 0x01, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0x03, 0x01, 0x00, 0x00, 0x80, 0x00, 0xC0,
+  0x82, 0x40, 0x00, 0x01, 0x80, 0xFF, 0x00, 0xFE, 0xD6, 0x00, 0x01, 0x06, 0x07, 0x81, 0x03, 0x80,
+  0x01, 0x17, 0x08, 0xF8, 0x70, 0xF1, 0xE1, 0xE0, 0xC0, 0xC0, 0xC7, 0xC7, 0xC0, 0xC7, 0xC7, 0xC0,
+  0xC0, 0xE3, 0xE1, 0xE0, 0xF0, 0x78, 0xF8, 0x09, 0x01, 0x01, 0x81, 0x03, 0x02, 0x07, 0x06, 0x04,
+  0xDF, 0x00, 0x04, 0x01, 0x0E, 0x18, 0x30, 0x78, 0x87, 0xF9, 0x03, 0x70, 0x30, 0x0C, 0x07, 0xB4,
+  0x00, 0x03, 0xAB, 0x00, 0x03, 0x40, 0x08, 0x20, 0x21, 0x80, 0x20, 0x00, 0x21, 0x83, 0x20, 0x02,
+  0x00, 0x00, 0x80, 0x81, 0x00, 0x86, 0x20, 0x05, 0x22, 0x20, 0x21, 0x20, 0x08, 0x40, 0xDB, 0x00,
+  0x01, 0x80, 0xA1, 0x80, 0xE0, 0x04, 0x80, 0xC0, 0x00, 0x00, 0x80, 0x83, 0x00, 0x00, 0x10, 0x81,
+  0x00, 0x04, 0x80, 0x00, 0x00, 0x80, 0x00, 0x81, 0xE0, 0x00, 0x80, 0xD9, 0x00, 0x02, 0x02, 0x05,
+  0x04, 0x81, 0x02, 0x80, 0x01, 0x05, 0x0D, 0x04, 0x48, 0x81, 0x91, 0x81, 0x80, 0x20, 0x02, 0x24,
+  0x20, 0x24, 0x80, 0x20, 0x08, 0x02, 0x91, 0x90, 0x88, 0xC4, 0x05, 0x0D, 0x01, 0x01, 0x81, 0x02,
+  0x02, 0x04, 0x05, 0x06, 0xDF, 0x00, 0x06, 0x01, 0x09, 0x14, 0x28, 0x44, 0x85, 0x85, 0x82, 0x05,
+  0x06, 0x85, 0x85, 0xC5, 0x48, 0x28, 0x0A, 0x04, 0xB4, 0x00, 0x02, 0xAB, 0x00, 0x05, 0x80, 0xB0,
+  0xD8, 0xCC, 0xC6, 0xC7, 0x81, 0xC3, 0x02, 0xC7, 0xC6, 0xCC, 0x80, 0x80, 0x81, 0x00, 0x05, 0x80,
+  0x80, 0xC0, 0xCE, 0xC7, 0xC7, 0x80, 0xC3, 0x05, 0xC7, 0xC6, 0xC6, 0xDC, 0xB0, 0xA0, 0xD9, 0x00,
+  0x80, 0xFF, 0x03, 0x03, 0x01, 0x41, 0xC1, 0x80, 0x81, 0x82, 0x01, 0x06, 0x03, 0xFF, 0xFE, 0x00,
+  0xFC, 0xFF, 0x07, 0x82, 0x01, 0x02, 0x81, 0x81, 0xC1, 0x80, 0x41, 0x00, 0x03, 0x80, 0xFF, 0xD6,
+  0x00, 0x03, 0x04, 0x04, 0x07, 0x07, 0x83, 0x03, 0x04, 0x09, 0xF8, 0xF0, 0xE1, 0xE3, 0x80, 0xC0,
+  0x0D, 0x8F, 0x8F, 0x80, 0x8F, 0x8F, 0xC0, 0xC0, 0xC2, 0xE1, 0xE1, 0xE0, 0xF0, 0xFB, 0x0B, 0x82,
+  0x03, 0x03, 0x07, 0x07, 0x04, 0x04, 0xDF, 0x00, 0x03, 0x03, 0x0E, 0x18, 0x30, 0x88, 0xF9, 0x04,
+  0x71, 0x30, 0x1C, 0x07, 0x01, 0xB3, 0x00, 0x02, 0xAA, 0x00, 0x06, 0x80, 0xC0, 0xD8, 0xEC, 0xE6,
+  0xE3, 0xE3, 0x80, 0xE1, 0x80, 0xE3, 0x03, 0xE6, 0xE0, 0xC0, 0xC0, 0x80, 0x00, 0x06, 0x80, 0xC0,
+  0xE0, 0xE4, 0xE7, 0xE3, 0xE3, 0x80, 0xE1, 0x06, 0xE3, 0xE3, 0xE7, 0xE6, 0xF8, 0xD0, 0x80, 0xD8,
+  0x00, 0x80, 0xFF, 0x00, 0x81, 0x81, 0xA0, 0x14, 0x40, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x01,
+  0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0x00, 0x80, 0x80, 0x00, 0x40, 0x60, 0x81, 0xA0, 0x00,
+  0x81, 0x80, 0xFF, 0x00, 0x7C, 0xD5, 0x00, 0x02, 0x02, 0x03, 0x03, 0x81, 0x01, 0x80, 0x00, 0x17,
+  0x05, 0xFC, 0x38, 0x70, 0x70, 0x71, 0xE0, 0xE0, 0xE7, 0xE3, 0xE0, 0xE3, 0xE7, 0xE0, 0xE0, 0xE1,
+  0x70, 0x70, 0x78, 0xBC, 0xFD, 0x04, 0x00, 0x00, 0x81, 0x01, 0x02, 0x03, 0x03, 0x02, 0xE0, 0x00,
+  0x05, 0x07, 0x0C, 0x18, 0x3C, 0x7C, 0x7C, 0x83, 0xFC, 0x05, 0x7C, 0x3C, 0x38, 0x18, 0x06, 0x03,
+  0xB4, 0x00, 0x03, 0xAC, 0x00, 0x0F, 0x20, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x01, 0x03, 0x02,
+  0x02, 0x05, 0x00, 0x20, 0x00, 0x80, 0x82, 0x00, 0x03, 0x04, 0x04, 0x00, 0x02, 0x80, 0x00, 0x06,
+  0x02, 0x02, 0x04, 0x00, 0x14, 0x08, 0x40, 0xDC, 0x00, 0x80, 0x40, 0x02, 0x00, 0xA0, 0x40, 0x86,
+  0x00, 0x00, 0x0C, 0x80, 0x00, 0x06, 0x80, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x80, 0x40, 0x00,
+  0x41, 0x80, 0x00, 0x00, 0x82, 0xD7, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x08,
+  0x01, 0x00, 0x80, 0x08, 0x00, 0x00, 0x80, 0x00, 0x04, 0x83, 0x00, 0x00, 0x90, 0x80, 0x00, 0x05,
+  0x04, 0x81, 0x06, 0x00, 0x00, 0x01, 0x80, 0x00, 0x02, 0x02, 0x00, 0x01, 0xE0, 0x00, 0x06, 0x04,
+  0x02, 0x04, 0x00, 0x40, 0x02, 0x82, 0x80, 0x80, 0x05, 0x82, 0x82, 0x42, 0x00, 0x24, 0x14, 0xB6,
+  0x00, 0x02, 0xAB, 0x00, 0x04, 0x80, 0xF0, 0xDC, 0xCC, 0xC6, 0x82, 0xC3, 0x05, 0xC7, 0xC7, 0xCC,
+  0xC0, 0xC0, 0x80, 0x80, 0x00, 0x06, 0x80, 0x80, 0xC0, 0xC0, 0xCE, 0xC7, 0xC7, 0x81, 0xC3, 0x05,
+  0xC7, 0xC6, 0xCC, 0xD8, 0xA0, 0x80, 0xD8, 0x00, 0x80, 0xFF, 0x06, 0x03, 0x41, 0x00, 0x40, 0x40,
+  0xC0, 0x80, 0x81, 0x00, 0x0E, 0x01, 0x03, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0x03, 0x01, 0x01, 0x00,
+  0x80, 0x00, 0x80, 0xC0, 0x80, 0x40, 0x01, 0x41, 0x01, 0x80, 0xFF, 0x00, 0x10, 0xD5, 0x00, 0x02,
+  0x04, 0x06, 0x07, 0x81, 0x03, 0x80, 0x01, 0x17, 0x0A, 0xF8, 0x70, 0xF1, 0xE1, 0xE2, 0xC0, 0xC0,
+  0xC7, 0xC7, 0xC0, 0xC7, 0xCF, 0xC0, 0xC0, 0xE3, 0xE1, 0xE1, 0xF0, 0x78, 0xF8, 0x09, 0x01, 0x01,
+  0x81, 0x03, 0x02, 0x07, 0x06, 0x04, 0xDF, 0x00, 0x04, 0x01, 0x06, 0x18, 0x30, 0x78, 0x86, 0xF9,
+  0x05, 0x79, 0x78, 0x30, 0x0C, 0x07, 0x01, 0xB3, 0x00, 0x03, 0xAC, 0x00, 0x05, 0x20, 0x04, 0x02,
+  0x01, 0x00, 0x00, 0x80, 0x02, 0x02, 0x06, 0x04, 0x0F, 0x84, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x08,
+  0x04, 0x04, 0x00, 0x02, 0x02, 0x00, 0x04, 0x80, 0x00, 0x00, 0x70, 0xDC, 0x00, 0x08, 0x80, 0x80,
+  0xC0, 0x80, 0x00, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x04, 0x80,
+  0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x40, 0x81, 0x80, 0x01, 0x81, 0x80, 0x80, 0x00, 0x00, 0xEE,
+  0xD7, 0x00, 0x04, 0x04, 0x00, 0x00, 0x02, 0x02, 0x80, 0x00, 0x06, 0x03, 0x04, 0x00, 0x80, 0x00,
+  0x03, 0x20, 0x82, 0x00, 0x12, 0x08, 0x00, 0x20, 0x00, 0x00, 0x11, 0x80, 0x04, 0x05, 0x0C, 0x00,
+  0x00, 0x02, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02, 0xE0, 0x00, 0x08, 0x01, 0x04, 0x08, 0x00, 0x85,
+  0x05, 0x04, 0x04, 0x00, 0x80, 0x04, 0x06, 0x05, 0x01, 0x40, 0x28, 0x00, 0x04, 0x01, 0xB3, 0x00,
+  0x03, 0xAB, 0x00, 0x10, 0x40, 0x00, 0x34, 0x28, 0x24, 0x20, 0x22, 0x20, 0x21, 0x21, 0x20, 0x22,
+  0x22, 0x20, 0x00, 0x40, 0x80, 0x82, 0x00, 0x01, 0x20, 0x25, 0x80, 0x22, 0x08, 0x20, 0x21, 0x23,
+  0x23, 0x26, 0x2C, 0x38, 0x10, 0x40, 0xDC, 0x00, 0x0A, 0x41, 0x60, 0x60, 0xE0, 0x00, 0xC0, 0x00,
+  0x00, 0x80, 0x00, 0x01, 0x81, 0x00, 0x00, 0x18, 0x81, 0x00, 0x04, 0x80, 0x00, 0x00, 0x80, 0x80,
+  0x81, 0x60, 0xDA, 0x00, 0x04, 0x04, 0x05, 0x00, 0x00, 0x02, 0x80, 0x00, 0x08, 0x01, 0x00, 0x0C,
+  0x00, 0x48, 0x01, 0x90, 0x00, 0x00, 0x84, 0x20, 0x08, 0x00, 0x02, 0x11, 0x80, 0x08, 0x80, 0x00,
+  0x01, 0x01, 0x80, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x04, 0xDF, 0x00, 0x09, 0x01, 0x00, 0x10,
+  0x20, 0x44, 0x00, 0x80, 0x01, 0x01, 0x05, 0x80, 0x01, 0x04, 0x80, 0x44, 0x00, 0x00, 0x02, 0xB5,
+  0x00, 0x02, 0xAB, 0x00, 0x0F, 0x80, 0x90, 0xD8, 0xCC, 0xC6, 0xC6, 0xC7, 0xC3, 0xC3, 0xC7, 0xC7,
+  0xCE, 0xCC, 0xC0, 0x80, 0x80, 0x81, 0x00, 0x04, 0x80, 0x80, 0xC0, 0xCC, 0xCE, 0x82, 0xC7, 0x05,
+  0xC6, 0xCC, 0xDC, 0x98, 0x80, 0x80, 0xD8, 0x00, 0x80, 0xFF, 0x00, 0x03, 0x80, 0x41, 0x01, 0xC1,
+  0x81, 0x83, 0x01, 0x06, 0x03, 0xFF, 0xFE, 0x00, 0xFC, 0xFF, 0x07, 0x82, 0x01, 0x01, 0x81, 0xC1,
+  0x81, 0x41, 0x00, 0x03, 0x80, 0xFF, 0x00, 0x70, 0xD5, 0x00, 0x02, 0x04, 0x06, 0x07, 0x80, 0x03,
+  0x81, 0x01, 0x14, 0x08, 0xF8, 0x70, 0xE1, 0xE1, 0xC2, 0xC0, 0xC0, 0xCF, 0x8F, 0x80, 0x8F, 0xCF,
+  0xC0, 0xC0, 0xC2, 0xE1, 0xE1, 0xF0, 0x70, 0xF8, 0x81, 0x01, 0x81, 0x03, 0x01, 0x06, 0x04, 0xDF,
+  0x00, 0x04, 0x01, 0x0E, 0x18, 0x30, 0x78, 0x86, 0xF9, 0x05, 0x79, 0x78, 0x10, 0x0C, 0x07, 0x01,
+  0xB3, 0x00, 0x02, 0xAA, 0x00, 0x05, 0x80, 0xC0, 0xE8, 0xEC, 0xE7, 0xE3, 0x80, 0x61, 0x00, 0x60,
+  0x80, 0x61, 0x0C, 0xE3, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0x63, 0x63,
+  0x83, 0x61, 0x04, 0xE3, 0xE7, 0xEC, 0xF8, 0xC0, 0xD8, 0x00, 0x80, 0xFF, 0x1A, 0x81, 0xC0, 0xC0,
+  0xE0, 0xA0, 0xA0, 0x40, 0x00, 0xC0, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x03,
+  0x00, 0x80, 0x80, 0xC0, 0x00, 0x40, 0xA0, 0xA0, 0x80, 0xE0, 0x01, 0x80, 0xE7, 0x80, 0xFF, 0xD5,
+  0x00, 0x02, 0x02, 0x03, 0x03, 0x80, 0x01, 0x81, 0x00, 0x15, 0x04, 0xFC, 0xB8, 0x78, 0x70, 0x71,
+  0x60, 0xE0, 0xE3, 0xE3, 0xE0, 0xE2, 0xE7, 0xE0, 0xE0, 0x71, 0x70, 0x70, 0x78, 0xB8, 0xFC, 0x04,
+  0x80, 0x00, 0x81, 0x01, 0x01, 0x03, 0x02, 0xE0, 0x00, 0x06, 0x03, 0x0E, 0x18, 0x3C, 0x3C, 0x7C,
+  0x7C, 0x80, 0xFC, 0x80, 0x7C, 0x04, 0x3C, 0x1C, 0x0C, 0x06, 0x03, 0xB4, 0x00, 0x02, 0xAB, 0x00,
+  0x05, 0x80, 0xB0, 0xD8, 0xCC, 0xC6, 0xC7, 0x80, 0xC3, 0x06, 0xC7, 0xC7, 0xCE, 0xCC, 0xC0, 0x80,
+  0x80, 0x81, 0x00, 0x0F, 0x80, 0xC0, 0xC0, 0xCC, 0xC6, 0xC7, 0xC7, 0xC3, 0xC3, 0xC7, 0xC6, 0xCE,
+  0xDC, 0xD8, 0x80, 0x80, 0xD8, 0x00, 0x80, 0xFF, 0x00, 0x03, 0x81, 0x41, 0x00, 0x81, 0x83, 0x01,
+  0x06, 0x03, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0x07, 0x82, 0x01, 0x01, 0x81, 0xC1, 0x81, 0x41, 0x00,
+  0x03, 0x80, 0xFF, 0x00, 0xFC, 0xD5, 0x00, 0x03, 0x04, 0x04, 0x07, 0x07, 0x81, 0x03, 0x18, 0x01,
+  0x03, 0x0A, 0xF8, 0x70, 0xE1, 0xE1, 0xC2, 0xC0, 0xC0, 0xCF, 0x87, 0x80, 0x87, 0xCF, 0xC0, 0xC0,
+  0xC2, 0xE1, 0xE1, 0xF0, 0x78, 0xFB, 0x0B, 0x01, 0x82, 0x03, 0x02, 0x07, 0x07, 0x04, 0xDF, 0x00,
+  0x04, 0x01, 0x0E, 0x18, 0x30, 0x78, 0x87, 0xF9, 0x04, 0x70, 0x30, 0x0C, 0x07, 0x01, 0xB3, 0x00,
+  0x02, 0xAB, 0x00, 0x04, 0xC0, 0xD8, 0xEC, 0xE6, 0xE3, 0x84, 0xE1, 0x0D, 0xE3, 0xE0, 0xE0, 0xC0,
+  0x80, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xE7, 0xE3, 0xE3, 0x81, 0xE1, 0x05, 0xE3, 0xE3, 0xE6,
+  0xEC, 0xD8, 0xC0, 0xD8, 0x00, 0x80, 0xFF, 0x13, 0x83, 0xE0, 0xC0, 0xE0, 0xA0, 0xA0, 0x40, 0x00,
+  0x80, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x80, 0x80, 0x03, 0x00,
+  0x40, 0xA0, 0xA0, 0x80, 0xE0, 0x01, 0x80, 0xE7, 0x80, 0xFF, 0xD5, 0x00, 0x01, 0x02, 0x03, 0x81,
+  0x01, 0x81, 0x00, 0x15, 0x04, 0xFC, 0xB8, 0x78, 0x70, 0x71, 0x60, 0xE0, 0xE3, 0xE3, 0xE0, 0xE3,
+  0xE7, 0xE0, 0xE0, 0x71, 0x70, 0x70, 0x78, 0xB8, 0x7C, 0x02, 0x80, 0x00, 0x81, 0x01, 0x01, 0x03,
+  0x03, 0xE0, 0x00, 0x06, 0x03, 0x0E, 0x1C, 0x3C, 0x3C, 0x7E, 0x7E, 0x80, 0x7C, 0x07, 0x7E, 0x7E,
+  0x3E, 0x3C, 0x1C, 0x0C, 0x06, 0x03, 0xB4, 0x00, 0x02, 0xAB, 0x00, 0x03, 0x80, 0xA0, 0xB0, 0x98,
+  0x80, 0x8C, 0x07, 0x8E, 0x8E, 0x8C, 0x9C, 0x9C, 0x90, 0x80, 0x80, 0x82, 0x00, 0x80, 0x80, 0x04,
+  0xB8, 0x9C, 0x8C, 0x8C, 0x8E, 0x80, 0x8C, 0x03, 0x98, 0x98, 0xB0, 0xC0, 0xD9, 0x00, 0x04, 0xFE,
+  0xFF, 0xFF, 0x07, 0x83, 0x81, 0x81, 0x83, 0x01, 0x07, 0x03, 0xFF, 0xFE, 0x00, 0xF8, 0xFF, 0x07,
+  0x03, 0x81, 0x01, 0x83, 0x81, 0x00, 0x03, 0x80, 0xFF, 0x00, 0xFC, 0xD5, 0x00, 0x05, 0x08, 0x0C,
+  0x0F, 0x07, 0x07, 0x06, 0x81, 0x02, 0x1E, 0x00, 0xF1, 0xE0, 0xE3, 0xC2, 0xC0, 0x80, 0x80, 0x8F,
+  0x8F, 0x80, 0x8F, 0x8F, 0x80, 0x80, 0x86, 0xC2, 0xC1, 0xE0, 0xF0, 0xF6, 0x12, 0x02, 0x02, 0x06,
+  0x06, 0x07, 0x07, 0x0F, 0x0F, 0x08, 0xDF, 0x00, 0x05, 0x03, 0x0E, 0x19, 0x31, 0xF9, 0xF9, 0x80,
+  0xFB, 0x00, 0xF3, 0x81, 0xFB, 0x05, 0xF9, 0x71, 0x31, 0x19, 0x06, 0x01, 0xB3, 0x00, 0x02, 0xAB,
+  0x00, 0x05, 0x80, 0xC0, 0xD8, 0xEC, 0xE7, 0xE3, 0x84, 0xE1, 0x06, 0xE3, 0xC0, 0xC0, 0x80, 0x00,
+  0x00, 0x80, 0x80, 0xC0, 0x00, 0xE4, 0x80, 0xE3, 0x80, 0xE1, 0x05, 0xE3, 0xE3, 0xE7, 0xCC, 0xD8,
+  0xC0, 0xD8, 0x00, 0x80, 0xFF, 0x1F, 0x83, 0x81, 0x80, 0x80, 0xC0, 0xC0, 0x40, 0x00, 0x80, 0x80,
+  0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x00, 0x80, 0x80, 0x00, 0x40, 0x40,
+  0xC0, 0xC0, 0x80, 0x80, 0x81, 0x83, 0x80, 0xFF, 0xD6, 0x00, 0x02, 0x02, 0x03, 0x03, 0x84, 0x01,
+  0x14, 0xFC, 0x78, 0x70, 0x71, 0xE1, 0xE0, 0xE0, 0xC7, 0xC7, 0xC0, 0xC0, 0xC7, 0xE0, 0xE0, 0xE1,
+  0xE1, 0x70, 0x70, 0xFC, 0xFC, 0x05, 0x82, 0x01, 0x80, 0x03, 0x00, 0x02, 0xDF, 0x00, 0x05, 0x01,
+  0x07, 0x0C, 0x38, 0x78, 0x7C, 0x80, 0xFC, 0x00, 0xF8, 0x80, 0xFC, 0x05, 0x7C, 0x78, 0x38, 0x18,
+  0x0E, 0x03, 0xB4, 0x00, 0x02, 0xAB, 0x00, 0x05, 0x80, 0xA0, 0xD8, 0xCC, 0xC6, 0xC7, 0x83, 0xC3,
+  0x03, 0xC7, 0xC4, 0xC0, 0x80, 0x81, 0x00, 0x05, 0x80, 0xC0, 0xC0, 0xCE, 0xC7, 0xC7, 0x81, 0xC3,
+  0x05, 0xC7, 0xC6, 0xCC, 0xD8, 0x90, 0x80, 0xD8, 0x00, 0x80, 0xFF, 0x04, 0x07, 0x01, 0x01, 0x00,
+  0x80, 0x83, 0x00, 0x09, 0x01, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x01, 0x85, 0x00,
+  0x05, 0x01, 0x01, 0x07, 0xFF, 0xFF, 0xFE, 0xD6, 0x00, 0x01, 0x06, 0x07, 0x81, 0x03, 0x80, 0x01,
+  0x04, 0x0A, 0xF8, 0x70, 0xE0, 0xE1, 0x80, 0xC0, 0x0F, 0xCF, 0x8F, 0x80, 0x80, 0x8F, 0xC8, 0xC0,
+  0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0x09, 0x01, 0x01, 0x81, 0x03, 0x02, 0x07, 0x07, 0x04, 0xE0,
+  0x00, 0x05, 0x03, 0x0C, 0x18, 0x38, 0x7D, 0x7D, 0x82, 0xFD, 0x06, 0x7D, 0x7D, 0x3D, 0x38, 0x18,
+  0x0E, 0x03, 0xB4, 0x00, 0x02, 0xAB, 0x00, 0x06, 0x80, 0xA0, 0xB0, 0x98, 0x98, 0x8C, 0x8C, 0x81,
+  0x86, 0x03, 0x8E, 0x8E, 0x8C, 0x80, 0x82, 0x00, 0x04, 0x80, 0x98, 0x8C, 0x8E, 0x8E, 0x80, 0x86,
+  0x06, 0x8E, 0x8C, 0x8C, 0x98, 0x90, 0xB0, 0xC0, 0xD9, 0x00, 0x04, 0xFE, 0xFF, 0xFF, 0x07, 0x03,
+  0x87, 0x01, 0x07, 0x03, 0xFF, 0xFE, 0x00, 0xF8, 0xFF, 0x07, 0x03, 0x87, 0x01, 0x00, 0x03, 0x80,
+  0xFF, 0x00, 0xFC, 0xD7, 0x00, 0x80, 0x1F, 0x84, 0x18, 0x02, 0x30, 0x80, 0x80, 0x80, 0x00, 0x05,
+  0x3F, 0x1F, 0x00, 0x1F, 0x1F, 0x30, 0x80, 0x00, 0x02, 0x80, 0x00, 0x10, 0x83, 0x18, 0x80, 0x1F,
+  0x00, 0x0F, 0xE2, 0x00, 0x04, 0x01, 0x07, 0x0F, 0x1E, 0x1E, 0x82, 0x3E, 0x05, 0x1E, 0x1E, 0x0E,
+  0x07, 0x03, 0x01, 0xB5, 0x00,
+};
+
+const uint8_t HAPPY_FRAME_COUNT = 25;
+
+#endif // HAPPY_128X32_H
@@ -0,0 +1,18 @@
+// Generated by clipenc from love.h - do not edit.
+// Single-frame still, see RideBuddyClip.h for the format.
+// Fitted to a 128x32 panel.
+#ifndef LOVE_128X32_H
+#define LOVE_128X32_H
+
+#include "../../RideBuddyClip.h"
+
+const uint8_t love_still[] PROGMEM = {
+  0x52, 0x43, 0x02, 0x01, 0x0C, 0x10, 0x04, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xAB,
+  0x00, 0x07, 0xFC, 0x9E, 0x1E, 0x3A, 0xF2, 0xF6, 0xFC, 0xFC, 0x81, 0xFE, 0x01, 0xFC, 0x78, 0x80,
+  0x00, 0x07, 0xF8, 0xCC, 0x9E, 0x1A, 0xB2, 0xF6, 0xEC, 0xFC, 0x82, 0xFE, 0x00, 0xFC, 0xDF, 0x00,
+  0x03, 0x01, 0x03, 0x07, 0x0F, 0x80, 0x1F, 0x04, 0x4F, 0x67, 0xC7, 0x83, 0x01, 0x82, 0x00, 0x0B,
+  0x01, 0x83, 0xE7, 0x6F, 0x4F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0xEA, 0x00, 0x85, 0x01,
+  0xBA, 0x00,
+};
+
+#endif // LOVE_128X32_H
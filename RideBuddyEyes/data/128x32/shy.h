@@ -0,0 +1,101 @@
+// Generated by clipenc from shy.h - do not edit.
+// Keyframe + XOR-delta clip, see RideBuddyClip.h for the format.
+// Fitted to a 128x32 panel.
+#ifndef SHY_128X32_H
+#define SHY_128X32_H
+
+#include "../../RideBuddyClip.h"
+
+const uint8_t shy_clip[] PROGMEM = {
+  0x52, 0x43, 0x02, 0x19, 0x0C, 0x10, 0x04, 0x00, 0x6C, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00,
+  0xEF, 0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x41, 0x01, 0x00, 0x00, 0x8B, 0x01, 0x00, 0x00,
+  0xC2, 0x01, 0x00, 0x00, 0xE4, 0x01, 0x00, 0x00, 0x3A, 0x02, 0x00, 0x00, 0x82, 0x02, 0x00, 0x00,
+  0xD6, 0x02, 0x00, 0x00, 0x0A, 0x03, 0x00, 0x00, 0x61, 0x03, 0x00, 0x00, 0xBC, 0x03, 0x00, 0x00,
+  0xC7, 0x03, 0x00, 0x00, 0xD2, 0x03, 0x00, 0x00, 0xE5, 0x03, 0x00, 0x00, 0x2F, 0x04, 0x00, 0x00,
+  0x67, 0x04, 0x00, 0x00, 0xBB, 0x04, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x00, 0xDF, 0x04, 0x00, 0x00,
+  0xF2, 0x04, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x07, 0x05, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xA3,
+  0x00, 0x0D, 0x0C, 0x0E, 0x1E, 0x1E, 0x3C, 0x3C, 0x78, 0x78, 0x70, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0,
+  0x91, 0x00, 0x0D, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0x70, 0x78, 0x78, 0x3C, 0x3C, 0x1E, 0x1E, 0x0E,
+  0x0C, 0xCD, 0x00, 0x0D, 0x30, 0x38, 0x38, 0x3C, 0x3C, 0x1E, 0x1E, 0x0F, 0x0F, 0x07, 0x07, 0x03,
+  0x03, 0x01, 0x91, 0x00, 0x0D, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1E, 0x1E, 0xBC, 0x3C,
+  0xBC, 0x38, 0x30, 0xCB, 0x00, 0x04, 0x08, 0x00, 0x08, 0x00, 0x10, 0x81, 0x00, 0x00, 0x08, 0x9C,
+  0x00, 0x0F, 0x0E, 0x03, 0x0C, 0x07, 0x1D, 0x0E, 0x13, 0x0E, 0x07, 0x0D, 0x06, 0x00, 0x00, 0x20,
+  0x60, 0x20, 0x9E, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x9D, 0x00, 0x04, 0x08, 0x00,
+  0x08, 0x00, 0x10, 0x81, 0x00, 0x00, 0x08, 0xA9, 0x00, 0x02, 0x20, 0x60, 0x20, 0x9E, 0x00, 0x01,
+  0x00, 0x03, 0xFF, 0x00, 0xA3, 0x00, 0x08, 0x02, 0x10, 0x00, 0x22, 0x00, 0x44, 0x00, 0x08, 0x80,
+  0x81, 0x00, 0x00, 0x40, 0x90, 0x00, 0x04, 0x80, 0x00, 0x20, 0x00, 0x10, 0x80, 0x00, 0x02, 0x40,
+  0x00, 0x20, 0x80, 0x00, 0x00, 0x0C, 0xCD, 0x00, 0x06, 0x08, 0x40, 0x04, 0x00, 0x22, 0x00, 0x10,
+  0x97, 0x00, 0x07, 0x01, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x01, 0x81, 0x00, 0x03, 0x04, 0x00,
+  0x30, 0x80, 0xF3, 0x00, 0x09, 0x08, 0x00, 0x08, 0x00, 0x18, 0x09, 0x10, 0x00, 0x04, 0x08, 0xA4,
+  0x00, 0x02, 0xFF, 0x00, 0xA2, 0x00, 0x0D, 0x0C, 0x0E, 0x1E, 0x1E, 0x3C, 0x3C, 0x78, 0x78, 0xF0,
+  0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x91, 0x00, 0x0D, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0x70, 0x78, 0x78,
+  0x3C, 0x3C, 0x1E, 0x1E, 0x0E, 0x0C, 0xCD, 0x00, 0x0A, 0x30, 0x78, 0x78, 0x3C, 0x3C, 0x1E, 0x1E,
+  0x0F, 0x0F, 0x07, 0x07, 0x80, 0x03, 0x91, 0x00, 0x0D, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F,
+  0x1E, 0x1E, 0x3C, 0x3C, 0x78, 0x78, 0x30, 0xFF, 0x00, 0xA4, 0x00, 0x02, 0xFF, 0x00, 0xA3, 0x00,
+  0x80, 0x70, 0x01, 0xF0, 0xF0, 0x82, 0xE0, 0x81, 0xC0, 0x90, 0x00, 0x81, 0xC0, 0x85, 0xE0, 0x02,
+  0xF0, 0xF0, 0x60, 0xCD, 0x00, 0x00, 0x0C, 0x80, 0x0E, 0x01, 0x0F, 0x0F, 0x80, 0x07, 0x81, 0x03,
+  0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x81, 0x03, 0x81, 0x07, 0x00, 0x0F, 0x81, 0x0E, 0xFF, 0x00,
+  0xA4, 0x00, 0x03, 0xFF, 0x00, 0xA2, 0x00, 0x00, 0x40, 0x80, 0x90, 0x01, 0x10, 0x10, 0x82, 0x20,
+  0x98, 0x00, 0x81, 0x20, 0x81, 0x00, 0x02, 0x10, 0x10, 0x20, 0xCE, 0x00, 0x02, 0x10, 0x00, 0x01,
+  0xFF, 0x00, 0xCF, 0x00, 0x03, 0xFF, 0x00, 0xA2, 0x00, 0x0C, 0x40, 0xEC, 0xEE, 0xFE, 0xFE, 0xDC,
+  0xFC, 0xB8, 0xB8, 0xB0, 0x30, 0x20, 0x20, 0x92, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x20, 0x20, 0x30,
+  0xB0, 0xB8, 0x98, 0xDC, 0xDC, 0xFE, 0xFE, 0xEE, 0x4C, 0xCD, 0x00, 0x0A, 0x3C, 0x26, 0x36, 0x33,
+  0x33, 0x11, 0x19, 0x08, 0x08, 0x04, 0x04, 0x93, 0x00, 0x0F, 0x01, 0x02, 0x00, 0x00, 0x04, 0x00,
+  0x08, 0x08, 0x19, 0x11, 0xB2, 0x32, 0xB2, 0x36, 0x30, 0x80, 0xF3, 0x00, 0x0A, 0x06, 0x03, 0x0C,
+  0x07, 0x1D, 0x0E, 0x03, 0x0E, 0x07, 0x0D, 0x06, 0xA3, 0x00, 0x02, 0xFF, 0x00, 0xA4, 0x00, 0x07,
+  0x0E, 0x0E, 0x1E, 0x1E, 0x3C, 0x3C, 0x78, 0x78, 0x80, 0xF0, 0x02, 0xE0, 0xE0, 0xC0, 0x91, 0x00,
+  0x0C, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0x78, 0x78, 0x3C, 0x3C, 0x1E, 0x1E, 0x0E, 0x0E, 0xCE, 0x00,
+  0x00, 0x38, 0x80, 0x3C, 0x08, 0x1E, 0x1E, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x92, 0x00,
+  0x02, 0x01, 0x03, 0x03, 0x80, 0x07, 0x06, 0x0F, 0x0E, 0x1E, 0x1E, 0x3C, 0x3C, 0x38, 0xFF, 0x00,
+  0xA3, 0x00, 0x02, 0xA7, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x00, 0x80, 0xA1, 0x00, 0x01, 0x80, 0x80,
+  0x81, 0xC0, 0xCE, 0x00, 0x0D, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1E, 0x9E, 0xBC, 0xFC,
+  0xF8, 0xF0, 0xE0, 0x91, 0x00, 0x0C, 0xF0, 0xF8, 0xFC, 0xFC, 0x9E, 0x9E, 0x0F, 0x0F, 0x07, 0x03,
+  0x03, 0x01, 0x01, 0xCE, 0x00, 0x0C, 0x38, 0x38, 0x3C, 0x3C, 0x1E, 0x1E, 0x0F, 0x0F, 0x07, 0x07,
+  0x03, 0x03, 0x01, 0x93, 0x00, 0x0B, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1E, 0x1E, 0x3C,
+  0x3C, 0x38, 0xFF, 0x00, 0xA2, 0x00, 0x02, 0xFF, 0x00, 0xA4, 0x00, 0x01, 0x60, 0xF0, 0x86, 0xE0,
+  0x81, 0xC0, 0x90, 0x00, 0x81, 0xC0, 0x85, 0xE0, 0x01, 0xF0, 0xE0, 0xCE, 0x00, 0x80, 0x0E, 0x01,
+  0x0F, 0x0F, 0x80, 0x07, 0x81, 0x03, 0x01, 0x01, 0x01, 0x90, 0x00, 0x00, 0x01, 0x82, 0x03, 0x80,
+  0x07, 0x01, 0x0F, 0x0F, 0x80, 0x0E, 0xFF, 0x00, 0xA2, 0x00, 0x02, 0xFF, 0x00, 0xA4, 0x00, 0x03,
+  0x38, 0x38, 0x78, 0x78, 0x80, 0x70, 0x00, 0xF0, 0x81, 0xE0, 0x01, 0xC0, 0xC0, 0x90, 0x00, 0x80,
+  0xC0, 0x80, 0xE0, 0x00, 0xF0, 0x81, 0x70, 0x02, 0x78, 0x38, 0x38, 0xCE, 0x00, 0x09, 0x18, 0x3C,
+  0x3C, 0x1C, 0x1E, 0x0E, 0x0F, 0x0F, 0x07, 0x07, 0x80, 0x03, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01,
+  0x80, 0x03, 0x80, 0x07, 0x07, 0x0F, 0x0E, 0x8E, 0x1E, 0x9E, 0x1C, 0x1C, 0x80, 0xCC, 0x00, 0x00,
+  0x01, 0xA3, 0x00, 0x0A, 0x06, 0x03, 0x0C, 0x07, 0x09, 0x0E, 0x03, 0x0E, 0x07, 0x0D, 0x06, 0xA3,
+  0x00, 0x02, 0xFF, 0x00, 0xA3, 0x00, 0x0D, 0x0C, 0x0E, 0x1E, 0x1E, 0x3C, 0x3C, 0x78, 0x78, 0x70,
+  0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x91, 0x00, 0x0D, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0x70, 0x78, 0x78,
+  0x3C, 0x3C, 0x1E, 0x1E, 0x0E, 0x0C, 0xCD, 0x00, 0x0D, 0x30, 0x38, 0x38, 0x3C, 0x3C, 0x1E, 0x1E,
+  0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x91, 0x00, 0x0D, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F,
+  0x0F, 0x1E, 0x1E, 0xBC, 0x3C, 0xBC, 0x38, 0x30, 0xCB, 0x00, 0x00, 0x08, 0xA5, 0x00, 0x0A, 0x0E,
+  0x03, 0x0C, 0x07, 0x1D, 0x0E, 0x13, 0x0E, 0x07, 0x0D, 0x06, 0xA3, 0x00, 0x01, 0x01, 0x3B, 0x00,
+  0x00, 0x00, 0x00, 0x20, 0x60, 0x20, 0x00, 0x01, 0x01, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xCE, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x81, 0x00, 0x02,
+  0x20, 0x60, 0x20, 0x9E, 0x00, 0x02, 0xFF, 0x00, 0xA2, 0x00, 0x0D, 0x0C, 0x0E, 0x1E, 0x1E, 0x3C,
+  0x3C, 0x78, 0x78, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x91, 0x00, 0x0D, 0xC0, 0xC0, 0xE0, 0xE0,
+  0xF0, 0xF0, 0x78, 0x78, 0x3C, 0x3C, 0x1E, 0x1E, 0x0E, 0x0C, 0xCD, 0x00, 0x0A, 0x30, 0x78, 0x78,
+  0x3C, 0x3C, 0x1E, 0x1E, 0x0E, 0x0F, 0x07, 0x07, 0x80, 0x03, 0x91, 0x00, 0x0D, 0x01, 0x03, 0x03,
+  0x07, 0x07, 0x0F, 0x0F, 0x1E, 0x1E, 0x3C, 0x3C, 0x78, 0x78, 0x30, 0xFF, 0x00, 0xA4, 0x00, 0x02,
+  0xFF, 0x00, 0xA3, 0x00, 0x80, 0x70, 0x01, 0xF0, 0xF0, 0x83, 0xE0, 0x80, 0xC0, 0x00, 0x80, 0x90,
+  0x00, 0x81, 0xC0, 0x85, 0xE0, 0x01, 0xF0, 0xF0, 0xCD, 0x00, 0x00, 0x0C, 0x81, 0x0E, 0x00, 0x0F,
+  0x80, 0x07, 0x81, 0x03, 0x01, 0x01, 0x01, 0x90, 0x00, 0x00, 0x01, 0x81, 0x03, 0x81, 0x07, 0x00,
+  0x0F, 0x81, 0x0E, 0xFF, 0x00, 0xA3, 0x00, 0x03, 0xFF, 0x00, 0xA3, 0x00, 0x0E, 0x7C, 0x7E, 0x6E,
+  0xEE, 0xCC, 0xDC, 0x98, 0x98, 0x90, 0x10, 0x00, 0x20, 0x00, 0x00, 0x80, 0x92, 0x00, 0x0B, 0x20,
+  0x20, 0x10, 0x90, 0x98, 0x98, 0xDC, 0xDC, 0xFC, 0xFE, 0xFE, 0xFC, 0xCD, 0x00, 0x0A, 0x3C, 0x36,
+  0x36, 0x32, 0x32, 0x11, 0x19, 0x08, 0x08, 0x04, 0x04, 0x80, 0x00, 0x00, 0x01, 0x93, 0x00, 0x0A,
+  0x04, 0x04, 0x08, 0x08, 0x19, 0x19, 0xB3, 0x32, 0xB6, 0x36, 0x3E, 0xF4, 0x00, 0x0A, 0x06, 0x03,
+  0x0C, 0x07, 0x0D, 0x0E, 0x03, 0x0E, 0x03, 0x0D, 0x06, 0xA3, 0x00, 0x03, 0xFF, 0x00, 0xCF, 0x00,
+  0x00, 0x02, 0xFD, 0x00, 0x00, 0x04, 0xF6, 0x00, 0x00, 0x08, 0x80, 0x00, 0x04, 0x10, 0x00, 0x10,
+  0x00, 0x04, 0xA5, 0x00, 0x01, 0x01, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x03,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x9D, 0x00, 0x00, 0x08, 0xB2, 0x00, 0x02, 0x20, 0x60, 0x20,
+  0x9E, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x9D, 0x00, 0x00, 0x08, 0xB2, 0x00, 0x02,
+  0x20, 0x60, 0x20, 0x9E, 0x00, 0x01, 0x00, 0x02, 0xFF, 0x00, 0xA3, 0x00, 0x0D, 0x0C, 0x0E, 0x1E,
+  0x1E, 0x3C, 0x3C, 0x78, 0x78, 0x70, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x91, 0x00, 0x0D, 0xC0, 0xC0,
+  0xE0, 0xE0, 0xF0, 0x70, 0x78, 0x78, 0x3C, 0x3C, 0x1E, 0x1E, 0x0E, 0x0C, 0xCD, 0x00, 0x0D, 0x30,
+  0x38, 0x38, 0x3C, 0x3C, 0x1E, 0x1E, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x91, 0x00, 0x0D,
+  0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1E, 0x1E, 0xBC, 0x3C, 0xBC, 0x38, 0x30, 0xCB, 0x00,
+  0x00, 0x08, 0xA5, 0x00, 0x0A, 0x0E, 0x03, 0x0C, 0x07, 0x1D, 0x0E, 0x13, 0x0E, 0x07, 0x0D, 0x06,
+  0xA3, 0x00,
+};
+
+const uint8_t SHY_FRAME_COUNT = 25;
+
+#endif // SHY_128X32_H
@@ -1,1760 +1,456 @@
-// Generated for U8g2 library
+// Generated by clipenc from driving.h - do not edit.
+// Keyframe + XOR-delta clip, see RideBuddyClip.h for the format.
 #ifndef DRIVING_H
 #define DRIVING_H
 
-#include <pgmspace.h>
-
-const unsigned char driving_f0[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0x00, 0xFE, 0x3F, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x7F, 0xFC, 0x1F, 0x00, 0xFF, 0xFF, 0x00, 0xFC, 0x1F, 0xFF, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0xFF, 0xC3, 0xFF, 0xF3, 0xFF, 0xFF, 0xE7, 0xFF, 0xE1, 0xFF, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0xFF, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x7F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x7F, 0xC0, 0x1F, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x7F, 0xF8, 0x07, 0xE0, 0x1F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f1[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF7, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF9, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFE, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x7F, 0xFC, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x8F, 0x1F, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xE3, 0x07, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x03, 0xFC, 0xF8, 0x03, 0xF8, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x3F, 0xFF, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xDF, 0x7F, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xEF, 0x1F, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x8F, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f2[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x02, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0x2F, 0x04, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x2F, 0x04, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x7F, 0x00, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x7B, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x39, 0xFC, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1C, 0xF8, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1E, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0E, 0xE0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x07, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x07, 0x80, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xCF, 0x03, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC7, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE3, 0x01, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF1, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x70, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x78, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x3F, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0xEF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x07, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f3[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC7, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x2F, 0x04, 0x2A, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0xFC, 0xFF, 0x2F, 0x44, 0x22, 0x18, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x2F, 0x42, 0x02, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x80, 0x3F, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0xC0, 0x19, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0x00, 0xC0, 0x19, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0xE0, 0x1C, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x1C, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0xF0, 0x0C, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x70, 0x0E, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x70, 0x0E, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x38, 0x0F, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x07, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x07, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x07, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x07, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x03, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x03, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x80, 0xDF, 0x03, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x8F, 0xFF, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x80, 0xFF, 0xCF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0xF0, 0xF8, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x80, 0xF8, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f4[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0x04, 0x2A, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0x2F, 0x44, 0x22, 0x18, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0x2F, 0x42, 0x02, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xE3, 0xCF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0xC0, 0x1F, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0xC0, 0x1F, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0xC0, 0x1D, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0xC0, 0x1D, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x7F, 0x00, 0xC0, 0x1C, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x71, 0x00, 0xE0, 0x1C, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0x7F, 0xF0, 0x00, 0xE0, 0x1C, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x3F, 0xE0, 0x01, 0xE0, 0x1C, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x01, 0xE0, 0x1C, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x01, 0xE0, 0x1C, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0xE0, 0x1C, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xE0, 0x1C, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x06, 0xE0, 0x1C, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x0E, 0xF0, 0x1C, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x0E, 0x70, 0x1C, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x1C, 0x70, 0x1C, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x1C, 0x70, 0x1C, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x38, 0x70, 0x1C, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x78, 0xF0, 0x1C, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x70, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x70, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xF0, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xE0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f5[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x4F, 0x04, 0x2A, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0x2F, 0x44, 0x22, 0x18, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0x0F, 0x40, 0x02, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x7F, 0xF8, 0xCF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0xF0, 0x07, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x70, 0x07, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x70, 0x07, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x70, 0x07, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x70, 0x0E, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x70, 0x0E, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x70, 0x0E, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x70, 0x0E, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x70, 0x0E, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x70, 0x0E, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x70, 0x0E, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x70, 0x0E, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x70, 0x0C, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x70, 0x1C, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x78, 0x1C, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x78, 0x1C, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x78, 0x1C, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x1C, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x1E, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f6[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0x2F, 0x04, 0x2A, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0x2F, 0x44, 0x22, 0x18, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0F, 0x40, 0x02, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x3C, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0x7C, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x78, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x80, 0x03, 0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0xE0, 0x03, 0x00, 0xE0, 0x3F, 0xFC, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0xF0, 0x07, 0x00, 0xE0, 0x3F, 0xF8, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0xE0, 0x0F, 0x00, 0xF0, 0x1D, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0xE0, 0x0F, 0x00, 0xF8, 0x1E, 0xE0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x3C, 0x0E, 0xC0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0xE0, 0x1E, 0x00, 0x1E, 0x0F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xE0, 0x3D, 0x00, 0x1E, 0x07, 0x80, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0xC0, 0x3D, 0x00, 0x8F, 0x03, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xC0, 0x79, 0x80, 0xC7, 0x03, 0x00, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xC0, 0x71, 0xC0, 0xE3, 0x01, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xC0, 0xF1, 0xE0, 0xE1, 0x01, 0x00, 0xFC, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xC0, 0xF9, 0xF8, 0xF0, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xC0, 0xFB, 0xFF, 0x70, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x7B, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f7[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x8F, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x2F, 0x04, 0x2A, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x2F, 0x44, 0x22, 0x18, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x40, 0x02, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x8F, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x7F, 0x00, 0xC0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0xBF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x1F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xBC, 0x03, 0x00, 0x00, 0xF0, 0xCF, 0xFF, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x18, 0x07, 0x00, 0x00, 0xFC, 0xE3, 0xFF, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x98, 0xFF, 0x0F, 0xC0, 0x7F, 0xF8, 0xFF, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x30, 0xFF, 0x3F, 0xF0, 0x0F, 0x7E, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x1F, 0xF8, 0xFF, 0xF7, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x1F, 0xFE, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xBF, 0x1F, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f8[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0x8F, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x2F, 0x04, 0x2A, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x2F, 0x44, 0x22, 0x18, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x2F, 0x40, 0x02, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x8F, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x7F, 0x00, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0xFF, 0x7F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x7F, 0xFC, 0x1F, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0xFF, 0xE1, 0xFF, 0x01, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0xFF, 0x87, 0xFF, 0xCF, 0xFF, 0x7F, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x83, 0x1F, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x7E, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x80, 0xFF, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xC0, 0xFF, 0xF1, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0x1F, 0xE0, 0x1F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f9[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0x3F, 0x04, 0x2A, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0x3F, 0x44, 0x22, 0x18, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0x3F, 0x40, 0x02, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x7F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x7F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0xF1, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0xE0, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0xC0, 0xF3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0x7F, 0x80, 0xC7, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x8F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x3C, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x78, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x0F, 0x00, 0xE0, 0xF1, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0xE0, 0xF3, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x07, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0xFF, 0x8F, 0xFF, 0xF8, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0xFF, 0x03, 0xC0, 0xF8, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f10[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0xFC, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0x3F, 0x04, 0x2A, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0x3F, 0x44, 0x22, 0x18, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0x3F, 0x40, 0x02, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x7F, 0x00, 0x00, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0xE7, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0xFF, 0x8F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x78, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0xF0, 0xF1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x0F, 0xE0, 0xC3, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x8F, 0x3F, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x1F, 0xFC, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x3E, 0xF8, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0xF8, 0xF8, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x07, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x07, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x07, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f11[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x3F, 0x04, 0x2A, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x3F, 0x44, 0x22, 0x18, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x3F, 0x40, 0x02, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x1F, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xE7, 0xFF, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xF1, 0xFF, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x3F, 0x7C, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xF0, 0x0F, 0x3F, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xC1, 0x0F, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x7F, 0xF0, 0x07, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0xFF, 0x7F, 0x00, 0xE0, 0xFF, 0xFF, 0x1F, 0xF8, 0x01, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x1F, 0x7E, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x1F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x1F, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x7F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xE0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xF7, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0xFE, 0x9F, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f12[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0x8F, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x2F, 0x04, 0x2A, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x2F, 0x44, 0x22, 0x18, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x40, 0x02, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x8F, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x80, 0xEF, 0xF9, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF7, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7B, 0xE0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3C, 0xC0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1C, 0x80, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x1E, 0x80, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x8F, 0x07, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC3, 0x03, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE3, 0x01, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xF0, 0x01, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xF1, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f13[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x04, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x2F, 0x04, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x7F, 0x00, 0x78, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xF8, 0xC3, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0xB8, 0x83, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0xBC, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x9C, 0x01, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0xDC, 0x01, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0xDE, 0x01, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0xCE, 0x01, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0xCE, 0x01, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xCF, 0x01, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xE7, 0x01, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x80, 0xE7, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x80, 0xE3, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x80, 0xE3, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0xC0, 0xE3, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0xF1, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x71, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x71, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f14[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x7F, 0x00, 0x70, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0xF0, 0xFB, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xF0, 0xCF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xF8, 0x0F, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x78, 0x06, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x78, 0x07, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x38, 0x07, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x38, 0x07, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x9C, 0x03, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x9C, 0x03, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x8E, 0x03, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x8E, 0x03, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x8F, 0x03, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x01, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x01, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x80, 0xC7, 0x01, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x80, 0xC7, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x80, 0xE3, 0x01, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0xE3, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f15[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xE1, 0x8F, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0xE0, 0x0F, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0xE0, 0x0F, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0xE0, 0x0E, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0xE0, 0x0E, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0xE0, 0x0E, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x70, 0x0E, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x70, 0x0E, 0x00, 0x3C, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x70, 0x0E, 0x00, 0x1E, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x70, 0x0E, 0x00, 0x0F, 0xFC, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x70, 0x0E, 0x80, 0x07, 0xF8, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x70, 0x0E, 0xC0, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x70, 0x0E, 0xE0, 0x01, 0xE0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x70, 0x0E, 0x80, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x70, 0x0E, 0x08, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x70, 0x0E, 0x3E, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x70, 0x0C, 0x3E, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x1F, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x38, 0x9E, 0x0F, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x78, 0xDE, 0x0F, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0xDF, 0x07, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0x9F, 0x03, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f16[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x04, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x77, 0x0F, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x7D, 0x0E, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xFF, 0x0E, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0xEE, 0x0E, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0xCE, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0xCC, 0x0D, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x9C, 0x03, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x9C, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x98, 0x07, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x18, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x38, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x38, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x30, 0x3E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x70, 0x3E, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x70, 0x3C, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x70, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0xE0, 0x78, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xE0, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xC0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f17[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0xF7, 0x01, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFE, 0x03, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0x3F, 0xB8, 0x07, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x1F, 0x38, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x0F, 0x70, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x70, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0xE0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0xE0, 0x39, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0xC0, 0x71, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0xC0, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x24, 0xC0, 0x7F, 0x00, 0x80, 0xF3, 0x01, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x40, 0xE8, 0x7F, 0x00, 0x80, 0xE7, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0xBF, 0x00, 0x00, 0xE7, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x04, 0xF0, 0x1F, 0x00, 0x00, 0xCF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x18, 0xF0, 0x1F, 0x00, 0x00, 0x8E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x9E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x9C, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f18[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0xFF, 0xF7, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x44, 0xE0, 0x3F, 0xCF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x40, 0xF8, 0x1F, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x9F, 0x7C, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x04, 0xF0, 0x1F, 0xF0, 0xF1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x18, 0xF0, 0x0F, 0xE0, 0xE3, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x87, 0x1F, 0xF0, 0x03, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x80, 0x0F, 0xFE, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x3E, 0xF8, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x7C, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0xF8, 0xFD, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x7F, 0x00, 0xFE, 0xFF, 0x1F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f19[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x40, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x0C, 0xF8, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x30, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x00, 0xFC, 0x07, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0xFC, 0x8F, 0xFF, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0xDF, 0xFF, 0x07, 0xC0, 0xFF, 0x7F, 0xC0, 0xFF, 0xFC, 0xFF, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x1F, 0xFC, 0x7F, 0xF0, 0xFF, 0xFF, 0xFB, 0x3F, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xF7, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xC0, 0x1F, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xF1, 0x3F, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0xF8, 0x07, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0xFE, 0x81, 0xFF, 0xFF, 0xFF, 0x1F, 0xFE, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0xF0, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0x01, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0x00, 0xC0, 0xFF, 0xDF, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f20[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0xFC, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x44, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x40, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0x00, 0x00, 
-  0x00, 0x40, 0xF0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFB, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x04, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x3E, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x18, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x01, 0xE0, 0x0F, 0x0F, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xFC, 0xC1, 0x07, 0xF8, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x7F, 0xF0, 0x03, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x1F, 0xFC, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0x3E, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x9F, 0x1F, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0x9F, 0x87, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xF3, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f21[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x1F, 0x00, 0x00, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x7F, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xC7, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC7, 0x83, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE3, 0x81, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF1, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x44, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x78, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x40, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x87, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x1F, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x04, 0xFC, 0x07, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x87, 0x0F, 0x00, 0xFC, 0x03, 0x00, 0x00, 
-  0x00, 0x18, 0xFE, 0x03, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xC3, 0x07, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xE3, 0x03, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xF8, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0x0F, 0x00, 0xE0, 0xFF, 0xDF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0xFF, 0x1F, 0xD0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f22[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0xFE, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFE, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xCF, 0x83, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE7, 0x01, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF1, 0x00, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x78, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x44, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x3C, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x40, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1E, 0x00, 0xFC, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x87, 0x00, 0x00, 0x00, 0xF0, 0xC3, 0x0F, 0x0F, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x04, 0xFC, 0x07, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x87, 0x07, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x18, 0xFC, 0x07, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xC7, 0x03, 0x00, 0xF8, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x0F, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f23[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0xFE, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFD, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFE, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x8F, 0x07, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xC7, 0x03, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x44, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF1, 0x01, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x40, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xF8, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x8F, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x3E, 0x7C, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x04, 0xFC, 0x07, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x0F, 0x1E, 0x00, 0xF8, 0x07, 0x00, 0x00, 
-  0x00, 0x18, 0xFC, 0x07, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x0F, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xCF, 0x07, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x0F, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0x0F, 0x80, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-};
-
-const unsigned char driving_f24[] PROGMEM = {
-  // width: 128, height: 64
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0xFC, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0xFE, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFE, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x8F, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x8F, 0x07, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC7, 0x03, 0xFF, 0x01, 0x00, 0x00, 
-  0x00, 0x44, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF1, 0x01, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x40, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0xFE, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0xF8, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x7C, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x04, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x83, 0x1F, 0x1E, 0x00, 0xFC, 0x07, 0x00, 0x00, 
-  0x00, 0x18, 0xFC, 0x07, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x0F, 0x0F, 0x00, 0xF8, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x87, 0x07, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xE7, 0x03, 0x00, 0xF8, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x03, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0x0F, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0x7F, 0x80, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-  0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 
-};
-
-const unsigned char* const driving_frames[] = {
-  driving_f0,
-  driving_f1,
-  driving_f2,
-  driving_f3,
-  driving_f4,
-  driving_f5,
-  driving_f6,
-  driving_f7,
-  driving_f8,
-  driving_f9,
-  driving_f10,
-  driving_f11,
-  driving_f12,
-  driving_f13,
-  driving_f14,
-  driving_f15,
-  driving_f16,
-  driving_f17,
-  driving_f18,
-  driving_f19,
-  driving_f20,
-  driving_f21,
-  driving_f22,
-  driving_f23,
-  driving_f24,
+#include "../RideBuddyClip.h"
+
+const uint8_t driving_clip[] PROGMEM = {
+  0x52, 0x43, 0x02, 0x19, 0x0C, 0x10, 0x08, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x6B, 0x01, 0x00, 0x00,
+  0x54, 0x02, 0x00, 0x00, 0x60, 0x03, 0x00, 0x00, 0x8E, 0x04, 0x00, 0x00, 0x86, 0x05, 0x00, 0x00,
+  0x61, 0x06, 0x00, 0x00, 0xA4, 0x07, 0x00, 0x00, 0xDE, 0x08, 0x00, 0x00, 0x1E, 0x0A, 0x00, 0x00,
+  0x56, 0x0B, 0x00, 0x00, 0x42, 0x0C, 0x00, 0x00, 0x87, 0x0D, 0x00, 0x00, 0xB2, 0x0E, 0x00, 0x00,
+  0xC5, 0x0F, 0x00, 0x00, 0xCA, 0x10, 0x00, 0x00, 0xF2, 0x11, 0x00, 0x00, 0xDE, 0x12, 0x00, 0x00,
+  0xE2, 0x13, 0x00, 0x00, 0x05, 0x15, 0x00, 0x00, 0x36, 0x16, 0x00, 0x00, 0x63, 0x17, 0x00, 0x00,
+  0x8E, 0x18, 0x00, 0x00, 0xAF, 0x19, 0x00, 0x00, 0xAB, 0x1A, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x9F,
+  0x00, 0x00, 0xC0, 0x80, 0xE0, 0x83, 0xC0, 0x83, 0x80, 0x95, 0x00, 0x83, 0x80, 0x83, 0xC0, 0x80,
+  0xE0, 0x00, 0xC0, 0xC4, 0x00, 0x00, 0x3F, 0x93, 0xFF, 0x00, 0x7E, 0x87, 0x00, 0x00, 0x7E, 0x93,
+  0xFF, 0x00, 0x3F, 0xCB, 0x00, 0x00, 0x80, 0x81, 0xC0, 0x80, 0xE0, 0x83, 0xF0, 0x8B, 0xF8, 0x82,
+  0xF0, 0x80, 0xE0, 0x81, 0xC0, 0x00, 0x80, 0xC7, 0x00, 0x09, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0xF0,
+  0xF8, 0xFC, 0xFC, 0xFE, 0x81, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0x01, 0x1F, 0x1F, 0x81, 0x0F, 0x82,
+  0x07, 0x86, 0x03, 0x82, 0x07, 0x81, 0x0F, 0x01, 0x1F, 0x1F, 0x80, 0x3F, 0x01, 0x7F, 0x7F, 0x80,
+  0xFF, 0x00, 0xFE, 0x80, 0xFC, 0x05, 0xF8, 0xF0, 0xE0, 0xC0, 0xC0, 0x80, 0xB4, 0x00, 0x04, 0xC0,
+  0xE0, 0xF0, 0xF8, 0xFE, 0x82, 0xFF, 0x07, 0x7F, 0x3F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0x01, 0xA8,
+  0x00, 0x07, 0x01, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x7F, 0x82, 0xFF, 0x04, 0xFE, 0xFC, 0xF0,
+  0xE0, 0xC0, 0xAA, 0x00, 0x02, 0xE0, 0xF8, 0xFE, 0x84, 0xFF, 0x03, 0x8F, 0x83, 0x81, 0x80, 0xB8,
+  0x00, 0x03, 0x80, 0x81, 0x83, 0x8F, 0x84, 0xFF, 0x02, 0xFE, 0xF8, 0xE0, 0xA4, 0x00, 0x01, 0xE0,
+  0xFE, 0x83, 0xFF, 0x00, 0x7F, 0x81, 0x1F, 0x07, 0x1B, 0x3B, 0x3B, 0x77, 0x77, 0xE7, 0xE6, 0xEE,
+  0x80, 0xCE, 0x09, 0x9C, 0x9C, 0x1C, 0x18, 0x38, 0x38, 0xF8, 0xF8, 0xF0, 0xF0, 0x81, 0xF8, 0x00,
+  0xFC, 0x80, 0xFE, 0x84, 0xFF, 0x80, 0xFE, 0x01, 0xFC, 0xFC, 0x80, 0xF8, 0x11, 0xF0, 0xF0, 0xF8,
+  0xF8, 0x38, 0x38, 0x18, 0x1C, 0x9C, 0x9C, 0x8E, 0xCE, 0xCE, 0xEE, 0xE6, 0xE7, 0x77, 0x77, 0x80,
+  0x3B, 0x81, 0x1F, 0x00, 0x7F, 0x84, 0xFF, 0x00, 0xE0, 0x90, 0x00, 0x03, 0xFF, 0x00, 0x9E, 0x00,
+  0x00, 0x80, 0x80, 0x00, 0x00, 0x20, 0x82, 0x00, 0x00, 0x40, 0xA1, 0x00, 0x00, 0x40, 0x82, 0x00,
+  0x02, 0x20, 0x00, 0x20, 0xDB, 0x00, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x40, 0x83, 0x00, 0x00, 0x10,
+  0x82, 0x00, 0x00, 0x08, 0x88, 0x00, 0x01, 0x08, 0x08, 0x88, 0x00, 0x00, 0x40, 0xE5, 0x00, 0x00,
+  0x04, 0x83, 0x00, 0x01, 0x04, 0x04, 0x81, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x10, 0x81, 0x00,
+  0x05, 0x40, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x04, 0x08, 0x80, 0x00, 0x01, 0x40,
+  0x80, 0xB7, 0x00, 0x00, 0x04, 0xB7, 0x00, 0x00, 0x02, 0x80, 0x00, 0x02, 0x90, 0xE0, 0x80, 0x81,
+  0x00, 0x05, 0x01, 0x02, 0x04, 0x00, 0x00, 0x40, 0xB2, 0x00, 0x01, 0x80, 0xE0, 0x81, 0x80, 0xA7,
+  0x00, 0x15, 0x80, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0x70, 0x78, 0x38, 0x9C, 0x9E, 0xCE, 0xEE, 0xF7,
+  0xF7, 0x7B, 0x7F, 0xBF, 0xBE, 0x9C, 0x80, 0xE0, 0x83, 0x00, 0x02, 0x02, 0x08, 0x20, 0xA4, 0x00,
+  0x01, 0x10, 0x01, 0x83, 0x00, 0x01, 0x80, 0x98, 0x80, 0x9F, 0x07, 0x9B, 0xBB, 0xBB, 0xF7, 0xF7,
+  0x67, 0x66, 0x6E, 0x80, 0x4E, 0x0D, 0x1C, 0x1C, 0x9C, 0x98, 0xB8, 0xB8, 0x78, 0x78, 0x70, 0x30,
+  0x18, 0x08, 0x00, 0x04, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x80, 0x00, 0x16, 0x02,
+  0x02, 0x06, 0x06, 0x07, 0x0F, 0x17, 0x13, 0x15, 0xC5, 0x46, 0x26, 0x22, 0x83, 0x93, 0x89, 0xC9,
+  0xCD, 0xEF, 0xE7, 0xE7, 0x77, 0x77, 0x80, 0x3B, 0x80, 0x1F, 0x01, 0x18, 0x80, 0x83, 0x00, 0x01,
+  0x01, 0x20, 0x90, 0x00, 0x02, 0xFF, 0x00, 0x9E, 0x00, 0x00, 0x80, 0x84, 0xC0, 0x84, 0x80, 0x98,
+  0x00, 0x85, 0x80, 0x84, 0xC0, 0x01, 0x00, 0x80, 0x80, 0x00, 0x01, 0x40, 0x80, 0xBD, 0x00, 0x00,
+  0x7F, 0x91, 0xFF, 0x02, 0xFE, 0xFE, 0x7E, 0x87, 0x00, 0x80, 0xFE, 0x91, 0xFF, 0x06, 0x00, 0x01,
+  0x00, 0x04, 0x00, 0x00, 0x01, 0xC5, 0x00, 0x01, 0x80, 0x80, 0x81, 0xC0, 0x80, 0xE0, 0x85, 0xF0,
+  0x83, 0xF8, 0x86, 0xF0, 0x80, 0xE0, 0x80, 0xC0, 0x02, 0x80, 0x80, 0x00, 0x82, 0x01, 0xC2, 0x00,
+  0x0A, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0x80, 0xFF, 0x03, 0x7F,
+  0x7F, 0x3F, 0x3F, 0x80, 0x1F, 0x81, 0x0F, 0x8D, 0x07, 0x82, 0x0F, 0x01, 0x1F, 0x1F, 0x80, 0x3F,
+  0x82, 0xFF, 0x09, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0xC0, 0x80, 0xB4, 0x00, 0x05,
+  0x80, 0xC0, 0xE0, 0xF0, 0xFC, 0xFE, 0x82, 0xFF, 0x07, 0x3F, 0x3F, 0x0F, 0x0F, 0x07, 0x03, 0x03,
+  0x01, 0x9E, 0x00, 0x11, 0x80, 0xE0, 0xF0, 0xF8, 0x3C, 0x1E, 0xCF, 0xE7, 0xFF, 0x7F, 0x1F, 0x0F,
+  0x07, 0x0F, 0x0F, 0x1F, 0x3F, 0x7F, 0x81, 0xFF, 0x05, 0xFE, 0xFC, 0xF8, 0xE0, 0xC0, 0x80, 0xAA,
+  0x00, 0x02, 0xE0, 0xF8, 0xFE, 0x82, 0xFF, 0x04, 0x7F, 0x1F, 0x0F, 0x03, 0x01, 0x9F, 0x00, 0x10,
+  0x80, 0x80, 0xE0, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0xC3, 0xE1, 0xF8, 0x7C, 0x3F, 0x0F, 0x07,
+  0x01, 0x86, 0x00, 0x04, 0x01, 0x03, 0x07, 0x1F, 0x7F, 0x82, 0xFF, 0x03, 0xFE, 0xF8, 0xE0, 0x80,
+  0xA4, 0x00, 0x00, 0xF8, 0x84, 0xFF, 0x02, 0x9F, 0x83, 0x00, 0x83, 0x80, 0x81, 0x00, 0x89, 0x80,
+  0x06, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0x81, 0xFE, 0x87, 0xFF, 0x80, 0xFE, 0x03, 0xFF,
+  0x0F, 0x03, 0x81, 0x81, 0x80, 0x8C, 0x00, 0x01, 0x01, 0x07, 0x84, 0xFF, 0x00, 0xFC, 0x91, 0x00,
+  0x02, 0xFF, 0x00, 0x9E, 0x00, 0x00, 0x80, 0x82, 0xC0, 0x84, 0x80, 0x9D, 0x00, 0x84, 0x80, 0x81,
+  0xC0, 0x07, 0x80, 0x00, 0x80, 0x40, 0x40, 0x00, 0x00, 0x80, 0x83, 0x00, 0x04, 0x80, 0x00, 0x80,
+  0x00, 0x80, 0xB2, 0x00, 0x00, 0x7F, 0x8E, 0xFF, 0x82, 0xFE, 0x00, 0x7E, 0x87, 0x00, 0x82, 0xFE,
+  0x8F, 0xFF, 0x01, 0x00, 0x03, 0x80, 0x00, 0x01, 0x02, 0x01, 0x80, 0x00, 0x03, 0x03, 0x00, 0x00,
+  0x03, 0x80, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x01, 0x01, 0xAD, 0x00, 0x84, 0x01, 0x01, 0x81,
+  0x81, 0x81, 0xC1, 0x81, 0xE1, 0x80, 0xF1, 0x8A, 0xF0, 0x80, 0xF1, 0x80, 0xE1, 0x81, 0xC1, 0x80,
+  0x81, 0x85, 0x01, 0xC1, 0x00, 0x09, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE,
+  0x80, 0xFF, 0x01, 0x7F, 0x7F, 0x80, 0x3F, 0x80, 0x1F, 0x82, 0x0F, 0x8A, 0x07, 0x07, 0x87, 0xF7,
+  0xFF, 0x7F, 0x7F, 0xFF, 0xFF, 0x7F, 0x80, 0x3F, 0x00, 0x7F, 0x80, 0xFF, 0x09, 0xFE, 0xFE, 0xFC,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xB6, 0x00, 0x04, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0x82,
+  0xFF, 0x08, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x03, 0x01, 0x01, 0x95, 0x00, 0x09, 0xC0, 0xF8,
+  0xFE, 0x3F, 0x0F, 0x01, 0xF0, 0xFE, 0xFF, 0x07, 0x84, 0x00, 0x07, 0x01, 0x03, 0x03, 0x07, 0x0F,
+  0x0F, 0x3F, 0x3F, 0x82, 0xFF, 0x04, 0xFC, 0xFC, 0xF0, 0xE0, 0xC0, 0xAB, 0x00, 0x02, 0xE0, 0xF8,
+  0xFE, 0x82, 0xFF, 0x04, 0x7F, 0x1F, 0x0F, 0x07, 0x01, 0x9B, 0x00, 0x0C, 0x80, 0xE0, 0xF8, 0xFE,
+  0xFF, 0x87, 0x01, 0x80, 0xF0, 0xFF, 0xFF, 0x1F, 0x01, 0x8E, 0x00, 0x04, 0x01, 0x07, 0x0F, 0x1F,
+  0x7F, 0x82, 0xFF, 0x03, 0xFE, 0xF8, 0xE0, 0x80, 0xA4, 0x00, 0x00, 0xF8, 0x84, 0xFF, 0x00, 0x3F,
+  0x82, 0x07, 0x81, 0x0E, 0x04, 0x04, 0x00, 0x00, 0x18, 0x18, 0x80, 0x38, 0x80, 0x78, 0x00, 0xF8,
+  0x80, 0x30, 0x06, 0xF0, 0xE0, 0xE0, 0xF8, 0xF8, 0xFC, 0xFC, 0x80, 0xFE, 0x89, 0xFF, 0x03, 0xF1,
+  0xC0, 0x80, 0x80, 0x92, 0x00, 0x01, 0x01, 0x0F, 0x84, 0xFF, 0x00, 0xFC, 0x91, 0x00, 0x03, 0xFF,
+  0x00, 0x9E, 0x00, 0x05, 0x80, 0x40, 0x00, 0x00, 0x40, 0x40, 0x82, 0x00, 0x01, 0x80, 0x80, 0x9D,
+  0x00, 0x00, 0x80, 0x83, 0x00, 0x03, 0x40, 0x00, 0x00, 0x40, 0x81, 0x00, 0x02, 0x60, 0x20, 0x40,
+  0xBE, 0x00, 0x00, 0x80, 0x8D, 0x00, 0x00, 0x01, 0x81, 0x00, 0x01, 0x02, 0x02, 0x87, 0x00, 0x00,
+  0x02, 0x81, 0x00, 0x01, 0x01, 0x01, 0xD5, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x40, 0x80, 0x00,
+  0x00, 0x20, 0x80, 0x00, 0x00, 0x10, 0x8E, 0x00, 0x00, 0x10, 0x86, 0x00, 0x00, 0x80, 0xCB, 0x00,
+  0x00, 0x20, 0x84, 0x00, 0x04, 0x01, 0x00, 0x00, 0x80, 0x80, 0x82, 0x00, 0x00, 0x10, 0x82, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80, 0xF8, 0x0F, 0x38, 0xF8, 0xF8, 0xF0, 0x00, 0x88, 0xF8,
+  0xF0, 0x70, 0x70, 0xE0, 0xE0, 0x40, 0x00, 0x00, 0x40, 0x82, 0x00, 0x02, 0x02, 0x00, 0x04, 0xC1,
+  0x00, 0x00, 0x01, 0x8A, 0x00, 0x05, 0x01, 0x07, 0x0F, 0x3F, 0x3C, 0x38, 0x89, 0x00, 0x0F, 0xFE,
+  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x3F, 0x07, 0xFE, 0x3F, 0x0F, 0x01, 0xF0, 0xFE, 0xFF, 0x07, 0x89,
+  0x00, 0x02, 0x10, 0x00, 0x40, 0x81, 0x00, 0x02, 0x01, 0x00, 0x04, 0xCB, 0x00, 0x05, 0x07, 0x1F,
+  0x7E, 0xF8, 0xE0, 0xC0, 0x82, 0x00, 0x0F, 0xFE, 0xFF, 0xFF, 0x43, 0x60, 0x78, 0x01, 0x00, 0x78,
+  0x81, 0x80, 0xF0, 0xFF, 0xFF, 0x1F, 0x01, 0xCD, 0x00, 0x81, 0x07, 0x81, 0x0E, 0x04, 0x04, 0x00,
+  0x00, 0x18, 0x18, 0x80, 0x38, 0x80, 0x78, 0x00, 0xF8, 0x80, 0x30, 0x09, 0x70, 0x03, 0x0F, 0x07,
+  0x06, 0x00, 0x02, 0x00, 0x01, 0x01, 0x86, 0x00, 0x06, 0x03, 0x07, 0x0F, 0x11, 0x40, 0x80, 0x80,
+  0x92, 0x00, 0x00, 0x02, 0x9A, 0x00, 0x03, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x40, 0x81, 0x00, 0x03,
+  0x80, 0xC0, 0x20, 0x60, 0xD6, 0x00, 0x00, 0x80, 0x9F, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02,
+  0xC9, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x20, 0x80, 0x00, 0x03, 0x10, 0x00, 0x00, 0x01, 0x8B,
+  0x00, 0x00, 0x10, 0x80, 0x00, 0x00, 0x20, 0x80, 0x00, 0x02, 0x40, 0x00, 0x80, 0xD6, 0x00, 0x01,
+  0x80, 0xC0, 0x86, 0x00, 0x80, 0x08, 0x0A, 0x00, 0x08, 0xF8, 0xF0, 0x00, 0xE0, 0x00, 0xC0, 0x00,
+  0xF0, 0xF0, 0x85, 0x00, 0x03, 0x20, 0x00, 0x00, 0x40, 0x82, 0x00, 0x02, 0x02, 0x00, 0x04, 0x82,
+  0x00, 0x01, 0x40, 0x80, 0xB5, 0x00, 0x00, 0x40, 0x8E, 0x00, 0x06, 0x01, 0x01, 0x07, 0x0F, 0x3F,
+  0x3C, 0x38, 0x88, 0x00, 0x08, 0xFF, 0x01, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x8D, 0x00,
+  0x00, 0x02, 0x80, 0x00, 0x02, 0x10, 0x20, 0x40, 0x81, 0x00, 0x06, 0x01, 0x02, 0x04, 0x08, 0x00,
+  0x00, 0x80, 0xAC, 0x00, 0x00, 0x02, 0x82, 0x00, 0x01, 0x80, 0x20, 0x90, 0x00, 0x05, 0x07, 0x1F,
+  0x7E, 0xF8, 0xE0, 0xC0, 0x80, 0x00, 0x0B, 0xC0, 0xFC, 0x01, 0x00, 0x00, 0x23, 0x00, 0x40, 0x00,
+  0x00, 0x01, 0x80, 0x95, 0x00, 0x01, 0x04, 0x08, 0x86, 0x00, 0x01, 0x10, 0x40, 0xA4, 0x00, 0x01,
+  0x08, 0x01, 0x83, 0x00, 0x00, 0x40, 0x95, 0x00, 0x07, 0x80, 0x23, 0x0F, 0x0F, 0x06, 0x04, 0x02,
+  0x01, 0x8C, 0x00, 0x00, 0x40, 0x94, 0x00, 0x01, 0x02, 0x08, 0x84, 0x00, 0x01, 0x02, 0xC0, 0x90,
+  0x00, 0x02, 0xFF, 0x00, 0x9E, 0x00, 0x00, 0x80, 0x84, 0xC0, 0x84, 0x80, 0x98, 0x00, 0x84, 0x80,
+  0x84, 0xC0, 0x07, 0x80, 0x00, 0x80, 0x00, 0x20, 0x20, 0x00, 0x80, 0x83, 0x00, 0x04, 0x80, 0x00,
+  0x80, 0x00, 0x80, 0xB2, 0x00, 0x00, 0x7F, 0x90, 0xFF, 0x80, 0xFE, 0x00, 0x3E, 0x86, 0x00, 0x00,
+  0x3E, 0x80, 0xFE, 0x91, 0xFF, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0x03,
+  0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x01, 0x01, 0xAD, 0x00, 0x82, 0x01,
+  0x01, 0x81, 0x81, 0x80, 0xC1, 0x80, 0xE1, 0x00, 0xE9, 0x82, 0xF1, 0x8B, 0xF8, 0x00, 0xF0, 0x82,
+  0xF1, 0x80, 0xE1, 0x04, 0xC1, 0xC1, 0xC0, 0x80, 0x80, 0xC7, 0x00, 0x09, 0x80, 0xC0, 0xE0, 0xF0,
+  0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0x80, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x1F, 0x04, 0x7F,
+  0xFF, 0xFF, 0xEF, 0xC7, 0x82, 0x07, 0x85, 0x03, 0x82, 0x07, 0x80, 0x0F, 0x80, 0x1F, 0x02, 0x3F,
+  0x3F, 0x7F, 0x81, 0xFF, 0x09, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xB4,
+  0x00, 0x05, 0x80, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0x81, 0xFF, 0x07, 0x7F, 0x3F, 0x1F, 0x0F, 0x07,
+  0x03, 0x03, 0x01, 0x87, 0x00, 0x08, 0x03, 0x23, 0xF3, 0xF3, 0xFF, 0xFE, 0xF8, 0xE0, 0xC0, 0x8C,
+  0x00, 0x06, 0x80, 0xC0, 0xF0, 0xF0, 0xFC, 0x7C, 0xBF, 0x80, 0xFF, 0x00, 0x3F, 0x81, 0x0F, 0x02,
+  0x1F, 0x3F, 0x7F, 0x81, 0xFF, 0x05, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x80, 0xA9, 0x00, 0x02, 0x80,
+  0xF0, 0xFC, 0x83, 0xFF, 0x03, 0x3F, 0x1F, 0x07, 0x01, 0x92, 0x00, 0x0A, 0x07, 0xFF, 0xFF, 0xFD,
+  0x03, 0x0F, 0x9F, 0xFE, 0xFC, 0xF0, 0xC0, 0x80, 0x00, 0x10, 0x80, 0x80, 0xC0, 0xE0, 0xF0, 0x78,
+  0x3E, 0x1F, 0x0F, 0x87, 0xE1, 0xF0, 0xF8, 0x7E, 0x1F, 0x07, 0x03, 0x87, 0x00, 0x03, 0x03, 0x07,
+  0x1F, 0x3F, 0x82, 0xFF, 0x03, 0xFE, 0xFC, 0xF0, 0x80, 0xA3, 0x00, 0x01, 0xC0, 0xFC, 0x84, 0xFF,
+  0x01, 0x0F, 0x01, 0x94, 0x00, 0x03, 0x80, 0xE0, 0xF0, 0xF9, 0x80, 0xFF, 0x00, 0xFE, 0x8A, 0xFF,
+  0x06, 0xFE, 0xFE, 0xFC, 0xFE, 0x1F, 0x07, 0x03, 0x90, 0x00, 0x01, 0x01, 0x07, 0x84, 0xFF, 0x01,
+  0xFE, 0x80, 0x90, 0x00, 0x02, 0xFF, 0x00, 0x9E, 0x00, 0x03, 0xE0, 0xE0, 0xF0, 0xF0, 0x84, 0xE0,
+  0x83, 0xC0, 0x83, 0x80, 0x87, 0x00, 0x84, 0x80, 0x83, 0xC0, 0x84, 0xE0, 0x0A, 0xF0, 0xF0, 0xE0,
+  0xE0, 0x00, 0x80, 0x00, 0x20, 0x20, 0x00, 0x80, 0x83, 0x00, 0x04, 0x80, 0x00, 0x80, 0x00, 0x80,
+  0xB2, 0x00, 0x00, 0x3F, 0x92, 0x7F, 0x00, 0x3F, 0x87, 0x00, 0x01, 0x1F, 0x3F, 0x92, 0x7F, 0x07,
+  0x3F, 0x00, 0x01, 0x00, 0x04, 0x04, 0x00, 0x01, 0x80, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x80,
+  0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x01, 0x01, 0xAF, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x01, 0xE0,
+  0xE0, 0x80, 0xF0, 0x81, 0xF8, 0x85, 0xFC, 0x83, 0xFE, 0x85, 0xFC, 0x80, 0xF8, 0x81, 0xF0, 0x01,
+  0xE0, 0xE0, 0x80, 0xC0, 0x00, 0x80, 0xC2, 0x00, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC,
+  0xFE, 0x83, 0xFF, 0x02, 0x3F, 0x3F, 0x1F, 0x80, 0x0F, 0x80, 0x07, 0x81, 0x03, 0x8C, 0x01, 0x82,
+  0x03, 0x80, 0x07, 0x06, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x81, 0xFF, 0x08, 0xFE, 0xFE,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xB1, 0x00, 0x04, 0xC0, 0xE0, 0xF8, 0xFC, 0xFE, 0x82,
+  0xFF, 0x12, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x18,
+  0x90, 0xA0, 0xC0, 0xC0, 0x80, 0xA1, 0x00, 0x06, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x3F, 0x7F, 0x82,
+  0xFF, 0x04, 0xFE, 0xF8, 0xF0, 0xE0, 0x80, 0xA7, 0x00, 0x02, 0x80, 0xE0, 0xFC, 0x83, 0xFF, 0x03,
+  0x7F, 0x0F, 0x07, 0x01, 0x8C, 0x00, 0x0C, 0x01, 0x07, 0x0F, 0x1F, 0x3F, 0xFF, 0xFE, 0x3C, 0x18,
+  0xB8, 0xF0, 0xE0, 0xC0, 0x86, 0x80, 0x87, 0x00, 0x81, 0x80, 0x01, 0xC0, 0xC0, 0x80, 0xE0, 0x06,
+  0x70, 0x70, 0x78, 0x38, 0xB8, 0x9C, 0xDC, 0x87, 0xFF, 0x02, 0xFE, 0xF8, 0xE0, 0xA3, 0x00, 0x00,
+  0xF8, 0x85, 0xFF, 0x00, 0x83, 0x8F, 0x80, 0x82, 0xC0, 0x05, 0xE0, 0xF0, 0xFB, 0xFF, 0xFE, 0xFE,
+  0x8B, 0xFF, 0x83, 0xFE, 0x0C, 0xFF, 0xE7, 0xC7, 0xE7, 0xE3, 0xF3, 0x71, 0x79, 0x38, 0x1C, 0x1C,
+  0x1E, 0x0E, 0x83, 0x0F, 0x81, 0x0E, 0x00, 0x07, 0x85, 0xFF, 0x00, 0xC0, 0x90, 0x00, 0x02, 0xFF,
+  0x00, 0x9E, 0x00, 0x03, 0xE0, 0xF0, 0xF8, 0xF8, 0x82, 0xF0, 0x85, 0xE0, 0x82, 0xC0, 0x01, 0x80,
+  0x80, 0x87, 0x00, 0x00, 0x80, 0x83, 0xC0, 0x84, 0xE0, 0x82, 0xF0, 0x80, 0xF8, 0x07, 0xF0, 0x00,
+  0x80, 0x00, 0x20, 0x20, 0x00, 0x80, 0x83, 0x00, 0x04, 0x80, 0x00, 0x80, 0x00, 0x80, 0xB2, 0x00,
+  0x00, 0x1F, 0x93, 0x3F, 0x00, 0x0F, 0x87, 0x00, 0x94, 0x3F, 0x06, 0x00, 0x03, 0x00, 0x04, 0x04,
+  0x00, 0x01, 0x80, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01,
+  0x01, 0x01, 0xAD, 0x00, 0x05, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0x80, 0xF0, 0x01, 0xF8, 0xF8,
+  0x82, 0xFC, 0x84, 0xFE, 0x84, 0xFF, 0x83, 0xFE, 0x82, 0xFC, 0x01, 0xF8, 0xF8, 0x80, 0xF0, 0x05,
+  0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0xBF, 0x00, 0x08, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0xFE, 0xFE, 0x80, 0xFF, 0x08, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x81, 0x03,
+  0x80, 0x01, 0x8D, 0x00, 0x81, 0x01, 0x80, 0x03, 0x08, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F,
+  0x7F, 0x7F, 0x81, 0xFF, 0x07, 0xFE, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xAF, 0x00, 0x04,
+  0x80, 0xC0, 0xF0, 0xF8, 0xFC, 0x82, 0xFF, 0x05, 0x7F, 0x3F, 0x0F, 0x07, 0x03, 0x01, 0xB0, 0x00,
+  0x06, 0x01, 0x03, 0x03, 0x07, 0x1F, 0x3F, 0x7F, 0x82, 0xFF, 0x04, 0xFC, 0xF8, 0xF0, 0xC0, 0x80,
+  0xA6, 0x00, 0x02, 0x80, 0xF0, 0xFE, 0x86, 0xFF, 0x03, 0xFE, 0xBE, 0xBC, 0x3C, 0x80, 0x78, 0x07,
+  0xF0, 0xF0, 0xD0, 0xC0, 0xE0, 0xE0, 0xC0, 0xC0, 0x81, 0x80, 0x84, 0x00, 0x80, 0x80, 0x85, 0xC0,
+  0x80, 0x80, 0x96, 0x00, 0x02, 0x01, 0x03, 0x0F, 0x84, 0xFF, 0x02, 0xFE, 0xF0, 0xC0, 0xA2, 0x00,
+  0x00, 0xF8, 0x85, 0xFF, 0x82, 0x01, 0x10, 0x03, 0x03, 0x07, 0x07, 0x0E, 0x0E, 0x1C, 0x1C, 0x39,
+  0x39, 0x79, 0x71, 0xF3, 0xE3, 0xE7, 0xC7, 0xE7, 0x81, 0xFF, 0x01, 0xFE, 0xFE, 0x8E, 0xFF, 0x03,
+  0xFE, 0xFE, 0xFC, 0xFC, 0x81, 0xF8, 0x00, 0x38, 0x83, 0x9C, 0x81, 0xCE, 0x06, 0xEE, 0xEE, 0xE6,
+  0x66, 0x67, 0x77, 0x77, 0x80, 0x3F, 0x00, 0x7F, 0x84, 0xFF, 0x00, 0xF0, 0x90, 0x00, 0x02, 0xFF,
+  0x00, 0x9F, 0x00, 0x00, 0xF0, 0x81, 0xF8, 0x82, 0xF0, 0x84, 0xE0, 0x83, 0xC0, 0x00, 0x80, 0x87,
+  0x00, 0x83, 0xC0, 0x84, 0xE0, 0x82, 0xF0, 0x81, 0xF8, 0x06, 0xF0, 0x80, 0x00, 0x20, 0x20, 0x00,
+  0x80, 0x83, 0x00, 0x04, 0x80, 0x00, 0x80, 0x00, 0x80, 0xB3, 0x00, 0x00, 0x1F, 0x93, 0x3F, 0x00,
+  0x0F, 0x87, 0x00, 0x00, 0x1F, 0x92, 0x3F, 0x06, 0x1F, 0x03, 0x00, 0x04, 0x04, 0x00, 0x01, 0x80,
+  0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x01, 0x01, 0xAE,
+  0x00, 0x05, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0x80, 0xF0, 0x80, 0xF8, 0x81, 0xFC, 0x85, 0xFE,
+  0x82, 0xFF, 0x84, 0xFE, 0x82, 0xFC, 0x01, 0xF8, 0xF8, 0x80, 0xF0, 0x05, 0xE0, 0xE0, 0xC0, 0xC0,
+  0x80, 0x80, 0xBF, 0x00, 0x08, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0x80, 0xFF,
+  0x06, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x0F, 0x80, 0x07, 0x80, 0x03, 0x81, 0x01, 0x8C, 0x00,
+  0x81, 0x01, 0x80, 0x03, 0x08, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x81, 0xFF,
+  0x07, 0xFE, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xB0, 0x00, 0x04, 0xC0, 0xF0, 0xF8, 0xFC,
+  0xFE, 0x81, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0x0B, 0x7F, 0xFF, 0xFF, 0xCF, 0x9C, 0x3C, 0x78, 0xF0,
+  0xE0, 0xC0, 0xC0, 0x80, 0xA6, 0x00, 0x06, 0x01, 0x03, 0x03, 0x0F, 0x1F, 0x3F, 0x7F, 0x82, 0xFF,
+  0x04, 0xFE, 0xF8, 0xF0, 0xC0, 0x80, 0xA7, 0x00, 0x01, 0xF0, 0xFC, 0x83, 0xFF, 0x03, 0x3F, 0x0F,
+  0x03, 0x01, 0x83, 0x00, 0x11, 0x01, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x79, 0xF1, 0xE3, 0xC7, 0x8F,
+  0x1E, 0x1E, 0x3C, 0xF8, 0xF0, 0xE0, 0xE0, 0x89, 0xC0, 0x80, 0x80, 0x97, 0x00, 0x02, 0x03, 0x0F,
+  0x3F, 0x83, 0xFF, 0x02, 0xFE, 0xF8, 0x80, 0xA2, 0x00, 0x00, 0xC0, 0x85, 0xFF, 0x00, 0xE3, 0x83,
+  0xE0, 0x01, 0x60, 0x60, 0x80, 0x00, 0x80, 0x60, 0x80, 0x70, 0x06, 0x71, 0xF1, 0xF3, 0x17, 0x1F,
+  0x3E, 0xFE, 0x92, 0xFF, 0x05, 0xFE, 0xFC, 0xF8, 0xE0, 0x80, 0x80, 0x92, 0x00, 0x01, 0x01, 0x7F,
+  0x84, 0xFF, 0x00, 0xF8, 0x8F, 0x00, 0x03, 0xFF, 0x00, 0xA4, 0x00, 0x80, 0x08, 0x01, 0x00, 0x00,
+  0x80, 0x10, 0x81, 0x00, 0x80, 0x20, 0x80, 0x00, 0x00, 0x40, 0x8B, 0x00, 0x01, 0x20, 0x20, 0x82,
+  0x00, 0x01, 0x10, 0x10, 0x81, 0x00, 0x00, 0x08, 0x82, 0x00, 0x00, 0x40, 0xD9, 0x00, 0x00, 0x20,
+  0xE9, 0x00, 0x00, 0x40, 0x83, 0x00, 0x03, 0x08, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x02, 0x82,
+  0x00, 0x80, 0x01, 0x82, 0x00, 0x80, 0x01, 0x81, 0x00, 0x00, 0x02, 0x83, 0x00, 0x07, 0x08, 0x00,
+  0x00, 0x10, 0x00, 0x20, 0x00, 0x40, 0xC4, 0x00, 0x04, 0x08, 0x00, 0x00, 0x02, 0x01, 0x81, 0x00,
+  0x03, 0x40, 0x00, 0x20, 0x10, 0x81, 0x00, 0x07, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x01,
+  0x8C, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x10, 0x87, 0x00, 0x00, 0x04, 0xB4, 0x00, 0x00, 0x80,
+  0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x0B, 0x9C, 0x3E, 0x3F, 0x4F, 0x1C,
+  0x3C, 0x78, 0xF0, 0xE0, 0xC0, 0xC0, 0x80, 0xA6, 0x00, 0x04, 0x01, 0x02, 0x00, 0x00, 0x10, 0xB2,
+  0x00, 0x02, 0x80, 0x08, 0x02, 0x83, 0x00, 0x1B, 0x20, 0x08, 0x00, 0x02, 0x03, 0x07, 0x07, 0x0E,
+  0x1C, 0x3D, 0x78, 0x70, 0xF0, 0xE8, 0xD9, 0xF2, 0xE7, 0xED, 0xDB, 0xBF, 0xF7, 0x6E, 0xFE, 0xDC,
+  0x38, 0x30, 0x60, 0x60, 0x80, 0x40, 0x86, 0x00, 0x00, 0x40, 0xCA, 0x00, 0x00, 0x20, 0x85, 0x00,
+  0x84, 0xE0, 0x01, 0x60, 0x60, 0x80, 0x00, 0x0C, 0x60, 0x60, 0x61, 0x71, 0x73, 0x77, 0x7E, 0xEF,
+  0xED, 0x2B, 0xE3, 0xC2, 0x01, 0x95, 0x00, 0x02, 0x10, 0x70, 0x60, 0x92, 0xE0, 0x01, 0xF0, 0x80,
+  0x97, 0x00, 0x02, 0xFF, 0x00, 0x9E, 0x00, 0x00, 0xE0, 0x86, 0xF8, 0x82, 0xF0, 0x84, 0xE0, 0x01,
+  0xC0, 0xC0, 0x87, 0x00, 0x01, 0xC0, 0xC0, 0x84, 0xE0, 0x83, 0xF0, 0x85, 0xF8, 0x06, 0xE0, 0x80,
+  0x00, 0x20, 0x20, 0x00, 0x80, 0x83, 0x00, 0x04, 0x80, 0x00, 0x80, 0x00, 0x80, 0xB2, 0x00, 0x02,
+  0x0F, 0x1F, 0x1F, 0x8F, 0x3F, 0x02, 0x1F, 0x1F, 0x0F, 0x87, 0x00, 0x02, 0x0F, 0x1F, 0x1F, 0x90,
+  0x3F, 0x07, 0x1F, 0x07, 0x03, 0x00, 0x04, 0x04, 0x00, 0x01, 0x80, 0x00, 0x03, 0x03, 0x00, 0x00,
+  0x03, 0x80, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x01, 0x01, 0xAD, 0x00, 0x04, 0x80, 0xC0, 0xC0,
+  0xE0, 0xE0, 0x80, 0xF0, 0x01, 0xF8, 0xF8, 0x81, 0xFC, 0x81, 0xFE, 0x83, 0xFF, 0x82, 0x7F, 0x83,
+  0xFF, 0x81, 0xFE, 0x81, 0xFC, 0x01, 0xF8, 0xF8, 0x80, 0xF0, 0x00, 0xE0, 0x80, 0xC0, 0x00, 0x80,
+  0xBE, 0x00, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0x81, 0xFF, 0x07, 0x7F, 0x3F,
+  0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x80, 0x03, 0x80, 0x01, 0x92, 0x00, 0x01, 0x01, 0x01, 0x81,
+  0x03, 0x00, 0x07, 0x80, 0x0F, 0x03, 0x1F, 0x3F, 0x3F, 0x7F, 0x81, 0xFF, 0x07, 0xFE, 0xFC, 0xF8,
+  0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xAE, 0x00, 0x04, 0x80, 0xC0, 0xF0, 0xF8, 0xFC, 0x82, 0xFF, 0x05,
+  0x7F, 0x3F, 0x0F, 0x07, 0x03, 0x01, 0xB1, 0x00, 0x04, 0x01, 0x03, 0x03, 0x0F, 0x9F, 0x83, 0xFF,
+  0x04, 0xFE, 0xFC, 0xF8, 0xE0, 0xC0, 0xA7, 0x00, 0x01, 0xE0, 0xFE, 0x84, 0xFF, 0x02, 0x0F, 0x03,
+  0x01, 0x95, 0x00, 0x01, 0x80, 0x80, 0x80, 0xC0, 0x84, 0xE0, 0x01, 0xC0, 0xC0, 0x84, 0x80, 0x01,
+  0xC0, 0xC0, 0x80, 0xE0, 0x0D, 0x70, 0x70, 0x78, 0x38, 0x38, 0x9C, 0x9C, 0xDE, 0xCE, 0xEE, 0xE7,
+  0x77, 0x7F, 0x3F, 0x81, 0x1F, 0x00, 0x7F, 0x83, 0xFF, 0x01, 0xF8, 0xE0, 0xA2, 0x00, 0x00, 0xC0,
+  0x85, 0xFF, 0x06, 0x7F, 0x3F, 0x7F, 0x76, 0x76, 0x66, 0x66, 0x80, 0xEE, 0x80, 0xCE, 0x00, 0xCC,
+  0x82, 0x9C, 0x02, 0x1C, 0x1C, 0xBC, 0x80, 0xF8, 0x02, 0xFC, 0xFC, 0xFE, 0x94, 0xFF, 0x0D, 0xF9,
+  0x71, 0x78, 0x38, 0x3C, 0x1C, 0x1E, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x86, 0x00, 0x00,
+  0x1F, 0x84, 0xFF, 0x00, 0xFC, 0x90, 0x00, 0x02, 0xFF, 0x00, 0x9D, 0x00, 0x01, 0x80, 0xF0, 0x83,
+  0xF8, 0x82, 0xF0, 0x84, 0xE0, 0x81, 0xC0, 0x87, 0x00, 0x82, 0xC0, 0x84, 0xE0, 0x82, 0xF0, 0x83,
+  0xF8, 0x07, 0xF0, 0x00, 0x80, 0x00, 0x20, 0x20, 0x00, 0x80, 0x83, 0x00, 0x04, 0x80, 0x00, 0x80,
+  0x00, 0x80, 0xB1, 0x00, 0x01, 0x07, 0x1F, 0x92, 0x3F, 0x00, 0x1F, 0x87, 0x00, 0x01, 0x0F, 0x1F,
+  0x92, 0x3F, 0x07, 0x1F, 0x00, 0x01, 0x00, 0x04, 0x04, 0x00, 0x01, 0x80, 0x00, 0x03, 0x03, 0x00,
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x01, 0x01, 0xAC, 0x00, 0x05, 0x80, 0x80,
+  0xC0, 0xC0, 0xE0, 0xE0, 0x80, 0xF0, 0x80, 0xF8, 0x81, 0xFC, 0x83, 0xFE, 0x87, 0xFF, 0x82, 0xFE,
+  0x82, 0xFC, 0x01, 0xF8, 0xF8, 0x80, 0xF0, 0x05, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0xBF, 0x00,
+  0x07, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0x80, 0xFF, 0x08, 0x7F, 0x7F, 0x3F, 0x3F,
+  0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x81, 0x03, 0x80, 0x01, 0x8E, 0x00, 0x81, 0x01, 0x80, 0x03, 0x05,
+  0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x9F, 0x84, 0xFF, 0x06, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0xC0,
+  0xB0, 0x00, 0x04, 0xC0, 0xE0, 0xF8, 0xFC, 0xFE, 0x82, 0xFF, 0x05, 0x3F, 0x1F, 0x0F, 0x07, 0x03,
+  0x01, 0xA2, 0x00, 0x14, 0x80, 0xC0, 0xE0, 0xF0, 0x70, 0x38, 0x3C, 0x3E, 0xDF, 0xEF, 0xF7, 0x7F,
+  0x3F, 0x1F, 0x0F, 0x07, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x81, 0xFF, 0x04, 0xFE, 0xFC, 0xF0, 0xE0,
+  0x80, 0xA7, 0x00, 0x01, 0xC0, 0xF8, 0x84, 0xFF, 0x02, 0x1F, 0x07, 0x01, 0x96, 0x00, 0x80, 0x80,
+  0x85, 0xC0, 0x80, 0xE0, 0x0F, 0xF0, 0xF8, 0xFC, 0xDE, 0x9F, 0x87, 0x87, 0xE1, 0xF1, 0xF8, 0x7C,
+  0x3E, 0x0F, 0x07, 0x03, 0x01, 0x87, 0x00, 0x03, 0x01, 0x07, 0x1F, 0x7F, 0x82, 0xFF, 0x02, 0xFE,
+  0xF8, 0xE0, 0xA3, 0x00, 0x00, 0xFE, 0x84, 0xFF, 0x00, 0x0F, 0x92, 0x00, 0x06, 0x80, 0x80, 0xC0,
+  0xE0, 0xF8, 0xFE, 0xFE, 0x92, 0xFF, 0x02, 0x1F, 0x07, 0x01, 0x92, 0x00, 0x00, 0x07, 0x85, 0xFF,
+  0x91, 0x00, 0x02, 0xFF, 0x00, 0x9D, 0x00, 0x01, 0xE0, 0xF0, 0x80, 0xF8, 0x82, 0xF0, 0x85, 0xE0,
+  0x82, 0xC0, 0x00, 0x80, 0x87, 0x00, 0x83, 0xC0, 0x84, 0xE0, 0x82, 0xF0, 0x81, 0xF8, 0x01, 0xF0,
+  0xE0, 0x83, 0x00, 0x00, 0x80, 0xBC, 0x00, 0x00, 0x1F, 0x93, 0x3F, 0x00, 0x0F, 0x87, 0x00, 0x00,
+  0x1F, 0x93, 0x3F, 0x02, 0x0F, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x80, 0x80,
+  0xC0, 0x03, 0xE0, 0xE0, 0xF0, 0xF0, 0x80, 0xF8, 0x82, 0xFC, 0x87, 0xFE, 0x00, 0x7E, 0x85, 0xFE,
+  0x81, 0xFC, 0x80, 0xF8, 0x80, 0xF0, 0x05, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0xC0, 0x00, 0x07,
+  0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0x80, 0xFF, 0x06, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F,
+  0x0F, 0x0F, 0x80, 0x07, 0x80, 0x03, 0x81, 0x01, 0x87, 0x00, 0x08, 0x80, 0xF0, 0xFF, 0xFF, 0x1F,
+  0xC7, 0xFE, 0xFF, 0x1F, 0x81, 0x03, 0x00, 0x07, 0x80, 0x0F, 0x03, 0x1F, 0x3F, 0x3F, 0x7F, 0x81,
+  0xFF, 0x07, 0xFE, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xB0, 0x00, 0x04, 0xC0, 0xF0, 0xF8,
+  0xFC, 0xFE, 0x81, 0xFF, 0x06, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x97, 0x00, 0x09, 0xE0,
+  0xFC, 0xFF, 0x3F, 0x07, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x8C, 0x00, 0x05, 0x01, 0x03, 0x07, 0x0F,
+  0x3F, 0x7F, 0x82, 0xFF, 0x03, 0xFE, 0xF8, 0xF0, 0xC0, 0xA8, 0x00, 0x01, 0xE0, 0xFC, 0x83, 0xFF,
+  0x03, 0x7F, 0x1F, 0x03, 0x01, 0x96, 0x00, 0x80, 0x80, 0x03, 0xC0, 0xC0, 0xF0, 0xF8, 0x80, 0xFF,
+  0x06, 0xF1, 0xF0, 0xF0, 0xFE, 0xFF, 0xFF, 0x03, 0x94, 0x00, 0x02, 0x03, 0x0F, 0x3F, 0x83, 0xFF,
+  0x02, 0xFE, 0xF0, 0xC0, 0xA2, 0x00, 0x00, 0xE0, 0x85, 0xFF, 0x00, 0x07, 0x94, 0x00, 0x04, 0x80,
+  0xF0, 0xF8, 0xFE, 0xFE, 0x8F, 0xFF, 0x02, 0xFC, 0xF8, 0xE0, 0x94, 0x00, 0x01, 0x01, 0x1F, 0x84,
+  0xFF, 0x00, 0xFC, 0x91, 0x00, 0x02, 0xFF, 0x00, 0x9D, 0x00, 0x03, 0xC0, 0xF0, 0xF0, 0xF8, 0x83,
+  0xF0, 0x84, 0xE0, 0x83, 0xC0, 0x00, 0x80, 0x87, 0x00, 0x00, 0x80, 0x83, 0xC0, 0x84, 0xE0, 0x82,
+  0xF0, 0x80, 0xF8, 0x01, 0xF0, 0xE0, 0xC3, 0x00, 0x00, 0x0F, 0x93, 0x3F, 0x00, 0x1F, 0x87, 0x00,
+  0x00, 0x1F, 0x93, 0x3F, 0x00, 0x1F, 0xC6, 0x00, 0x05, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0x80,
+  0xF0, 0x80, 0xF8, 0x82, 0xFC, 0x8F, 0xFE, 0x82, 0xFC, 0x80, 0xF8, 0x80, 0xF0, 0x00, 0xE0, 0x80,
+  0xC0, 0x00, 0x80, 0xC0, 0x00, 0x08, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0x80,
+  0xFF, 0x08, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x81, 0x03, 0x80, 0x01, 0x89,
+  0x00, 0x13, 0xF8, 0xFF, 0xFF, 0x3F, 0x0E, 0xEF, 0xFF, 0xFD, 0x0F, 0x03, 0x03, 0x07, 0x07, 0x0F,
+  0x0F, 0x1F, 0x1F, 0x3F, 0x7F, 0x7F, 0x80, 0xFF, 0x07, 0xFE, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0,
+  0xC0, 0xB0, 0x00, 0x04, 0x80, 0xE0, 0xF0, 0xF8, 0xFE, 0x82, 0xFF, 0x05, 0x7F, 0x3F, 0x0F, 0x07,
+  0x03, 0x01, 0x98, 0x00, 0x09, 0xE0, 0xF8, 0xFE, 0x7F, 0x07, 0x01, 0xC0, 0xFF, 0xFF, 0x3F, 0x8B,
+  0x00, 0x05, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x82, 0xFF, 0x04, 0xFE, 0xFC, 0xF0, 0xE0, 0xC0,
+  0xA7, 0x00, 0x02, 0xC0, 0xF0, 0xFE, 0x83, 0xFF, 0x02, 0x3F, 0x07, 0x03, 0x97, 0x00, 0x80, 0x80,
+  0x03, 0xC0, 0xE0, 0xF0, 0xF8, 0x80, 0xFF, 0x06, 0xF3, 0xF0, 0xF0, 0xFC, 0xFF, 0xFF, 0x07, 0x93,
+  0x00, 0x03, 0x01, 0x07, 0x1F, 0x7F, 0x83, 0xFF, 0x01, 0xFC, 0xE0, 0xA3, 0x00, 0x00, 0xFC, 0x84,
+  0xFF, 0x01, 0x3F, 0x01, 0x94, 0x00, 0x03, 0xC0, 0xF0, 0xFC, 0xFE, 0x8F, 0xFF, 0x03, 0xFE, 0xF8,
+  0xF0, 0x80, 0x94, 0x00, 0x00, 0x03, 0x85, 0xFF, 0x91, 0x00, 0x02, 0xFF, 0x00, 0x9E, 0x00, 0x00,
+  0xE0, 0x85, 0xF8, 0x82, 0xF0, 0x85, 0xE0, 0x01, 0xC0, 0xC0, 0x87, 0x00, 0x01, 0xC0, 0xC0, 0x83,
+  0xE0, 0x83, 0xF0, 0x86, 0xF8, 0x00, 0xE0, 0xC3, 0x00, 0x01, 0x0F, 0x1F, 0x90, 0x3F, 0x02, 0x1F,
+  0x1F, 0x0F, 0x87, 0x00, 0x02, 0x0F, 0x1F, 0x1F, 0x8E, 0x3F, 0x80, 0x1F, 0x00, 0x07, 0xC4, 0x00,
+  0x04, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0x80, 0xF0, 0x01, 0xF8, 0xF8, 0x81, 0xFC, 0x80, 0xFE, 0x81,
+  0xFF, 0x81, 0x7F, 0x84, 0xFF, 0x80, 0x7F, 0x80, 0xFF, 0x80, 0xFE, 0x81, 0xFC, 0x01, 0xF8, 0xF8,
+  0x80, 0xF0, 0x04, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0xBD, 0x00, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0xF8,
+  0xFC, 0xFC, 0xFE, 0x80, 0xFF, 0x07, 0x7F, 0x7F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x80, 0x03,
+  0x80, 0x01, 0x85, 0x00, 0x04, 0xE0, 0xFF, 0xFF, 0x1F, 0x03, 0x80, 0xFF, 0x85, 0x00, 0x01, 0x01,
+  0x01, 0x80, 0x03, 0x07, 0x87, 0xC7, 0xFF, 0xFF, 0x7F, 0x3F, 0x3F, 0x7F, 0x80, 0xFF, 0x07, 0xFE,
+  0xFC, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xAE, 0x00, 0x04, 0x80, 0xC0, 0xF0, 0xF8, 0xFE, 0x82,
+  0xFF, 0x05, 0x7F, 0x3F, 0x0F, 0x07, 0x03, 0x01, 0x94, 0x00, 0x80, 0xFF, 0x04, 0x00, 0x00, 0x7F,
+  0xFF, 0xFF, 0x82, 0x00, 0x0A, 0xC0, 0xC0, 0xE0, 0xC0, 0xC8, 0x0C, 0x1E, 0x0F, 0x07, 0x03, 0x01,
+  0x83, 0x00, 0x05, 0x01, 0x03, 0x07, 0x0F, 0x3F, 0x7F, 0x82, 0xFF, 0x03, 0xFC, 0xF8, 0xF0, 0xC0,
+  0xA7, 0x00, 0x01, 0xE0, 0xFE, 0x83, 0xFF, 0x02, 0x7F, 0x0F, 0x03, 0x96, 0x00, 0x03, 0x80, 0x80,
+  0xC0, 0xF0, 0x80, 0xFF, 0x0E, 0xFC, 0xF8, 0xF8, 0xFE, 0xFF, 0xFF, 0xFE, 0xE0, 0xEC, 0xFE, 0x7F,
+  0x1F, 0x0F, 0x07, 0x01, 0x90, 0x00, 0x03, 0x01, 0x03, 0x0F, 0x7F, 0x83, 0xFF, 0x01, 0xFC, 0xF0,
+  0xA3, 0x00, 0x85, 0xFF, 0x00, 0x07, 0x8D, 0x00, 0x81, 0x80, 0x06, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0,
+  0xFC, 0xFE, 0x90, 0xFF, 0x02, 0xFE, 0xFC, 0xF0, 0x95, 0x00, 0x00, 0x0F, 0x84, 0xFF, 0x00, 0xFE,
+  0x90, 0x00, 0x03, 0xFF, 0x00, 0x9E, 0x00, 0x00, 0x10, 0x85, 0x00, 0x00, 0x08, 0x81, 0x00, 0x01,
+  0x10, 0x10, 0x83, 0x00, 0x01, 0x20, 0x20, 0x87, 0x00, 0x01, 0x20, 0x20, 0x82, 0x00, 0x00, 0x10,
+  0x82, 0x00, 0x00, 0x08, 0x82, 0x00, 0x80, 0x04, 0xC7, 0x00, 0x90, 0x20, 0x8D, 0x00, 0x8E, 0x20,
+  0xCD, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x04, 0x83, 0x00, 0x07, 0x01, 0x00, 0x00, 0x80, 0x00,
+  0x80, 0x00, 0x00, 0x84, 0x80, 0x05, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x04,
+  0x81, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x80, 0xC9, 0x00, 0x19, 0x40, 0x00, 0x00, 0x10, 0x00,
+  0x08, 0x04, 0x00, 0x00, 0x04, 0x1C, 0xFE, 0xFF, 0xC7, 0x0F, 0x3F, 0xFC, 0xF1, 0xDF, 0x3F, 0x3F,
+  0xE0, 0xFF, 0xFF, 0x1F, 0x03, 0x80, 0xFF, 0x84, 0x00, 0x0D, 0x01, 0x00, 0x02, 0x00, 0x00, 0x04,
+  0x80, 0xC8, 0xF0, 0xE0, 0x40, 0x00, 0x40, 0x80, 0xBD, 0x00, 0x00, 0x02, 0x96, 0x00, 0x10, 0x0F,
+  0xFF, 0xFC, 0xE0, 0x01, 0x07, 0x3F, 0xFF, 0xFE, 0x01, 0x07, 0x7F, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+  0x82, 0x00, 0x0A, 0xC0, 0xC0, 0xE0, 0xC0, 0xC8, 0x0C, 0x1E, 0x0F, 0x07, 0x03, 0x01, 0x85, 0x00,
+  0x01, 0x08, 0x10, 0xB3, 0x00, 0x00, 0x02, 0x9C, 0x00, 0x18, 0x01, 0x1F, 0xFF, 0x7F, 0x78, 0x30,
+  0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x08, 0x1E, 0x1F, 0x1F, 0x3E, 0x20, 0x6C, 0x7E, 0x7F, 0x1F,
+  0x0F, 0x07, 0x01, 0x91, 0x00, 0x01, 0x04, 0x10, 0x85, 0x00, 0x00, 0x10, 0xBC, 0x00, 0x81, 0x80,
+  0x06, 0xC0, 0xC0, 0xE0, 0xE0, 0x00, 0x00, 0x01, 0xB3, 0x00, 0x00, 0x02, 0x90, 0x00, 0x03, 0xFF,
+  0x00, 0x9E, 0x00, 0x00, 0x08, 0x83, 0x04, 0x80, 0x00, 0x81, 0x08, 0x01, 0x00, 0x00, 0x80, 0x10,
+  0x90, 0x00, 0x80, 0x10, 0x80, 0x00, 0x80, 0x08, 0x80, 0x00, 0x80, 0x04, 0x80, 0x00, 0x01, 0x04,
+  0x10, 0xC3, 0x00, 0x01, 0x08, 0x10, 0x91, 0x00, 0x01, 0x10, 0x08, 0x88, 0x00, 0x00, 0x10, 0x91,
+  0x00, 0x01, 0x10, 0x04, 0xC5, 0x00, 0x10, 0x40, 0x00, 0x20, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x01, 0x81, 0x00, 0x00, 0x80, 0x88, 0x00, 0x03, 0x80,
+  0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x04, 0x86, 0x00, 0x00, 0x80, 0xBE, 0x00, 0x01, 0x20, 0x10,
+  0x80, 0x00, 0x1A, 0x02, 0x01, 0x00, 0x00, 0x80, 0x40, 0x00, 0x20, 0x20, 0x30, 0xF8, 0xF8, 0xFC,
+  0x3C, 0x7C, 0xFA, 0xEC, 0x3E, 0x7E, 0xC7, 0x0F, 0x3F, 0xFC, 0xF1, 0xDF, 0x3F, 0x3F, 0x8E, 0x00,
+  0x03, 0x02, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x20, 0xB1, 0x00, 0x04, 0x40, 0x00, 0x00, 0x40,
+  0x80, 0x81, 0x00, 0x06, 0x80, 0x00, 0x00, 0x20, 0x00, 0x04, 0x02, 0x82, 0x00, 0x01, 0x40, 0x20,
+  0x80, 0x00, 0x00, 0x01, 0x84, 0x00, 0x12, 0x03, 0x0F, 0x3F, 0xFC, 0xF8, 0xE3, 0x87, 0x00, 0x81,
+  0x00, 0x10, 0xE1, 0xC7, 0x3F, 0xFF, 0xFE, 0xFE, 0xF8, 0x80, 0xA5, 0x00, 0x00, 0x10, 0x9F, 0x00,
+  0x02, 0x02, 0x04, 0x04, 0x82, 0x00, 0x02, 0x80, 0x10, 0x03, 0x83, 0x00, 0x04, 0x40, 0x08, 0x02,
+  0x00, 0x01, 0x8D, 0x00, 0x10, 0x03, 0x0F, 0x3F, 0xFE, 0xF9, 0xFE, 0x1C, 0x00, 0x07, 0x0F, 0x0E,
+  0x07, 0x07, 0x0F, 0x0F, 0x18, 0x10, 0xA6, 0x00, 0x00, 0x04, 0xA3, 0x00, 0x00, 0xE0, 0x85, 0x00,
+  0x00, 0x04, 0x94, 0x00, 0x02, 0x80, 0x09, 0x03, 0xAC, 0x00, 0x00, 0x70, 0x84, 0x00, 0x00, 0x04,
+  0x90, 0x00, 0x02, 0xFF, 0x00, 0x9E, 0x00, 0x01, 0xFC, 0xBC, 0x85, 0xFE, 0x82, 0xFC, 0x85, 0xF8,
+  0x00, 0xF0, 0x87, 0x00, 0x00, 0xF0, 0x84, 0xF8, 0x83, 0xFC, 0x86, 0xFE, 0x00, 0xF8, 0xC3, 0x00,
+  0x02, 0x03, 0x07, 0x07, 0x82, 0x0F, 0x86, 0x07, 0x06, 0x87, 0x87, 0x8F, 0x8F, 0x87, 0xC7, 0xC3,
+  0x87, 0xC0, 0x00, 0xC3, 0x82, 0x87, 0x8E, 0x07, 0x00, 0x01, 0xC2, 0x00, 0x07, 0x80, 0xC0, 0xC0,
+  0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0x80, 0xFC, 0x01, 0xFE, 0xFE, 0x81, 0xFF, 0x80, 0x7F, 0x90, 0x3F,
+  0x80, 0x7F, 0x80, 0xFF, 0x80, 0xFE, 0x09, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0,
+  0xC0, 0xBA, 0x00, 0x06, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0x81, 0xFF, 0x0A, 0x7F, 0x3F,
+  0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x03, 0x01, 0x01, 0x9D, 0x00, 0x0A, 0x01, 0x01, 0x03, 0x03,
+  0x07, 0x07, 0x0F, 0x1F, 0x1F, 0x3F, 0x7F, 0x81, 0xFF, 0x06, 0xFE, 0xFC, 0xF8, 0xF0, 0xF0, 0xC0,
+  0x80, 0xA2, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0xC0, 0x81, 0x00, 0x05, 0x80, 0x80, 0xE0, 0xF0,
+  0xFC, 0xFE, 0x81, 0xFF, 0x10, 0x7F, 0x3F, 0x3F, 0x7F, 0xFF, 0xFF, 0xDF, 0xBC, 0xBC, 0x78, 0x70,
+  0x70, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0xAA, 0x00, 0x05, 0x01, 0x03, 0x07, 0x0F, 0x3F, 0x7F, 0x82,
+  0xFF, 0x03, 0xFC, 0xF8, 0xE0, 0x80, 0x9D, 0x00, 0x02, 0x02, 0x04, 0x04, 0x82, 0x00, 0x01, 0xE0,
+  0xF8, 0x84, 0xFF, 0x19, 0x1F, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x03, 0x07, 0x0F,
+  0x1E, 0x1E, 0x3C, 0x79, 0xF1, 0xE3, 0xE7, 0xC7, 0x8F, 0x8E, 0x1E, 0x9C, 0xF8, 0xF8, 0x84, 0xF0,
+  0x83, 0xF8, 0x80, 0xF0, 0x04, 0xE0, 0xE0, 0xC0, 0x80, 0x80, 0x94, 0x00, 0x02, 0x01, 0x07, 0x3F,
+  0x83, 0xFF, 0x01, 0xFE, 0xF8, 0xA2, 0x00, 0x00, 0xF0, 0x85, 0xFF, 0x8F, 0x00, 0x05, 0x01, 0x01,
+  0x03, 0x07, 0x0F, 0x1F, 0x95, 0xFF, 0x01, 0xFE, 0xFC, 0x80, 0xF8, 0x87, 0x70, 0x88, 0xE0, 0x85,
+  0xFF, 0x00, 0xFE, 0x90, 0x00, 0x02, 0xFF, 0x00, 0x9D, 0x00, 0x01, 0xF8, 0xFE, 0x80, 0xFF, 0x85,
+  0xFE, 0x82, 0xFC, 0x83, 0xF8, 0x87, 0x00, 0x84, 0xF8, 0x83, 0xFC, 0x84, 0xFE, 0x03, 0xFF, 0xFF,
+  0xFE, 0xFE, 0xC4, 0x00, 0x00, 0x03, 0x8A, 0x07, 0x81, 0x87, 0x81, 0xC7, 0x00, 0xC3, 0x87, 0xC0,
+  0x03, 0xC1, 0xC3, 0xC7, 0xC7, 0x81, 0x87, 0x8C, 0x07, 0x00, 0x03, 0xC2, 0x00, 0x0B, 0x80, 0xC0,
+  0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0x81, 0xFF, 0x80, 0x7F, 0x82, 0x3F,
+  0x88, 0x1F, 0x83, 0x3F, 0x01, 0x7F, 0x7F, 0x80, 0xFF, 0x80, 0xFE, 0x09, 0xFC, 0xFC, 0xF8, 0xF8,
+  0xF0, 0xF0, 0xE0, 0xC0, 0xC0, 0x80, 0xB9, 0x00, 0x06, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE,
+  0x81, 0xFF, 0x0A, 0x7F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x9E, 0x00,
+  0x0A, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x81, 0xFF, 0x05, 0xFE,
+  0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0xA7, 0x00, 0x00, 0x80, 0x81, 0x00, 0x03, 0x80, 0xE0, 0xF8, 0xFC,
+  0x83, 0xFF, 0x04, 0x3F, 0x1F, 0x0F, 0x03, 0x01, 0xB6, 0x00, 0x04, 0x01, 0x07, 0x0F, 0x1F, 0x7F,
+  0x82, 0xFF, 0x03, 0xFE, 0xF8, 0xF0, 0xC0, 0x9E, 0x00, 0x03, 0x01, 0x01, 0x02, 0x02, 0x80, 0x00,
+  0x01, 0xC0, 0xF8, 0x86, 0xFF, 0x09, 0xFC, 0x98, 0xB8, 0xB9, 0xB8, 0xB0, 0xF0, 0x70, 0xF0, 0x60,
+  0x82, 0xE0, 0x81, 0xC0, 0x82, 0x80, 0x05, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0x86, 0xF8, 0x03,
+  0xF0, 0xF0, 0xE0, 0xE0, 0x80, 0xC0, 0x00, 0x80, 0x80, 0xC0, 0x81, 0xE0, 0x80, 0x70, 0x09, 0x78,
+  0x38, 0x38, 0xD8, 0xD8, 0xFC, 0xFC, 0xEC, 0xEE, 0xEE, 0x88, 0xFF, 0x01, 0xF8, 0xC0, 0xA1, 0x00,
+  0x00, 0x20, 0x85, 0xFF, 0x02, 0x01, 0x01, 0x00, 0x82, 0x03, 0x07, 0x07, 0x07, 0x06, 0x0E, 0x0E,
+  0x1C, 0x1D, 0x1D, 0x80, 0x39, 0x02, 0x71, 0x71, 0xF1, 0x8B, 0xFF, 0x00, 0x7F, 0x8C, 0xFF, 0x0A,
+  0x79, 0x79, 0x38, 0x38, 0x1C, 0x1C, 0x1E, 0x0E, 0x0E, 0x07, 0x07, 0x80, 0x03, 0x01, 0x01, 0x01,
+  0x84, 0x00, 0x85, 0xFF, 0x91, 0x00, 0x02, 0xA2, 0x00, 0x01, 0x80, 0x80, 0xF9, 0x00, 0x00, 0xFE,
+  0x86, 0xFF, 0x84, 0xFE, 0x82, 0xFC, 0x01, 0xF8, 0xF8, 0x87, 0x00, 0x01, 0xF8, 0xF8, 0x82, 0xFC,
+  0x85, 0xFE, 0x85, 0xFF, 0x00, 0xFC, 0xC3, 0x00, 0x00, 0x01, 0x88, 0x03, 0x81, 0x83, 0x83, 0xC3,
+  0x00, 0xE3, 0x88, 0xE0, 0x00, 0xC1, 0x83, 0xC3, 0x01, 0x83, 0x83, 0x8B, 0x03, 0xC1, 0x00, 0x0B,
+  0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0x80, 0xFF, 0x80, 0x7F,
+  0x81, 0x3F, 0x83, 0x1F, 0x83, 0x0F, 0x83, 0x1F, 0x81, 0x3F, 0x01, 0x7F, 0x7F, 0x81, 0xFF, 0x0A,
+  0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xB8, 0x00, 0x06, 0x80, 0xC0,
+  0xE0, 0xF0, 0xFC, 0xFC, 0xFE, 0x81, 0xFF, 0x09, 0x7F, 0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x03,
+  0x01, 0x01, 0xA1, 0x00, 0x09, 0x01, 0x01, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x81,
+  0xFF, 0x05, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0x80, 0xA2, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0xC0,
+  0x81, 0x00, 0x03, 0x80, 0xE0, 0xF0, 0xFC, 0x83, 0xFF, 0x04, 0x3F, 0x1F, 0x07, 0x03, 0x01, 0xAE,
+  0x00, 0x05, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0x80, 0xF0, 0x87, 0xFF, 0x03, 0xFE, 0xF8, 0xE0,
+  0x80, 0x9D, 0x00, 0x09, 0x02, 0x04, 0x04, 0x00, 0x01, 0x00, 0x00, 0x80, 0xF8, 0xFE, 0x84, 0xFF,
+  0x04, 0x87, 0x81, 0x80, 0x80, 0x81, 0x90, 0x00, 0x05, 0x80, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0x81,
+  0xF8, 0x81, 0xFC, 0x81, 0xF8, 0x82, 0xF0, 0x19, 0xF8, 0xF8, 0xB8, 0x1C, 0x1C, 0x8E, 0x8E, 0xC7,
+  0xE7, 0xE7, 0xF3, 0x71, 0x39, 0x39, 0x1D, 0x1F, 0x0E, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0x01,
+  0x07, 0x3F, 0x83, 0xFF, 0x01, 0xFE, 0xF0, 0xA2, 0x00, 0x85, 0xFF, 0x03, 0xBF, 0x9F, 0xDF, 0xFF,
+  0x80, 0xFB, 0x06, 0xF3, 0xF3, 0xF7, 0x77, 0x77, 0x67, 0xE7, 0x81, 0xF7, 0x00, 0xEF, 0x80, 0xCF,
+  0x9A, 0xFF, 0x07, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x03, 0x01, 0x01, 0x8D, 0x00, 0x85, 0xFF, 0x00,
+  0x78, 0x90, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x80, 0x81, 0xC0, 0x85, 0x80, 0x9C, 0x00, 0x84, 0x80,
+  0x82, 0xC0, 0x00, 0x80, 0xC3, 0x00, 0x00, 0x7F, 0x8F, 0xFF, 0x81, 0xFE, 0x00, 0x7E, 0x87, 0x00,
+  0x00, 0x7E, 0x81, 0xFE, 0x8F, 0xFF, 0x00, 0x7F, 0xC5, 0x00, 0x83, 0x01, 0x01, 0x81, 0x81, 0x81,
+  0xC1, 0x81, 0xE1, 0x81, 0xF1, 0x8B, 0xF0, 0x80, 0xF1, 0x80, 0xE1, 0x81, 0xC1, 0x01, 0x81, 0x81,
+  0x85, 0x01, 0xC0, 0x00, 0x0A, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE,
+  0x80, 0xFF, 0x01, 0x7F, 0x7F, 0x80, 0x3F, 0x01, 0x1F, 0x1F, 0x82, 0x0F, 0x8B, 0x07, 0x82, 0x0F,
+  0x80, 0x1F, 0x03, 0x3F, 0x3F, 0x7F, 0x7F, 0x80, 0xFF, 0x0A, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8,
+  0xF0, 0xE0, 0xC0, 0xC0, 0x80, 0xB4, 0x00, 0x05, 0x80, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0x82, 0xFF,
+  0x07, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x03, 0x01, 0xA7, 0x00, 0x04, 0x01, 0x83, 0xC3, 0xC7,
+  0xEF, 0x85, 0xFF, 0x04, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0xA2, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00,
+  0xC0, 0x80, 0x00, 0x03, 0x80, 0xE0, 0xFC, 0xFE, 0x83, 0xFF, 0x03, 0x1F, 0x07, 0x03, 0x01, 0xA6,
+  0x00, 0x11, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0x78, 0x38, 0x3C, 0x9E, 0x8E, 0xC7, 0xE7, 0xF3, 0x7B,
+  0x3D, 0x1F, 0x0F, 0x07, 0x80, 0x03, 0x02, 0x07, 0x1F, 0x7F, 0x82, 0xFF, 0x03, 0xFE, 0xF8, 0xE0,
+  0x80, 0x9D, 0x00, 0x02, 0x02, 0x04, 0x04, 0x80, 0x00, 0x01, 0x80, 0xFC, 0x84, 0xFF, 0x01, 0x1F,
+  0x03, 0x81, 0x00, 0x00, 0x01, 0x8F, 0x00, 0x06, 0x80, 0xC0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0x8B,
+  0xFE, 0x80, 0xFF, 0x0A, 0xF3, 0xF1, 0xF1, 0x78, 0x3C, 0x1E, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x89,
+  0x00, 0x01, 0x01, 0x0F, 0x84, 0xFF, 0x01, 0xFC, 0xC0, 0xA1, 0x00, 0x86, 0xFF, 0x04, 0xFC, 0xF8,
+  0xF8, 0xD8, 0xD8, 0x84, 0xDC, 0x80, 0x9C, 0x81, 0x8E, 0x03, 0xCE, 0xAE, 0xFE, 0xFE, 0x8A, 0xFF,
+  0x00, 0xDF, 0x8A, 0xFF, 0x00, 0x07, 0x94, 0x00, 0x00, 0x81, 0x85, 0xFF, 0x91, 0x00, 0x02, 0xA0,
+  0x00, 0x00, 0xC0, 0x80, 0xE0, 0x83, 0xC0, 0x84, 0x80, 0x93, 0x00, 0x84, 0x80, 0x83, 0xC0, 0x81,
+  0xE0, 0x00, 0xC0, 0xC3, 0x00, 0x01, 0x1F, 0x7F, 0x92, 0xFF, 0x00, 0x7F, 0x87, 0x00, 0x01, 0x3E,
+  0x7F, 0x92, 0xFF, 0x00, 0x7F, 0xCA, 0x00, 0x01, 0x80, 0x80, 0x80, 0xC0, 0x80, 0xE0, 0x82, 0xF0,
+  0x8E, 0xF8, 0x82, 0xF0, 0x80, 0xE0, 0x80, 0xC0, 0x01, 0x80, 0x80, 0xC6, 0x00, 0x09, 0x80, 0xC0,
+  0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFE, 0xFE, 0x80, 0xFF, 0x05, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F,
+  0x1F, 0x81, 0x0F, 0x81, 0x07, 0x8A, 0x03, 0x81, 0x07, 0x81, 0x0F, 0x05, 0x1F, 0x1F, 0x3F, 0x3F,
+  0x7F, 0x7F, 0x80, 0xFF, 0x09, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0xB3,
+  0x00, 0x05, 0x80, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0x82, 0xFF, 0x06, 0x3F, 0x3F, 0x0F, 0x07, 0x07,
+  0x03, 0x01, 0xA8, 0x00, 0x04, 0x80, 0xC0, 0xC1, 0xE3, 0xF7, 0x86, 0xFF, 0x04, 0xFE, 0xFC, 0xF8,
+  0xE0, 0xC0, 0xA1, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0xC0, 0x81, 0x00, 0x02, 0xE0, 0xFC, 0xFE,
+  0x83, 0xFF, 0x03, 0x1F, 0x0F, 0x03, 0x01, 0xA5, 0x00, 0x19, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0x78,
+  0x38, 0x3C, 0x1E, 0x8E, 0xCF, 0xE7, 0xF3, 0x79, 0x3C, 0x1C, 0x0E, 0x07, 0x03, 0x03, 0x01, 0x01,
+  0x03, 0x07, 0x1F, 0x7F, 0x82, 0xFF, 0x02, 0xFE, 0xF8, 0xE0, 0x9D, 0x00, 0x02, 0x02, 0x04, 0x04,
+  0x81, 0x00, 0x00, 0xF0, 0x84, 0xFF, 0x01, 0x7F, 0x07, 0x81, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x06,
+  0x80, 0x80, 0xC0, 0xF0, 0xF8, 0xF8, 0xFC, 0x81, 0xFE, 0x83, 0xFF, 0x81, 0xFE, 0x82, 0xFF, 0x08,
+  0xF9, 0xF8, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0x01, 0x8B, 0x00, 0x01, 0x03, 0x1F, 0x84, 0xFF,
+  0x00, 0xF8, 0xA2, 0x00, 0x85, 0xFF, 0x02, 0xFE, 0xFC, 0xFC, 0x80, 0xEC, 0x00, 0xEE, 0x88, 0xCE,
+  0x03, 0xC6, 0xC6, 0xC7, 0xCF, 0x99, 0xFF, 0x00, 0x1F, 0x95, 0x00, 0x85, 0xFF, 0x91, 0x00, 0x03,
+  0xA0, 0x00, 0x04, 0x40, 0x20, 0x00, 0x00, 0x20, 0x9F, 0x00, 0x01, 0x80, 0x80, 0x82, 0x00, 0x01,
+  0x40, 0x40, 0x81, 0x00, 0x03, 0x20, 0x00, 0x00, 0x20, 0xC4, 0x00, 0x00, 0x1F, 0x94, 0x00, 0x00,
+  0x3E, 0x86, 0x00, 0x01, 0x3E, 0x01, 0xE0, 0x00, 0x08, 0x80, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00,
+  0x00, 0x10, 0x81, 0x00, 0x01, 0x08, 0x08, 0x8B, 0x00, 0x00, 0x08, 0xD5, 0x00, 0x06, 0x20, 0x00,
+  0x00, 0x08, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x80, 0x80, 0x00, 0x02, 0x20, 0x00, 0x10, 0x80,
+  0x00, 0x00, 0x08, 0x80, 0x00, 0x01, 0x04, 0x04, 0x87, 0x00, 0x00, 0x04, 0x95, 0x00, 0x00, 0x20,
+  0xB5, 0x00, 0x05, 0x80, 0x00, 0x10, 0x08, 0x04, 0x02, 0x82, 0x00, 0x07, 0x40, 0x00, 0x10, 0x08,
+  0x00, 0x00, 0x02, 0x01, 0xA7, 0x00, 0x06, 0x80, 0xC0, 0xC0, 0xE0, 0x70, 0x38, 0x10, 0x89, 0x00,
+  0x00, 0x80, 0xA9, 0x00, 0x01, 0x20, 0x04, 0x84, 0x00, 0x00, 0x20, 0xA8, 0x00, 0x16, 0x80, 0xC0,
+  0x40, 0x20, 0x30, 0x98, 0xC8, 0xCC, 0x66, 0xB6, 0xF3, 0x7B, 0x3D, 0xB6, 0xDB, 0xEF, 0x75, 0x3A,
+  0x1C, 0x0C, 0x06, 0x06, 0x04, 0x88, 0x00, 0x00, 0x80, 0xA3, 0x00, 0x01, 0x10, 0x01, 0x83, 0x00,
+  0x02, 0x80, 0x00, 0x01, 0x91, 0x00, 0x00, 0x80, 0x80, 0x00, 0x04, 0x10, 0x08, 0x00, 0x00, 0x02,
+  0x85, 0x00, 0x00, 0x01, 0x81, 0x00, 0x80, 0x01, 0x0D, 0x00, 0x00, 0x06, 0x19, 0x89, 0x44, 0x66,
+  0x33, 0x19, 0x0C, 0x06, 0x03, 0x01, 0x01, 0x88, 0x00, 0x00, 0x02, 0x85, 0x00, 0x00, 0x04, 0xAA,
+  0x00, 0x06, 0x81, 0xC3, 0xC3, 0xDB, 0x9B, 0x9B, 0x99, 0x81, 0xB9, 0x81, 0xA9, 0x80, 0x29, 0x03,
+  0x21, 0x21, 0x20, 0x28, 0x99, 0x00, 0x01, 0x20, 0x01, 0xB0, 0x00, 0x02, 0xA1, 0x00, 0x01, 0x80,
+  0xC0, 0x85, 0x80, 0xA1, 0x00, 0x87, 0x80, 0xC4, 0x00, 0x8D, 0xFF, 0x84, 0xFE, 0x00, 0x7E, 0x87,
+  0x00, 0x84, 0xFE, 0x8D, 0xFF, 0xC5, 0x00, 0x85, 0x01, 0x01, 0x81, 0x81, 0x82, 0xC1, 0x81, 0xE1,
+  0x01, 0xF1, 0xF1, 0x8A, 0xF0, 0x00, 0xF1, 0x81, 0xE1, 0x81, 0xC1, 0x80, 0x81, 0x87, 0x01, 0xC0,
+  0x00, 0x05, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0x80, 0xFC, 0x01, 0xFE, 0xFE, 0x80, 0xFF, 0x01,
+  0x7F, 0x7F, 0x80, 0x3F, 0x01, 0x1F, 0x1F, 0x85, 0x0F, 0x83, 0x07, 0x84, 0x0F, 0x80, 0x1F, 0x80,
+  0x3F, 0x01, 0x7F, 0x7F, 0x80, 0xFF, 0x0A, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0,
+  0xC0, 0x80, 0xB5, 0x00, 0x05, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFE, 0x82, 0xFF, 0x08, 0x7F, 0x3F,
+  0x1F, 0x0F, 0x07, 0x03, 0x03, 0x01, 0x01, 0xA5, 0x00, 0x05, 0x01, 0x03, 0x03, 0x07, 0x8F, 0xCF,
+  0x84, 0xFF, 0x05, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x80, 0xA1, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00,
+  0xC0, 0x81, 0x00, 0x03, 0x80, 0xF0, 0xFC, 0xFE, 0x82, 0xFF, 0x04, 0x7F, 0x1F, 0x07, 0x03, 0x01,
+  0xA7, 0x00, 0x10, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0x70, 0x38, 0x3C, 0x1C, 0xCE, 0xCF, 0xE7, 0xF3,
+  0x7B, 0x3F, 0x1F, 0x0F, 0x80, 0x07, 0x01, 0x0F, 0x3F, 0x83, 0xFF, 0x02, 0xFC, 0xF0, 0xC0, 0x9D,
+  0x00, 0x02, 0x02, 0x04, 0x04, 0x81, 0x00, 0x01, 0xC0, 0xFC, 0x84, 0xFF, 0x01, 0x1F, 0x03, 0x80,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x05, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0x80, 0xFC, 0x83, 0xFE,
+  0x82, 0xFC, 0x0F, 0xFE, 0xFE, 0xFF, 0xFF, 0xE7, 0xE3, 0xF1, 0xF1, 0x78, 0x3C, 0x1E, 0x0F, 0x07,
+  0x03, 0x01, 0x01, 0x88, 0x00, 0x01, 0x03, 0x1F, 0x84, 0xFF, 0x00, 0xF8, 0xA2, 0x00, 0x86, 0xFF,
+  0x01, 0xFC, 0xFC, 0x88, 0xDC, 0x02, 0x9C, 0x9C, 0x9E, 0x81, 0x8E, 0x00, 0x9E, 0x80, 0xFE, 0x96,
+  0xFF, 0x02, 0x7F, 0x03, 0x01, 0x93, 0x00, 0x85, 0xFF, 0x91, 0x00,
 };
 
 const uint8_t DRIVING_FRAME_COUNT = 25;
@@ -0,0 +1,1762 @@
+// Generated for U8g2 library
+#ifndef HAPPY_H
+#define HAPPY_H
+
+#include <pgmspace.h>
+
+const unsigned char happy_f0[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x80, 0x1F, 0xFC, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f1[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x70, 0x00, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0xE0, 0x0F, 0xF8, 0x03, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f2[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0x1E, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x30, 0x00, 0x00, 0x06, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x7F, 0x00, 0x80, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0xF0, 0x0F, 0xF8, 0x03, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x80, 0x1F, 0x7C, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x1C, 0x1E, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x1E, 0x3E, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x07, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x07, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFC, 0x3F, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f3[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x30, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xC7, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x80, 0x1F, 0xFC, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xF8, 0x01, 0x00, 0x38, 0x0E, 0x00, 0xF0, 0x8F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x0E, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x10, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x01, 0x38, 0x0E, 0x10, 0xE0, 0xBF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x0C, 0x38, 0x0E, 0x0C, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x10, 0x38, 0x0E, 0x02, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x01, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x18, 0x0E, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0x3F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xC0, 0xFF, 0xFF, 0x03, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xFC, 0x1F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x3F, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f4[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0xC0, 0x1F, 0xF8, 0x01, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x3C, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x60, 0x00, 0x00, 0x38, 0x0C, 0x00, 0xF0, 0x8F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x80, 0x0F, 0x00, 0x38, 0x0E, 0x00, 0x1C, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x10, 0x00, 0x38, 0x0E, 0x00, 0x02, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x7E, 0x00, 0x01, 0x38, 0x0E, 0x10, 0x80, 0x9F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x06, 0x38, 0x0E, 0x18, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x08, 0x38, 0x0E, 0x02, 0x98, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x38, 0x0E, 0x01, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0x7F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF0, 0xFF, 0xFF, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xFE, 0x7F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x1F, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f5[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x01, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0xC0, 0x0F, 0xF8, 0x01, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x86, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFC, 0x07, 0x00, 0x18, 0x0E, 0x00, 0xFC, 0x84, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x18, 0x00, 0x18, 0x0E, 0x00, 0x02, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x06, 0x18, 0x0E, 0x08, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x08, 0x18, 0x0E, 0x06, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x10, 0x18, 0x0E, 0x01, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x18, 0x0E, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x08, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x7F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF0, 0xFF, 0xFF, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0xFF, 0xFF, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x1F, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x7F, 0xFF, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f6[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x18, 0x00, 0x00, 0xF0, 0xF3, 0x03, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x80, 0x1F, 0xF8, 0x01, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x3C, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xF8, 0x07, 0x00, 0x38, 0x0C, 0x00, 0xF8, 0x07, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x1C, 0x00, 0x38, 0x0C, 0x00, 0x0E, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x03, 0x38, 0x0C, 0x10, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x0C, 0x38, 0x0C, 0x0C, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x10, 0x38, 0x0E, 0x02, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x01, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x08, 0x0C, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x3F, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF8, 0xFF, 0xFF, 0x1F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xE0, 0xFF, 0xFF, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xE0, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x1F, 0xFE, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x7F, 0xFF, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f7[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0xCF, 0x1F, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x1C, 0x00, 0x00, 0xFC, 0xE1, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x10, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x01, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0xE0, 0x0F, 0xFC, 0x01, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1E, 0x1C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x80, 0x87, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0xFC, 0x07, 0x00, 0x18, 0x0E, 0x00, 0x7C, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x18, 0x00, 0x18, 0x0E, 0x00, 0x03, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x07, 0x18, 0x0E, 0x08, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x08, 0x18, 0x0E, 0x06, 0x98, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x10, 0x18, 0x0E, 0x01, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x08, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x7F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF0, 0xFF, 0xFF, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0xFF, 0xFF, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x0F, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x7F, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f8[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x38, 0x00, 0x00, 0xF0, 0xCF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x00, 0xFC, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x0F, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0xC0, 0x1F, 0xF8, 0x03, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x38, 0x3C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0xC0, 0x0F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x88, 0x0F, 0x00, 0x38, 0x0C, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x10, 0x00, 0x38, 0x0C, 0x00, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x01, 0x38, 0x0C, 0x10, 0x80, 0x1F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x06, 0x38, 0x0C, 0x18, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x08, 0x38, 0x0C, 0x06, 0x08, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x10, 0x38, 0x0C, 0x01, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x08, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0x7F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF0, 0xFF, 0xFF, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xFE, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x3F, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f9[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x1F, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x10, 0x00, 0x00, 0xF8, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x3C, 0x1C, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xF0, 0x01, 0x00, 0x38, 0x0E, 0x00, 0xF0, 0x8F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x00, 0x38, 0x0E, 0x00, 0x1E, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x18, 0x00, 0x38, 0x0E, 0x00, 0x02, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0x38, 0x0E, 0x10, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x06, 0x38, 0x0E, 0x08, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x08, 0x18, 0x0E, 0x02, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x18, 0x0E, 0x01, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF8, 0xFF, 0xFF, 0x1F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0xFF, 0xFF, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x0F, 0x38, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x7F, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f10[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x1E, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x10, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x80, 0x1F, 0xF8, 0x01, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1C, 0x3C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xF8, 0x03, 0x00, 0x38, 0x0E, 0x00, 0xF0, 0x8F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x1C, 0x00, 0x38, 0x0E, 0x00, 0x06, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x10, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x03, 0x38, 0x0E, 0x10, 0xE0, 0xBF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x0C, 0x38, 0x0E, 0x0C, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x0F, 0x04, 0x10, 0x38, 0x0E, 0x02, 0x08, 0xFC, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x01, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x08, 0x0C, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0x3F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xC0, 0xFF, 0xFF, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xF8, 0x1F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x0F, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x7F, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f11[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x00, 0xFC, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x1E, 0x1C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1C, 0x1E, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x70, 0x00, 0x00, 0x18, 0x0E, 0x00, 0xF0, 0x87, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x80, 0x0F, 0x00, 0x18, 0x0E, 0x00, 0x1E, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x18, 0x00, 0x18, 0x0E, 0x00, 0x01, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0x18, 0x0E, 0x10, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x06, 0x18, 0x0E, 0x0C, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x08, 0x18, 0x0E, 0x02, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x18, 0x0E, 0x01, 0x04, 0xF8, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x7F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF0, 0xFF, 0xFF, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xFF, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x06, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xBF, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f12[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0x80, 0x0F, 0x00, 0x00, 0xFC, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x7F, 0x00, 0x80, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1E, 0x1C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFC, 0x03, 0x00, 0x18, 0x0E, 0x00, 0xF8, 0x87, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x0C, 0x00, 0x18, 0x0E, 0x00, 0x06, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x03, 0x38, 0x0E, 0x10, 0xE0, 0xBF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x0C, 0x38, 0x0E, 0x04, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x0F, 0x04, 0x10, 0x38, 0x0E, 0x03, 0x04, 0xFC, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x08, 0x0C, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0x3F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xC0, 0xFF, 0xFF, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xF8, 0x1F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x0F, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x7F, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f13[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x1F, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x10, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x20, 0x00, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x80, 0x1F, 0xFC, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0xE0, 0x8F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xEC, 0x07, 0x00, 0x38, 0x0E, 0x00, 0x3C, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x18, 0x00, 0x38, 0x0E, 0x00, 0x02, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x38, 0x0E, 0x10, 0xC0, 0x9F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x03, 0x38, 0x0E, 0x18, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x08, 0x38, 0x0E, 0x06, 0x08, 0xFE, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x10, 0x38, 0x0E, 0x01, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0x7F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF0, 0xFF, 0xFF, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xFE, 0x7F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x0F, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x7F, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f14[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0xC0, 0x0F, 0xF8, 0x01, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1C, 0x0C, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0xE0, 0x87, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xC4, 0x07, 0x00, 0x18, 0x0E, 0x00, 0x3C, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x18, 0x00, 0x18, 0x0E, 0x00, 0x06, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x10, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x03, 0x18, 0x0E, 0x18, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x08, 0x18, 0x0E, 0x06, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x0F, 0x04, 0x10, 0x18, 0x0E, 0x01, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x08, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x7F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF8, 0xFF, 0xFF, 0x1F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0xFF, 0xFF, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x1F, 0xFE, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x7F, 0xFF, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f15[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x18, 0x00, 0x00, 0xF8, 0xC3, 0x07, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x20, 0x00, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x80, 0x1F, 0xFC, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xF8, 0x01, 0x00, 0x38, 0x0E, 0x00, 0xF0, 0x8F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x0E, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x10, 0x00, 0x38, 0x0E, 0x00, 0x02, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x01, 0x38, 0x0E, 0x10, 0xE0, 0xBF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x05, 0x06, 0x38, 0x0E, 0x0C, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x0F, 0x04, 0x18, 0x38, 0x0E, 0x02, 0x08, 0xFC, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x01, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x18, 0x0E, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0x3F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xE0, 0xFF, 0xFF, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xF8, 0x1F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x81, 0x1F, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x7F, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f16[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x1E, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0xC0, 0x1F, 0xF8, 0x01, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1C, 0x3C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x3C, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xF0, 0x01, 0x00, 0x38, 0x0E, 0x00, 0xF0, 0x8F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x38, 0x0E, 0x00, 0x0E, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x10, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFE, 0x00, 0x01, 0x38, 0x0E, 0x10, 0xC0, 0x9F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x0C, 0x38, 0x0E, 0x0C, 0xF4, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x1F, 0x06, 0x18, 0x38, 0x0E, 0x02, 0x08, 0xFE, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x01, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0x3F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xE0, 0xFF, 0xFF, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xFC, 0x3F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x0F, 0x78, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x7F, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f17[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0xC1, 0x0F, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x18, 0x00, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0xFC, 0x03, 0x00, 0x18, 0x0E, 0x00, 0xF8, 0x87, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x0E, 0x00, 0x18, 0x0E, 0x00, 0x0E, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x03, 0x18, 0x0E, 0x10, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x0C, 0x18, 0x0E, 0x04, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x10, 0x18, 0x0E, 0x03, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x01, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x0E, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0xF8, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0x3F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xC0, 0xFF, 0xFF, 0x03, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xF8, 0x1F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC1, 0x1F, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f18[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x87, 0x1F, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x38, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x20, 0x00, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0xE0, 0x1F, 0xF8, 0x03, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x3C, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0xE0, 0x8F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x80, 0x0F, 0x00, 0x38, 0x0C, 0x00, 0x3C, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x10, 0x00, 0x38, 0x0C, 0x00, 0x02, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x01, 0x38, 0x0C, 0x10, 0x80, 0x8F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x07, 0x38, 0x0C, 0x18, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x08, 0x38, 0x0C, 0x06, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x10, 0x38, 0x0C, 0x01, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x08, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0x7F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF0, 0xFF, 0xFF, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xFF, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x3F, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f19[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0xC0, 0x0F, 0x00, 0x00, 0xF8, 0xC3, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x80, 0x1F, 0xFC, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFC, 0x03, 0x00, 0x18, 0x0E, 0x00, 0xF8, 0x8F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x0C, 0x00, 0x18, 0x0E, 0x00, 0x0E, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x03, 0x18, 0x0E, 0x10, 0x80, 0x9F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x0C, 0x18, 0x0E, 0x04, 0xE8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x3F, 0x07, 0x10, 0x18, 0x0E, 0x02, 0x18, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x18, 0x0E, 0x01, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x08, 0x0C, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0x3F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xC0, 0xFF, 0xFF, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xF8, 0x1F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x0F, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x7F, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f20[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x00, 0xF8, 0xC3, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x30, 0x00, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x07, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x80, 0x1F, 0xF8, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0xC0, 0x07, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xC8, 0x0F, 0x00, 0x38, 0x0C, 0x00, 0x7C, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x10, 0x00, 0x38, 0x0C, 0x00, 0x02, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x80, 0x8F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x07, 0x38, 0x0E, 0x18, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x08, 0x38, 0x0E, 0x06, 0x08, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x10, 0x38, 0x0E, 0x01, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0x7F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF0, 0xFF, 0xFF, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xFE, 0x7F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x0E, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x3F, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f21[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x3C, 0x80, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x00, 0x0C, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x18, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xF8, 0x01, 0x00, 0x18, 0x0E, 0x00, 0xF0, 0x8F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x0E, 0x00, 0x18, 0x0E, 0x00, 0x0E, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x10, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0x18, 0x0E, 0x10, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x06, 0x18, 0x0E, 0x0C, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x08, 0x18, 0x0E, 0x06, 0xE4, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x18, 0x0E, 0x01, 0x0C, 0xFC, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0x7F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF0, 0xFF, 0xFF, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xFF, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x3F, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f22[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x70, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x40, 0x00, 0x00, 0xF0, 0x03, 0x1E, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x7F, 0x00, 0x00, 0xFC, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x0F, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0xC0, 0x1F, 0xF8, 0x07, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x38, 0x3C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x38, 0x0C, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x18, 0x00, 0x38, 0x0C, 0x00, 0x06, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x06, 0x38, 0x0C, 0x18, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x08, 0x38, 0x0C, 0x04, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x10, 0x38, 0x0C, 0x01, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x08, 0x0C, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF0, 0xFF, 0xFF, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0xFF, 0xFF, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x1F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x7F, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f23[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x3C, 0x00, 0x00, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x60, 0x00, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0xC0, 0x1F, 0xF8, 0x03, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x3C, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x01, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFE, 0x00, 0x00, 0x38, 0x0C, 0x00, 0xC0, 0x1F, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0x04, 0x38, 0x0C, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x0F, 0x04, 0x00, 0x38, 0x0C, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x18, 0x0C, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x18, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0x7F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF8, 0xFF, 0xFF, 0x1F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80, 0xFF, 0xFF, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xE0, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x7F, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char happy_f24[] PROGMEM = {
+  // width: 128, height: 64
+
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xF8, 0x00, 0x80, 0x1F, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x00, 0x80, 0x03, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0x18, 0x0E, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xFC, 0xFF, 0x1F, 0x00, 0x18, 0x0E, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x77, 0x00, 0x18, 0x0E, 0x00, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3F, 0x00, 0x1C, 0x1C, 0x00, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x0F, 0xF0, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const unsigned char* const happy_frames[] = {
+  happy_f0,
+  happy_f1,
+  happy_f2,
+  happy_f3,
+  happy_f4,
+  happy_f5,
+  happy_f6,
+  happy_f7,
+  happy_f8,
+  happy_f9,
+  happy_f10,
+  happy_f11,
+  happy_f12,
+  happy_f13,
+  happy_f14,
+  happy_f15,
+  happy_f16,
+  happy_f17,
+  happy_f18,
+  happy_f19,
+  happy_f20,
+  happy_f21,
+  happy_f22,
+  happy_f23,
+  happy_f24,
+};
+
+const uint8_t HAPPY_FRAME_COUNT = 25;
+
+#endif // HAPPY_H
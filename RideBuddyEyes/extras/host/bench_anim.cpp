@@ -0,0 +1,182 @@
+/*
+  bench_anim.cpp - Benchmark of the eye animation core (RideBuddyAnim.h).
+
+  Built twice, as bench_anim (float EyeState) and bench_anim_fixed
+  (RIDEBUDDY_FIXED_POINT=1, Q8.8), so the two number formats can be compared
+  side by side:
+
+    bench_anim [--frames N] && bench_anim_fixed [--frames N]
+
+  "core" times one updateAnimation() worth of work: progress, easing and the
+  eight lerps for both eyes, once per easing table, once with the analytic
+  cubic the tables replaced and once through the TweenPool the library
+  uses (cubic in-out, one tween per eye property). "update" times RideBuddyEyes::update()
+  for the tween-heavy emotions on the virtual clock. The checksums cover
+  every animation state the core produced; in fixed point they only depend
+  on integer arithmetic, so they are the same on any host or target.
+*/
+#include "RideBuddyEyes.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if RIDEBUDDY_FIXED_POINT
+#define BENCH_FORMAT "q8.8"
+#else
+#define BENCH_FORMAT "float"
+#endif
+
+static uint32_t checksum(uint32_t hash, const EyeState& s) {
+  const uint8_t* bytes = (const uint8_t*)&s;
+  for (size_t i = 0; i < sizeof(EyeState); i++) hash = (hash ^ bytes[i]) * 16777619u; // FNV-1a
+  return hash;
+}
+
+static const char* const curveNames[ANIM_CURVE_COUNT] = {
+  "linear", "cubic_in", "cubic_out", "cubic_in_out", "back_out", "elastic_out", "bounce_out", "steps",
+};
+
+// The cubic ease-in-out as it was computed before the lookup tables
+#if RIDEBUDDY_FIXED_POINT
+static anim_progress_t referenceEaseInOut(anim_progress_t t) {
+  if (t < ANIM_PROGRESS_ONE / 2) {
+    uint32_t t2 = ((uint32_t)t * t) >> 16;
+    return (anim_progress_t)((t2 * t) >> 14);
+  }
+  uint32_t v = 2 * (ANIM_PROGRESS_ONE - t);
+  uint32_t v2 = (uint32_t)(((uint64_t)v * v) >> 16);
+  return ANIM_PROGRESS_ONE - (anim_progress_t)(((uint64_t)v2 * v) >> 17);
+}
+#else
+static anim_progress_t referenceEaseInOut(anim_progress_t t) { return t < 0.5 ? 4 * t * t * t : 1 - pow(-2 * t + 2, 3) / 2; }
+#endif
+
+static double nowMicros() {
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Tweens both eyes between pseudo-random targets, one 50 ms step per frame.
+// curve < 0 uses referenceEaseInOut().
+static double benchCore(long frames, int curve, uint32_t* hashOut) {
+  EyeState start[2], target[2], current[2];
+  for (int i = 0; i < 2; i++) {
+    current[i] = {EYE_COORD(0), EYE_COORD(0), EYE_COORD(EYE_WIDTH), EYE_COORD(EYE_HEIGHT),
+                  EYE_COORD(0), EYE_COORD(0), EYE_COORD(0), EYE_COORD(0)};
+  }
+  uint32_t seed = 1;
+  uint32_t hash = 2166136261u;
+  uint16_t duration = 0;
+  unsigned long elapsed = 0;
+
+  double begin = nowMicros();
+  for (long f = 0; f < frames; f++) {
+    if (elapsed >= duration) {
+      for (int i = 0; i < 2; i++) {
+        seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+        start[i] = current[i];
+        target[i] = {EYE_COORD((int)(seed % 31) - 15), EYE_COORD((int)(seed >> 8) % 13 - 6),
+                     EYE_COORD(19 + (seed >> 12) % 39), EYE_COORD(21 + (seed >> 20) % 42),
+                     EYE_COORD(0), EYE_COORD(0), EYE_COORD(0), EYE_COORD(0)};
+      }
+      duration = 100 + seed % 400;
+      elapsed = 0;
+    }
+    elapsed += FRAME_INTERVAL;
+    anim_progress_t progress = animProgress(elapsed, duration);
+    anim_progress_t eased = curve < 0 ? referenceEaseInOut(progress) : animEase((AnimCurve)curve, progress);
+    for (int i = 0; i < 2; i++) {
+      current[i].xOffset = animLerp(start[i].xOffset, target[i].xOffset, eased);
+      current[i].yOffset = animLerp(start[i].yOffset, target[i].yOffset, eased);
+      current[i].width = animLerp(start[i].width, target[i].width, eased);
+      current[i].height = animLerp(start[i].height, target[i].height, eased);
+      hash = checksum(hash, current[i]);
+    }
+  }
+  double micros = nowMicros() - begin;
+  *hashOut = hash;
+  return frames ? micros * 1000 / frames : 0; // ns per frame
+}
+
+// Same motion as benchCore(), one TweenPool tween per property
+static double benchPool(long frames, uint32_t* hashOut) {
+  EyeState current[2];
+  for (int i = 0; i < 2; i++) {
+    current[i] = {EYE_COORD(0), EYE_COORD(0), EYE_COORD(EYE_WIDTH), EYE_COORD(EYE_HEIGHT),
+                  EYE_COORD(0), EYE_COORD(0), EYE_COORD(0), EYE_COORD(0)};
+  }
+  TweenPool pool;
+  uint32_t seed = 1;
+  uint32_t hash = 2166136261u;
+  unsigned long now = 0;
+
+  double begin = nowMicros();
+  for (long f = 0; f < frames; f++) {
+    if (pool.active() == 0) {
+      uint16_t duration = 0;
+      EyeState target[2];
+      for (int i = 0; i < 2; i++) {
+        seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+        target[i] = {EYE_COORD((int)(seed % 31) - 15), EYE_COORD((int)(seed >> 8) % 13 - 6),
+                     EYE_COORD(19 + (seed >> 12) % 39), EYE_COORD(21 + (seed >> 20) % 42),
+                     EYE_COORD(0), EYE_COORD(0), EYE_COORD(0), EYE_COORD(0)};
+      }
+      duration = 100 + seed % 400;
+      for (int i = 0; i < 2; i++) { // As startAnimation() does, one run of the state's values per eye
+        pool.start(&current[i].xOffset, &target[i].xOffset, 4, duration, ANIM_CURVE_CUBIC_IN_OUT, now);
+      }
+    }
+    now += FRAME_INTERVAL;
+    pool.update(now);
+    for (int i = 0; i < 2; i++) hash = checksum(hash, current[i]);
+  }
+  double micros = nowMicros() - begin;
+  *hashOut = hash;
+  return frames ? micros * 1000 / frames : 0;
+}
+
+static double benchUpdate(Emotion emotion, double seconds) {
+  hostSetMillis(0);
+  randomSeed(1);
+  U8G2_SH1106_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, U8X8_PIN_NONE);
+  RideBuddyEyes eyes;
+  eyes.begin(&u8g2, 21, 22);
+  eyes.setEmotion(emotion);
+
+  long frames = (long)(seconds * 1000 / FRAME_INTERVAL);
+  double begin = nowMicros();
+  for (long i = 0; i < frames; i++) {
+    hostAdvanceMillis(FRAME_INTERVAL);
+    eyes.update();
+  }
+  return frames ? (nowMicros() - begin) / frames : 0;
+}
+
+int main(int argc, char** argv) {
+  long frames = 2000000;
+  double seconds = 60;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (!strcmp(argv[i], "--frames")) frames = atol(argv[i + 1]);
+    else if (!strcmp(argv[i], "--seconds")) seconds = atof(argv[i + 1]);
+  }
+
+  printf("format=%s eye_state_bytes=%u\n", BENCH_FORMAT, (unsigned)sizeof(EyeState));
+  uint32_t hash;
+  double coreNanos = benchCore(frames, -1, &hash);
+  printf("core:   %-13s %6.1f ns/frame, checksum %08x\n", "reference", coreNanos, hash);
+  for (int c = 0; c < ANIM_CURVE_COUNT; c++) {
+    coreNanos = benchCore(frames, c, &hash);
+    printf("core:   %-13s %6.1f ns/frame, checksum %08x\n", curveNames[c], coreNanos, hash);
+  }
+  coreNanos = benchPool(frames, &hash);
+  printf("core:   %-13s %6.1f ns/frame, checksum %08x\n", "tween_pool", coreNanos, hash);
+
+  hostUseVirtualClock(true);
+  double neutral = benchUpdate(NEUTRAL, seconds);
+  double distracted = benchUpdate(DISTRACTED, seconds);
+  double scared = benchUpdate(SCARED, seconds);
+
+  printf("update: NEUTRAL %.2f us, DISTRACTED %.2f us, SCARED %.2f us per frame\n", neutral, distracted, scared);
+  return 0;
+}
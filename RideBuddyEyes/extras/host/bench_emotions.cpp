@@ -0,0 +1,164 @@
+/*
+  bench_emotions.cpp - Per-emotion frame-time benchmark for
+  RideBuddyEyes::update().
+
+  Each emotion runs on the virtual clock for a number of simulated seconds,
+  one frame per step, and the wall-clock time of every update() is
+  recorded. For each emotion it reports render time percentiles, the U8g2
+  primitives drawn and pixels touched per frame (as counted by the mock
+  display; clip frames decoded straight into the buffer draw no
+  primitives), the bytes that would go over the bus and how many frames
+  were elided because nothing visible changed.
+
+    bench_emotions [--seconds N] [--interval MS] [--format json|csv|table]
+
+  JSON (the default) and CSV are meant to be diffed or tracked over time.
+*/
+#include "RideBuddyEyes.h"
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+struct BenchEmotion {
+  const char* name;
+  Emotion emotion;
+};
+
+static const BenchEmotion benchEmotions[] = {
+  { "NEUTRAL", NEUTRAL }, { "BLINK", BLINK }, { "HAPPY", HAPPY }, { "CRY", CRY },
+  { "LOVE", LOVE }, { "SHY", SHY }, { "ANGRY", ANGRY }, { "DRIVING", DRIVING },
+  { "SCARED", SCARED }, { "DISTRACTED", DISTRACTED }, { "SLEEP", SLEEP }, { "BATTERY", BATTERY },
+};
+
+struct BenchResult {
+  const char* name;
+  long frames;
+  double meanMicros;
+  double p50Micros;
+  double p99Micros;
+  double maxMicros;
+  double primitivesPerFrame;
+  double pixelsPerFrame;
+  double bytesPerFrame;
+  uint32_t totalBytes;
+  uint32_t elided;
+};
+
+enum OutputFormat { FORMAT_JSON, FORMAT_CSV, FORMAT_TABLE };
+
+static double percentile(std::vector<double>& sorted, double p) {
+  if (sorted.empty()) return 0;
+  size_t index = (size_t)(p * (sorted.size() - 1) + 0.5);
+  return sorted[index];
+}
+
+static BenchResult runEmotion(const BenchEmotion& entry, double seconds, int interval) {
+  hostSetMillis(0);
+  randomSeed(1);
+
+  U8G2_SH1106_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, U8X8_PIN_NONE);
+  RideBuddyEyes eyes;
+  eyes.begin(&u8g2, 21, 22);
+  eyes.setFrameInterval(interval);
+  eyes.neutral(); // BLINK returns to whatever came before it
+  // blink() times the blink and ignores calls while one is running, so
+  // calling it every frame re-triggers it as soon as the last one ends
+  bool blinking = entry.emotion == BLINK;
+  if (blinking) eyes.blink();
+  else eyes.setEmotion(entry.emotion);
+
+  // Skip the first frame: it is always a full send of a fresh panel
+  hostAdvanceMillis(interval);
+  eyes.update();
+  u8g2.resetCounters();
+  uint32_t startElided = eyes.framesElided();
+
+  long frames = (long)(seconds * 1000 / interval);
+  std::vector<double> samples;
+  samples.reserve(frames);
+  double total = 0;
+  for (long i = 0; i < frames; i++) {
+    hostAdvanceMillis(interval);
+    if (blinking) eyes.blink();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    eyes.update();
+    double micros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    samples.push_back(micros);
+    total += micros;
+  }
+  std::sort(samples.begin(), samples.end());
+
+  BenchResult r;
+  r.name = entry.name;
+  r.frames = frames;
+  r.meanMicros = frames ? total / frames : 0;
+  r.p50Micros = percentile(samples, 0.50);
+  r.p99Micros = percentile(samples, 0.99);
+  r.maxMicros = samples.empty() ? 0 : samples.back();
+  r.primitivesPerFrame = frames ? (double)u8g2.primitivesDrawn() / frames : 0;
+  r.pixelsPerFrame = frames ? (double)u8g2.pixelsTouched() / frames : 0;
+  r.totalBytes = u8g2.bytesSent();
+  r.bytesPerFrame = frames ? (double)r.totalBytes / frames : 0;
+  r.elided = eyes.framesElided() - startElided;
+  return r;
+}
+
+static void printResults(const std::vector<BenchResult>& results, OutputFormat format, double seconds, int interval) {
+  if (format == FORMAT_JSON) {
+    printf("{\n  \"seconds\": %g,\n  \"interval_ms\": %d,\n  \"emotions\": [\n", seconds, interval);
+    for (size_t i = 0; i < results.size(); i++) {
+      const BenchResult& r = results[i];
+      printf("    {\"emotion\": \"%s\", \"frames\": %ld, \"render_us_mean\": %.2f, \"render_us_p50\": %.2f, "
+             "\"render_us_p99\": %.2f, \"render_us_max\": %.2f, \"primitives_per_frame\": %.2f, "
+             "\"pixels_per_frame\": %.1f, \"bytes_per_frame\": %.1f, \"bytes_total\": %u, \"frames_elided\": %u}%s\n",
+             r.name, r.frames, r.meanMicros, r.p50Micros, r.p99Micros, r.maxMicros, r.primitivesPerFrame,
+             r.pixelsPerFrame, r.bytesPerFrame, r.totalBytes, r.elided, i + 1 < results.size() ? "," : "");
+    }
+    printf("  ]\n}\n");
+  } else if (format == FORMAT_CSV) {
+    printf("emotion,frames,render_us_mean,render_us_p50,render_us_p99,render_us_max,primitives_per_frame,pixels_per_frame,bytes_per_frame,bytes_total,frames_elided\n");
+    for (const BenchResult& r : results) {
+      printf("%s,%ld,%.2f,%.2f,%.2f,%.2f,%.2f,%.1f,%.1f,%u,%u\n", r.name, r.frames, r.meanMicros, r.p50Micros, r.p99Micros,
+             r.maxMicros, r.primitivesPerFrame, r.pixelsPerFrame, r.bytesPerFrame, r.totalBytes, r.elided);
+    }
+  } else {
+    printf("%-11s %7s %9s %9s %9s %9s %9s %10s %7s\n", "emotion", "frames", "mean_us", "p50_us", "p99_us", "prims/f", "pixels/f", "bytes/f", "elided");
+    for (const BenchResult& r : results) {
+      printf("%-11s %7ld %9.2f %9.2f %9.2f %9.2f %9.1f %10.1f %7u\n", r.name, r.frames, r.meanMicros, r.p50Micros, r.p99Micros,
+             r.primitivesPerFrame, r.pixelsPerFrame, r.bytesPerFrame, r.elided);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  double seconds = 30;
+  int interval = FRAME_INTERVAL;
+  OutputFormat format = FORMAT_JSON;
+
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (!strcmp(argv[i], "--seconds")) seconds = atof(argv[i + 1]);
+    else if (!strcmp(argv[i], "--interval")) interval = atoi(argv[i + 1]);
+    else if (!strcmp(argv[i], "--format")) {
+      if (!strcmp(argv[i + 1], "csv")) format = FORMAT_CSV;
+      else if (!strcmp(argv[i + 1], "table")) format = FORMAT_TABLE;
+      else format = FORMAT_JSON;
+    } else {
+      fprintf(stderr, "usage: bench_emotions [--seconds N] [--interval MS] [--format json|csv|table]\n");
+      return 2;
+    }
+  }
+  if (argc % 2 == 0) {
+    fprintf(stderr, "usage: bench_emotions [--seconds N] [--interval MS] [--format json|csv|table]\n");
+    return 2;
+  }
+  if (interval < 1) interval = 1;
+
+  hostUseVirtualClock(true);
+  std::vector<BenchResult> results;
+  for (const BenchEmotion& entry : benchEmotions) results.push_back(runEmotion(entry, seconds, interval));
+  printResults(results, format, seconds, interval);
+  return 0;
+}
@@ -0,0 +1,161 @@
+/*
+  eyes_host.cpp - Drives RideBuddyEyes::update() on the host.
+
+  Runs one emotion (or all of them in turn) on a virtual clock that advances
+  exactly one frame interval per step, so every step renders one frame and
+  runs are reproducible. Built once per panel geometry (eyes_host,
+  eyes_host_128x32, eyes_host_128x128), and once with the eyelid moods
+  (eyes_host_moods). Optionally dumps every frame the "panel" shows as a
+  PBM image. Handy as a profiling target:
+
+    perf record ./eyes_host --seconds 60 && perf report
+*/
+#include "RideBuddyEyes.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct EmotionName {
+  const char* name;
+  Emotion emotion;
+};
+
+static const EmotionName emotionNames[] = {
+  { "NEUTRAL", NEUTRAL }, { "BLINK", BLINK }, { "HAPPY", HAPPY }, { "CRY", CRY },
+  { "LOVE", LOVE }, { "SHY", SHY }, { "ANGRY", ANGRY }, { "DRIVING", DRIVING },
+  { "SCARED", SCARED }, { "DISTRACTED", DISTRACTED }, { "SLEEP", SLEEP }, { "BATTERY", BATTERY },
+};
+static const int emotionCount = sizeof(emotionNames) / sizeof(emotionNames[0]);
+
+#if SCREEN_HEIGHT == 32
+typedef U8G2_SSD1306_128X32_UNIVISION_F_HW_I2C HostPanel;
+#elif SCREEN_HEIGHT == 128
+typedef U8G2_SSD1327_MIDAS_128X128_F_HW_I2C HostPanel;
+#else
+typedef U8G2_SH1106_128X64_NONAME_F_HW_I2C HostPanel;
+#endif
+
+static void usage() {
+  fprintf(stderr,
+    "usage: eyes_host [options]\n"
+    "  --emotion NAME   run only this emotion (default: all in turn)\n"
+    "  --seconds N      simulated seconds per emotion (default 4)\n"
+    "  --interval MS    frame interval (default %d)\n"
+    "  --dump DIR       write every frame to DIR/frame_NNNNN.pbm\n"
+    "  --seed N         random seed (default 1)\n"
+    "  --fade N         cross-fade frames between emotions (default %d, 0 = hard cut)\n"
+    "  --never-skip     show every clip frame instead of dropping late ones\n"
+    "  --realtime       follow the wall clock instead of the virtual one\n"
+    "  --display-task   flush from the display task thread (ESP32 dual-core mode)\n"
+    "  --dual           one panel per eye; --dump also writes frame_NNNNN_r.pbm\n"
+    "  --pages N        page-buffer mode, N pages in RAM (U8g2 _1_/_2_ constructors)\n"
+    "  --pack FILE      register the clips of a clip pack (clippack) first\n"
+    "  --prefetch N     RAM budget in bytes for a copy of the clip on screen (default %d)\n",
+    FRAME_INTERVAL, EMOTION_FADE_FRAMES, CLIP_PREFETCH_BYTES);
+}
+
+int main(int argc, char** argv) {
+  int only = -1;
+  double seconds = 4;
+  int interval = FRAME_INTERVAL;
+  const char* dumpDir = NULL;
+  unsigned long seed = 1;
+  bool realtime = false;
+  bool displayTask = false;
+  bool neverSkip = false;
+  bool dual = false;
+  int fadeFrames = EMOTION_FADE_FRAMES;
+  int pages = 0;
+  const char* packPath = NULL;
+  int prefetch = CLIP_PREFETCH_BYTES;
+
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+    if (!strcmp(arg, "--realtime")) { realtime = true; continue; }
+    if (!strcmp(arg, "--display-task")) { displayTask = true; continue; }
+    if (!strcmp(arg, "--never-skip")) { neverSkip = true; continue; }
+    if (!strcmp(arg, "--dual")) { dual = true; continue; }
+    if (!value) { usage(); return 2; }
+    if (!strcmp(arg, "--emotion")) {
+      for (int e = 0; e < emotionCount; e++) if (!strcasecmp(value, emotionNames[e].name)) only = e;
+      if (only < 0) { fprintf(stderr, "eyes_host: unknown emotion %s\n", value); return 2; }
+    } else if (!strcmp(arg, "--seconds")) seconds = atof(value);
+    else if (!strcmp(arg, "--interval")) interval = atoi(value);
+    else if (!strcmp(arg, "--dump")) dumpDir = value;
+    else if (!strcmp(arg, "--seed")) seed = strtoul(value, NULL, 10);
+    else if (!strcmp(arg, "--fade")) fadeFrames = atoi(value);
+    else if (!strcmp(arg, "--pages")) pages = atoi(value);
+    else if (!strcmp(arg, "--pack")) packPath = value;
+    else if (!strcmp(arg, "--prefetch")) prefetch = atoi(value);
+    else { usage(); return 2; }
+    i++;
+  }
+  if (interval < 1) interval = 1;
+  if (pages < 0 || pages >= SCREEN_HEIGHT / 8) { fprintf(stderr, "eyes_host: --pages must be 1 .. %d\n", SCREEN_HEIGHT / 8 - 1); return 2; }
+
+  hostUseVirtualClock(!realtime);
+  hostSetMillis(0);
+  randomSeed(seed);
+
+  HostPanel fullPanel(U8G2_R0, U8X8_PIN_NONE);
+  U8G2 pagePanel(SCREEN_WIDTH, SCREEN_HEIGHT, pages); // Same panel, page-buffer layout
+  U8G2& u8g2 = pages ? pagePanel : fullPanel;
+  HostPanel u8g2Right(U8G2_R0, U8X8_PIN_NONE);
+  u8g2.begin();
+  u8g2Right.begin();
+  ClipPack pack; // Outlives eyes: closing it unregisters the clips
+  if (packPath) {
+    if (!pack.openFile(packPath)) { fprintf(stderr, "eyes_host: %s is missing or not a valid pack\n", packPath); return 1; }
+    if (pack.registerClips() != pack.clipCount()) fprintf(stderr, "eyes_host: some clips in %s do not fit this panel\n", packPath);
+  }
+  RideBuddyEyes eyes;
+  if (dual) eyes.begin(&u8g2, &u8g2Right, 21, 22);
+  else eyes.begin(&u8g2, 21, 22);
+  eyes.setFrameInterval(interval);
+  eyes.setTransitionFrames(fadeFrames);
+  if (neverSkip) eyes.setClipFramePolicy(CLIP_NEVER_SKIP);
+  eyes.setClipPrefetchBudget(prefetch < 0 ? 0 : prefetch > 65535 ? 65535 : prefetch);
+  if (displayTask && !eyes.beginDisplayTask()) { fprintf(stderr, "eyes_host: display task unavailable\n"); return 1; }
+
+  unsigned long frameNumber = 0;
+  long stepsPerEmotion = (long)(seconds * 1000 / interval);
+  printf("%-11s %8s %8s %10s %10s\n", "emotion", "frames", "elided", "bytes", "bytes/frm");
+  for (int e = 0; e < emotionCount; e++) {
+    if (only >= 0 && e != only) continue;
+    eyes.setEmotion(emotionNames[e].emotion);
+    uint32_t startBytes = eyes.totalBytesSent();
+    uint32_t startElided = eyes.framesElided();
+
+    for (long step = 0; step < stepsPerEmotion; step++) {
+      if (realtime) delay(interval);
+      else hostAdvanceMillis(interval);
+      eyes.update();
+
+      if (dumpDir) {
+        eyes.waitForFlush();
+        char path[512];
+        snprintf(path, sizeof(path), "%s/frame_%05lu.pbm", dumpDir, frameNumber);
+        if (!u8g2.writePBM(path)) { fprintf(stderr, "eyes_host: cannot write %s\n", path); return 1; }
+        snprintf(path, sizeof(path), "%s/frame_%05lu_r.pbm", dumpDir, frameNumber);
+        if (dual && !u8g2Right.writePBM(path)) { fprintf(stderr, "eyes_host: cannot write %s\n", path); return 1; }
+      }
+      frameNumber++;
+    }
+
+    uint32_t bytes = eyes.totalBytesSent() - startBytes;
+    printf("%-11s %8ld %8u %10u %10.1f\n", emotionNames[e].name, stepsPerEmotion, eyes.framesElided() - startElided,
+           bytes, stepsPerEmotion ? (double)bytes / stepsPerEmotion : 0.0);
+  }
+
+  eyes.waitForFlush();
+  RideBuddyStats stats = eyes.stats();
+  printf("\nrendered %u, skipped %u, late %u, clip frames dropped %u, from RAM %u\n", stats.framesRendered,
+         stats.framesSkipped, stats.framesLate, stats.clipFramesDropped, stats.clipFramesFromRam);
+  if (realtime) { // micros() stands still on the virtual clock
+    printf("render %.1f us mean, %u us max; flush %.1f us mean, %u us max\n",
+           stats.framesRendered ? (double)stats.renderMicros / stats.framesRendered : 0.0, stats.renderMicrosMax,
+           stats.framesRendered ? (double)stats.flushMicros / stats.framesRendered : 0.0, stats.flushMicrosMax);
+  }
+  return 0;
+}
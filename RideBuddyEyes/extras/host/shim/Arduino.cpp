@@ -0,0 +1,58 @@
+#include "Arduino.h"
+#include "Wire.h"
+#include <chrono>
+#include <thread>
+
+TwoWire Wire;
+
+static bool virtualClock = false;
+static unsigned long virtualMillis = 0;
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+static uint32_t randomState = 0x12345678;
+
+unsigned long millis() {
+  if (virtualClock) return virtualMillis;
+  return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long micros() {
+  if (virtualClock) return virtualMillis * 1000UL;
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+void delay(unsigned long ms) {
+  if (virtualClock) { virtualMillis += ms; return; }
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+  if (!virtualClock) std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+// xorshift32: deterministic across hosts so frame dumps are reproducible
+static uint32_t nextRandom() {
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+long random(long howbig) {
+  if (howbig <= 0) return 0;
+  return (long)(nextRandom() % (uint32_t)howbig);
+}
+
+long random(long howsmall, long howbig) {
+  if (howsmall >= howbig) return howsmall;
+  return howsmall + random(howbig - howsmall);
+}
+
+void randomSeed(unsigned long seed) { randomState = seed ? (uint32_t)seed : 0x12345678; }
+
+void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+int digitalRead(uint8_t pin) { (void)pin; return HIGH; }
+void digitalWrite(uint8_t pin, uint8_t val) { (void)pin; (void)val; }
+
+void hostUseVirtualClock(bool enabled) { virtualClock = enabled; }
+void hostSetMillis(unsigned long ms) { virtualMillis = ms; }
+void hostAdvanceMillis(unsigned long ms) { virtualMillis += ms; }
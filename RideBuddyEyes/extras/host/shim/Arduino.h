@@ -0,0 +1,53 @@
+/*
+  Arduino.h - Host stand-in for the Arduino core used by the RideBuddyEyes
+  native build. Provides a controllable millis() clock, a deterministic
+  random() and no-op pin functions.
+*/
+#ifndef RideBuddyHost_Arduino_h
+#define RideBuddyHost_Arduino_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+#include "pgmspace.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define LOW 0x0
+#define HIGH 0x1
+
+using std::min;
+using std::max;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);
+
+// --- Host Clock Control ---
+// By default millis()/micros() follow the wall clock. Switching to the
+// virtual clock freezes time until it is advanced explicitly, which makes
+// runs reproducible and lets benchmarks simulate minutes in milliseconds.
+void hostUseVirtualClock(bool enabled);
+void hostSetMillis(unsigned long ms);
+void hostAdvanceMillis(unsigned long ms);
+
+#endif
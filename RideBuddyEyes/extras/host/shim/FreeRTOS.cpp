@@ -0,0 +1,51 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <pthread.h>
+#include <thread>
+
+struct HostSemaphore {
+  std::mutex mutex;
+  std::condition_variable available;
+  bool given = false;
+};
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char* name, uint32_t stackDepth, void* parameter,
+                                   UBaseType_t priority, TaskHandle_t* createdTask, BaseType_t coreId) {
+  (void)name; (void)stackDepth; (void)priority; (void)coreId;
+  std::thread thread(task, parameter);
+  if (createdTask) *createdTask = (TaskHandle_t)(uintptr_t)1; // Opaque, never dereferenced
+  thread.detach();
+  return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task) {
+  if (task == NULL) pthread_exit(NULL);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() { return new HostSemaphore(); }
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait) {
+  std::unique_lock<std::mutex> lock(semaphore->mutex);
+  if (ticksToWait == portMAX_DELAY) {
+    semaphore->available.wait(lock, [semaphore] { return semaphore->given; });
+  } else if (!semaphore->available.wait_for(lock, std::chrono::milliseconds(ticksToWait * portTICK_PERIOD_MS),
+                                            [semaphore] { return semaphore->given; })) {
+    return pdFALSE;
+  }
+  semaphore->given = false;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+  std::lock_guard<std::mutex> lock(semaphore->mutex);
+  if (semaphore->given) return pdFALSE; // Binary: already available
+  semaphore->given = true;
+  semaphore->available.notify_one();
+  return pdTRUE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) { delete semaphore; }
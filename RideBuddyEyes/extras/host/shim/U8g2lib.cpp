@@ -0,0 +1,345 @@
+#include "U8g2lib.h"
+#include <stdio.h>
+
+static const u8g2_cb_t rotation0 = { 0 };
+const u8g2_cb_t* U8G2_R0 = &rotation0;
+
+const uint8_t u8g2_font_ncenB08_tr[] = { 0 };
+const uint8_t u8g2_font_6x10_tf[] = { 0 };
+
+U8G2::U8G2(uint8_t width, uint8_t height, uint8_t bufferTileRows)
+  : _width(width), _height(height), _bufferTileRows(bufferTileRows ? bufferTileRows : height / 8) {
+  _u8x8.display = this;
+  size_t size = (size_t)_width * (_height / 8);
+  _buffer = new uint8_t[(size_t)_width * _bufferTileRows];
+  _panel = new uint8_t[size];
+  memset(_buffer, 0, (size_t)_width * _bufferTileRows);
+  memset(_panel, 0, size);
+}
+
+U8G2::~U8G2() {
+  delete[] _buffer;
+  delete[] _panel;
+}
+
+void U8G2::clearBuffer() { memset(_buffer, 0, (size_t)_width * _bufferTileRows); }
+
+// Sends the buffer to the pages it covers: the whole panel for a full buffer
+void U8G2::sendBuffer() {
+  uint8_t rows = _bufferTileRows;
+  if (_bandTileRow + rows > _height / 8) rows = _height / 8 - _bandTileRow;
+  size_t size = (size_t)_width * rows;
+  memcpy(&_panel[(size_t)_bandTileRow * _width], _buffer, size);
+  _bytesSent += size;
+  if (_bandTileRow + rows >= _height / 8) _framesSent++;
+}
+
+// --- Page Buffer Loop ---
+void U8G2::firstPage() {
+  _bandTileRow = 0;
+  clearBuffer();
+}
+
+uint8_t U8G2::nextPage() {
+  sendBuffer();
+  _bandTileRow += _bufferTileRows;
+  if (_bandTileRow >= _height / 8) {
+    _bandTileRow = 0;
+    return 0;
+  }
+  clearBuffer();
+  return 1;
+}
+
+uint8_t u8x8_DrawTile(u8x8_t* u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t* tile_ptr) {
+  U8G2* d = u8x8->display;
+  if (y >= d->_height / 8) return 0;
+  for (uint8_t i = 0; i < cnt && x + i < d->_width / 8; i++) {
+    memcpy(&d->_panel[(size_t)y * d->_width + (x + i) * 8], tile_ptr + i * 8, 8);
+    d->_bytesSent += 8;
+  }
+  return 1;
+}
+
+void u8x8_RefreshDisplay(u8x8_t* u8x8) { (void)u8x8; } // SH1106: nothing to latch
+
+void U8G2::updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) {
+  for (uint8_t row = ty; row < ty + th && row < _height / 8; row++) {
+    if (row < _bandTileRow || row >= _bandTileRow + _bufferTileRows) continue;
+    for (uint8_t col = tx; col < tx + tw && col < _width / 8; col++) {
+      size_t offset = (size_t)row * _width + col * 8;
+      memcpy(&_panel[offset], &_buffer[offset - (size_t)_bandTileRow * _width], 8);
+      _bytesSent += 8;
+    }
+  }
+}
+
+// --- Pixels ---
+void U8G2::plot(int x, int y) {
+  if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+  int page = (y >> 3) - _bandTileRow;
+  if (page < 0 || page >= _bufferTileRows) return; // Outside the band being drawn
+  _pixelsTouched++;
+  uint8_t* b = &_buffer[page * _width + x];
+  uint8_t mask = 1 << (y & 7);
+  if (_drawColor == 0) *b &= ~mask;
+  else if (_drawColor == 1) *b |= mask;
+  else *b ^= mask;
+}
+
+void U8G2::drawPixel(int x, int y) { _primitives++; plot(x, y); }
+void U8G2::drawHLine(int x, int y, int w) { _primitives++; hline(x, y, w); }
+void U8G2::drawVLine(int x, int y, int h) { _primitives++; vline(x, y, h); }
+void U8G2::drawBox(int x, int y, int w, int h) { _primitives++; box(x, y, w, h); }
+void U8G2::drawFrame(int x, int y, int w, int h) { _primitives++; frame(x, y, w, h); }
+
+bool U8G2::getPixel(int x, int y) const {
+  if (x < 0 || y < 0 || x >= _width || y >= _height) return false;
+  int page = (y >> 3) - _bandTileRow;
+  if (page < 0 || page >= _bufferTileRows) return false;
+  return _buffer[page * _width + x] & (1 << (y & 7));
+}
+
+void U8G2::hline(int x, int y, int w) {
+  for (int i = 0; i < w; i++) plot(x + i, y);
+}
+
+void U8G2::vline(int x, int y, int h) {
+  for (int i = 0; i < h; i++) plot(x, y + i);
+}
+
+void U8G2::drawLine(int x0, int y0, int x1, int y1) {
+  _primitives++;
+  int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+  int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+  int err = dx + dy;
+  for (;;) {
+    plot(x0, y0);
+    if (x0 == x1 && y0 == y1) break;
+    int e2 = 2 * err;
+    if (e2 >= dy) { err += dy; x0 += sx; }
+    if (e2 <= dx) { err += dx; y0 += sy; }
+  }
+}
+
+void U8G2::box(int x, int y, int w, int h) {
+  for (int i = 0; i < h; i++) hline(x, y + i, w);
+}
+
+void U8G2::frame(int x, int y, int w, int h) {
+  if (w <= 0 || h <= 0) return;
+  hline(x, y, w);
+  if (h > 1) hline(x, y + h - 1, w);
+  vline(x, y + 1, h - 2);
+  if (w > 1) vline(x + w - 1, y + 1, h - 2);
+}
+
+// --- Circles (midpoint algorithm, same section layout as U8g2) ---
+void U8G2::drawCircleQuadrants(int x0, int y0, int rad, bool filled, uint8_t quadrants) {
+  int f = 1 - rad;
+  int ddF_x = 1;
+  int ddF_y = -2 * rad;
+  int x = 0;
+  int y = rad;
+
+  for (;;) {
+    if (filled) {
+      if (quadrants & U8G2_DRAW_UPPER_RIGHT) { vline(x0 + x, y0 - y, y + 1); vline(x0 + y, y0 - x, x + 1); }
+      if (quadrants & U8G2_DRAW_UPPER_LEFT)  { vline(x0 - x, y0 - y, y + 1); vline(x0 - y, y0 - x, x + 1); }
+      if (quadrants & U8G2_DRAW_LOWER_RIGHT) { vline(x0 + x, y0, y + 1); vline(x0 + y, y0, x + 1); }
+      if (quadrants & U8G2_DRAW_LOWER_LEFT)  { vline(x0 - x, y0, y + 1); vline(x0 - y, y0, x + 1); }
+    } else {
+      if (quadrants & U8G2_DRAW_UPPER_RIGHT) { plot(x0 + x, y0 - y); plot(x0 + y, y0 - x); }
+      if (quadrants & U8G2_DRAW_UPPER_LEFT)  { plot(x0 - x, y0 - y); plot(x0 - y, y0 - x); }
+      if (quadrants & U8G2_DRAW_LOWER_RIGHT) { plot(x0 + x, y0 + y); plot(x0 + y, y0 + x); }
+      if (quadrants & U8G2_DRAW_LOWER_LEFT)  { plot(x0 - x, y0 + y); plot(x0 - y, y0 + x); }
+    }
+    if (x >= y) break;
+    if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+  }
+}
+
+void U8G2::drawDisc(int x0, int y0, int rad, uint8_t opt) {
+  _primitives++;
+  if (rad < 0) return;
+  // Filled sections overlap on the axes; with XOR colour that would cancel
+  // pixels, so draw the disc as horizontal spans instead.
+  if (_drawColor == 2 && opt == U8G2_DRAW_ALL) {
+    for (int dy = -rad; dy <= rad; dy++) {
+      int dx = (int)floor(sqrt((double)rad * rad - (double)dy * dy) + 0.5);
+      hline(x0 - dx, y0 + dy, 2 * dx + 1);
+    }
+    return;
+  }
+  drawCircleQuadrants(x0, y0, rad, true, opt);
+}
+
+void U8G2::drawCircle(int x0, int y0, int rad, uint8_t opt) {
+  _primitives++;
+  if (rad < 0) return;
+  drawCircleQuadrants(x0, y0, rad, false, opt);
+}
+
+void U8G2::drawRBox(int x, int y, int w, int h, int r) {
+  _primitives++;
+  if (w <= 0 || h <= 0) return;
+  if (r <= 0) { box(x, y, w, h); return; }
+  int xl = x + r;
+  int yu = y + r;
+  int xr = x + w - r - 1;
+  int yl = y + h - r - 1;
+
+  drawCircleQuadrants(xl, yu, r, true, U8G2_DRAW_UPPER_LEFT);
+  drawCircleQuadrants(xr, yu, r, true, U8G2_DRAW_UPPER_RIGHT);
+  drawCircleQuadrants(xl, yl, r, true, U8G2_DRAW_LOWER_LEFT);
+  drawCircleQuadrants(xr, yl, r, true, U8G2_DRAW_LOWER_RIGHT);
+
+  int ww = w - r - r;
+  int hh = h - r - r;
+  xl++;
+  yu++;
+  if (ww >= 3) {
+    ww -= 2;
+    box(xl, y, ww, r + 1);
+    box(xl, yl, ww, r + 1);
+  }
+  if (hh >= 3) {
+    hh -= 2;
+    box(x, yu, w, hh);
+  }
+}
+
+void U8G2::drawRFrame(int x, int y, int w, int h, int r) {
+  _primitives++;
+  if (w <= 0 || h <= 0) return;
+  if (r <= 0) { frame(x, y, w, h); return; }
+  int xl = x + r;
+  int yu = y + r;
+  int xr = x + w - r - 1;
+  int yl = y + h - r - 1;
+  drawCircleQuadrants(xl, yu, r, false, U8G2_DRAW_UPPER_LEFT);
+  drawCircleQuadrants(xr, yu, r, false, U8G2_DRAW_UPPER_RIGHT);
+  drawCircleQuadrants(xl, yl, r, false, U8G2_DRAW_LOWER_LEFT);
+  drawCircleQuadrants(xr, yl, r, false, U8G2_DRAW_LOWER_RIGHT);
+  int ww = w - r - r;
+  int hh = h - r - r;
+  xl++;
+  yu++;
+  if (ww >= 3) {
+    ww -= 2;
+    hline(xl, y, ww);
+    hline(xl, y + h - 1, ww);
+  }
+  if (hh >= 3) {
+    hh -= 2;
+    vline(x, yu, hh);
+    vline(x + w - 1, yu, hh);
+  }
+}
+
+// --- Ellipses (sampled along both axes; close to, not bit-identical with, U8g2) ---
+static int ellipseSpan(int r, int d, int rd) {
+  if (rd == 0) return r;
+  double t = 1.0 - (double)d * d / ((double)rd * rd);
+  return (int)floor(r * sqrt(t < 0 ? 0 : t) + 0.5);
+}
+
+void U8G2::drawEllipse(int x0, int y0, int rx, int ry) {
+  _primitives++;
+  if (rx < 0 || ry < 0) return;
+  // Walking both axes keeps steep and flat parts of the outline connected
+  for (int dy = 0; dy <= ry; dy++) {
+    int dx = ellipseSpan(rx, dy, ry);
+    plot(x0 + dx, y0 + dy); plot(x0 - dx, y0 + dy);
+    plot(x0 + dx, y0 - dy); plot(x0 - dx, y0 - dy);
+  }
+  for (int dx = 0; dx <= rx; dx++) {
+    int dy = ellipseSpan(ry, dx, rx);
+    plot(x0 + dx, y0 + dy); plot(x0 - dx, y0 + dy);
+    plot(x0 + dx, y0 - dy); plot(x0 - dx, y0 - dy);
+  }
+}
+
+void U8G2::drawFilledEllipse(int x0, int y0, int rx, int ry) {
+  _primitives++;
+  if (rx < 0 || ry < 0) return;
+  for (int dy = -ry; dy <= ry; dy++) {
+    int dx = ellipseSpan(rx, dy, ry);
+    hline(x0 - dx, y0 + dy, 2 * dx + 1);
+  }
+}
+
+// --- Bitmaps (XBM: row-major, LSB = leftmost pixel) ---
+void U8G2::drawXBM(int x, int y, int w, int h, const uint8_t* bitmap) {
+  _primitives++;
+  int stride = (w + 7) / 8;
+  uint8_t color = _drawColor;
+  for (int row = 0; row < h; row++) {
+    const uint8_t* line = bitmap + row * stride;
+    for (int col = 0; col < w; col++) {
+      if (line[col >> 3] & (1 << (col & 7))) {
+        _drawColor = color;
+      } else if (!_bitmapTransparent && color != 2) {
+        _drawColor = color ? 0 : 1; // Solid mode paints the background too
+      } else {
+        continue;
+      }
+      plot(x + col, y + row);
+    }
+  }
+  _drawColor = color;
+}
+
+// --- Text ---
+void U8G2::drawGlyph(int x, int y, char c) {
+  if (c == ' ') return;
+  frame(x, y - 7, 5, 7); // Baseline-anchored placeholder cell
+}
+
+size_t U8G2::print(const char* text) {
+  _primitives++;
+  size_t n = 0;
+  for (; *text; text++, n++) {
+    drawGlyph(_cursorX, _cursorY, *text);
+    _cursorX += 6;
+  }
+  return n;
+}
+
+size_t U8G2::print(char c) {
+  char text[2] = { c, 0 };
+  return print(text);
+}
+
+size_t U8G2::print(int value) {
+  char text[12];
+  snprintf(text, sizeof(text), "%d", value);
+  return print(text);
+}
+
+int U8G2::drawStr(int x, int y, const char* text) {
+  setCursor(x, y);
+  return (int)print(text) * 6;
+}
+
+// --- Host Introspection ---
+bool U8G2::writePBM(const char* path) const {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  fprintf(f, "P4\n%d %d\n", _width, _height);
+  int stride = (_width + 7) / 8;
+  uint8_t* row = new uint8_t[stride];
+  for (int y = 0; y < _height; y++) {
+    memset(row, 0, stride);
+    for (int x = 0; x < _width; x++) {
+      if (_panel[(y >> 3) * _width + x] & (1 << (y & 7))) row[x >> 3] |= 0x80 >> (x & 7);
+    }
+    fwrite(row, 1, stride, f);
+  }
+  delete[] row;
+  fclose(f);
+  return true;
+}
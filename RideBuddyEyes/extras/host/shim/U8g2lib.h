@@ -0,0 +1,165 @@
+/*
+  U8g2lib.h - Host stand-in for the parts of U8g2 that RideBuddyEyes uses.
+  Draws into an in-memory buffer with the same page-major layout as U8g2
+  (one byte = 8 vertical pixels, one page per 8 rows), so code that
+  pokes getBufferPtr() behaves exactly as on the device. "Sending" a frame
+  only counts bytes and bumps a frame counter. The "_1_"/"_2_" constructors
+  keep only a band of one or two pages, drawn through firstPage()/nextPage().
+*/
+#ifndef RideBuddyHost_U8g2lib_h
+#define RideBuddyHost_U8g2lib_h
+
+#include "Arduino.h"
+
+#define U8X8_PIN_NONE 255
+
+#define U8G2_DRAW_UPPER_RIGHT 0x01
+#define U8G2_DRAW_UPPER_LEFT  0x02
+#define U8G2_DRAW_LOWER_LEFT  0x04
+#define U8G2_DRAW_LOWER_RIGHT 0x08
+#define U8G2_DRAW_ALL (U8G2_DRAW_UPPER_RIGHT | U8G2_DRAW_UPPER_LEFT | U8G2_DRAW_LOWER_RIGHT | U8G2_DRAW_LOWER_LEFT)
+
+typedef struct { int rotation; } u8g2_cb_t;
+
+// Low-level (u8x8) transfer handle: sends tiles from any buffer, not just
+// the U8G2 one. Tile (x, y) is 8 bytes at tile_ptr, one byte per column.
+class U8G2;
+typedef struct u8x8_struct { U8G2* display; } u8x8_t;
+uint8_t u8x8_DrawTile(u8x8_t* u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t* tile_ptr);
+void u8x8_RefreshDisplay(u8x8_t* u8x8);
+extern const u8g2_cb_t* U8G2_R0;
+
+extern const uint8_t u8g2_font_ncenB08_tr[];
+extern const uint8_t u8g2_font_6x10_tf[];
+
+class U8G2 {
+  public:
+    U8G2(uint8_t width = 128, uint8_t height = 64, uint8_t bufferTileRows = 0); // 0 = full buffer
+    ~U8G2();
+
+    bool begin() { return true; }
+    void setBusClock(uint32_t clock) { _busClock = clock; }
+    void setI2CAddress(uint8_t address) { (void)address; }
+    void clearDisplay() { clearBuffer(); sendBuffer(); }
+    void setPowerSave(uint8_t enabled) { (void)enabled; }
+    void setContrast(uint8_t value) { (void)value; }
+
+    // --- Buffer Access ---
+    uint8_t* getBufferPtr() { return _buffer; }
+    uint8_t getBufferTileWidth() const { return _width / 8; }
+    uint8_t getBufferTileHeight() const { return _bufferTileRows; }
+    uint8_t getBufferCurrTileRow() const { return _bandTileRow; }
+    uint16_t getDisplayWidth() const { return _width; }
+    uint16_t getDisplayHeight() const { return _height; }
+
+    // --- Transfer ---
+    void clearBuffer();
+    void sendBuffer();
+    void updateDisplay() { sendBuffer(); }
+    void updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th);
+    u8x8_t* getU8x8() { return &_u8x8; }
+
+    // --- Page Buffer Loop ---
+    void firstPage();
+    uint8_t nextPage(); // Sends the band; 0 once the last one is out
+
+    // --- Drawing ---
+    void setDrawColor(uint8_t color) { _drawColor = color; }
+    uint8_t getDrawColor() const { return _drawColor; }
+    void drawPixel(int x, int y);
+    void drawHLine(int x, int y, int w);
+    void drawVLine(int x, int y, int h);
+    void drawLine(int x0, int y0, int x1, int y1);
+    void drawBox(int x, int y, int w, int h);
+    void drawFrame(int x, int y, int w, int h);
+    void drawRBox(int x, int y, int w, int h, int r);
+    void drawRFrame(int x, int y, int w, int h, int r);
+    void drawDisc(int x0, int y0, int rad, uint8_t opt = U8G2_DRAW_ALL);
+    void drawCircle(int x0, int y0, int rad, uint8_t opt = U8G2_DRAW_ALL);
+    void drawEllipse(int x0, int y0, int rx, int ry);
+    void drawFilledEllipse(int x0, int y0, int rx, int ry);
+    void setBitmapMode(uint8_t transparent) { _bitmapTransparent = transparent; }
+    void drawXBM(int x, int y, int w, int h, const uint8_t* bitmap);
+    void drawXBMP(int x, int y, int w, int h, const uint8_t* bitmap) { drawXBM(x, y, w, h, bitmap); }
+
+    // --- Text (fixed 6x8 placeholder glyphs; font data is not emulated) ---
+    void setFont(const uint8_t* font) { (void)font; }
+    void setCursor(int x, int y) { _cursorX = x; _cursorY = y; }
+    size_t print(const char* text);
+    size_t print(char c);
+    size_t print(int value);
+    int drawStr(int x, int y, const char* text);
+
+    // --- Host Introspection ---
+    uint32_t framesSent() const { return _framesSent; }
+    uint32_t bytesSent() const { return _bytesSent; }
+    uint32_t primitivesDrawn() const { return _primitives; }  // Public draw calls
+    uint32_t pixelsTouched() const { return _pixelsTouched; } // In-bounds pixel writes
+    void resetCounters() { _primitives = 0; _pixelsTouched = 0; _bytesSent = 0; _framesSent = 0; }
+    const uint8_t* panel() const { return _panel; }   // What the "glass" shows
+    bool getPixel(int x, int y) const;
+    bool writePBM(const char* path) const;            // Dumps the panel contents
+
+  private:
+    friend uint8_t u8x8_DrawTile(u8x8_t* u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t* tile_ptr);
+
+    u8x8_t _u8x8;
+    uint8_t _width;
+    uint8_t _height;
+    uint8_t _bufferTileRows;
+    uint8_t _bandTileRow = 0; // Page at the top of the buffer
+    uint8_t* _buffer;
+    uint8_t* _panel;
+    uint8_t _drawColor = 1;
+    uint8_t _bitmapTransparent = 0;
+    int _cursorX = 0;
+    int _cursorY = 0;
+    uint32_t _busClock = 400000;
+    uint32_t _framesSent = 0;
+    uint32_t _bytesSent = 0;
+    uint32_t _primitives = 0;
+    uint32_t _pixelsTouched = 0;
+
+    // Uncounted building blocks shared by the public primitives
+    void plot(int x, int y);
+    void hline(int x, int y, int w);
+    void vline(int x, int y, int h);
+    void box(int x, int y, int w, int h);
+    void frame(int x, int y, int w, int h);
+
+    void drawCircleQuadrants(int x0, int y0, int rad, bool filled, uint8_t quadrants);
+    void drawGlyph(int x, int y, char c);
+};
+
+// The concrete constructors are thin aliases; only geometry matters here.
+class U8G2_SH1106_128X64_NONAME_F_HW_I2C : public U8G2 {
+  public:
+    U8G2_SH1106_128X64_NONAME_F_HW_I2C(const u8g2_cb_t* rotation, uint8_t reset = U8X8_PIN_NONE, uint8_t clock = U8X8_PIN_NONE, uint8_t data = U8X8_PIN_NONE)
+      : U8G2(128, 64) { (void)rotation; (void)reset; (void)clock; (void)data; }
+};
+
+class U8G2_SH1106_128X64_NONAME_1_HW_I2C : public U8G2 {
+  public:
+    U8G2_SH1106_128X64_NONAME_1_HW_I2C(const u8g2_cb_t* rotation, uint8_t reset = U8X8_PIN_NONE, uint8_t clock = U8X8_PIN_NONE, uint8_t data = U8X8_PIN_NONE)
+      : U8G2(128, 64, 1) { (void)rotation; (void)reset; (void)clock; (void)data; }
+};
+
+class U8G2_SH1106_128X64_NONAME_2_HW_I2C : public U8G2 {
+  public:
+    U8G2_SH1106_128X64_NONAME_2_HW_I2C(const u8g2_cb_t* rotation, uint8_t reset = U8X8_PIN_NONE, uint8_t clock = U8X8_PIN_NONE, uint8_t data = U8X8_PIN_NONE)
+      : U8G2(128, 64, 2) { (void)rotation; (void)reset; (void)clock; (void)data; }
+};
+
+class U8G2_SSD1306_128X32_UNIVISION_F_HW_I2C : public U8G2 {
+  public:
+    U8G2_SSD1306_128X32_UNIVISION_F_HW_I2C(const u8g2_cb_t* rotation, uint8_t reset = U8X8_PIN_NONE, uint8_t clock = U8X8_PIN_NONE, uint8_t data = U8X8_PIN_NONE)
+      : U8G2(128, 32) { (void)rotation; (void)reset; (void)clock; (void)data; }
+};
+
+class U8G2_SSD1327_MIDAS_128X128_F_HW_I2C : public U8G2 {
+  public:
+    U8G2_SSD1327_MIDAS_128X128_F_HW_I2C(const u8g2_cb_t* rotation, uint8_t reset = U8X8_PIN_NONE, uint8_t clock = U8X8_PIN_NONE, uint8_t data = U8X8_PIN_NONE)
+      : U8G2(128, 128) { (void)rotation; (void)reset; (void)clock; (void)data; }
+};
+
+#endif
@@ -0,0 +1,24 @@
+/*
+  Wire.h - Host stand-in. The mock display never touches the bus, so
+  TwoWire only records the pins and clock it was configured with.
+*/
+#ifndef RideBuddyHost_Wire_h
+#define RideBuddyHost_Wire_h
+
+#include "Arduino.h"
+
+class TwoWire {
+  public:
+    bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) { _sda = sda; _scl = scl; if (frequency) _clock = frequency; return true; }
+    void setClock(uint32_t frequency) { _clock = frequency; }
+    uint32_t getClock() const { return _clock; }
+
+  private:
+    int _sda = -1;
+    int _scl = -1;
+    uint32_t _clock = 100000;
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,21 @@
+/*
+  freertos/FreeRTOS.h - Host stand-in for the few FreeRTOS calls used by the
+  RideBuddyEyes display task. Tasks are std::threads and semaphores a mutex
+  plus condition variable; core pinning and priorities are ignored.
+*/
+#ifndef RideBuddyHost_FreeRTOS_h
+#define RideBuddyHost_FreeRTOS_h
+
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS pdTRUE
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+#define portTICK_PERIOD_MS 1
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef RideBuddyHost_task_h
+#define RideBuddyHost_task_h
+
+#include "FreeRTOS.h"
+
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char* name, uint32_t stackDepth, void* parameter,
+                                   UBaseType_t priority, TaskHandle_t* createdTask, BaseType_t coreId);
+void vTaskDelete(TaskHandle_t task); // Only vTaskDelete(NULL) from inside the task is supported
+
+#endif
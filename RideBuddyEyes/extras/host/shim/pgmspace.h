@@ -0,0 +1,21 @@
+/*
+  pgmspace.h - Host stand-in. Flash and RAM share one address space on the
+  host, so PROGMEM is empty and the read helpers are plain loads.
+*/
+#ifndef RideBuddyHost_pgmspace_h
+#define RideBuddyHost_pgmspace_h
+
+#include <stdint.h>
+#include <string.h>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_ptr(addr) (*(const void* const*)(addr))
+#define memcpy_P memcpy
+
+#endif
@@ -0,0 +1,171 @@
+/*
+  clipbench.cpp - Host-side decode benchmark for the compiled-in clips and
+  stills. Reports the stored bytes per frame and the time to decode a frame
+  into a 1 KB tile buffer, next to a plain 1 KB copy as the baseline.
+
+  Also measures how much 8x8 tile content the clips share, and what a
+  shared tile dictionary (every distinct tile once, frames as maps of tile
+  indices) would take compared with the keyframe + XOR-delta encoding.
+
+  Build:  g++ -O2 -I../.. -o clipbench clipbench.cpp ../../RideBuddyClip.cpp
+  Usage:  clipbench [iterations]
+*/
+#include "RideBuddyClip.h"
+#include "data/cry.h"
+#include "data/shy.h"
+#include "data/driving.h"
+#include "data/happy.h"
+#include "data/battery.h"
+#include "data/angry.h"
+#include "data/love.h"
+#include <chrono>
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define FRAME_BYTES 1024
+#define TILE_ROWS 8
+
+struct BenchEntry {
+  const char* name;
+  const uint8_t* data;
+  bool still;
+};
+
+static const BenchEntry entries[] = {
+  { "cry", cry_clip, false },
+  { "shy", shy_clip, false },
+  { "driving", driving_clip, false },
+  { "happy", happy_clip, false },
+  { "battery", battery_clip, false },
+  { "angry", angry_still, true },
+  { "love", love_still, true },
+};
+
+static volatile uint8_t sink; // Keeps the optimiser from dropping the work
+
+// --- Tile Sharing ---
+struct TileUse {
+  uint32_t placements; // Frames that change the tile at some position to this content
+  uint32_t clips;      // Bit per entry using it
+};
+
+static uint64_t tileKey(const uint8_t* tile) {
+  uint64_t key;
+  memcpy(&key, tile, CLIP_TILE_BYTES);
+  return key;
+}
+
+// Decodes every frame and records, per distinct tile, where it is placed.
+// Only tiles that differ from the previous frame at their position count:
+// a tile-map frame, like a delta, would leave the others alone.
+static void collectTiles(size_t entry, const uint8_t* clip, std::map<uint64_t, TileUse>& tiles, uint32_t* changed) {
+  uint8_t buffer[FRAME_BYTES];
+  uint8_t previous[FRAME_BYTES];
+  uint16_t dirty[TILE_ROWS];
+  memset(previous, 0, sizeof(previous));
+  memset(buffer, 0, sizeof(buffer)); // Stills are drawn over a cleared buffer
+  int current = -1;
+  for (uint8_t f = 0; f < clipFrameCount(clip); f++) {
+    if (clipFrameCount(clip) == 1) clipDrawKeyFrame(clip, 0, 0, 0, buffer);
+    else current = clipSeek(clip, current, f, buffer, dirty);
+    for (uint16_t t = 0; t < FRAME_BYTES / CLIP_TILE_BYTES; t++) {
+      const uint8_t* tile = &buffer[t * CLIP_TILE_BYTES];
+      if (!memcmp(tile, &previous[t * CLIP_TILE_BYTES], CLIP_TILE_BYTES)) continue;
+      TileUse& use = tiles[tileKey(tile)];
+      use.placements++;
+      use.clips |= 1u << entry;
+      (*changed)++;
+    }
+    memcpy(previous, buffer, sizeof(previous));
+  }
+}
+
+static double nowMicros() {
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int main(int argc, char** argv) {
+  int iterations = argc > 1 ? atoi(argv[1]) : 2000;
+  if (iterations < 1) iterations = 1;
+
+  static const size_t sizes[] = { sizeof(cry_clip), sizeof(shy_clip), sizeof(driving_clip), sizeof(happy_clip),
+                                  sizeof(battery_clip), sizeof(angry_still), sizeof(love_still) };
+
+  uint8_t buffer[FRAME_BYTES];
+  uint8_t raw[FRAME_BYTES];
+  uint16_t dirty[TILE_ROWS];
+  memset(raw, 0x5A, sizeof(raw));
+
+  // Baseline: what a raw 1 KB frame costs just to copy
+  double start = nowMicros();
+  for (int i = 0; i < iterations; i++) {
+    raw[i & 1023] = (uint8_t)i;
+    memcpy(buffer, raw, FRAME_BYTES);
+    sink = buffer[i & 1023];
+  }
+  double copyMicros = (nowMicros() - start) / iterations;
+
+  printf("%-8s %6s %8s %10s %10s %10s\n", "name", "frames", "bytes", "bytes/frm", "us/decode", "us/seek");
+  uint32_t totalBytes = 0;
+  uint32_t totalFrames = 0;
+  for (size_t e = 0; e < sizeof(entries) / sizeof(entries[0]); e++) {
+    const BenchEntry& entry = entries[e];
+    uint8_t frames = clipFrameCount(entry.data);
+    uint32_t bytes = (uint32_t)sizes[e];
+    double decodeMicros;
+    double seekMicros = 0;
+
+    if (entry.still) {
+      start = nowMicros();
+      for (int i = 0; i < iterations; i++) {
+        memset(buffer, 0, sizeof(buffer));
+        clipDrawKeyFrame(entry.data, 0, (int8_t)(i % 5 - 2), (int8_t)(i % 3 - 1), buffer);
+        sink = buffer[i & 1023];
+      }
+      decodeMicros = (nowMicros() - start) / iterations; // Includes the clear, as drawEyes() does
+    } else {
+      // Sequential playback: one step per frame, looping
+      int current = -1;
+      memset(buffer, 0, sizeof(buffer));
+      current = clipSeek(entry.data, current, 0, buffer, dirty);
+      long steps = (long)iterations * frames;
+      start = nowMicros();
+      for (long i = 1; i <= steps; i++) {
+        current = clipSeek(entry.data, current, (uint8_t)(i % frames), buffer, dirty);
+        sink = buffer[i & 1023];
+      }
+      decodeMicros = (nowMicros() - start) / steps;
+
+      // Random access: jump into the middle of the clip from scratch
+      start = nowMicros();
+      for (int i = 0; i < iterations; i++) {
+        clipSeek(entry.data, -1, (uint8_t)((i * 7) % frames), buffer, dirty);
+        sink = buffer[i & 1023];
+      }
+      seekMicros = (nowMicros() - start) / iterations;
+    }
+
+    totalBytes += bytes;
+    totalFrames += frames;
+    printf("%-8s %6u %8u %10.1f %10.2f %10.2f\n", entry.name, frames, bytes, (double)bytes / frames, decodeMicros, seekMicros);
+  }
+  printf("%-8s %6u %8u %10.1f\n", "total", totalFrames, totalBytes, (double)totalBytes / totalFrames);
+  printf("raw frame: %u bytes, %.2f us per 1 KB copy\n", FRAME_BYTES, copyMicros);
+
+  std::map<uint64_t, TileUse> tiles;
+  uint32_t changed = 0;
+  for (size_t e = 0; e < sizeof(entries) / sizeof(entries[0]); e++) collectTiles(e, entries[e].data, tiles, &changed);
+  uint32_t once = 0, shared = 0;
+  for (const auto& tile : tiles) {
+    if (tile.second.placements == 1) once++;
+    if (tile.second.clips & (tile.second.clips - 1)) shared++;
+  }
+  // Dictionary plus, per frame, a changed-tile bitmap and a 2-byte index per changed tile
+  uint32_t dictionaryBytes = (uint32_t)tiles.size() * CLIP_TILE_BYTES;
+  uint32_t mapBytes = totalFrames * (FRAME_BYTES / CLIP_TILE_BYTES / 8) + changed * 2;
+  printf("\ntiles: %u distinct, %u placed only once, %u in more than one clip\n", (unsigned)tiles.size(), once, shared);
+  printf("shared dictionary: %u + %u bytes of tile maps = %u bytes (stored now: %u)\n", dictionaryBytes, mapBytes,
+         dictionaryBytes + mapBytes, totalBytes);
+  return 0;
+}
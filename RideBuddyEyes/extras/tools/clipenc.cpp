@@ -0,0 +1,537 @@
+/*
+  clipenc.cpp - Compiles frame images into the clip format described in
+  RideBuddyClip.h: keyframes plus XOR deltas, each stored raw or
+  RLE-compressed, whichever is smaller.
+
+  Build:  g++ -O2 -I../.. -o clipenc clipenc.cpp ../../RideBuddyClip.cpp
+          (add -DCLIPENC_PNG=1 -lpng for PNG input; the CMake build does)
+  Usage:  clipenc [options] input... output.h
+          clipenc [options] input... output.bin   (raw clip for clippack)
+
+  Inputs are read in order and may be mixed:
+    .h         XBM frame header (extras/assets): every 128x64 array is a frame
+    .pbm       P1/P4 bitmap; 1 bits are lit pixels, as in eyes_host --dump
+    .pgm .png  greyscale/colour, reduced to 1 bit by -t and -d; bright is lit
+  Images are 128x64, the canvas the face is designed on.
+
+  Options:
+    -k N       keyframe interval (default 12)
+    -n NAME    symbol prefix (default: output file name)
+    -g WxH     fit to another panel, see below
+    -t N       threshold 0-255 for .pgm/.png (default 128)
+    -d MODE    dither .pgm/.png: none (default), bayer or fs (Floyd-Steinberg)
+    -i         invert
+    -u         drop frames identical to the one before
+    -x DIR     write the frames to DIR/NAME_NNN.pbm instead of encoding,
+               e.g. to turn an asset header back into editable images
+
+  A single frame is written as a still (<name>_still) instead of a clip
+  (<name>_clip + <NAME>_FRAME_COUNT). The encoded data is decoded again
+  before writing to make sure it round-trips.
+
+  -g fits the frames to another panel the way RideBuddyEyes.h lays out the
+  face: shrunk by a whole factor until they fit (a shrunk pixel is set if
+  any pixel it covers is), then centred. Such headers go to data/WxH/.
+*/
+#include "RideBuddyClip.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#if CLIPENC_PNG
+#include <png.h>
+#endif
+
+#define SOURCE_WIDTH 128
+#define SOURCE_HEIGHT 64
+#define SOURCE_BYTES (SOURCE_WIDTH * SOURCE_HEIGHT / 8)
+#define MAX_TILE_COLS 16 // One uint16_t of dirty bits per page
+#define MAX_TILES 256    // Delta tile indices are one byte
+
+typedef std::vector<uint8_t> Bytes;
+
+// Target panel, see -g
+static int panelWidth = SOURCE_WIDTH;
+static int panelHeight = SOURCE_HEIGHT;
+static int frameBytes() { return panelWidth * panelHeight / 8; }
+static int tileCols() { return panelWidth / 8; }
+static int tileRows() { return panelHeight / 8; }
+
+static std::string fileName(const char* path) {
+  std::string s(path);
+  size_t slash = s.find_last_of("/\\");
+  return slash == std::string::npos ? s : s.substr(slash + 1);
+}
+
+static bool readFile(const char* path, std::string& out) {
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+  char chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) out.append(chunk, n);
+  fclose(f);
+  return true;
+}
+
+// Collects the hex bytes of every "name[] ... = { ... };" array that holds
+// exactly one 128x64 XBM image.
+static std::vector<Bytes> parseXbmFrames(const std::string& text) {
+  std::vector<Bytes> frames;
+  size_t pos = 0;
+  while ((pos = text.find("[]", pos)) != std::string::npos) {
+    size_t open = text.find('{', pos);
+    size_t close = text.find("};", pos);
+    pos += 2;
+    if (open == std::string::npos || close == std::string::npos || open > close) continue;
+    Bytes xbm;
+    for (size_t i = open; i < close; i++) {
+      if (text.compare(i, 2, "//") == 0) { i = text.find('\n', i); if (i == std::string::npos) break; continue; }
+      if (text[i] == '0' && (text[i + 1] == 'x' || text[i + 1] == 'X')) {
+        xbm.push_back((uint8_t)strtoul(text.c_str() + i, NULL, 16));
+        i += 3;
+      }
+    }
+    if (xbm.size() == SOURCE_BYTES) frames.push_back(xbm);
+    pos = close;
+  }
+  return frames;
+}
+
+// --- Image Input ---
+enum DitherMode { DITHER_NONE, DITHER_BAYER, DITHER_FS };
+
+static int threshold = 128;
+static DitherMode dither = DITHER_NONE;
+
+static bool endsWith(const std::string& s, const char* suffix) {
+  size_t n = strlen(suffix);
+  if (s.size() < n) return false;
+  for (size_t i = 0; i < n; i++) {
+    if (tolower((unsigned char)s[s.size() - n + i]) != suffix[i]) return false;
+  }
+  return true;
+}
+
+static void setXbmPixel(Bytes& xbm, int x, int y) { xbm[y * (SOURCE_WIDTH / 8) + x / 8] |= 1 << (x & 7); }
+
+// Greyscale canvas (0 = black) -> XBM, by threshold or dither
+static Bytes greyToXbm(std::vector<int> grey) {
+  static const uint8_t bayer[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5},
+  };
+  Bytes xbm(SOURCE_BYTES, 0);
+  for (int y = 0; y < SOURCE_HEIGHT; y++) {
+    for (int x = 0; x < SOURCE_WIDTH; x++) {
+      int v = grey[y * SOURCE_WIDTH + x];
+      int t = threshold;
+      if (dither == DITHER_BAYER) t = (bayer[y & 3][x & 3] * 2 + 1) * 8; // Thresholds spread over 8 .. 248
+      bool lit = v >= t;
+      if (lit) setXbmPixel(xbm, x, y);
+      if (dither != DITHER_FS) continue;
+      int error = v - (lit ? 255 : 0);
+      if (x + 1 < SOURCE_WIDTH) grey[y * SOURCE_WIDTH + x + 1] += error * 7 / 16;
+      if (y + 1 < SOURCE_HEIGHT) {
+        if (x > 0) grey[(y + 1) * SOURCE_WIDTH + x - 1] += error * 3 / 16;
+        grey[(y + 1) * SOURCE_WIDTH + x] += error * 5 / 16;
+        if (x + 1 < SOURCE_WIDTH) grey[(y + 1) * SOURCE_WIDTH + x + 1] += error / 16;
+      }
+    }
+  }
+  return xbm;
+}
+
+// Reads one whitespace-separated PNM header number, skipping comments
+static bool pnmNumber(const std::string& text, size_t& pos, int& value) {
+  for (;;) {
+    while (pos < text.size() && isspace((unsigned char)text[pos])) pos++;
+    if (pos < text.size() && text[pos] == '#') { pos = text.find('\n', pos); if (pos == std::string::npos) return false; continue; }
+    break;
+  }
+  if (pos >= text.size() || !isdigit((unsigned char)text[pos])) return false;
+  value = 0;
+  while (pos < text.size() && isdigit((unsigned char)text[pos])) value = value * 10 + (text[pos++] - '0');
+  return true;
+}
+
+// P1/P4 bitmaps and P2/P5 greymaps
+static bool parsePnm(const std::string& text, Bytes& xbm, std::string& error) {
+  if (text.size() < 2 || text[0] != 'P' || text[1] < '1' || text[1] > '5' || text[1] == '3') { error = "not a PBM or PGM file"; return false; }
+  char kind = text[1];
+  bool bitmap = kind == '1' || kind == '4';
+  size_t pos = 2;
+  int width, height, maxval = 1;
+  if (!pnmNumber(text, pos, width) || !pnmNumber(text, pos, height) || (!bitmap && !pnmNumber(text, pos, maxval)) || maxval < 1 || maxval > 255) {
+    error = "bad header";
+    return false;
+  }
+  if (width != SOURCE_WIDTH || height != SOURCE_HEIGHT) { error = "image is " + std::to_string(width) + "x" + std::to_string(height) + ", expected 128x64"; return false; }
+  pos++; // The single whitespace byte before raster data
+
+  if (kind == '4') {
+    if (text.size() < pos + SOURCE_BYTES) { error = "truncated"; return false; }
+    xbm.assign(SOURCE_BYTES, 0);
+    for (int y = 0; y < SOURCE_HEIGHT; y++) {
+      for (int x = 0; x < SOURCE_WIDTH; x++) {
+        if ((uint8_t)text[pos + y * (SOURCE_WIDTH / 8) + x / 8] & (0x80 >> (x & 7))) setXbmPixel(xbm, x, y);
+      }
+    }
+    return true;
+  }
+
+  std::vector<int> grey(SOURCE_WIDTH * SOURCE_HEIGHT);
+  for (size_t i = 0; i < grey.size(); i++) {
+    int v;
+    if (kind == '5') {
+      if (pos >= text.size()) { error = "truncated"; return false; }
+      v = (uint8_t)text[pos++];
+    } else if (kind == '1') { // Digits may be packed without spaces
+      while (pos < text.size() && text[pos] != '0' && text[pos] != '1') pos++;
+      if (pos >= text.size()) { error = "truncated"; return false; }
+      v = text[pos++] - '0';
+    } else if (!pnmNumber(text, pos, v)) {
+      error = "truncated";
+      return false;
+    }
+    grey[i] = bitmap ? (v ? 255 : 0) : v * 255 / maxval;
+  }
+  if (bitmap) { // No threshold or dither for bitmaps
+    xbm.assign(SOURCE_BYTES, 0);
+    for (int i = 0; i < SOURCE_WIDTH * SOURCE_HEIGHT; i++) if (grey[i]) setXbmPixel(xbm, i % SOURCE_WIDTH, i / SOURCE_WIDTH);
+    return true;
+  }
+  xbm = greyToXbm(grey);
+  return true;
+}
+
+#if CLIPENC_PNG
+// Any PNG, reduced to grey over a black background
+static bool readPng(const char* path, Bytes& xbm, std::string& error) {
+  png_image image;
+  memset(&image, 0, sizeof(image));
+  image.version = PNG_IMAGE_VERSION;
+  if (!png_image_begin_read_from_file(&image, path)) { error = image.message; return false; }
+  if (image.width != SOURCE_WIDTH || image.height != SOURCE_HEIGHT) {
+    error = "image is " + std::to_string(image.width) + "x" + std::to_string(image.height) + ", expected 128x64";
+    png_image_free(&image);
+    return false;
+  }
+  image.format = PNG_FORMAT_GA;
+  Bytes pixels(PNG_IMAGE_SIZE(image));
+  if (!png_image_finish_read(&image, NULL, pixels.data(), 0, NULL)) { error = image.message; return false; }
+  std::vector<int> grey(SOURCE_WIDTH * SOURCE_HEIGHT);
+  for (size_t i = 0; i < grey.size(); i++) grey[i] = pixels[i * 2] * pixels[i * 2 + 1] / 255;
+  xbm = greyToXbm(grey);
+  return true;
+}
+#endif
+
+// Appends the frames of one input file, as XBM canvases
+static bool readFrames(const char* path, std::vector<Bytes>& frames) {
+  std::string error;
+  Bytes xbm;
+  if (endsWith(path, ".png")) {
+#if CLIPENC_PNG
+    if (!readPng(path, xbm, error)) { fprintf(stderr, "clipenc: %s: %s\n", path, error.c_str()); return false; }
+    frames.push_back(xbm);
+    return true;
+#else
+    fprintf(stderr, "clipenc: %s: built without PNG support (CLIPENC_PNG)\n", path);
+    return false;
+#endif
+  }
+  std::string text;
+  if (!readFile(path, text)) { fprintf(stderr, "clipenc: cannot read %s\n", path); return false; }
+  if (endsWith(path, ".pbm") || endsWith(path, ".pgm")) {
+    if (!parsePnm(text, xbm, error)) { fprintf(stderr, "clipenc: %s: %s\n", path, error.c_str()); return false; }
+    frames.push_back(xbm);
+    return true;
+  }
+  std::vector<Bytes> found = parseXbmFrames(text);
+  if (found.empty()) { fprintf(stderr, "clipenc: %s: no 128x64 XBM arrays found\n", path); return false; }
+  frames.insert(frames.end(), found.begin(), found.end());
+  return true;
+}
+
+// Writes a page-major frame as P4, lit pixels as 1 bits
+static bool writePbm(const char* path, const Bytes& pages) {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  fprintf(f, "P4\n%d %d\n", panelWidth, panelHeight);
+  for (int y = 0; y < panelHeight; y++) {
+    for (int x = 0; x < panelWidth; x += 8) {
+      uint8_t row = 0;
+      for (int i = 0; i < 8; i++) {
+        if (pages[(y / 8) * panelWidth + x + i] & (1 << (y & 7))) row |= 0x80 >> i;
+      }
+      fputc(row, f);
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+// XBM rows (LSB = leftmost pixel) -> U8g2 pages (LSB = topmost pixel),
+// fitted to the panel
+static Bytes xbmToPages(const Bytes& xbm) {
+  int shrink = 1;
+  while (SOURCE_WIDTH / shrink > panelWidth || SOURCE_HEIGHT / shrink > panelHeight) shrink++;
+  int originX = (panelWidth - SOURCE_WIDTH / shrink) / 2;
+  int originY = (panelHeight - SOURCE_HEIGHT / shrink) / 2;
+
+  Bytes pages(frameBytes(), 0);
+  for (int y = 0; y < SOURCE_HEIGHT / shrink * shrink; y++) {
+    for (int x = 0; x < SOURCE_WIDTH / shrink * shrink; x++) {
+      if (xbm[y * (SOURCE_WIDTH / 8) + x / 8] & (1 << (x & 7))) {
+        int px = originX + x / shrink, py = originY + y / shrink;
+        pages[(py / 8) * panelWidth + px] |= 1 << (py & 7);
+      }
+    }
+  }
+  return pages;
+}
+
+static Bytes encodeDelta(const Bytes& prev, const Bytes& cur) {
+  Bytes out;
+  out.push_back(CLIP_FRAME_DELTA);
+  out.push_back(0);
+  int count = 0;
+  for (int tile = 0; tile < tileCols() * tileRows(); tile++) {
+    uint8_t x[CLIP_TILE_BYTES];
+    uint8_t any = 0;
+    for (int i = 0; i < CLIP_TILE_BYTES; i++) {
+      x[i] = prev[tile * CLIP_TILE_BYTES + i] ^ cur[tile * CLIP_TILE_BYTES + i];
+      any |= x[i];
+    }
+    if (!any) continue;
+    out.push_back((uint8_t)tile);
+    out.insert(out.end(), x, x + CLIP_TILE_BYTES);
+    out[1] = (uint8_t)++count;
+  }
+  if (count > 255) out.resize(2 * frameBytes()); // Count does not fit, never the smaller encoding
+  return out;
+}
+
+static Bytes encodeKey(const Bytes& cur) {
+  Bytes out;
+  out.push_back(CLIP_FRAME_KEY);
+  out.insert(out.end(), cur.begin(), cur.end());
+  return out;
+}
+
+// PackBits-style runs: repeats of 3+ bytes become (0x80 | n - 3, value),
+// everything else is grouped into literals of up to 128 bytes.
+static Bytes encodeRle(uint8_t type, const Bytes& data) {
+  Bytes out;
+  out.push_back(type);
+  Bytes literal;
+  size_t pos = 0;
+  while (pos < data.size()) {
+    size_t run = 1;
+    while (pos + run < data.size() && data[pos + run] == data[pos] && run < CLIP_RLE_MAX_REPEAT) run++;
+    if (run >= CLIP_RLE_MIN_REPEAT || literal.size() == CLIP_RLE_MAX_LITERAL) {
+      if (!literal.empty()) {
+        out.push_back((uint8_t)(literal.size() - 1));
+        out.insert(out.end(), literal.begin(), literal.end());
+        literal.clear();
+      }
+    }
+    if (run >= CLIP_RLE_MIN_REPEAT) {
+      out.push_back((uint8_t)(0x80 | (run - CLIP_RLE_MIN_REPEAT)));
+      out.push_back(data[pos]);
+      pos += run;
+    } else {
+      literal.push_back(data[pos++]);
+    }
+  }
+  if (!literal.empty()) {
+    out.push_back((uint8_t)(literal.size() - 1));
+    out.insert(out.end(), literal.begin(), literal.end());
+  }
+  return out;
+}
+
+static const Bytes& smaller(const Bytes& a, const Bytes& b) { return b.size() < a.size() ? b : a; }
+
+static Bytes encodeBestKey(const Bytes& cur) { return smaller(encodeKey(cur), encodeRle(CLIP_FRAME_KEY_RLE, cur)); }
+
+static Bytes encodeBestDelta(const Bytes& prev, const Bytes& cur) {
+  Bytes xorFrame(frameBytes());
+  for (int i = 0; i < frameBytes(); i++) xorFrame[i] = prev[i] ^ cur[i];
+  return smaller(encodeDelta(prev, cur), encodeRle(CLIP_FRAME_DELTA_RLE, xorFrame));
+}
+
+static Bytes encodeClip(const std::vector<Bytes>& frames, int keyInterval, int* keyCount) {
+  const uint8_t header[CLIP_HEADER_SIZE] = { 'R', 'C', CLIP_FORMAT_VERSION, (uint8_t)frames.size(), (uint8_t)keyInterval,
+                                             (uint8_t)tileCols(), (uint8_t)tileRows(), 0 };
+  Bytes clip(header, header + CLIP_HEADER_SIZE);
+  clip.resize(CLIP_HEADER_SIZE + frames.size() * 4, 0);
+
+  *keyCount = 0;
+  for (size_t i = 0; i < frames.size(); i++) {
+    Bytes body;
+    if (i % keyInterval == 0) {
+      body = encodeBestKey(frames[i]);
+    } else {
+      body = smaller(encodeBestDelta(frames[i - 1], frames[i]), encodeBestKey(frames[i]));
+    }
+    if (body[0] == CLIP_FRAME_KEY || body[0] == CLIP_FRAME_KEY_RLE) (*keyCount)++;
+
+    uint32_t offset = clip.size();
+    for (int b = 0; b < 4; b++) clip[CLIP_HEADER_SIZE + i * 4 + b] = (offset >> (8 * b)) & 0xFF;
+    clip.insert(clip.end(), body.begin(), body.end());
+  }
+  return clip;
+}
+
+static bool verifyClip(const Bytes& clip, const std::vector<Bytes>& frames) {
+  Bytes buffer(frameBytes(), 0);
+  if (frames.size() == 1) {
+    clipDrawKeyFrame(clip.data(), 0, 0, 0, buffer.data());
+    return buffer == frames[0];
+  }
+  std::vector<uint16_t> dirty(tileRows(), 0);
+  int current = -1;
+  // Play through twice so the loop back to frame 0 is exercised too
+  for (size_t n = 0; n < frames.size() * 2; n++) {
+    size_t i = n % frames.size();
+    current = clipSeek(clip.data(), current, (uint8_t)i, buffer.data(), dirty.data());
+    if (buffer != frames[i]) return false;
+  }
+  return true;
+}
+
+static bool writeBlob(const char* path, const Bytes& clip) {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  bool ok = fwrite(clip.data(), 1, clip.size(), f) == clip.size();
+  return fclose(f) == 0 && ok;
+}
+
+static bool writeHeader(const char* path, const std::string& name, const char* source, const Bytes& clip, size_t frameCount) {
+  FILE* f = fopen(path, "w");
+  if (!f) return false;
+  std::string guard, symbol;
+  for (char c : name) symbol += (char)toupper((unsigned char)c);
+  guard = symbol;
+  bool fitted = panelWidth != SOURCE_WIDTH || panelHeight != SOURCE_HEIGHT;
+  if (fitted) guard += "_" + std::to_string(panelWidth) + "X" + std::to_string(panelHeight);
+
+  fprintf(f, "// Generated by clipenc from %s - do not edit.\n", source);
+  fprintf(f, "// %s, see RideBuddyClip.h for the format.\n", frameCount == 1 ? "Single-frame still" : "Keyframe + XOR-delta clip");
+  if (fitted) fprintf(f, "// Fitted to a %dx%d panel.\n", panelWidth, panelHeight);
+  fprintf(f, "#ifndef %s_H\n#define %s_H\n\n", guard.c_str(), guard.c_str());
+  fprintf(f, "#include \"%s../RideBuddyClip.h\"\n\n", fitted ? "../" : "");
+  fprintf(f, "const uint8_t %s_%s[] PROGMEM = {\n", name.c_str(), frameCount == 1 ? "still" : "clip");
+  for (size_t i = 0; i < clip.size(); i++) {
+    if (i % 16 == 0) fprintf(f, "  ");
+    fprintf(f, "0x%02X,%s", clip[i], (i % 16 == 15 || i + 1 == clip.size()) ? "\n" : " ");
+  }
+  fprintf(f, "};\n\n");
+  if (frameCount > 1) fprintf(f, "const uint8_t %s_FRAME_COUNT = %u;\n\n", symbol.c_str(), (unsigned)frameCount);
+  fprintf(f, "#endif // %s_H\n", guard.c_str());
+  fclose(f);
+  return true;
+}
+
+static std::string baseName(const char* path) {
+  std::string s = fileName(path);
+  size_t dot = s.find('.');
+  if (dot != std::string::npos) s = s.substr(0, dot);
+  return s;
+}
+
+static void usage() {
+  fprintf(stderr, "usage: clipenc [-k keyInterval] [-n name] [-g WxH] [-t threshold] [-d none|bayer|fs] [-i] [-u] [-x dir]\n"
+                  "               input.(h|pbm|pgm|png)... output.(h|bin)\n");
+}
+
+int main(int argc, char** argv) {
+  int keyInterval = 12;
+  std::string name;
+  const char* exportDir = NULL;
+  bool invert = false;
+  bool dropDuplicates = false;
+  int argi = 1;
+  for (; argi < argc && argv[argi][0] == '-'; argi++) {
+    const char* value = argi + 1 < argc ? argv[argi + 1] : NULL;
+    if (!strcmp(argv[argi], "-i")) { invert = true; continue; }
+    if (!strcmp(argv[argi], "-u")) { dropDuplicates = true; continue; }
+    if (!value) break;
+    if (!strcmp(argv[argi], "-k")) keyInterval = atoi(value);
+    else if (!strcmp(argv[argi], "-n")) name = value;
+    else if (!strcmp(argv[argi], "-x")) exportDir = value;
+    else if (!strcmp(argv[argi], "-t")) threshold = atoi(value);
+    else if (!strcmp(argv[argi], "-g")) {
+      if (sscanf(value, "%dx%d", &panelWidth, &panelHeight) != 2) panelWidth = 0;
+    } else if (!strcmp(argv[argi], "-d")) {
+      if (!strcmp(value, "none")) dither = DITHER_NONE;
+      else if (!strcmp(value, "bayer")) dither = DITHER_BAYER;
+      else if (!strcmp(value, "fs")) dither = DITHER_FS;
+      else { usage(); return 2; }
+    } else break;
+    argi++;
+  }
+  bool panelOk = panelWidth > 0 && panelHeight > 0 && panelWidth % 8 == 0 && panelHeight % 8 == 0 &&
+                 tileCols() <= MAX_TILE_COLS && tileCols() * tileRows() <= MAX_TILES;
+  int inputCount = argc - argi - (exportDir ? 0 : 1);
+  if (inputCount < 1 || keyInterval < 1 || keyInterval > 255 || threshold < 0 || threshold > 255 || !panelOk) {
+    usage();
+    return 2;
+  }
+  char** inputs = argv + argi;
+  const char* output = exportDir ? NULL : argv[argc - 1];
+  if (name.empty()) name = baseName(output ? output : inputs[0]);
+
+  std::vector<Bytes> frames;
+  for (int i = 0; i < inputCount; i++) {
+    if (!readFrames(inputs[i], frames)) return 1;
+  }
+  size_t duplicates = 0;
+  for (size_t i = 0; i < frames.size(); i++) {
+    if (invert) for (uint8_t& b : frames[i]) b = ~b;
+    frames[i] = xbmToPages(frames[i]);
+  }
+  if (dropDuplicates) {
+    std::vector<Bytes> kept;
+    for (const Bytes& frame : frames) {
+      if (!kept.empty() && frame == kept.back()) duplicates++;
+      else kept.push_back(frame);
+    }
+    frames.swap(kept);
+  }
+  if (frames.size() > 255) { fprintf(stderr, "clipenc: %u frames, at most 255 fit in a clip\n", (unsigned)frames.size()); return 1; }
+
+  if (exportDir) {
+    for (size_t i = 0; i < frames.size(); i++) {
+      char path[1024];
+      snprintf(path, sizeof(path), "%s/%s_%03u.pbm", exportDir, name.c_str(), (unsigned)i);
+      if (!writePbm(path, frames[i])) { fprintf(stderr, "clipenc: cannot write %s\n", path); return 1; }
+    }
+    printf("%-10s %3u frames written to %s\n", name.c_str(), (unsigned)frames.size(), exportDir);
+    return 0;
+  }
+
+  int keyCount = 0;
+  Bytes clip = encodeClip(frames, keyInterval, &keyCount);
+  if (!verifyClip(clip, frames)) { fprintf(stderr, "clipenc: %s: round-trip check failed\n", output); return 1; }
+  std::string source = fileName(inputs[0]);
+  if (inputCount > 1) source += " .. " + fileName(inputs[inputCount - 1]) + " (" + std::to_string(inputCount) + " files)";
+  bool written = endsWith(output, ".bin") ? writeBlob(output, clip) : writeHeader(output, name, source.c_str(), clip, frames.size());
+  if (!written) { fprintf(stderr, "clipenc: cannot write %s\n", output); return 1; }
+
+  size_t raw = frames.size() * frameBytes();
+  size_t largest = 0;
+  for (size_t i = 0; i < frames.size(); i++) {
+    size_t end = i + 1 < frames.size() ? clipFrameOffset(clip.data(), i + 1) : clip.size();
+    if (end - clipFrameOffset(clip.data(), i) > largest) largest = end - clipFrameOffset(clip.data(), i);
+  }
+  printf("%-10s %3u frames, %2d keyframes: %6u -> %6u bytes (%.1fx), largest frame %u",
+         name.c_str(), (unsigned)frames.size(), keyCount, (unsigned)raw, (unsigned)clip.size(), (double)raw / clip.size(), (unsigned)largest);
+  if (duplicates) printf(", %u duplicates dropped", (unsigned)duplicates);
+  printf("\n");
+  return 0;
+}
@@ -0,0 +1,156 @@
+/*
+  clippack.cpp - Bundles clips compiled by clipenc into a clip pack, the
+  format described in RideBuddyPack.h, and lists existing packs.
+
+  Build:  part of the host CMake build (links the library for ClipPack)
+  Usage:  clippack output.bin EMOTION=clip.bin[,ms][,hold]...
+          clippack -l pack.bin
+
+  EMOTION is an Emotion name (CRY, HAPPY, ...) or CUSTOM0..CUSTOM3 for
+  CUSTOM_EMOTION(n). ms is the frame duration (default 33, the built-in
+  clips' rate); hold plays the clip once and stays on the last frame.
+
+    clipenc ../assets/cry.h cry.bin
+    clippack clips.bin CRY=cry.bin HAPPY=happy.bin,40 CUSTOM0=wave.bin,50,hold
+
+  The pack is opened with ClipPack after writing, so a pack that would be
+  rejected on the device is caught here.
+*/
+#include "RideBuddyEyes.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+typedef std::vector<uint8_t> Bytes;
+
+#define DEFAULT_FRAME_MS 33
+
+static const char* const emotionNames[EMOTION_SLOTS] = {
+  "NEUTRAL", "BLINK", "HAPPY", "CRY", "LOVE", "SHY", "ANGRY", "DRIVING",
+  "SCARED", "DISTRACTED", "SLEEP", "BATTERY", "CUSTOM0", "CUSTOM1", "CUSTOM2", "CUSTOM3",
+};
+
+struct PackEntry {
+  uint8_t emotion;
+  uint8_t loopMode;
+  uint16_t frameMs;
+  Bytes clip;
+};
+
+static void putLe32(uint8_t* p, uint32_t v) {
+  for (int i = 0; i < 4; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static bool readFile(const char* path, Bytes& out) {
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) out.insert(out.end(), chunk, chunk + n);
+  fclose(f);
+  return true;
+}
+
+static int emotionId(const std::string& name) {
+  for (int i = 0; i < EMOTION_SLOTS; i++) {
+    if (!strcasecmp(name.c_str(), emotionNames[i])) return i;
+  }
+  return -1;
+}
+
+// EMOTION=clip.bin[,ms][,hold]
+static bool parseEntry(const char* arg, PackEntry& entry) {
+  std::string s = arg;
+  size_t eq = s.find('=');
+  if (eq == std::string::npos) { fprintf(stderr, "clippack: %s: expected EMOTION=clip.bin\n", arg); return false; }
+  int emotion = emotionId(s.substr(0, eq));
+  if (emotion < 0 || emotion == BLINK) { fprintf(stderr, "clippack: %s: no clip can play for this emotion\n", arg); return false; }
+  entry.emotion = (uint8_t)emotion;
+  entry.loopMode = CLIP_LOOP;
+  entry.frameMs = DEFAULT_FRAME_MS;
+
+  std::vector<std::string> parts;
+  size_t start = eq + 1;
+  for (size_t comma; (comma = s.find(',', start)) != std::string::npos; start = comma + 1) parts.push_back(s.substr(start, comma - start));
+  parts.push_back(s.substr(start));
+  for (size_t i = 1; i < parts.size(); i++) {
+    if (parts[i] == "hold") entry.loopMode = CLIP_HOLD_LAST;
+    else if (atoi(parts[i].c_str()) > 0 && atoi(parts[i].c_str()) <= 65535) entry.frameMs = (uint16_t)atoi(parts[i].c_str());
+    else { fprintf(stderr, "clippack: %s: bad option %s\n", arg, parts[i].c_str()); return false; }
+  }
+
+  if (!readFile(parts[0].c_str(), entry.clip)) { fprintf(stderr, "clippack: cannot read %s\n", parts[0].c_str()); return false; }
+  if (entry.clip.size() < CLIP_HEADER_SIZE || !clipIsValid(entry.clip.data())) {
+    fprintf(stderr, "clippack: %s is not a clip (write one with clipenc ... %s)\n", parts[0].c_str(), parts[0].c_str());
+    return false;
+  }
+  if (!clipFramesValid(entry.clip.data(), (uint32_t)entry.clip.size())) {
+    fprintf(stderr, "clippack: %s: a frame is truncated or corrupt\n", parts[0].c_str());
+    return false;
+  }
+  return true;
+}
+
+static int list(const char* path) {
+  ClipPack pack;
+  if (!pack.openFile(path)) { fprintf(stderr, "clippack: %s: missing or not a valid pack\n", path); return 1; }
+  printf("%s: %u clips, %u bytes\n", path, pack.clipCount(), (unsigned)pack.size());
+  for (uint8_t i = 0; i < pack.clipCount(); i++) {
+    const AnimationClip* clip = pack.clip(i);
+    uint8_t emotion = pack.emotion(i);
+    printf("  %-10s %3u frames %4u ms %s %ux%u\n", emotion < EMOTION_SLOTS ? emotionNames[emotion] : "?",
+           clipFrameCount(clip->data), clip->frameDuration, clip->loopMode == CLIP_HOLD_LAST ? "hold" : "loop",
+           clipTileCols(clip->data) * 8, clipTileRows(clip->data) * 8);
+  }
+  return 0;
+}
+
+static void usage() {
+  fprintf(stderr, "usage: clippack output.bin EMOTION=clip.bin[,ms][,hold]...\n"
+                  "       clippack -l pack.bin\n");
+}
+
+int main(int argc, char** argv) {
+  if (argc == 3 && !strcmp(argv[1], "-l")) return list(argv[2]);
+  if (argc < 3 || argv[1][0] == '-') {
+    usage();
+    return 2;
+  }
+  const char* output = argv[1];
+  std::vector<PackEntry> entries;
+  for (int i = 2; i < argc; i++) {
+    PackEntry entry;
+    if (!parseEntry(argv[i], entry)) return 1;
+    for (const PackEntry& other : entries) {
+      if (other.emotion == entry.emotion) { fprintf(stderr, "clippack: %s appears twice\n", emotionNames[entry.emotion]); return 1; }
+    }
+    entries.push_back(entry);
+  }
+  if (entries.size() > 255) { fprintf(stderr, "clippack: at most 255 clips fit in a pack\n"); return 1; }
+
+  Bytes pack(CLIP_PACK_HEADER_SIZE + entries.size() * CLIP_PACK_ENTRY_SIZE, 0);
+  for (size_t i = 0; i < entries.size(); i++) {
+    uint8_t* entry = &pack[CLIP_PACK_HEADER_SIZE + i * CLIP_PACK_ENTRY_SIZE];
+    entry[0] = entries[i].emotion;
+    entry[1] = entries[i].loopMode;
+    entry[2] = (uint8_t)entries[i].frameMs;
+    entry[3] = (uint8_t)(entries[i].frameMs >> 8);
+    putLe32(&entry[4], (uint32_t)pack.size());
+    putLe32(&entry[8], (uint32_t)entries[i].clip.size());
+    pack.insert(pack.end(), entries[i].clip.begin(), entries[i].clip.end());
+  }
+  pack[0] = 'R';
+  pack[1] = 'P';
+  pack[2] = CLIP_PACK_VERSION;
+  pack[3] = (uint8_t)entries.size();
+  putLe32(&pack[4], (uint32_t)pack.size());
+  putLe32(&pack[8], clipPackCrc32(pack.data() + CLIP_PACK_HEADER_SIZE, pack.size() - CLIP_PACK_HEADER_SIZE));
+
+  FILE* f = fopen(output, "wb");
+  bool written = f && fwrite(pack.data(), 1, pack.size(), f) == pack.size();
+  if (f && fclose(f) != 0) written = false;
+  if (!written) { fprintf(stderr, "clippack: cannot write %s\n", output); return 1; }
+  return list(output);
+}
@@ -34,6 +34,7 @@
 #define SLEEP_TIME   15000
 #define DRIVING_LIMIT 15000
 #define SLEEP_EMOTION_DURATION 5000 // How long sleep emotion is shown before deep sleep (5 seconds)
+#define EYES_MAX_IDLE_DELAY 20 // Longest loop() pause in MODE_EYES, bounds input latency (ms)
 
 // --- Desk Buddy ---
 const byte DNS_PORT = 53;
@@ -514,12 +515,16 @@ void loop() {
       runClockStartupAnimation = true;
       clockAnimStartTime = millis();
     }
+    if (currentAppMode == MODE_EYES) {
+      eyes.forceFullFlush(); // Other modes drew over the eyes; resend the whole frame
+    }
     previousMode = currentAppMode;
   }
 
   if (currentAppMode == MODE_EYES) {
     eyes.update();               // Animate eyes
-    delay(10);
+    // Idle until the eyes need the next frame, but keep polling touch/MPU/button
+    delay(min(eyes.msUntilNextFrame(), (unsigned long)EYES_MAX_IDLE_DELAY));
   } else {
     // Desk modes → use u8g2 drawing
     static unsigned long lastRefresh = 0;
@@ -699,6 +704,7 @@ void handleTouchAndMotion(unsigned long currentTime) {
           u8g2.clearBuffer();
           u8g2.sendBuffer();
           u8g2.setPowerSave(1); // Turn off OLED display
+          eyes.forceFullFlush(); // Panel was blanked behind the eyes' back
           oledIsOffForIdle = true;
         }
         // ESP32 remains running, just OLED is off